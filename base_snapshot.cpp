@@ -0,0 +1,73 @@
+
+#include <memory>
+#include <future>
+#include <utility>
+
+#include "base_snapshot.h"
+#include "json_reader.h"
+
+using namespace std;
+
+namespace transport
+{
+    shared_ptr<const BaseSnapshot> LoadBaseSnapshot(const serial::SerializationContext& serial_context)
+    {
+        auto snapshot = make_shared<BaseSnapshot>();
+        reader::JSONReader loader(serial_context, snapshot->catalogue);
+        loader.ProcessDeserialize();
+        loader.ExportSnapshot(*snapshot);
+        return snapshot;
+    }
+
+    SnapshotHolder::SnapshotHolder(shared_ptr<const BaseSnapshot> snapshot) : snapshot_(move(snapshot))
+    {}
+
+    SnapshotHolder::~SnapshotHolder()
+    {
+        unique_lock lock(reload_mutex_);
+        reload_finished_.wait(lock, [this]() {return pending_reloads_ == 0;});
+    }
+
+    void SnapshotHolder::Publish(shared_ptr<const BaseSnapshot> snapshot)
+    {
+        // Сначала подменяется снимок, затем номер версии: читатель, увидевший новый номер,
+        // гарантированно получит снимок не старее опубликованного.
+        atomic_store(&snapshot_, move(snapshot));
+        version_.fetch_add(1, memory_order_release);
+    }
+
+    future<void> SnapshotHolder::ReloadAsync(serial::SerializationContext serial_context)
+    {
+        {
+            lock_guard lock(reload_mutex_);
+            ++pending_reloads_;
+        }
+        return async(launch::async, [this, serial_context = move(serial_context)]()
+        {
+            // Загрузка отмечается завершённой при любом исходе, в том числе при ошибке. Уведомление
+            // посылается под блокировкой: деструктор не продолжит работу, пока она не будет снята,
+            // и после этого задача к хранилищу уже не обращается.
+            auto finish = [this]()
+            {
+                lock_guard lock(reload_mutex_);
+                --pending_reloads_;
+                reload_finished_.notify_all();
+            };
+            try
+            {
+                Publish(LoadBaseSnapshot(serial_context));
+            }
+            catch (...)
+            {
+                finish();
+                throw;
+            }
+            finish();
+        });
+    }
+
+    shared_ptr<const BaseSnapshot> SnapshotHolder::Acquire() const
+    {
+        return atomic_load(&snapshot_);
+    }
+} // namespace transport
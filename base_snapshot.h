@@ -0,0 +1,97 @@
+#pragma once
+
+#include <memory>
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+
+#include "transport_catalogue.h"
+#include "transport_router.h"
+#include "map_renderer.h"
+#include "serialization.h"
+
+namespace transport
+{
+    // Неизменяемый снимок полного состояния справочника, загруженного из базы: сам справочник,
+    // настройки и построенный по ним маршрутизатор. Снимок создаётся функцией LoadBaseSnapshot
+    // и далее только читается, поэтому может одновременно использоваться любым числом потоков.
+    struct BaseSnapshot
+    {
+        TransportCatalogue catalogue;
+        router::RouterContext router_context;
+        renderer::MapRendererContext render_context;
+        std::unique_ptr<router::BusRouter> bus_router; // Ссылается на catalogue этого же снимка
+
+        BaseSnapshot() = default;
+        BaseSnapshot(const BaseSnapshot&) = delete;
+        BaseSnapshot& operator=(const BaseSnapshot&) = delete;
+    };
+
+    // Загружает из базы, заданной настройками serial_context, новый снимок. Все разделы базы
+    // читаются сразу, маршрутизатор при его отсутствии в базе строится.
+    std::shared_ptr<const BaseSnapshot> LoadBaseSnapshot(const serial::SerializationContext& serial_context);
+
+    // Хранилище текущего снимка долгоживущего процесса. Новый снимок загружается в фоновом
+    // потоке и подменяет текущий атомарно; запросы, уже получившие прежний снимок, дорабатывают
+    // с ним, а освобождается он вместе с последней ссылкой на него. Деструктор хранилища дожидается
+    // окончания всех начатых фоновых загрузок, так как они публикуют снимок в это хранилище.
+    class SnapshotHolder
+    {
+    public:
+        explicit SnapshotHolder(std::shared_ptr<const BaseSnapshot> snapshot);
+        SnapshotHolder(const SnapshotHolder&) = delete;
+        SnapshotHolder& operator=(const SnapshotHolder&) = delete;
+        ~SnapshotHolder();
+
+        void Publish(std::shared_ptr<const BaseSnapshot> snapshot);
+        // Загружает базу в фоновом потоке и публикует полученный снимок. Ошибка загрузки
+        // передаётся через возвращаемый future, текущий снимок при этом не меняется.
+        std::future<void> ReloadAsync(serial::SerializationContext serial_context);
+
+        // Текущий снимок. Метод не предназначен для частых вызовов - читающим потокам
+        // следует пользоваться объектами SnapshotReader.
+        std::shared_ptr<const BaseSnapshot> Acquire() const;
+        // Номер версии увеличивается при каждой публикации снимка.
+        uint64_t GetVersion() const
+        {
+            return version_.load(std::memory_order_acquire);
+        }
+
+    private:
+        std::shared_ptr<const BaseSnapshot> snapshot_; // Доступ - только через std::atomic_load/atomic_store
+        std::atomic<uint64_t> version_{0};
+        // Число ещё не завершившихся фоновых загрузок
+        std::mutex reload_mutex_;
+        std::condition_variable reload_finished_;
+        size_t pending_reloads_ = 0;
+    };
+
+    // Закреплённая за одним читающим потоком ссылка на текущий снимок. Get() при неизменной
+    // версии хранилища ограничивается одним атомарным чтением её номера, без блокировок и
+    // без изменения счётчика ссылок снимка. Ссылка, возвращённая Get(), действительна до
+    // следующего вызова Get() этим же потоком - на это время снимок удерживается.
+    class SnapshotReader
+    {
+    public:
+        explicit SnapshotReader(const SnapshotHolder& holder) : holder_(holder)
+        {}
+
+        const BaseSnapshot& Get()
+        {
+            const uint64_t version = holder_.GetVersion();
+            if (version != version_ || !snapshot_)
+            {
+                snapshot_ = holder_.Acquire();
+                version_ = version;
+            }
+            return *snapshot_;
+        }
+
+    private:
+        const SnapshotHolder& holder_;
+        std::shared_ptr<const BaseSnapshot> snapshot_;
+        uint64_t version_ = 0;
+    };
+} // namespace transport
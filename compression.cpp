@@ -0,0 +1,253 @@
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+#include "compression.h"
+#include "parallel.h"
+
+using namespace std;
+
+namespace compression
+{
+    namespace
+    {
+        constexpr size_t MIN_MATCH = 4;
+        constexpr size_t MAX_OFFSET = 65535;
+        constexpr int HASH_BITS = 16;
+        // Через каждые 2^SKIP_SHIFT неудачных попыток найти совпадение шаг поиска увеличивается на единицу -
+        // так плохо сжимаемые участки данных проходятся быстрее.
+        constexpr int SKIP_SHIFT = 6;
+        constexpr size_t NIBBLE_MAX = 15;
+
+        uint32_t Read32(const char* ptr)
+        {
+            uint32_t value;
+            memcpy(&value, ptr, sizeof(value));
+            return value;
+        }
+
+        uint32_t Hash(uint32_t value)
+        {
+            return (value * 2654435761u) >> (32 - HASH_BITS);
+        }
+
+        void WriteLengthExtension(string& out, size_t length)
+        {
+            for (; length >= 255; length -= 255)
+                out.push_back(static_cast<char>(255));
+            out.push_back(static_cast<char>(length));
+        }
+
+        size_t ReadLengthExtension(const unsigned char*& ip, const unsigned char* iend)
+        {
+            size_t length = 0;
+            unsigned char byte;
+            do
+            {
+                if (ip >= iend)
+                    throw CompressionError("Unexpected end of compressed block");
+                byte = *ip++;
+                length += byte;
+            } while (byte == 255);
+            return length;
+        }
+
+        // Записывает одну запись сжатого блока. Нулевая длина совпадения означает последнюю запись блока.
+        void WriteSequence(string& out, const char* literals, size_t literal_length, size_t offset, size_t match_length)
+        {
+            const size_t match_code = match_length ? match_length - MIN_MATCH : 0;
+            out.push_back(static_cast<char>((min(literal_length, NIBBLE_MAX) << 4) | min(match_code, NIBBLE_MAX)));
+            if (literal_length >= NIBBLE_MAX)
+                WriteLengthExtension(out, literal_length - NIBBLE_MAX);
+            out.append(literals, literal_length);
+            if (!match_length)
+                return;
+            out.push_back(static_cast<char>(offset & 0xFF));
+            out.push_back(static_cast<char>(offset >> 8));
+            if (match_code >= NIBBLE_MAX)
+                WriteLengthExtension(out, match_code - NIBBLE_MAX);
+        }
+
+        void WriteUint(string& out, uint64_t value, int byte_count)
+        {
+            for (int i = 0; i < byte_count; ++i)
+                out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+
+        uint64_t ReadUint(string_view data, size_t& pos, int byte_count)
+        {
+            if (data.size() - pos < static_cast<size_t>(byte_count))
+                throw CompressionError("Unexpected end of compressed container");
+            uint64_t value = 0;
+            for (int i = 0; i < byte_count; ++i)
+                value |= static_cast<uint64_t>(static_cast<unsigned char>(data[pos + i])) << (8 * i);
+            pos += byte_count;
+            return value;
+        }
+    } // namespace
+
+    string CompressBlock(string_view src)
+    {
+        const char* const base = src.data();
+        const size_t src_size = src.size();
+        string out;
+        out.reserve(src_size + src_size / 255 + 16);
+
+        vector<uint32_t> hash_table(size_t(1) << HASH_BITS, 0); // Позиция последнего вхождения плюс один, 0 - пусто
+        size_t anchor = 0, pos = 0, miss_count = 0;
+        while (pos + MIN_MATCH <= src_size)
+        {
+            const uint32_t sequence = Read32(base + pos);
+            uint32_t& hash_entry = hash_table[Hash(sequence)];
+            const size_t candidate = hash_entry;
+            hash_entry = static_cast<uint32_t>(pos + 1);
+            if (!candidate || pos - (candidate - 1) > MAX_OFFSET || Read32(base + candidate - 1) != sequence)
+            {
+                pos += 1 + (miss_count++ >> SKIP_SHIFT);
+                continue;
+            }
+
+            size_t ref = candidate - 1;
+            size_t match_length = MIN_MATCH;
+            while (pos + match_length < src_size && base[ref + match_length] == base[pos + match_length])
+                ++match_length;
+            // Совпадение может начинаться и раньше найденной позиции - продлеваем его назад за счёт литералов.
+            while (pos > anchor && ref > 0 && base[pos - 1] == base[ref - 1])
+            {
+                --pos;
+                --ref;
+                ++match_length;
+            }
+            WriteSequence(out, base + anchor, pos - anchor, pos - ref, match_length);
+            pos += match_length;
+            anchor = pos;
+            miss_count = 0;
+            if (pos >= 2 && pos - 2 + MIN_MATCH <= src_size)
+                hash_table[Hash(Read32(base + pos - 2))] = static_cast<uint32_t>(pos - 1);
+        }
+        WriteSequence(out, base + anchor, src_size - anchor, 0, 0);
+        return out;
+    }
+
+    void DecompressBlock(string_view src, char* dst, size_t dst_size)
+    {
+        const unsigned char* ip = reinterpret_cast<const unsigned char*>(src.data());
+        const unsigned char* const iend = ip + src.size();
+        char* op = dst;
+        char* const oend = dst + dst_size;
+
+        while (true)
+        {
+            if (ip >= iend)
+                throw CompressionError("Unexpected end of compressed block");
+            const unsigned char token = *ip++;
+            size_t literal_length = token >> 4;
+            if (literal_length == NIBBLE_MAX)
+                literal_length += ReadLengthExtension(ip, iend);
+            if (literal_length > static_cast<size_t>(iend - ip) || literal_length > static_cast<size_t>(oend - op))
+                throw CompressionError("Compressed block literals are out of range");
+            memcpy(op, ip, literal_length);
+            op += literal_length;
+            ip += literal_length;
+            if (ip == iend)
+                break;
+
+            if (iend - ip < 2)
+                throw CompressionError("Unexpected end of compressed block");
+            const size_t offset = ip[0] | (static_cast<size_t>(ip[1]) << 8);
+            ip += 2;
+            size_t match_length = token & NIBBLE_MAX;
+            if (match_length == NIBBLE_MAX)
+                match_length += ReadLengthExtension(ip, iend);
+            match_length += MIN_MATCH;
+            if (!offset || offset > static_cast<size_t>(op - dst) || match_length > static_cast<size_t>(oend - op))
+                throw CompressionError("Compressed block match is out of range");
+            const char* match = op - offset;
+            if (offset >= match_length)
+                memcpy(op, match, match_length);
+            else // Перекрывающееся совпадение (повтор короткого образца) копируется побайтно
+                for (size_t i = 0; i < match_length; ++i)
+                    op[i] = match[i];
+            op += match_length;
+        }
+
+        if (op != oend)
+            throw CompressionError("Decompressed block size mismatch");
+    }
+
+    string PackContainer(string_view data, size_t chunk_size, unsigned thread_count)
+    {
+        if (!chunk_size || chunk_size > UINT32_MAX)
+            chunk_size = DEFAULT_CHUNK_SIZE;
+        const size_t chunk_count = (data.size() + chunk_size - 1) / chunk_size;
+        if (chunk_count > UINT32_MAX)
+            throw CompressionError("Too many chunks in compressed container");
+        vector<string> chunks(chunk_count);
+        parallel::ParallelFor(chunk_count, thread_count, [&](size_t chunk_num)
+        {
+            string_view raw_chunk = data.substr(chunk_num * chunk_size, chunk_size);
+            chunks[chunk_num] = CompressBlock(raw_chunk);
+            if (chunks[chunk_num].size() >= raw_chunk.size())
+                chunks[chunk_num] = string(raw_chunk);
+        });
+
+        string result(CONTAINER_MAGIC);
+        WriteUint(result, chunk_size, 4);
+        WriteUint(result, data.size(), 8);
+        WriteUint(result, chunk_count, 4);
+        size_t total_size = result.size() + 4 * chunk_count;
+        for (const string& chunk : chunks)
+        {
+            WriteUint(result, chunk.size(), 4);
+            total_size += chunk.size();
+        }
+        result.reserve(total_size);
+        for (const string& chunk : chunks)
+            result += chunk;
+        return result;
+    }
+
+    string UnpackContainer(string_view container, unsigned thread_count)
+    {
+        if (!IsContainer(container))
+            throw CompressionError("Not a compressed container");
+        size_t pos = CONTAINER_MAGIC.size();
+        const size_t chunk_size = ReadUint(container, pos, 4);
+        const uint64_t raw_size = ReadUint(container, pos, 8);
+        const size_t chunk_count = ReadUint(container, pos, 4);
+        if (!chunk_size || chunk_count != (raw_size + chunk_size - 1) / chunk_size
+            || chunk_count > (container.size() - pos) / 4)
+            throw CompressionError("Invalid compressed container header");
+
+        // Смещения сжатых фрагментов в контейнере вычисляются по таблице их размеров.
+        vector<size_t> chunk_offsets(chunk_count + 1);
+        chunk_offsets[0] = pos + 4 * chunk_count;
+        for (size_t chunk_num = 0; chunk_num < chunk_count; ++chunk_num)
+            chunk_offsets[chunk_num + 1] = chunk_offsets[chunk_num] + ReadUint(container, pos, 4);
+        if (chunk_offsets[chunk_count] != container.size())
+            throw CompressionError("Invalid compressed container size");
+
+        string result(raw_size, '\0');
+        parallel::ParallelFor(chunk_count, thread_count, [&](size_t chunk_num)
+        {
+            const size_t raw_offset = chunk_num * chunk_size;
+            const size_t raw_chunk_size = min<size_t>(chunk_size, raw_size - raw_offset);
+            string_view chunk = container.substr(chunk_offsets[chunk_num],
+                                                 chunk_offsets[chunk_num + 1] - chunk_offsets[chunk_num]);
+            if (chunk.size() == raw_chunk_size) // Фрагмент хранится несжатым
+                memcpy(result.data() + raw_offset, chunk.data(), raw_chunk_size);
+            else
+                DecompressBlock(chunk, result.data() + raw_offset, raw_chunk_size);
+        });
+        return result;
+    }
+
+    bool IsContainer(string_view data)
+    {
+        return data.substr(0, CONTAINER_MAGIC.size()) == CONTAINER_MAGIC;
+    }
+
+} // namespace compression
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <stdexcept>
+#include <cstdint>
+
+namespace compression
+{
+    // Ошибка распаковки: повреждённый или усечённый сжатый поток.
+    class CompressionError : public std::runtime_error
+    {
+    public:
+        using runtime_error::runtime_error;
+    };
+
+    // Собственный быстрый блочный кодек семейства LZ77 (по устройству близкий к LZ4), не требующий
+    // никаких внешних библиотек. Сжатый блок - последовательность записей вида
+    // [маркер][длина литералов*][литералы][смещение совпадения][длина совпадения*],
+    // где маркер хранит в старшей тетраде длину литералов, а в младшей - длину совпадения
+    // за вычетом MIN_MATCH; значение 15 в тетраде означает продолжение длины в следующих байтах
+    // (добавляются байты до первого, меньшего 255). Последняя запись блока содержит только литералы.
+    std::string CompressBlock(std::string_view src);
+    // Распаковывает блок src, исходный размер которого равен dst_size, в буфер dst.
+    void DecompressBlock(std::string_view src, char* dst, size_t dst_size);
+
+    // Контейнер для сжатия больших объёмов данных. Данные делятся на независимые фрагменты
+    // размером chunk_size, которые сжимаются и распаковываются параллельно в нескольких потоках.
+    // Формат контейнера: сигнатура CONTAINER_MAGIC, размер фрагмента (4 байта), исходный размер
+    // данных (8 байт), количество фрагментов (4 байта), таблица размеров сжатых фрагментов
+    // (по 4 байта на фрагмент) и далее - сами фрагменты. Фрагмент, который не удалось сжать,
+    // хранится как есть (его сжатый размер равен исходному). Все числа записываются в порядке little-endian.
+    inline constexpr std::string_view CONTAINER_MAGIC = "TCZ1";
+    inline constexpr size_t DEFAULT_CHUNK_SIZE = 1 << 20;
+
+    // Нулевое количество потоков означает выбор по числу ядер процессора.
+    std::string PackContainer(std::string_view data, size_t chunk_size = DEFAULT_CHUNK_SIZE,
+                              unsigned thread_count = 0);
+    std::string UnpackContainer(std::string_view container, unsigned thread_count = 0);
+    bool IsContainer(std::string_view data);
+
+} // namespace compression
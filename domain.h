@@ -1,8 +1,10 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <set>
+#include <optional>
 #include <unordered_map>
 
 #include "geo.h"
@@ -23,6 +25,8 @@ namespace transport
         detail::Coordinates stop_coords;
         std::set<std::string> buses_at_stop;
         std::unordered_map<std::string, double> distance_to_stop;
+        // Время ожидания автобуса на остановке в минутах. nullopt - общее время из настроек маршрутизации.
+        std::optional<double> wait_time;
     };
 
     enum class BusType
@@ -37,6 +41,50 @@ namespace transport
         BusType bus_type;
         std::string bus_name;
         std::vector<std::string> bus_stops;
+        // Расписание: времена отправления рейсов с первой остановки маршрута (у некольцевого маршрута - также
+        // и с последней, в обратном направлении) в минутах от начала суток. Пусто - расписания нет.
+        std::vector<double> departures;
+        // Скорость автобусов маршрута в км/ч. nullopt - общая скорость из настроек маршрутизации.
+        std::optional<double> velocity;
+    };
+
+    // Таблица расстояний между соседними остановками маршрута. Для маршрута из n остановок
+    // массивы расстояний по участкам имеют размер n - 1 (элемент i относится к участку
+    // между остановками i и i + 1), массивы префиксных сумм - размер n (элемент i равен
+    // сумме длин участков от остановки 0 до остановки i).
+    struct BusDistanceTable
+    {
+        std::vector<double> forward_road;  // Расстояние по дорогам от остановки i до остановки i + 1
+        std::vector<double> backward_road; // Расстояние по дорогам от остановки i + 1 до остановки i
+        std::vector<double> geo;           // Географическое расстояние между остановками i и i + 1
+        std::vector<double> forward_road_prefix;
+        std::vector<double> backward_road_prefix;
+        std::vector<double> geo_prefix;
+
+        // Расстояние по дорогам при движении в прямом направлении от остановки from до остановки to (from <= to).
+        double ForwardRoadDistance(size_t from, size_t to) const
+        {
+            return forward_road_prefix[to] - forward_road_prefix[from];
+        }
+
+        // Расстояние по дорогам при движении в обратном направлении от остановки from до остановки to (from >= to).
+        double BackwardRoadDistance(size_t from, size_t to) const
+        {
+            return backward_road_prefix[from] - backward_road_prefix[to];
+        }
+
+        double GeoDistance(size_t from, size_t to) const
+        {
+            return from <= to ? geo_prefix[to] - geo_prefix[from] : geo_prefix[from] - geo_prefix[to];
+        }
+    };
+
+    // Остановка, достижимая из заданной, и наименьшее время поездки до неё в минутах. Имя ссылается
+    // на данные справочника.
+    struct StopArrival
+    {
+        std::string_view stop_name;
+        double time;
     };
 
     struct TCCommonMetric
@@ -1,6 +1,15 @@
 #pragma once
 
 #include <cmath>
+#include <cfloat>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GEO_USE_SSE2
+#endif
 
 namespace detail
 {
@@ -20,4 +29,180 @@ namespace detail
                     + cos(from.lat * radians_in_degree) * cos(to.lat * radians_in_degree)
                     * cos(abs(from.lng - to.lng) * radians_in_degree)) * earth_radius;
     }
+
+    // Допустимое по умолчанию отклонение (в метрах) результатов ускоренного расчёта
+    // расстояний от результатов эталонной функции ComputeDistance.
+    inline constexpr double DISTANCE_TOLERANCE = 1E-3;
+
+    // Координаты точки вместе с заранее вычисленными синусами и косинусами широты и долготы.
+    // Косинус разности долгот раскладывается как cos(a)cos(b) + sin(a)sin(b), поэтому
+    // при наличии таких предвычисленных значений расчёт расстояния между двумя точками
+    // сводится к нескольким умножениям и сложениям и единственному вызову acos.
+    struct CoordinatesTrig
+    {
+        Coordinates coords;
+        double sin_lat;
+        double cos_lat;
+        double sin_lng;
+        double cos_lng;
+    };
+
+    inline CoordinatesTrig ComputeCoordinatesTrig(Coordinates point)
+    {
+        static const double radians_in_degree = 3.1415926535 / 180.;
+        return {point, std::sin(point.lat * radians_in_degree), std::cos(point.lat * radians_in_degree),
+                std::sin(point.lng * radians_in_degree), std::cos(point.lng * radians_in_degree)};
+    }
+
+    // Набор точек в виде "структуры массивов" (SoA) - каждая компонента хранится в своём
+    // непрерывном массиве, что позволяет обрабатывать сразу несколько точек одной SIMD-командой.
+    struct CoordinatesBatch
+    {
+        std::vector<Coordinates> coords;
+        std::vector<double> sin_lat;
+        std::vector<double> cos_lat;
+        std::vector<double> sin_lng;
+        std::vector<double> cos_lng;
+
+        void reserve(size_t count)
+        {
+            coords.reserve(count);
+            sin_lat.reserve(count);
+            cos_lat.reserve(count);
+            sin_lng.reserve(count);
+            cos_lng.reserve(count);
+        }
+
+        void push_back(const CoordinatesTrig& point)
+        {
+            coords.push_back(point.coords);
+            sin_lat.push_back(point.sin_lat);
+            cos_lat.push_back(point.cos_lat);
+            sin_lng.push_back(point.sin_lng);
+            cos_lng.push_back(point.cos_lng);
+        }
+
+        size_t size() const
+        {
+            return coords.size();
+        }
+    };
+
+    namespace geo_impl
+    {
+        static constexpr double EARTH_RADIUS = 6371000;
+        // Оценка сверху погрешности аргумента acos, накопленной при его вычислении через
+        // предвычисленные синусы и косинусы, по сравнению с эталонной формулой.
+        static constexpr double COS_ARG_ERROR = 8 * DBL_EPSILON;
+
+        // Функция переводит косинус центрального угла в расстояние. Вблизи cos = 1 (очень близкие точки)
+        // acos плохо обусловлен, и погрешность аргумента может дать отклонение больше допустимого.
+        // Для таких пар расстояние пересчитывается по эталонной формуле ComputeDistance.
+        inline double CosToDistance(double cos_arg, Coordinates from, Coordinates to, double tolerance)
+        {
+            const double max_error_sin = EARTH_RADIUS * COS_ARG_ERROR / tolerance;
+            if (1 - cos_arg * cos_arg < max_error_sin * max_error_sin)
+                return ComputeDistance(from, to);
+            return std::acos(cos_arg) * EARTH_RADIUS;
+        }
+
+        inline double ComputeCos(double from_sin_lat, double from_cos_lat, double from_sin_lng, double from_cos_lng,
+                                 double to_sin_lat, double to_cos_lat, double to_sin_lng, double to_cos_lng)
+        {
+            return from_sin_lat * to_sin_lat
+                   + from_cos_lat * to_cos_lat * (from_cos_lng * to_cos_lng + from_sin_lng * to_sin_lng);
+        }
+    } // namespace geo_impl
+
+    inline double ComputeDistance(const CoordinatesTrig& from, const CoordinatesTrig& to,
+                                  double tolerance = DISTANCE_TOLERANCE)
+    {
+        return geo_impl::CosToDistance(geo_impl::ComputeCos(from.sin_lat, from.cos_lat, from.sin_lng, from.cos_lng,
+                                                            to.sin_lat, to.cos_lat, to.sin_lng, to.cos_lng),
+                                       from.coords, to.coords, tolerance);
+    }
+
+    // Пакетный расчёт расстояний между парами точек from[i] - to[i], i = 0..count-1 (count - меньший
+    // из размеров наборов), результат записывается в result[i]. Косинусы центральных углов
+    // считаются векторно (AVX2 по 4 пары или SSE2 по 2 пары, в зависимости от целевой платформы
+    // сборки, иначе - скалярно), затем переводятся в расстояния с контролем погрешности tolerance.
+    inline void ComputeDistances(const CoordinatesBatch& from, const CoordinatesBatch& to, double* result,
+                                 double tolerance = DISTANCE_TOLERANCE)
+    {
+        const size_t count = from.size() < to.size() ? from.size() : to.size();
+        size_t i = 0;
+#if defined(__AVX2__)
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d cos_lng = _mm256_add_pd(
+                _mm256_mul_pd(_mm256_loadu_pd(&from.cos_lng[i]), _mm256_loadu_pd(&to.cos_lng[i])),
+                _mm256_mul_pd(_mm256_loadu_pd(&from.sin_lng[i]), _mm256_loadu_pd(&to.sin_lng[i])));
+            __m256d cos_arg = _mm256_add_pd(
+                _mm256_mul_pd(_mm256_loadu_pd(&from.sin_lat[i]), _mm256_loadu_pd(&to.sin_lat[i])),
+                _mm256_mul_pd(_mm256_mul_pd(_mm256_loadu_pd(&from.cos_lat[i]), _mm256_loadu_pd(&to.cos_lat[i])),
+                              cos_lng));
+            _mm256_storeu_pd(result + i, cos_arg);
+        }
+#elif defined(GEO_USE_SSE2)
+        for (; i + 2 <= count; i += 2)
+        {
+            __m128d cos_lng = _mm_add_pd(
+                _mm_mul_pd(_mm_loadu_pd(&from.cos_lng[i]), _mm_loadu_pd(&to.cos_lng[i])),
+                _mm_mul_pd(_mm_loadu_pd(&from.sin_lng[i]), _mm_loadu_pd(&to.sin_lng[i])));
+            __m128d cos_arg = _mm_add_pd(
+                _mm_mul_pd(_mm_loadu_pd(&from.sin_lat[i]), _mm_loadu_pd(&to.sin_lat[i])),
+                _mm_mul_pd(_mm_mul_pd(_mm_loadu_pd(&from.cos_lat[i]), _mm_loadu_pd(&to.cos_lat[i])), cos_lng));
+            _mm_storeu_pd(result + i, cos_arg);
+        }
+#endif
+        for (; i < count; ++i)
+            result[i] = geo_impl::ComputeCos(from.sin_lat[i], from.cos_lat[i], from.sin_lng[i], from.cos_lng[i],
+                                             to.sin_lat[i], to.cos_lat[i], to.sin_lng[i], to.cos_lng[i]);
+
+        for (i = 0; i < count; ++i)
+            result[i] = geo_impl::CosToDistance(result[i], from.coords[i], to.coords[i], tolerance);
+    }
+
+    // Вариант пакетного расчёта для последовательности точек (ломаной): result[i] - расстояние
+    // между points[i] и points[i + 1], i = 0..points.size()-2.
+    inline void ComputeChainDistances(const CoordinatesBatch& points, double* result,
+                                      double tolerance = DISTANCE_TOLERANCE)
+    {
+        const size_t count = points.size() < 2 ? 0 : points.size() - 1;
+        size_t i = 0;
+#if defined(__AVX2__)
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d cos_lng = _mm256_add_pd(
+                _mm256_mul_pd(_mm256_loadu_pd(&points.cos_lng[i]), _mm256_loadu_pd(&points.cos_lng[i + 1])),
+                _mm256_mul_pd(_mm256_loadu_pd(&points.sin_lng[i]), _mm256_loadu_pd(&points.sin_lng[i + 1])));
+            __m256d cos_arg = _mm256_add_pd(
+                _mm256_mul_pd(_mm256_loadu_pd(&points.sin_lat[i]), _mm256_loadu_pd(&points.sin_lat[i + 1])),
+                _mm256_mul_pd(_mm256_mul_pd(_mm256_loadu_pd(&points.cos_lat[i]),
+                                            _mm256_loadu_pd(&points.cos_lat[i + 1])), cos_lng));
+            _mm256_storeu_pd(result + i, cos_arg);
+        }
+#elif defined(GEO_USE_SSE2)
+        for (; i + 2 <= count; i += 2)
+        {
+            __m128d cos_lng = _mm_add_pd(
+                _mm_mul_pd(_mm_loadu_pd(&points.cos_lng[i]), _mm_loadu_pd(&points.cos_lng[i + 1])),
+                _mm_mul_pd(_mm_loadu_pd(&points.sin_lng[i]), _mm_loadu_pd(&points.sin_lng[i + 1])));
+            __m128d cos_arg = _mm_add_pd(
+                _mm_mul_pd(_mm_loadu_pd(&points.sin_lat[i]), _mm_loadu_pd(&points.sin_lat[i + 1])),
+                _mm_mul_pd(_mm_mul_pd(_mm_loadu_pd(&points.cos_lat[i]), _mm_loadu_pd(&points.cos_lat[i + 1])),
+                           cos_lng));
+            _mm_storeu_pd(result + i, cos_arg);
+        }
+#endif
+        for (; i < count; ++i)
+            result[i] = geo_impl::ComputeCos(points.sin_lat[i], points.cos_lat[i], points.sin_lng[i], points.cos_lng[i],
+                                             points.sin_lat[i + 1], points.cos_lat[i + 1],
+                                             points.sin_lng[i + 1], points.cos_lng[i + 1]);
+
+        for (i = 0; i < count; ++i)
+            result[i] = geo_impl::CosToDistance(result[i], points.coords[i], points.coords[i + 1], tolerance);
+    }
 } //namespace detail
+
+#undef GEO_USE_SSE2
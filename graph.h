@@ -32,6 +32,8 @@ namespace graph
         explicit DirectedWeightedGraph(size_t vertex_count);
         void clear(size_t vertex_count);
         EdgeId AddEdge(const Edge<Weight>& edge);
+        // Меняет вес ребра, не затрагивая структуру графа.
+        void SetEdgeWeight(EdgeId edge_id, Weight weight);
 
         size_t GetVertexCount() const;
         size_t GetEdgeCount() const;
@@ -65,6 +67,12 @@ namespace graph
         return id;
     }
 
+    template <typename Weight>
+    void DirectedWeightedGraph<Weight>::SetEdgeWeight(EdgeId edge_id, Weight weight)
+    {
+        edges_.at(edge_id).weight = weight;
+    }
+
     template <typename Weight>
     size_t DirectedWeightedGraph<Weight>::GetVertexCount() const
     {
@@ -16,101 +16,184 @@
 #include <google/protobuf/port_def.inc>
 
 PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
 namespace TransCatSerial {
-constexpr Edge::Edge(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : from_(0u)
-  , to_(0u)
-  , weight_(0){}
+PROTOBUF_CONSTEXPR Edge::Edge(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.from_)*/0u
+  , /*decltype(_impl_.to_)*/0u
+  , /*decltype(_impl_.weight_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct EdgeDefaultTypeInternal {
-  constexpr EdgeDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR EdgeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~EdgeDefaultTypeInternal() {}
   union {
     Edge _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT EdgeDefaultTypeInternal _Edge_default_instance_;
-constexpr Edges::Edges(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : edges_(){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EdgeDefaultTypeInternal _Edge_default_instance_;
+PROTOBUF_CONSTEXPR Edges::Edges(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.edges_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct EdgesDefaultTypeInternal {
-  constexpr EdgesDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR EdgesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~EdgesDefaultTypeInternal() {}
   union {
     Edges _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT EdgesDefaultTypeInternal _Edges_default_instance_;
-constexpr IncidenceList::IncidenceList(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : edge_id_()
-  , _edge_id_cached_byte_size_(0){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EdgesDefaultTypeInternal _Edges_default_instance_;
+PROTOBUF_CONSTEXPR IncidenceList::IncidenceList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.edge_id_)*/{}
+  , /*decltype(_impl_._edge_id_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct IncidenceListDefaultTypeInternal {
-  constexpr IncidenceListDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR IncidenceListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~IncidenceListDefaultTypeInternal() {}
   union {
     IncidenceList _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT IncidenceListDefaultTypeInternal _IncidenceList_default_instance_;
-constexpr IncidenceLists::IncidenceLists(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : incidence_list_(){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IncidenceListDefaultTypeInternal _IncidenceList_default_instance_;
+PROTOBUF_CONSTEXPR IncidenceLists::IncidenceLists(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.incidence_list_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct IncidenceListsDefaultTypeInternal {
-  constexpr IncidenceListsDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR IncidenceListsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~IncidenceListsDefaultTypeInternal() {}
   union {
     IncidenceLists _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT IncidenceListsDefaultTypeInternal _IncidenceLists_default_instance_;
-constexpr RouteData::RouteData(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : weight_(0)
-  , has_value_(false)
-  , has_prev_edge_value_(false)
-  , prev_edge_(0u){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IncidenceListsDefaultTypeInternal _IncidenceLists_default_instance_;
+PROTOBUF_CONSTEXPR RouteData::RouteData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.weight_)*/0
+  , /*decltype(_impl_.has_value_)*/false
+  , /*decltype(_impl_.has_prev_edge_value_)*/false
+  , /*decltype(_impl_.prev_edge_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct RouteDataDefaultTypeInternal {
-  constexpr RouteDataDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR RouteDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~RouteDataDefaultTypeInternal() {}
   union {
     RouteData _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT RouteDataDefaultTypeInternal _RouteData_default_instance_;
-constexpr RoutesSecIndexData::RoutesSecIndexData(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : sec_routes_data_(){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RouteDataDefaultTypeInternal _RouteData_default_instance_;
+PROTOBUF_CONSTEXPR RoutesSecIndexData::RoutesSecIndexData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sec_routes_data_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct RoutesSecIndexDataDefaultTypeInternal {
-  constexpr RoutesSecIndexDataDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR RoutesSecIndexDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~RoutesSecIndexDataDefaultTypeInternal() {}
   union {
     RoutesSecIndexData _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT RoutesSecIndexDataDefaultTypeInternal _RoutesSecIndexData_default_instance_;
-constexpr RoutesData::RoutesData(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : first_routes_data_(){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoutesSecIndexDataDefaultTypeInternal _RoutesSecIndexData_default_instance_;
+PROTOBUF_CONSTEXPR RoutesData::RoutesData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.first_routes_data_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct RoutesDataDefaultTypeInternal {
-  constexpr RoutesDataDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR RoutesDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~RoutesDataDefaultTypeInternal() {}
   union {
     RoutesData _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT RoutesDataDefaultTypeInternal _RoutesData_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoutesDataDefaultTypeInternal _RoutesData_default_instance_;
+PROTOBUF_CONSTEXPR PackedRoutesData::PackedRoutesData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.prev_edge_)*/{}
+  , /*decltype(_impl_._prev_edge_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.prev_edge_delta_)*/{}
+  , /*decltype(_impl_._prev_edge_delta_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.weight_)*/{}
+  , /*decltype(_impl_.vertex_count_)*/0u
+  , /*decltype(_impl_.delta_encoded_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PackedRoutesDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PackedRoutesDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PackedRoutesDataDefaultTypeInternal() {}
+  union {
+    PackedRoutesData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PackedRoutesDataDefaultTypeInternal _PackedRoutesData_default_instance_;
+PROTOBUF_CONSTEXPR ContractionHierarchy::ContractionHierarchy(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.vertex_rank_)*/{}
+  , /*decltype(_impl_._vertex_rank_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.edge_from_)*/{}
+  , /*decltype(_impl_._edge_from_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.edge_to_)*/{}
+  , /*decltype(_impl_._edge_to_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.edge_weight_)*/{}
+  , /*decltype(_impl_.original_edge_)*/{}
+  , /*decltype(_impl_._original_edge_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.first_child_)*/{}
+  , /*decltype(_impl_._first_child_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.second_child_)*/{}
+  , /*decltype(_impl_._second_child_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ContractionHierarchyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ContractionHierarchyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ContractionHierarchyDefaultTypeInternal() {}
+  union {
+    ContractionHierarchy _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ContractionHierarchyDefaultTypeInternal _ContractionHierarchy_default_instance_;
+PROTOBUF_CONSTEXPR HubLabels::HubLabels(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hub_vertex_)*/{}
+  , /*decltype(_impl_._hub_vertex_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.in_label_count_)*/{}
+  , /*decltype(_impl_._in_label_count_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.in_hub_delta_)*/{}
+  , /*decltype(_impl_._in_hub_delta_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.in_weight_)*/{}
+  , /*decltype(_impl_.in_edge_)*/{}
+  , /*decltype(_impl_._in_edge_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.out_label_count_)*/{}
+  , /*decltype(_impl_._out_label_count_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.out_hub_delta_)*/{}
+  , /*decltype(_impl_._out_hub_delta_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.out_weight_)*/{}
+  , /*decltype(_impl_.out_edge_)*/{}
+  , /*decltype(_impl_._out_edge_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HubLabelsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HubLabelsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HubLabelsDefaultTypeInternal() {}
+  union {
+    HubLabels _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HubLabelsDefaultTypeInternal _HubLabels_default_instance_;
 }  // namespace TransCatSerial
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_graph_2eproto[7];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_graph_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_graph_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_graph_2eproto[10];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_graph_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_graph_2eproto = nullptr;
 
 const uint32_t TableStruct_graph_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
@@ -119,56 +202,95 @@ const uint32_t TableStruct_graph_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pr
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Edge, from_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Edge, to_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Edge, weight_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Edge, _impl_.from_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Edge, _impl_.to_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Edge, _impl_.weight_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::Edges, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Edges, edges_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Edges, _impl_.edges_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::IncidenceList, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::IncidenceList, edge_id_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::IncidenceList, _impl_.edge_id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::IncidenceLists, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::IncidenceLists, incidence_list_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::IncidenceLists, _impl_.incidence_list_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::RouteData, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RouteData, has_value_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RouteData, weight_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RouteData, has_prev_edge_value_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RouteData, prev_edge_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RouteData, _impl_.has_value_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RouteData, _impl_.weight_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RouteData, _impl_.has_prev_edge_value_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RouteData, _impl_.prev_edge_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::RoutesSecIndexData, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RoutesSecIndexData, sec_routes_data_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RoutesSecIndexData, _impl_.sec_routes_data_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::RoutesData, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RoutesData, first_routes_data_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RoutesData, _impl_.first_routes_data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::PackedRoutesData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::PackedRoutesData, _impl_.vertex_count_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::PackedRoutesData, _impl_.delta_encoded_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::PackedRoutesData, _impl_.prev_edge_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::PackedRoutesData, _impl_.prev_edge_delta_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::PackedRoutesData, _impl_.weight_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::ContractionHierarchy, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::ContractionHierarchy, _impl_.vertex_rank_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::ContractionHierarchy, _impl_.edge_from_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::ContractionHierarchy, _impl_.edge_to_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::ContractionHierarchy, _impl_.edge_weight_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::ContractionHierarchy, _impl_.original_edge_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::ContractionHierarchy, _impl_.first_child_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::ContractionHierarchy, _impl_.second_child_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::HubLabels, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::HubLabels, _impl_.hub_vertex_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::HubLabels, _impl_.in_label_count_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::HubLabels, _impl_.in_hub_delta_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::HubLabels, _impl_.in_weight_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::HubLabels, _impl_.in_edge_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::HubLabels, _impl_.out_label_count_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::HubLabels, _impl_.out_hub_delta_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::HubLabels, _impl_.out_weight_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::HubLabels, _impl_.out_edge_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::TransCatSerial::Edge)},
   { 9, -1, -1, sizeof(::TransCatSerial::Edges)},
   { 16, -1, -1, sizeof(::TransCatSerial::IncidenceList)},
@@ -176,16 +298,22 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 30, -1, -1, sizeof(::TransCatSerial::RouteData)},
   { 40, -1, -1, sizeof(::TransCatSerial::RoutesSecIndexData)},
   { 47, -1, -1, sizeof(::TransCatSerial::RoutesData)},
+  { 54, -1, -1, sizeof(::TransCatSerial::PackedRoutesData)},
+  { 65, -1, -1, sizeof(::TransCatSerial::ContractionHierarchy)},
+  { 78, -1, -1, sizeof(::TransCatSerial::HubLabels)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_Edge_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_Edges_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_IncidenceList_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_IncidenceLists_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_RouteData_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_RoutesSecIndexData_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_RoutesData_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::TransCatSerial::_Edge_default_instance_._instance,
+  &::TransCatSerial::_Edges_default_instance_._instance,
+  &::TransCatSerial::_IncidenceList_default_instance_._instance,
+  &::TransCatSerial::_IncidenceLists_default_instance_._instance,
+  &::TransCatSerial::_RouteData_default_instance_._instance,
+  &::TransCatSerial::_RoutesSecIndexData_default_instance_._instance,
+  &::TransCatSerial::_RoutesData_default_instance_._instance,
+  &::TransCatSerial::_PackedRoutesData_default_instance_._instance,
+  &::TransCatSerial::_ContractionHierarchy_default_instance_._instance,
+  &::TransCatSerial::_HubLabels_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_graph_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -200,22 +328,36 @@ const char descriptor_table_protodef_graph_2eproto[] PROTOBUF_SECTION_VARIABLE(p
   "ge\030\004 \001(\r\"H\n\022RoutesSecIndexData\0222\n\017sec_ro"
   "utes_data\030\001 \003(\0132\031.TransCatSerial.RouteDa"
   "ta\"K\n\nRoutesData\022=\n\021first_routes_data\030\001 "
-  "\003(\0132\".TransCatSerial.RoutesSecIndexDatab"
-  "\006proto3"
+  "\003(\0132\".TransCatSerial.RoutesSecIndexData\""
+  "{\n\020PackedRoutesData\022\024\n\014vertex_count\030\001 \001("
+  "\r\022\025\n\rdelta_encoded\030\002 \001(\010\022\021\n\tprev_edge\030\003 "
+  "\003(\r\022\027\n\017prev_edge_delta\030\004 \003(\021\022\016\n\006weight\030\005"
+  " \003(\001\"\246\001\n\024ContractionHierarchy\022\023\n\013vertex_"
+  "rank\030\001 \003(\r\022\021\n\tedge_from\030\002 \003(\r\022\017\n\007edge_to"
+  "\030\003 \003(\r\022\023\n\013edge_weight\030\004 \003(\001\022\025\n\roriginal_"
+  "edge\030\005 \003(\r\022\023\n\013first_child\030\006 \003(\r\022\024\n\014secon"
+  "d_child\030\007 \003(\r\"\307\001\n\tHubLabels\022\022\n\nhub_verte"
+  "x\030\001 \003(\r\022\026\n\016in_label_count\030\002 \003(\r\022\024\n\014in_hu"
+  "b_delta\030\003 \003(\r\022\021\n\tin_weight\030\004 \003(\001\022\017\n\007in_e"
+  "dge\030\005 \003(\r\022\027\n\017out_label_count\030\006 \003(\r\022\025\n\rou"
+  "t_hub_delta\030\007 \003(\r\022\022\n\nout_weight\030\010 \003(\001\022\020\n"
+  "\010out_edge\030\t \003(\rb\006proto3"
   ;
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_graph_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_graph_2eproto = {
-  false, false, 487, descriptor_table_protodef_graph_2eproto, "graph.proto", 
-  &descriptor_table_graph_2eproto_once, nullptr, 0, 7,
-  schemas, file_default_instances, TableStruct_graph_2eproto::offsets,
-  file_level_metadata_graph_2eproto, file_level_enum_descriptors_graph_2eproto, file_level_service_descriptors_graph_2eproto,
+static ::_pbi::once_flag descriptor_table_graph_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_graph_2eproto = {
+    false, false, 983, descriptor_table_protodef_graph_2eproto,
+    "graph.proto",
+    &descriptor_table_graph_2eproto_once, nullptr, 0, 10,
+    schemas, file_default_instances, TableStruct_graph_2eproto::offsets,
+    file_level_metadata_graph_2eproto, file_level_enum_descriptors_graph_2eproto,
+    file_level_service_descriptors_graph_2eproto,
 };
-PROTOBUF_ATTRIBUTE_WEAK const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable* descriptor_table_graph_2eproto_getter() {
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_graph_2eproto_getter() {
   return &descriptor_table_graph_2eproto;
 }
 
 // Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY static ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptorsRunner dynamic_init_dummy_graph_2eproto(&descriptor_table_graph_2eproto);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_graph_2eproto(&descriptor_table_graph_2eproto);
 namespace TransCatSerial {
 
 // ===================================================================
@@ -227,47 +369,52 @@ class Edge::_Internal {
 Edge::Edge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.Edge)
 }
 Edge::Edge(const Edge& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Edge* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_){}
+    , decltype(_impl_.to_){}
+    , decltype(_impl_.weight_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&from_, &from.from_,
-    static_cast<size_t>(reinterpret_cast<char*>(&weight_) -
-    reinterpret_cast<char*>(&from_)) + sizeof(weight_));
+  ::memcpy(&_impl_.from_, &from._impl_.from_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.weight_) -
+    reinterpret_cast<char*>(&_impl_.from_)) + sizeof(_impl_.weight_));
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.Edge)
 }
 
-inline void Edge::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&from_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&weight_) -
-    reinterpret_cast<char*>(&from_)) + sizeof(weight_));
+inline void Edge::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_){0u}
+    , decltype(_impl_.to_){0u}
+    , decltype(_impl_.weight_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Edge::~Edge() {
   // @@protoc_insertion_point(destructor:TransCatSerial.Edge)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void Edge::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void Edge::ArenaDtor(void* object) {
-  Edge* _this = reinterpret_cast< Edge* >(object);
-  (void)_this;
-}
-void Edge::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Edge::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void Edge::Clear() {
@@ -276,22 +423,22 @@ void Edge::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&from_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&weight_) -
-      reinterpret_cast<char*>(&from_)) + sizeof(weight_));
+  ::memset(&_impl_.from_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.weight_) -
+      reinterpret_cast<char*>(&_impl_.from_)) + sizeof(_impl_.weight_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Edge::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Edge::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // uint32 from = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -299,7 +446,7 @@ const char* Edge::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inter
       // uint32 to = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -307,7 +454,7 @@ const char* Edge::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inter
       // double weight = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
-          weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -344,13 +491,13 @@ uint8_t* Edge::_InternalSerialize(
   // uint32 from = 1;
   if (this->_internal_from() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_from(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_from(), target);
   }
 
   // uint32 to = 2;
   if (this->_internal_to() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_to(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_to(), target);
   }
 
   // double weight = 3;
@@ -360,11 +507,11 @@ uint8_t* Edge::_InternalSerialize(
   memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
   if (raw_weight != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(3, this->_internal_weight(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_weight(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.Edge)
@@ -381,12 +528,12 @@ size_t Edge::ByteSizeLong() const {
 
   // uint32 from = 1;
   if (this->_internal_from() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32SizePlusOne(this->_internal_from());
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_from());
   }
 
   // uint32 to = 2;
   if (this->_internal_to() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32SizePlusOne(this->_internal_to());
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_to());
   }
 
   // double weight = 3;
@@ -398,42 +545,38 @@ size_t Edge::ByteSizeLong() const {
     total_size += 1 + 8;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Edge::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     Edge::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Edge::GetClassData() const { return &_class_data_; }
 
-void Edge::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Edge *>(to)->MergeFrom(
-      static_cast<const Edge &>(from));
-}
-
 
-void Edge::MergeFrom(const Edge& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.Edge)
-  GOOGLE_DCHECK_NE(&from, this);
+void Edge::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Edge*>(&to_msg);
+  auto& from = static_cast<const Edge&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.Edge)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (from._internal_from() != 0) {
-    _internal_set_from(from._internal_from());
+    _this->_internal_set_from(from._internal_from());
   }
   if (from._internal_to() != 0) {
-    _internal_set_to(from._internal_to());
+    _this->_internal_set_to(from._internal_to());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_weight = from._internal_weight();
   uint64_t raw_weight;
   memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
   if (raw_weight != 0) {
-    _internal_set_weight(from._internal_weight());
+    _this->_internal_set_weight(from._internal_weight());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Edge::CopyFrom(const Edge& from) {
@@ -451,15 +594,15 @@ void Edge::InternalSwap(Edge* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Edge, weight_)
-      + sizeof(Edge::weight_)
-      - PROTOBUF_FIELD_OFFSET(Edge, from_)>(
-          reinterpret_cast<char*>(&from_),
-          reinterpret_cast<char*>(&other->from_));
+      PROTOBUF_FIELD_OFFSET(Edge, _impl_.weight_)
+      + sizeof(Edge::_impl_.weight_)
+      - PROTOBUF_FIELD_OFFSET(Edge, _impl_.from_)>(
+          reinterpret_cast<char*>(&_impl_.from_),
+          reinterpret_cast<char*>(&other->_impl_.from_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Edge::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
       file_level_metadata_graph_2eproto[0]);
 }
@@ -472,43 +615,47 @@ class Edges::_Internal {
 
 Edges::Edges(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  edges_(arena) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.Edges)
 }
 Edges::Edges(const Edges& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      edges_(from.edges_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Edges* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edges_){from._impl_.edges_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.Edges)
 }
 
-inline void Edges::SharedCtor() {
+inline void Edges::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edges_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Edges::~Edges() {
   // @@protoc_insertion_point(destructor:TransCatSerial.Edges)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void Edges::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.edges_.~RepeatedPtrField();
 }
 
-void Edges::ArenaDtor(void* object) {
-  Edges* _this = reinterpret_cast< Edges* >(object);
-  (void)_this;
-}
-void Edges::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Edges::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void Edges::Clear() {
@@ -517,15 +664,15 @@ void Edges::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  edges_.Clear();
+  _impl_.edges_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Edges::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Edges::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .TransCatSerial.Edge edges = 1;
       case 1:
@@ -570,15 +717,15 @@ uint8_t* Edges::_InternalSerialize(
   (void) cached_has_bits;
 
   // repeated .TransCatSerial.Edge edges = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_edges_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_edges_size()); i < n; i++) {
+    const auto& repfield = this->_internal_edges(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_edges(i), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.Edges)
@@ -595,35 +742,31 @@ size_t Edges::ByteSizeLong() const {
 
   // repeated .TransCatSerial.Edge edges = 1;
   total_size += 1UL * this->_internal_edges_size();
-  for (const auto& msg : this->edges_) {
+  for (const auto& msg : this->_impl_.edges_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Edges::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     Edges::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Edges::GetClassData() const { return &_class_data_; }
 
-void Edges::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Edges *>(to)->MergeFrom(
-      static_cast<const Edges &>(from));
-}
-
 
-void Edges::MergeFrom(const Edges& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.Edges)
-  GOOGLE_DCHECK_NE(&from, this);
+void Edges::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Edges*>(&to_msg);
+  auto& from = static_cast<const Edges&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.Edges)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  edges_.MergeFrom(from.edges_);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.edges_.MergeFrom(from._impl_.edges_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Edges::CopyFrom(const Edges& from) {
@@ -640,11 +783,11 @@ bool Edges::IsInitialized() const {
 void Edges::InternalSwap(Edges* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  edges_.InternalSwap(&other->edges_);
+  _impl_.edges_.InternalSwap(&other->_impl_.edges_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Edges::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
       file_level_metadata_graph_2eproto[1]);
 }
@@ -657,43 +800,49 @@ class IncidenceList::_Internal {
 
 IncidenceList::IncidenceList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  edge_id_(arena) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.IncidenceList)
 }
 IncidenceList::IncidenceList(const IncidenceList& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      edge_id_(from.edge_id_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IncidenceList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edge_id_){from._impl_.edge_id_}
+    , /*decltype(_impl_._edge_id_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.IncidenceList)
 }
 
-inline void IncidenceList::SharedCtor() {
+inline void IncidenceList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edge_id_){arena}
+    , /*decltype(_impl_._edge_id_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 IncidenceList::~IncidenceList() {
   // @@protoc_insertion_point(destructor:TransCatSerial.IncidenceList)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void IncidenceList::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.edge_id_.~RepeatedField();
 }
 
-void IncidenceList::ArenaDtor(void* object) {
-  IncidenceList* _this = reinterpret_cast< IncidenceList* >(object);
-  (void)_this;
-}
-void IncidenceList::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void IncidenceList::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void IncidenceList::Clear() {
@@ -702,15 +851,15 @@ void IncidenceList::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  edge_id_.Clear();
+  _impl_.edge_id_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* IncidenceList::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* IncidenceList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated uint32 edge_id = 1;
       case 1:
@@ -754,7 +903,7 @@ uint8_t* IncidenceList::_InternalSerialize(
 
   // repeated uint32 edge_id = 1;
   {
-    int byte_size = _edge_id_cached_byte_size_.load(std::memory_order_relaxed);
+    int byte_size = _impl_._edge_id_cached_byte_size_.load(std::memory_order_relaxed);
     if (byte_size > 0) {
       target = stream->WriteUInt32Packed(
           1, _internal_edge_id(), byte_size, target);
@@ -762,7 +911,7 @@ uint8_t* IncidenceList::_InternalSerialize(
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.IncidenceList)
@@ -779,43 +928,38 @@ size_t IncidenceList::ByteSizeLong() const {
 
   // repeated uint32 edge_id = 1;
   {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      UInt32Size(this->edge_id_);
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.edge_id_);
     if (data_size > 0) {
       total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-            static_cast<int32_t>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
-    _edge_id_cached_byte_size_.store(cached_size,
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._edge_id_cached_byte_size_.store(cached_size,
                                     std::memory_order_relaxed);
     total_size += data_size;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IncidenceList::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     IncidenceList::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IncidenceList::GetClassData() const { return &_class_data_; }
 
-void IncidenceList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<IncidenceList *>(to)->MergeFrom(
-      static_cast<const IncidenceList &>(from));
-}
-
 
-void IncidenceList::MergeFrom(const IncidenceList& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.IncidenceList)
-  GOOGLE_DCHECK_NE(&from, this);
+void IncidenceList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IncidenceList*>(&to_msg);
+  auto& from = static_cast<const IncidenceList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.IncidenceList)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  edge_id_.MergeFrom(from.edge_id_);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.edge_id_.MergeFrom(from._impl_.edge_id_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void IncidenceList::CopyFrom(const IncidenceList& from) {
@@ -832,11 +976,11 @@ bool IncidenceList::IsInitialized() const {
 void IncidenceList::InternalSwap(IncidenceList* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  edge_id_.InternalSwap(&other->edge_id_);
+  _impl_.edge_id_.InternalSwap(&other->_impl_.edge_id_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata IncidenceList::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
       file_level_metadata_graph_2eproto[2]);
 }
@@ -849,43 +993,47 @@ class IncidenceLists::_Internal {
 
 IncidenceLists::IncidenceLists(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  incidence_list_(arena) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.IncidenceLists)
 }
 IncidenceLists::IncidenceLists(const IncidenceLists& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      incidence_list_(from.incidence_list_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IncidenceLists* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.incidence_list_){from._impl_.incidence_list_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.IncidenceLists)
 }
 
-inline void IncidenceLists::SharedCtor() {
+inline void IncidenceLists::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.incidence_list_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 IncidenceLists::~IncidenceLists() {
   // @@protoc_insertion_point(destructor:TransCatSerial.IncidenceLists)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void IncidenceLists::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.incidence_list_.~RepeatedPtrField();
 }
 
-void IncidenceLists::ArenaDtor(void* object) {
-  IncidenceLists* _this = reinterpret_cast< IncidenceLists* >(object);
-  (void)_this;
-}
-void IncidenceLists::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void IncidenceLists::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void IncidenceLists::Clear() {
@@ -894,15 +1042,15 @@ void IncidenceLists::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  incidence_list_.Clear();
+  _impl_.incidence_list_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* IncidenceLists::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* IncidenceLists::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .TransCatSerial.IncidenceList incidence_list = 1;
       case 1:
@@ -947,15 +1095,15 @@ uint8_t* IncidenceLists::_InternalSerialize(
   (void) cached_has_bits;
 
   // repeated .TransCatSerial.IncidenceList incidence_list = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_incidence_list_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_incidence_list_size()); i < n; i++) {
+    const auto& repfield = this->_internal_incidence_list(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_incidence_list(i), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.IncidenceLists)
@@ -972,35 +1120,31 @@ size_t IncidenceLists::ByteSizeLong() const {
 
   // repeated .TransCatSerial.IncidenceList incidence_list = 1;
   total_size += 1UL * this->_internal_incidence_list_size();
-  for (const auto& msg : this->incidence_list_) {
+  for (const auto& msg : this->_impl_.incidence_list_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IncidenceLists::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     IncidenceLists::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IncidenceLists::GetClassData() const { return &_class_data_; }
 
-void IncidenceLists::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<IncidenceLists *>(to)->MergeFrom(
-      static_cast<const IncidenceLists &>(from));
-}
-
 
-void IncidenceLists::MergeFrom(const IncidenceLists& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.IncidenceLists)
-  GOOGLE_DCHECK_NE(&from, this);
+void IncidenceLists::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IncidenceLists*>(&to_msg);
+  auto& from = static_cast<const IncidenceLists&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.IncidenceLists)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  incidence_list_.MergeFrom(from.incidence_list_);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.incidence_list_.MergeFrom(from._impl_.incidence_list_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void IncidenceLists::CopyFrom(const IncidenceLists& from) {
@@ -1017,11 +1161,11 @@ bool IncidenceLists::IsInitialized() const {
 void IncidenceLists::InternalSwap(IncidenceLists* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  incidence_list_.InternalSwap(&other->incidence_list_);
+  _impl_.incidence_list_.InternalSwap(&other->_impl_.incidence_list_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata IncidenceLists::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
       file_level_metadata_graph_2eproto[3]);
 }
@@ -1035,47 +1179,54 @@ class RouteData::_Internal {
 RouteData::RouteData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.RouteData)
 }
 RouteData::RouteData(const RouteData& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RouteData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.weight_){}
+    , decltype(_impl_.has_value_){}
+    , decltype(_impl_.has_prev_edge_value_){}
+    , decltype(_impl_.prev_edge_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&weight_, &from.weight_,
-    static_cast<size_t>(reinterpret_cast<char*>(&prev_edge_) -
-    reinterpret_cast<char*>(&weight_)) + sizeof(prev_edge_));
+  ::memcpy(&_impl_.weight_, &from._impl_.weight_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.prev_edge_) -
+    reinterpret_cast<char*>(&_impl_.weight_)) + sizeof(_impl_.prev_edge_));
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.RouteData)
 }
 
-inline void RouteData::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&weight_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&prev_edge_) -
-    reinterpret_cast<char*>(&weight_)) + sizeof(prev_edge_));
+inline void RouteData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.weight_){0}
+    , decltype(_impl_.has_value_){false}
+    , decltype(_impl_.has_prev_edge_value_){false}
+    , decltype(_impl_.prev_edge_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 RouteData::~RouteData() {
   // @@protoc_insertion_point(destructor:TransCatSerial.RouteData)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void RouteData::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void RouteData::ArenaDtor(void* object) {
-  RouteData* _this = reinterpret_cast< RouteData* >(object);
-  (void)_this;
-}
-void RouteData::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void RouteData::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void RouteData::Clear() {
@@ -1084,22 +1235,22 @@ void RouteData::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&weight_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&prev_edge_) -
-      reinterpret_cast<char*>(&weight_)) + sizeof(prev_edge_));
+  ::memset(&_impl_.weight_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.prev_edge_) -
+      reinterpret_cast<char*>(&_impl_.weight_)) + sizeof(_impl_.prev_edge_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RouteData::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* RouteData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bool has_value = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          has_value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.has_value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1107,7 +1258,7 @@ const char* RouteData::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::
       // double weight = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
-          weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -1115,7 +1266,7 @@ const char* RouteData::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::
       // bool has_prev_edge_value = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          has_prev_edge_value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.has_prev_edge_value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1123,7 +1274,7 @@ const char* RouteData::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::
       // uint32 prev_edge = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          prev_edge_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.prev_edge_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1160,7 +1311,7 @@ uint8_t* RouteData::_InternalSerialize(
   // bool has_value = 1;
   if (this->_internal_has_value() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(1, this->_internal_has_value(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_has_value(), target);
   }
 
   // double weight = 2;
@@ -1170,23 +1321,23 @@ uint8_t* RouteData::_InternalSerialize(
   memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
   if (raw_weight != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_weight(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_weight(), target);
   }
 
   // bool has_prev_edge_value = 3;
   if (this->_internal_has_prev_edge_value() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(3, this->_internal_has_prev_edge_value(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_has_prev_edge_value(), target);
   }
 
   // uint32 prev_edge = 4;
   if (this->_internal_prev_edge() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_prev_edge(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_prev_edge(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.RouteData)
@@ -1222,28 +1373,24 @@ size_t RouteData::ByteSizeLong() const {
 
   // uint32 prev_edge = 4;
   if (this->_internal_prev_edge() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32SizePlusOne(this->_internal_prev_edge());
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_prev_edge());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RouteData::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     RouteData::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RouteData::GetClassData() const { return &_class_data_; }
 
-void RouteData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<RouteData *>(to)->MergeFrom(
-      static_cast<const RouteData &>(from));
-}
-
 
-void RouteData::MergeFrom(const RouteData& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.RouteData)
-  GOOGLE_DCHECK_NE(&from, this);
+void RouteData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RouteData*>(&to_msg);
+  auto& from = static_cast<const RouteData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.RouteData)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -1252,18 +1399,18 @@ void RouteData::MergeFrom(const RouteData& from) {
   uint64_t raw_weight;
   memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
   if (raw_weight != 0) {
-    _internal_set_weight(from._internal_weight());
+    _this->_internal_set_weight(from._internal_weight());
   }
   if (from._internal_has_value() != 0) {
-    _internal_set_has_value(from._internal_has_value());
+    _this->_internal_set_has_value(from._internal_has_value());
   }
   if (from._internal_has_prev_edge_value() != 0) {
-    _internal_set_has_prev_edge_value(from._internal_has_prev_edge_value());
+    _this->_internal_set_has_prev_edge_value(from._internal_has_prev_edge_value());
   }
   if (from._internal_prev_edge() != 0) {
-    _internal_set_prev_edge(from._internal_prev_edge());
+    _this->_internal_set_prev_edge(from._internal_prev_edge());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RouteData::CopyFrom(const RouteData& from) {
@@ -1281,15 +1428,15 @@ void RouteData::InternalSwap(RouteData* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RouteData, prev_edge_)
-      + sizeof(RouteData::prev_edge_)
-      - PROTOBUF_FIELD_OFFSET(RouteData, weight_)>(
-          reinterpret_cast<char*>(&weight_),
-          reinterpret_cast<char*>(&other->weight_));
+      PROTOBUF_FIELD_OFFSET(RouteData, _impl_.prev_edge_)
+      + sizeof(RouteData::_impl_.prev_edge_)
+      - PROTOBUF_FIELD_OFFSET(RouteData, _impl_.weight_)>(
+          reinterpret_cast<char*>(&_impl_.weight_),
+          reinterpret_cast<char*>(&other->_impl_.weight_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata RouteData::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
       file_level_metadata_graph_2eproto[4]);
 }
@@ -1302,43 +1449,47 @@ class RoutesSecIndexData::_Internal {
 
 RoutesSecIndexData::RoutesSecIndexData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  sec_routes_data_(arena) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.RoutesSecIndexData)
 }
 RoutesSecIndexData::RoutesSecIndexData(const RoutesSecIndexData& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      sec_routes_data_(from.sec_routes_data_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoutesSecIndexData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sec_routes_data_){from._impl_.sec_routes_data_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.RoutesSecIndexData)
 }
 
-inline void RoutesSecIndexData::SharedCtor() {
+inline void RoutesSecIndexData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sec_routes_data_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 RoutesSecIndexData::~RoutesSecIndexData() {
   // @@protoc_insertion_point(destructor:TransCatSerial.RoutesSecIndexData)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void RoutesSecIndexData::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sec_routes_data_.~RepeatedPtrField();
 }
 
-void RoutesSecIndexData::ArenaDtor(void* object) {
-  RoutesSecIndexData* _this = reinterpret_cast< RoutesSecIndexData* >(object);
-  (void)_this;
-}
-void RoutesSecIndexData::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void RoutesSecIndexData::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void RoutesSecIndexData::Clear() {
@@ -1347,15 +1498,15 @@ void RoutesSecIndexData::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  sec_routes_data_.Clear();
+  _impl_.sec_routes_data_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RoutesSecIndexData::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* RoutesSecIndexData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .TransCatSerial.RouteData sec_routes_data = 1;
       case 1:
@@ -1400,15 +1551,15 @@ uint8_t* RoutesSecIndexData::_InternalSerialize(
   (void) cached_has_bits;
 
   // repeated .TransCatSerial.RouteData sec_routes_data = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_sec_routes_data_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sec_routes_data_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sec_routes_data(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_sec_routes_data(i), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.RoutesSecIndexData)
@@ -1425,35 +1576,31 @@ size_t RoutesSecIndexData::ByteSizeLong() const {
 
   // repeated .TransCatSerial.RouteData sec_routes_data = 1;
   total_size += 1UL * this->_internal_sec_routes_data_size();
-  for (const auto& msg : this->sec_routes_data_) {
+  for (const auto& msg : this->_impl_.sec_routes_data_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoutesSecIndexData::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     RoutesSecIndexData::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoutesSecIndexData::GetClassData() const { return &_class_data_; }
 
-void RoutesSecIndexData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<RoutesSecIndexData *>(to)->MergeFrom(
-      static_cast<const RoutesSecIndexData &>(from));
-}
-
 
-void RoutesSecIndexData::MergeFrom(const RoutesSecIndexData& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.RoutesSecIndexData)
-  GOOGLE_DCHECK_NE(&from, this);
+void RoutesSecIndexData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoutesSecIndexData*>(&to_msg);
+  auto& from = static_cast<const RoutesSecIndexData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.RoutesSecIndexData)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  sec_routes_data_.MergeFrom(from.sec_routes_data_);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.sec_routes_data_.MergeFrom(from._impl_.sec_routes_data_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RoutesSecIndexData::CopyFrom(const RoutesSecIndexData& from) {
@@ -1470,11 +1617,11 @@ bool RoutesSecIndexData::IsInitialized() const {
 void RoutesSecIndexData::InternalSwap(RoutesSecIndexData* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  sec_routes_data_.InternalSwap(&other->sec_routes_data_);
+  _impl_.sec_routes_data_.InternalSwap(&other->_impl_.sec_routes_data_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata RoutesSecIndexData::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
       file_level_metadata_graph_2eproto[5]);
 }
@@ -1487,43 +1634,47 @@ class RoutesData::_Internal {
 
 RoutesData::RoutesData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  first_routes_data_(arena) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.RoutesData)
 }
 RoutesData::RoutesData(const RoutesData& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      first_routes_data_(from.first_routes_data_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoutesData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.first_routes_data_){from._impl_.first_routes_data_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.RoutesData)
 }
 
-inline void RoutesData::SharedCtor() {
+inline void RoutesData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.first_routes_data_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 RoutesData::~RoutesData() {
   // @@protoc_insertion_point(destructor:TransCatSerial.RoutesData)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void RoutesData::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.first_routes_data_.~RepeatedPtrField();
 }
 
-void RoutesData::ArenaDtor(void* object) {
-  RoutesData* _this = reinterpret_cast< RoutesData* >(object);
-  (void)_this;
-}
-void RoutesData::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void RoutesData::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void RoutesData::Clear() {
@@ -1532,15 +1683,15 @@ void RoutesData::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  first_routes_data_.Clear();
+  _impl_.first_routes_data_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RoutesData::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* RoutesData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .TransCatSerial.RoutesSecIndexData first_routes_data = 1;
       case 1:
@@ -1585,15 +1736,15 @@ uint8_t* RoutesData::_InternalSerialize(
   (void) cached_has_bits;
 
   // repeated .TransCatSerial.RoutesSecIndexData first_routes_data = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_first_routes_data_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_first_routes_data_size()); i < n; i++) {
+    const auto& repfield = this->_internal_first_routes_data(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_first_routes_data(i), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.RoutesData)
@@ -1610,35 +1761,31 @@ size_t RoutesData::ByteSizeLong() const {
 
   // repeated .TransCatSerial.RoutesSecIndexData first_routes_data = 1;
   total_size += 1UL * this->_internal_first_routes_data_size();
-  for (const auto& msg : this->first_routes_data_) {
+  for (const auto& msg : this->_impl_.first_routes_data_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoutesData::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     RoutesData::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoutesData::GetClassData() const { return &_class_data_; }
 
-void RoutesData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<RoutesData *>(to)->MergeFrom(
-      static_cast<const RoutesData &>(from));
-}
-
 
-void RoutesData::MergeFrom(const RoutesData& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.RoutesData)
-  GOOGLE_DCHECK_NE(&from, this);
+void RoutesData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoutesData*>(&to_msg);
+  auto& from = static_cast<const RoutesData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.RoutesData)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  first_routes_data_.MergeFrom(from.first_routes_data_);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.first_routes_data_.MergeFrom(from._impl_.first_routes_data_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RoutesData::CopyFrom(const RoutesData& from) {
@@ -1655,38 +1802,1332 @@ bool RoutesData::IsInitialized() const {
 void RoutesData::InternalSwap(RoutesData* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  first_routes_data_.InternalSwap(&other->first_routes_data_);
+  _impl_.first_routes_data_.InternalSwap(&other->_impl_.first_routes_data_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata RoutesData::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
       file_level_metadata_graph_2eproto[6]);
 }
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace TransCatSerial
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::TransCatSerial::Edge* Arena::CreateMaybeMessage< ::TransCatSerial::Edge >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::TransCatSerial::Edge >(arena);
+// ===================================================================
+
+class PackedRoutesData::_Internal {
+ public:
+};
+
+PackedRoutesData::PackedRoutesData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TransCatSerial.PackedRoutesData)
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::Edges* Arena::CreateMaybeMessage< ::TransCatSerial::Edges >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::TransCatSerial::Edges >(arena);
+PackedRoutesData::PackedRoutesData(const PackedRoutesData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PackedRoutesData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prev_edge_){from._impl_.prev_edge_}
+    , /*decltype(_impl_._prev_edge_cached_byte_size_)*/{0}
+    , decltype(_impl_.prev_edge_delta_){from._impl_.prev_edge_delta_}
+    , /*decltype(_impl_._prev_edge_delta_cached_byte_size_)*/{0}
+    , decltype(_impl_.weight_){from._impl_.weight_}
+    , decltype(_impl_.vertex_count_){}
+    , decltype(_impl_.delta_encoded_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.vertex_count_, &from._impl_.vertex_count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.delta_encoded_) -
+    reinterpret_cast<char*>(&_impl_.vertex_count_)) + sizeof(_impl_.delta_encoded_));
+  // @@protoc_insertion_point(copy_constructor:TransCatSerial.PackedRoutesData)
+}
+
+inline void PackedRoutesData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prev_edge_){arena}
+    , /*decltype(_impl_._prev_edge_cached_byte_size_)*/{0}
+    , decltype(_impl_.prev_edge_delta_){arena}
+    , /*decltype(_impl_._prev_edge_delta_cached_byte_size_)*/{0}
+    , decltype(_impl_.weight_){arena}
+    , decltype(_impl_.vertex_count_){0u}
+    , decltype(_impl_.delta_encoded_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::IncidenceList* Arena::CreateMaybeMessage< ::TransCatSerial::IncidenceList >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::TransCatSerial::IncidenceList >(arena);
+
+PackedRoutesData::~PackedRoutesData() {
+  // @@protoc_insertion_point(destructor:TransCatSerial.PackedRoutesData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::IncidenceLists* Arena::CreateMaybeMessage< ::TransCatSerial::IncidenceLists >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::TransCatSerial::IncidenceLists >(arena);
+
+inline void PackedRoutesData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.prev_edge_.~RepeatedField();
+  _impl_.prev_edge_delta_.~RepeatedField();
+  _impl_.weight_.~RepeatedField();
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::RouteData* Arena::CreateMaybeMessage< ::TransCatSerial::RouteData >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::TransCatSerial::RouteData >(arena);
+
+void PackedRoutesData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::RoutesSecIndexData* Arena::CreateMaybeMessage< ::TransCatSerial::RoutesSecIndexData >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::TransCatSerial::RoutesSecIndexData >(arena);
+
+void PackedRoutesData::Clear() {
+// @@protoc_insertion_point(message_clear_start:TransCatSerial.PackedRoutesData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.prev_edge_.Clear();
+  _impl_.prev_edge_delta_.Clear();
+  _impl_.weight_.Clear();
+  ::memset(&_impl_.vertex_count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.delta_encoded_) -
+      reinterpret_cast<char*>(&_impl_.vertex_count_)) + sizeof(_impl_.delta_encoded_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::RoutesData* Arena::CreateMaybeMessage< ::TransCatSerial::RoutesData >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::TransCatSerial::RoutesData >(arena);
+
+const char* PackedRoutesData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 vertex_count = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.vertex_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool delta_encoded = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.delta_encoded_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 prev_edge = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_prev_edge(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_prev_edge(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 prev_edge_delta = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_prev_edge_delta(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_prev_edge_delta(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double weight = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_weight(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 41) {
+          _internal_add_weight(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PackedRoutesData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TransCatSerial.PackedRoutesData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 vertex_count = 1;
+  if (this->_internal_vertex_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_vertex_count(), target);
+  }
+
+  // bool delta_encoded = 2;
+  if (this->_internal_delta_encoded() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_delta_encoded(), target);
+  }
+
+  // repeated uint32 prev_edge = 3;
+  {
+    int byte_size = _impl_._prev_edge_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_prev_edge(), byte_size, target);
+    }
+  }
+
+  // repeated sint32 prev_edge_delta = 4;
+  {
+    int byte_size = _impl_._prev_edge_delta_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          4, _internal_prev_edge_delta(), byte_size, target);
+    }
+  }
+
+  // repeated double weight = 5;
+  if (this->_internal_weight_size() > 0) {
+    target = stream->WriteFixedPacked(5, _internal_weight(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.PackedRoutesData)
+  return target;
+}
+
+size_t PackedRoutesData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TransCatSerial.PackedRoutesData)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 prev_edge = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.prev_edge_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._prev_edge_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sint32 prev_edge_delta = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.prev_edge_delta_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._prev_edge_delta_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated double weight = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_weight_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // uint32 vertex_count = 1;
+  if (this->_internal_vertex_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_vertex_count());
+  }
+
+  // bool delta_encoded = 2;
+  if (this->_internal_delta_encoded() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PackedRoutesData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PackedRoutesData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PackedRoutesData::GetClassData() const { return &_class_data_; }
+
+
+void PackedRoutesData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PackedRoutesData*>(&to_msg);
+  auto& from = static_cast<const PackedRoutesData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.PackedRoutesData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.prev_edge_.MergeFrom(from._impl_.prev_edge_);
+  _this->_impl_.prev_edge_delta_.MergeFrom(from._impl_.prev_edge_delta_);
+  _this->_impl_.weight_.MergeFrom(from._impl_.weight_);
+  if (from._internal_vertex_count() != 0) {
+    _this->_internal_set_vertex_count(from._internal_vertex_count());
+  }
+  if (from._internal_delta_encoded() != 0) {
+    _this->_internal_set_delta_encoded(from._internal_delta_encoded());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PackedRoutesData::CopyFrom(const PackedRoutesData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TransCatSerial.PackedRoutesData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PackedRoutesData::IsInitialized() const {
+  return true;
+}
+
+void PackedRoutesData::InternalSwap(PackedRoutesData* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.prev_edge_.InternalSwap(&other->_impl_.prev_edge_);
+  _impl_.prev_edge_delta_.InternalSwap(&other->_impl_.prev_edge_delta_);
+  _impl_.weight_.InternalSwap(&other->_impl_.weight_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PackedRoutesData, _impl_.delta_encoded_)
+      + sizeof(PackedRoutesData::_impl_.delta_encoded_)
+      - PROTOBUF_FIELD_OFFSET(PackedRoutesData, _impl_.vertex_count_)>(
+          reinterpret_cast<char*>(&_impl_.vertex_count_),
+          reinterpret_cast<char*>(&other->_impl_.vertex_count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackedRoutesData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
+      file_level_metadata_graph_2eproto[7]);
+}
+
+// ===================================================================
+
+class ContractionHierarchy::_Internal {
+ public:
+};
+
+ContractionHierarchy::ContractionHierarchy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TransCatSerial.ContractionHierarchy)
+}
+ContractionHierarchy::ContractionHierarchy(const ContractionHierarchy& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ContractionHierarchy* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.vertex_rank_){from._impl_.vertex_rank_}
+    , /*decltype(_impl_._vertex_rank_cached_byte_size_)*/{0}
+    , decltype(_impl_.edge_from_){from._impl_.edge_from_}
+    , /*decltype(_impl_._edge_from_cached_byte_size_)*/{0}
+    , decltype(_impl_.edge_to_){from._impl_.edge_to_}
+    , /*decltype(_impl_._edge_to_cached_byte_size_)*/{0}
+    , decltype(_impl_.edge_weight_){from._impl_.edge_weight_}
+    , decltype(_impl_.original_edge_){from._impl_.original_edge_}
+    , /*decltype(_impl_._original_edge_cached_byte_size_)*/{0}
+    , decltype(_impl_.first_child_){from._impl_.first_child_}
+    , /*decltype(_impl_._first_child_cached_byte_size_)*/{0}
+    , decltype(_impl_.second_child_){from._impl_.second_child_}
+    , /*decltype(_impl_._second_child_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:TransCatSerial.ContractionHierarchy)
+}
+
+inline void ContractionHierarchy::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.vertex_rank_){arena}
+    , /*decltype(_impl_._vertex_rank_cached_byte_size_)*/{0}
+    , decltype(_impl_.edge_from_){arena}
+    , /*decltype(_impl_._edge_from_cached_byte_size_)*/{0}
+    , decltype(_impl_.edge_to_){arena}
+    , /*decltype(_impl_._edge_to_cached_byte_size_)*/{0}
+    , decltype(_impl_.edge_weight_){arena}
+    , decltype(_impl_.original_edge_){arena}
+    , /*decltype(_impl_._original_edge_cached_byte_size_)*/{0}
+    , decltype(_impl_.first_child_){arena}
+    , /*decltype(_impl_._first_child_cached_byte_size_)*/{0}
+    , decltype(_impl_.second_child_){arena}
+    , /*decltype(_impl_._second_child_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ContractionHierarchy::~ContractionHierarchy() {
+  // @@protoc_insertion_point(destructor:TransCatSerial.ContractionHierarchy)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ContractionHierarchy::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.vertex_rank_.~RepeatedField();
+  _impl_.edge_from_.~RepeatedField();
+  _impl_.edge_to_.~RepeatedField();
+  _impl_.edge_weight_.~RepeatedField();
+  _impl_.original_edge_.~RepeatedField();
+  _impl_.first_child_.~RepeatedField();
+  _impl_.second_child_.~RepeatedField();
+}
+
+void ContractionHierarchy::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ContractionHierarchy::Clear() {
+// @@protoc_insertion_point(message_clear_start:TransCatSerial.ContractionHierarchy)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.vertex_rank_.Clear();
+  _impl_.edge_from_.Clear();
+  _impl_.edge_to_.Clear();
+  _impl_.edge_weight_.Clear();
+  _impl_.original_edge_.Clear();
+  _impl_.first_child_.Clear();
+  _impl_.second_child_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ContractionHierarchy::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 vertex_rank = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_vertex_rank(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_vertex_rank(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 edge_from = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_edge_from(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_edge_from(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 edge_to = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_edge_to(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_edge_to(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double edge_weight = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_edge_weight(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 33) {
+          _internal_add_edge_weight(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 original_edge = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_original_edge(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_original_edge(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 first_child = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_first_child(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_first_child(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 second_child = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_second_child(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 56) {
+          _internal_add_second_child(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ContractionHierarchy::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TransCatSerial.ContractionHierarchy)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 vertex_rank = 1;
+  {
+    int byte_size = _impl_._vertex_rank_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_vertex_rank(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 edge_from = 2;
+  {
+    int byte_size = _impl_._edge_from_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_edge_from(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 edge_to = 3;
+  {
+    int byte_size = _impl_._edge_to_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_edge_to(), byte_size, target);
+    }
+  }
+
+  // repeated double edge_weight = 4;
+  if (this->_internal_edge_weight_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_edge_weight(), target);
+  }
+
+  // repeated uint32 original_edge = 5;
+  {
+    int byte_size = _impl_._original_edge_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          5, _internal_original_edge(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 first_child = 6;
+  {
+    int byte_size = _impl_._first_child_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          6, _internal_first_child(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 second_child = 7;
+  {
+    int byte_size = _impl_._second_child_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          7, _internal_second_child(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.ContractionHierarchy)
+  return target;
+}
+
+size_t ContractionHierarchy::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TransCatSerial.ContractionHierarchy)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 vertex_rank = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.vertex_rank_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._vertex_rank_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 edge_from = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.edge_from_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._edge_from_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 edge_to = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.edge_to_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._edge_to_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated double edge_weight = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_edge_weight_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated uint32 original_edge = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.original_edge_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._original_edge_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 first_child = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.first_child_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._first_child_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 second_child = 7;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.second_child_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._second_child_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ContractionHierarchy::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ContractionHierarchy::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ContractionHierarchy::GetClassData() const { return &_class_data_; }
+
+
+void ContractionHierarchy::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ContractionHierarchy*>(&to_msg);
+  auto& from = static_cast<const ContractionHierarchy&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.ContractionHierarchy)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.vertex_rank_.MergeFrom(from._impl_.vertex_rank_);
+  _this->_impl_.edge_from_.MergeFrom(from._impl_.edge_from_);
+  _this->_impl_.edge_to_.MergeFrom(from._impl_.edge_to_);
+  _this->_impl_.edge_weight_.MergeFrom(from._impl_.edge_weight_);
+  _this->_impl_.original_edge_.MergeFrom(from._impl_.original_edge_);
+  _this->_impl_.first_child_.MergeFrom(from._impl_.first_child_);
+  _this->_impl_.second_child_.MergeFrom(from._impl_.second_child_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ContractionHierarchy::CopyFrom(const ContractionHierarchy& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TransCatSerial.ContractionHierarchy)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ContractionHierarchy::IsInitialized() const {
+  return true;
+}
+
+void ContractionHierarchy::InternalSwap(ContractionHierarchy* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.vertex_rank_.InternalSwap(&other->_impl_.vertex_rank_);
+  _impl_.edge_from_.InternalSwap(&other->_impl_.edge_from_);
+  _impl_.edge_to_.InternalSwap(&other->_impl_.edge_to_);
+  _impl_.edge_weight_.InternalSwap(&other->_impl_.edge_weight_);
+  _impl_.original_edge_.InternalSwap(&other->_impl_.original_edge_);
+  _impl_.first_child_.InternalSwap(&other->_impl_.first_child_);
+  _impl_.second_child_.InternalSwap(&other->_impl_.second_child_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ContractionHierarchy::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
+      file_level_metadata_graph_2eproto[8]);
+}
+
+// ===================================================================
+
+class HubLabels::_Internal {
+ public:
+};
+
+HubLabels::HubLabels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TransCatSerial.HubLabels)
+}
+HubLabels::HubLabels(const HubLabels& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HubLabels* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hub_vertex_){from._impl_.hub_vertex_}
+    , /*decltype(_impl_._hub_vertex_cached_byte_size_)*/{0}
+    , decltype(_impl_.in_label_count_){from._impl_.in_label_count_}
+    , /*decltype(_impl_._in_label_count_cached_byte_size_)*/{0}
+    , decltype(_impl_.in_hub_delta_){from._impl_.in_hub_delta_}
+    , /*decltype(_impl_._in_hub_delta_cached_byte_size_)*/{0}
+    , decltype(_impl_.in_weight_){from._impl_.in_weight_}
+    , decltype(_impl_.in_edge_){from._impl_.in_edge_}
+    , /*decltype(_impl_._in_edge_cached_byte_size_)*/{0}
+    , decltype(_impl_.out_label_count_){from._impl_.out_label_count_}
+    , /*decltype(_impl_._out_label_count_cached_byte_size_)*/{0}
+    , decltype(_impl_.out_hub_delta_){from._impl_.out_hub_delta_}
+    , /*decltype(_impl_._out_hub_delta_cached_byte_size_)*/{0}
+    , decltype(_impl_.out_weight_){from._impl_.out_weight_}
+    , decltype(_impl_.out_edge_){from._impl_.out_edge_}
+    , /*decltype(_impl_._out_edge_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:TransCatSerial.HubLabels)
+}
+
+inline void HubLabels::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hub_vertex_){arena}
+    , /*decltype(_impl_._hub_vertex_cached_byte_size_)*/{0}
+    , decltype(_impl_.in_label_count_){arena}
+    , /*decltype(_impl_._in_label_count_cached_byte_size_)*/{0}
+    , decltype(_impl_.in_hub_delta_){arena}
+    , /*decltype(_impl_._in_hub_delta_cached_byte_size_)*/{0}
+    , decltype(_impl_.in_weight_){arena}
+    , decltype(_impl_.in_edge_){arena}
+    , /*decltype(_impl_._in_edge_cached_byte_size_)*/{0}
+    , decltype(_impl_.out_label_count_){arena}
+    , /*decltype(_impl_._out_label_count_cached_byte_size_)*/{0}
+    , decltype(_impl_.out_hub_delta_){arena}
+    , /*decltype(_impl_._out_hub_delta_cached_byte_size_)*/{0}
+    , decltype(_impl_.out_weight_){arena}
+    , decltype(_impl_.out_edge_){arena}
+    , /*decltype(_impl_._out_edge_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+HubLabels::~HubLabels() {
+  // @@protoc_insertion_point(destructor:TransCatSerial.HubLabels)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HubLabels::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hub_vertex_.~RepeatedField();
+  _impl_.in_label_count_.~RepeatedField();
+  _impl_.in_hub_delta_.~RepeatedField();
+  _impl_.in_weight_.~RepeatedField();
+  _impl_.in_edge_.~RepeatedField();
+  _impl_.out_label_count_.~RepeatedField();
+  _impl_.out_hub_delta_.~RepeatedField();
+  _impl_.out_weight_.~RepeatedField();
+  _impl_.out_edge_.~RepeatedField();
+}
+
+void HubLabels::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HubLabels::Clear() {
+// @@protoc_insertion_point(message_clear_start:TransCatSerial.HubLabels)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.hub_vertex_.Clear();
+  _impl_.in_label_count_.Clear();
+  _impl_.in_hub_delta_.Clear();
+  _impl_.in_weight_.Clear();
+  _impl_.in_edge_.Clear();
+  _impl_.out_label_count_.Clear();
+  _impl_.out_hub_delta_.Clear();
+  _impl_.out_weight_.Clear();
+  _impl_.out_edge_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HubLabels::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 hub_vertex = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_hub_vertex(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_hub_vertex(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 in_label_count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_in_label_count(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_in_label_count(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 in_hub_delta = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_in_hub_delta(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_in_hub_delta(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double in_weight = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_in_weight(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 33) {
+          _internal_add_in_weight(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 in_edge = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_in_edge(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_in_edge(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 out_label_count = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_out_label_count(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_out_label_count(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 out_hub_delta = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_out_hub_delta(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 56) {
+          _internal_add_out_hub_delta(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double out_weight = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_out_weight(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 65) {
+          _internal_add_out_weight(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 out_edge = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_out_edge(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 72) {
+          _internal_add_out_edge(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HubLabels::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TransCatSerial.HubLabels)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 hub_vertex = 1;
+  {
+    int byte_size = _impl_._hub_vertex_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_hub_vertex(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 in_label_count = 2;
+  {
+    int byte_size = _impl_._in_label_count_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_in_label_count(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 in_hub_delta = 3;
+  {
+    int byte_size = _impl_._in_hub_delta_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_in_hub_delta(), byte_size, target);
+    }
+  }
+
+  // repeated double in_weight = 4;
+  if (this->_internal_in_weight_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_in_weight(), target);
+  }
+
+  // repeated uint32 in_edge = 5;
+  {
+    int byte_size = _impl_._in_edge_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          5, _internal_in_edge(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 out_label_count = 6;
+  {
+    int byte_size = _impl_._out_label_count_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          6, _internal_out_label_count(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 out_hub_delta = 7;
+  {
+    int byte_size = _impl_._out_hub_delta_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          7, _internal_out_hub_delta(), byte_size, target);
+    }
+  }
+
+  // repeated double out_weight = 8;
+  if (this->_internal_out_weight_size() > 0) {
+    target = stream->WriteFixedPacked(8, _internal_out_weight(), target);
+  }
+
+  // repeated uint32 out_edge = 9;
+  {
+    int byte_size = _impl_._out_edge_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          9, _internal_out_edge(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.HubLabels)
+  return target;
+}
+
+size_t HubLabels::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TransCatSerial.HubLabels)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 hub_vertex = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.hub_vertex_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._hub_vertex_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 in_label_count = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.in_label_count_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._in_label_count_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 in_hub_delta = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.in_hub_delta_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._in_hub_delta_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated double in_weight = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_in_weight_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated uint32 in_edge = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.in_edge_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._in_edge_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 out_label_count = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.out_label_count_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._out_label_count_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 out_hub_delta = 7;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.out_hub_delta_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._out_hub_delta_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated double out_weight = 8;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_out_weight_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated uint32 out_edge = 9;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.out_edge_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._out_edge_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HubLabels::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HubLabels::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HubLabels::GetClassData() const { return &_class_data_; }
+
+
+void HubLabels::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HubLabels*>(&to_msg);
+  auto& from = static_cast<const HubLabels&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.HubLabels)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.hub_vertex_.MergeFrom(from._impl_.hub_vertex_);
+  _this->_impl_.in_label_count_.MergeFrom(from._impl_.in_label_count_);
+  _this->_impl_.in_hub_delta_.MergeFrom(from._impl_.in_hub_delta_);
+  _this->_impl_.in_weight_.MergeFrom(from._impl_.in_weight_);
+  _this->_impl_.in_edge_.MergeFrom(from._impl_.in_edge_);
+  _this->_impl_.out_label_count_.MergeFrom(from._impl_.out_label_count_);
+  _this->_impl_.out_hub_delta_.MergeFrom(from._impl_.out_hub_delta_);
+  _this->_impl_.out_weight_.MergeFrom(from._impl_.out_weight_);
+  _this->_impl_.out_edge_.MergeFrom(from._impl_.out_edge_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HubLabels::CopyFrom(const HubLabels& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TransCatSerial.HubLabels)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HubLabels::IsInitialized() const {
+  return true;
+}
+
+void HubLabels::InternalSwap(HubLabels* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.hub_vertex_.InternalSwap(&other->_impl_.hub_vertex_);
+  _impl_.in_label_count_.InternalSwap(&other->_impl_.in_label_count_);
+  _impl_.in_hub_delta_.InternalSwap(&other->_impl_.in_hub_delta_);
+  _impl_.in_weight_.InternalSwap(&other->_impl_.in_weight_);
+  _impl_.in_edge_.InternalSwap(&other->_impl_.in_edge_);
+  _impl_.out_label_count_.InternalSwap(&other->_impl_.out_label_count_);
+  _impl_.out_hub_delta_.InternalSwap(&other->_impl_.out_hub_delta_);
+  _impl_.out_weight_.InternalSwap(&other->_impl_.out_weight_);
+  _impl_.out_edge_.InternalSwap(&other->_impl_.out_edge_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HubLabels::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
+      file_level_metadata_graph_2eproto[9]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace TransCatSerial
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::TransCatSerial::Edge*
+Arena::CreateMaybeMessage< ::TransCatSerial::Edge >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TransCatSerial::Edge >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TransCatSerial::Edges*
+Arena::CreateMaybeMessage< ::TransCatSerial::Edges >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TransCatSerial::Edges >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TransCatSerial::IncidenceList*
+Arena::CreateMaybeMessage< ::TransCatSerial::IncidenceList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TransCatSerial::IncidenceList >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TransCatSerial::IncidenceLists*
+Arena::CreateMaybeMessage< ::TransCatSerial::IncidenceLists >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TransCatSerial::IncidenceLists >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TransCatSerial::RouteData*
+Arena::CreateMaybeMessage< ::TransCatSerial::RouteData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TransCatSerial::RouteData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TransCatSerial::RoutesSecIndexData*
+Arena::CreateMaybeMessage< ::TransCatSerial::RoutesSecIndexData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TransCatSerial::RoutesSecIndexData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TransCatSerial::RoutesData*
+Arena::CreateMaybeMessage< ::TransCatSerial::RoutesData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TransCatSerial::RoutesData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TransCatSerial::PackedRoutesData*
+Arena::CreateMaybeMessage< ::TransCatSerial::PackedRoutesData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TransCatSerial::PackedRoutesData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TransCatSerial::ContractionHierarchy*
+Arena::CreateMaybeMessage< ::TransCatSerial::ContractionHierarchy >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TransCatSerial::ContractionHierarchy >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TransCatSerial::HubLabels*
+Arena::CreateMaybeMessage< ::TransCatSerial::HubLabels >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TransCatSerial::HubLabels >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3019000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3019003 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -42,30 +41,31 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_graph_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[7]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
   static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_graph_2eproto;
 namespace TransCatSerial {
+class ContractionHierarchy;
+struct ContractionHierarchyDefaultTypeInternal;
+extern ContractionHierarchyDefaultTypeInternal _ContractionHierarchy_default_instance_;
 class Edge;
 struct EdgeDefaultTypeInternal;
 extern EdgeDefaultTypeInternal _Edge_default_instance_;
 class Edges;
 struct EdgesDefaultTypeInternal;
 extern EdgesDefaultTypeInternal _Edges_default_instance_;
+class HubLabels;
+struct HubLabelsDefaultTypeInternal;
+extern HubLabelsDefaultTypeInternal _HubLabels_default_instance_;
 class IncidenceList;
 struct IncidenceListDefaultTypeInternal;
 extern IncidenceListDefaultTypeInternal _IncidenceList_default_instance_;
 class IncidenceLists;
 struct IncidenceListsDefaultTypeInternal;
 extern IncidenceListsDefaultTypeInternal _IncidenceLists_default_instance_;
+class PackedRoutesData;
+struct PackedRoutesDataDefaultTypeInternal;
+extern PackedRoutesDataDefaultTypeInternal _PackedRoutesData_default_instance_;
 class RouteData;
 struct RouteDataDefaultTypeInternal;
 extern RouteDataDefaultTypeInternal _RouteData_default_instance_;
@@ -77,10 +77,13 @@ struct RoutesSecIndexDataDefaultTypeInternal;
 extern RoutesSecIndexDataDefaultTypeInternal _RoutesSecIndexData_default_instance_;
 }  // namespace TransCatSerial
 PROTOBUF_NAMESPACE_OPEN
+template<> ::TransCatSerial::ContractionHierarchy* Arena::CreateMaybeMessage<::TransCatSerial::ContractionHierarchy>(Arena*);
 template<> ::TransCatSerial::Edge* Arena::CreateMaybeMessage<::TransCatSerial::Edge>(Arena*);
 template<> ::TransCatSerial::Edges* Arena::CreateMaybeMessage<::TransCatSerial::Edges>(Arena*);
+template<> ::TransCatSerial::HubLabels* Arena::CreateMaybeMessage<::TransCatSerial::HubLabels>(Arena*);
 template<> ::TransCatSerial::IncidenceList* Arena::CreateMaybeMessage<::TransCatSerial::IncidenceList>(Arena*);
 template<> ::TransCatSerial::IncidenceLists* Arena::CreateMaybeMessage<::TransCatSerial::IncidenceLists>(Arena*);
+template<> ::TransCatSerial::PackedRoutesData* Arena::CreateMaybeMessage<::TransCatSerial::PackedRoutesData>(Arena*);
 template<> ::TransCatSerial::RouteData* Arena::CreateMaybeMessage<::TransCatSerial::RouteData>(Arena*);
 template<> ::TransCatSerial::RoutesData* Arena::CreateMaybeMessage<::TransCatSerial::RoutesData>(Arena*);
 template<> ::TransCatSerial::RoutesSecIndexData* Arena::CreateMaybeMessage<::TransCatSerial::RoutesSecIndexData>(Arena*);
@@ -94,7 +97,7 @@ class Edge final :
  public:
   inline Edge() : Edge(nullptr) {}
   ~Edge() override;
-  explicit constexpr Edge(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR Edge(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Edge(const Edge& from);
   Edge(Edge&& from) noexcept
@@ -169,9 +172,11 @@ class Edge final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Edge& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Edge& from);
+  void MergeFrom( const Edge& from) {
+    Edge::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -180,10 +185,10 @@ class Edge final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Edge* other);
@@ -196,9 +201,6 @@ class Edge final :
   protected:
   explicit Edge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -249,10 +251,13 @@ class Edge final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  uint32_t from_;
-  uint32_t to_;
-  double weight_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint32_t from_;
+    uint32_t to_;
+    double weight_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_graph_2eproto;
 };
 // -------------------------------------------------------------------
@@ -262,7 +267,7 @@ class Edges final :
  public:
   inline Edges() : Edges(nullptr) {}
   ~Edges() override;
-  explicit constexpr Edges(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR Edges(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Edges(const Edges& from);
   Edges(Edges&& from) noexcept
@@ -337,9 +342,11 @@ class Edges final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Edges& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Edges& from);
+  void MergeFrom( const Edges& from) {
+    Edges::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -348,10 +355,10 @@ class Edges final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Edges* other);
@@ -364,9 +371,6 @@ class Edges final :
   protected:
   explicit Edges(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -406,8 +410,11 @@ class Edges final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Edge > edges_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Edge > edges_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_graph_2eproto;
 };
 // -------------------------------------------------------------------
@@ -417,7 +424,7 @@ class IncidenceList final :
  public:
   inline IncidenceList() : IncidenceList(nullptr) {}
   ~IncidenceList() override;
-  explicit constexpr IncidenceList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR IncidenceList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   IncidenceList(const IncidenceList& from);
   IncidenceList(IncidenceList&& from) noexcept
@@ -492,9 +499,11 @@ class IncidenceList final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const IncidenceList& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const IncidenceList& from);
+  void MergeFrom( const IncidenceList& from) {
+    IncidenceList::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -503,10 +512,10 @@ class IncidenceList final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(IncidenceList* other);
@@ -519,9 +528,6 @@ class IncidenceList final :
   protected:
   explicit IncidenceList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -565,9 +571,12 @@ class IncidenceList final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > edge_id_;
-  mutable std::atomic<int> _edge_id_cached_byte_size_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > edge_id_;
+    mutable std::atomic<int> _edge_id_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_graph_2eproto;
 };
 // -------------------------------------------------------------------
@@ -577,7 +586,7 @@ class IncidenceLists final :
  public:
   inline IncidenceLists() : IncidenceLists(nullptr) {}
   ~IncidenceLists() override;
-  explicit constexpr IncidenceLists(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR IncidenceLists(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   IncidenceLists(const IncidenceLists& from);
   IncidenceLists(IncidenceLists&& from) noexcept
@@ -652,9 +661,11 @@ class IncidenceLists final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const IncidenceLists& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const IncidenceLists& from);
+  void MergeFrom( const IncidenceLists& from) {
+    IncidenceLists::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -663,10 +674,10 @@ class IncidenceLists final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(IncidenceLists* other);
@@ -679,9 +690,6 @@ class IncidenceLists final :
   protected:
   explicit IncidenceLists(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -721,8 +729,11 @@ class IncidenceLists final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::IncidenceList > incidence_list_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::IncidenceList > incidence_list_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_graph_2eproto;
 };
 // -------------------------------------------------------------------
@@ -732,7 +743,7 @@ class RouteData final :
  public:
   inline RouteData() : RouteData(nullptr) {}
   ~RouteData() override;
-  explicit constexpr RouteData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR RouteData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RouteData(const RouteData& from);
   RouteData(RouteData&& from) noexcept
@@ -807,9 +818,11 @@ class RouteData final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RouteData& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const RouteData& from);
+  void MergeFrom( const RouteData& from) {
+    RouteData::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -818,10 +831,10 @@ class RouteData final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RouteData* other);
@@ -834,9 +847,6 @@ class RouteData final :
   protected:
   explicit RouteData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -897,11 +907,14 @@ class RouteData final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  double weight_;
-  bool has_value_;
-  bool has_prev_edge_value_;
-  uint32_t prev_edge_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    double weight_;
+    bool has_value_;
+    bool has_prev_edge_value_;
+    uint32_t prev_edge_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_graph_2eproto;
 };
 // -------------------------------------------------------------------
@@ -911,7 +924,7 @@ class RoutesSecIndexData final :
  public:
   inline RoutesSecIndexData() : RoutesSecIndexData(nullptr) {}
   ~RoutesSecIndexData() override;
-  explicit constexpr RoutesSecIndexData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR RoutesSecIndexData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RoutesSecIndexData(const RoutesSecIndexData& from);
   RoutesSecIndexData(RoutesSecIndexData&& from) noexcept
@@ -986,9 +999,11 @@ class RoutesSecIndexData final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RoutesSecIndexData& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const RoutesSecIndexData& from);
+  void MergeFrom( const RoutesSecIndexData& from) {
+    RoutesSecIndexData::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -997,10 +1012,10 @@ class RoutesSecIndexData final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RoutesSecIndexData* other);
@@ -1013,9 +1028,6 @@ class RoutesSecIndexData final :
   protected:
   explicit RoutesSecIndexData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -1055,8 +1067,11 @@ class RoutesSecIndexData final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::RouteData > sec_routes_data_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::RouteData > sec_routes_data_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_graph_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1066,7 +1081,7 @@ class RoutesData final :
  public:
   inline RoutesData() : RoutesData(nullptr) {}
   ~RoutesData() override;
-  explicit constexpr RoutesData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR RoutesData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RoutesData(const RoutesData& from);
   RoutesData(RoutesData&& from) noexcept
@@ -1141,9 +1156,11 @@ class RoutesData final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RoutesData& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const RoutesData& from);
+  void MergeFrom( const RoutesData& from) {
+    RoutesData::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1152,10 +1169,10 @@ class RoutesData final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RoutesData* other);
@@ -1168,9 +1185,6 @@ class RoutesData final :
   protected:
   explicit RoutesData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -1210,390 +1224,2242 @@ class RoutesData final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::RoutesSecIndexData > first_routes_data_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::RoutesSecIndexData > first_routes_data_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_graph_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class PackedRoutesData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TransCatSerial.PackedRoutesData) */ {
+ public:
+  inline PackedRoutesData() : PackedRoutesData(nullptr) {}
+  ~PackedRoutesData() override;
+  explicit PROTOBUF_CONSTEXPR PackedRoutesData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  PackedRoutesData(const PackedRoutesData& from);
+  PackedRoutesData(PackedRoutesData&& from) noexcept
+    : PackedRoutesData() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Edge
+  inline PackedRoutesData& operator=(const PackedRoutesData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PackedRoutesData& operator=(PackedRoutesData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// uint32 from = 1;
-inline void Edge::clear_from() {
-  from_ = 0u;
-}
-inline uint32_t Edge::_internal_from() const {
-  return from_;
-}
-inline uint32_t Edge::from() const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.Edge.from)
-  return _internal_from();
-}
-inline void Edge::_internal_set_from(uint32_t value) {
-  
-  from_ = value;
-}
-inline void Edge::set_from(uint32_t value) {
-  _internal_set_from(value);
-  // @@protoc_insertion_point(field_set:TransCatSerial.Edge.from)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PackedRoutesData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PackedRoutesData* internal_default_instance() {
+    return reinterpret_cast<const PackedRoutesData*>(
+               &_PackedRoutesData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-// uint32 to = 2;
-inline void Edge::clear_to() {
-  to_ = 0u;
-}
-inline uint32_t Edge::_internal_to() const {
-  return to_;
-}
-inline uint32_t Edge::to() const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.Edge.to)
-  return _internal_to();
-}
-inline void Edge::_internal_set_to(uint32_t value) {
-  
-  to_ = value;
-}
-inline void Edge::set_to(uint32_t value) {
-  _internal_set_to(value);
-  // @@protoc_insertion_point(field_set:TransCatSerial.Edge.to)
-}
+  friend void swap(PackedRoutesData& a, PackedRoutesData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackedRoutesData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PackedRoutesData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// double weight = 3;
-inline void Edge::clear_weight() {
-  weight_ = 0;
-}
-inline double Edge::_internal_weight() const {
-  return weight_;
-}
-inline double Edge::weight() const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.Edge.weight)
-  return _internal_weight();
-}
-inline void Edge::_internal_set_weight(double value) {
-  
-  weight_ = value;
-}
-inline void Edge::set_weight(double value) {
-  _internal_set_weight(value);
-  // @@protoc_insertion_point(field_set:TransCatSerial.Edge.weight)
-}
+  // implements Message ----------------------------------------------
 
-// -------------------------------------------------------------------
+  PackedRoutesData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PackedRoutesData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PackedRoutesData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PackedRoutesData& from) {
+    PackedRoutesData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// Edges
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// repeated .TransCatSerial.Edge edges = 1;
-inline int Edges::_internal_edges_size() const {
-  return edges_.size();
-}
-inline int Edges::edges_size() const {
-  return _internal_edges_size();
-}
-inline void Edges::clear_edges() {
-  edges_.Clear();
-}
-inline ::TransCatSerial::Edge* Edges::mutable_edges(int index) {
-  // @@protoc_insertion_point(field_mutable:TransCatSerial.Edges.edges)
-  return edges_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Edge >*
-Edges::mutable_edges() {
-  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.Edges.edges)
-  return &edges_;
-}
-inline const ::TransCatSerial::Edge& Edges::_internal_edges(int index) const {
-  return edges_.Get(index);
-}
-inline const ::TransCatSerial::Edge& Edges::edges(int index) const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.Edges.edges)
-  return _internal_edges(index);
-}
-inline ::TransCatSerial::Edge* Edges::_internal_add_edges() {
-  return edges_.Add();
-}
-inline ::TransCatSerial::Edge* Edges::add_edges() {
-  ::TransCatSerial::Edge* _add = _internal_add_edges();
-  // @@protoc_insertion_point(field_add:TransCatSerial.Edges.edges)
-  return _add;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Edge >&
-Edges::edges() const {
-  // @@protoc_insertion_point(field_list:TransCatSerial.Edges.edges)
-  return edges_;
-}
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PackedRoutesData* other);
 
-// -------------------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TransCatSerial.PackedRoutesData";
+  }
+  protected:
+  explicit PackedRoutesData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-// IncidenceList
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-// repeated uint32 edge_id = 1;
-inline int IncidenceList::_internal_edge_id_size() const {
-  return edge_id_.size();
-}
-inline int IncidenceList::edge_id_size() const {
-  return _internal_edge_id_size();
-}
-inline void IncidenceList::clear_edge_id() {
-  edge_id_.Clear();
-}
-inline uint32_t IncidenceList::_internal_edge_id(int index) const {
-  return edge_id_.Get(index);
-}
-inline uint32_t IncidenceList::edge_id(int index) const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.IncidenceList.edge_id)
-  return _internal_edge_id(index);
-}
-inline void IncidenceList::set_edge_id(int index, uint32_t value) {
-  edge_id_.Set(index, value);
-  // @@protoc_insertion_point(field_set:TransCatSerial.IncidenceList.edge_id)
-}
-inline void IncidenceList::_internal_add_edge_id(uint32_t value) {
-  edge_id_.Add(value);
-}
-inline void IncidenceList::add_edge_id(uint32_t value) {
-  _internal_add_edge_id(value);
-  // @@protoc_insertion_point(field_add:TransCatSerial.IncidenceList.edge_id)
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
-IncidenceList::_internal_edge_id() const {
-  return edge_id_;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
-IncidenceList::edge_id() const {
-  // @@protoc_insertion_point(field_list:TransCatSerial.IncidenceList.edge_id)
-  return _internal_edge_id();
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
-IncidenceList::_internal_mutable_edge_id() {
-  return &edge_id_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
-IncidenceList::mutable_edge_id() {
-  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.IncidenceList.edge_id)
-  return _internal_mutable_edge_id();
-}
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-// -------------------------------------------------------------------
+  // nested types ----------------------------------------------------
 
-// IncidenceLists
+  // accessors -------------------------------------------------------
 
-// repeated .TransCatSerial.IncidenceList incidence_list = 1;
-inline int IncidenceLists::_internal_incidence_list_size() const {
-  return incidence_list_.size();
-}
-inline int IncidenceLists::incidence_list_size() const {
-  return _internal_incidence_list_size();
-}
-inline void IncidenceLists::clear_incidence_list() {
-  incidence_list_.Clear();
-}
-inline ::TransCatSerial::IncidenceList* IncidenceLists::mutable_incidence_list(int index) {
-  // @@protoc_insertion_point(field_mutable:TransCatSerial.IncidenceLists.incidence_list)
-  return incidence_list_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::IncidenceList >*
-IncidenceLists::mutable_incidence_list() {
-  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.IncidenceLists.incidence_list)
-  return &incidence_list_;
-}
-inline const ::TransCatSerial::IncidenceList& IncidenceLists::_internal_incidence_list(int index) const {
-  return incidence_list_.Get(index);
-}
-inline const ::TransCatSerial::IncidenceList& IncidenceLists::incidence_list(int index) const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.IncidenceLists.incidence_list)
-  return _internal_incidence_list(index);
-}
-inline ::TransCatSerial::IncidenceList* IncidenceLists::_internal_add_incidence_list() {
-  return incidence_list_.Add();
-}
-inline ::TransCatSerial::IncidenceList* IncidenceLists::add_incidence_list() {
-  ::TransCatSerial::IncidenceList* _add = _internal_add_incidence_list();
+  enum : int {
+    kPrevEdgeFieldNumber = 3,
+    kPrevEdgeDeltaFieldNumber = 4,
+    kWeightFieldNumber = 5,
+    kVertexCountFieldNumber = 1,
+    kDeltaEncodedFieldNumber = 2,
+  };
+  // repeated uint32 prev_edge = 3;
+  int prev_edge_size() const;
+  private:
+  int _internal_prev_edge_size() const;
+  public:
+  void clear_prev_edge();
+  private:
+  uint32_t _internal_prev_edge(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_prev_edge() const;
+  void _internal_add_prev_edge(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_prev_edge();
+  public:
+  uint32_t prev_edge(int index) const;
+  void set_prev_edge(int index, uint32_t value);
+  void add_prev_edge(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      prev_edge() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_prev_edge();
+
+  // repeated sint32 prev_edge_delta = 4;
+  int prev_edge_delta_size() const;
+  private:
+  int _internal_prev_edge_delta_size() const;
+  public:
+  void clear_prev_edge_delta();
+  private:
+  int32_t _internal_prev_edge_delta(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_prev_edge_delta() const;
+  void _internal_add_prev_edge_delta(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_prev_edge_delta();
+  public:
+  int32_t prev_edge_delta(int index) const;
+  void set_prev_edge_delta(int index, int32_t value);
+  void add_prev_edge_delta(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      prev_edge_delta() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_prev_edge_delta();
+
+  // repeated double weight = 5;
+  int weight_size() const;
+  private:
+  int _internal_weight_size() const;
+  public:
+  void clear_weight();
+  private:
+  double _internal_weight(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_weight() const;
+  void _internal_add_weight(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_weight();
+  public:
+  double weight(int index) const;
+  void set_weight(int index, double value);
+  void add_weight(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      weight() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_weight();
+
+  // uint32 vertex_count = 1;
+  void clear_vertex_count();
+  uint32_t vertex_count() const;
+  void set_vertex_count(uint32_t value);
+  private:
+  uint32_t _internal_vertex_count() const;
+  void _internal_set_vertex_count(uint32_t value);
+  public:
+
+  // bool delta_encoded = 2;
+  void clear_delta_encoded();
+  bool delta_encoded() const;
+  void set_delta_encoded(bool value);
+  private:
+  bool _internal_delta_encoded() const;
+  void _internal_set_delta_encoded(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TransCatSerial.PackedRoutesData)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > prev_edge_;
+    mutable std::atomic<int> _prev_edge_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > prev_edge_delta_;
+    mutable std::atomic<int> _prev_edge_delta_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > weight_;
+    uint32_t vertex_count_;
+    bool delta_encoded_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_graph_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ContractionHierarchy final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TransCatSerial.ContractionHierarchy) */ {
+ public:
+  inline ContractionHierarchy() : ContractionHierarchy(nullptr) {}
+  ~ContractionHierarchy() override;
+  explicit PROTOBUF_CONSTEXPR ContractionHierarchy(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ContractionHierarchy(const ContractionHierarchy& from);
+  ContractionHierarchy(ContractionHierarchy&& from) noexcept
+    : ContractionHierarchy() {
+    *this = ::std::move(from);
+  }
+
+  inline ContractionHierarchy& operator=(const ContractionHierarchy& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ContractionHierarchy& operator=(ContractionHierarchy&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ContractionHierarchy& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ContractionHierarchy* internal_default_instance() {
+    return reinterpret_cast<const ContractionHierarchy*>(
+               &_ContractionHierarchy_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(ContractionHierarchy& a, ContractionHierarchy& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ContractionHierarchy* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ContractionHierarchy* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ContractionHierarchy* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ContractionHierarchy>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ContractionHierarchy& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ContractionHierarchy& from) {
+    ContractionHierarchy::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ContractionHierarchy* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TransCatSerial.ContractionHierarchy";
+  }
+  protected:
+  explicit ContractionHierarchy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVertexRankFieldNumber = 1,
+    kEdgeFromFieldNumber = 2,
+    kEdgeToFieldNumber = 3,
+    kEdgeWeightFieldNumber = 4,
+    kOriginalEdgeFieldNumber = 5,
+    kFirstChildFieldNumber = 6,
+    kSecondChildFieldNumber = 7,
+  };
+  // repeated uint32 vertex_rank = 1;
+  int vertex_rank_size() const;
+  private:
+  int _internal_vertex_rank_size() const;
+  public:
+  void clear_vertex_rank();
+  private:
+  uint32_t _internal_vertex_rank(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_vertex_rank() const;
+  void _internal_add_vertex_rank(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_vertex_rank();
+  public:
+  uint32_t vertex_rank(int index) const;
+  void set_vertex_rank(int index, uint32_t value);
+  void add_vertex_rank(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      vertex_rank() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_vertex_rank();
+
+  // repeated uint32 edge_from = 2;
+  int edge_from_size() const;
+  private:
+  int _internal_edge_from_size() const;
+  public:
+  void clear_edge_from();
+  private:
+  uint32_t _internal_edge_from(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_edge_from() const;
+  void _internal_add_edge_from(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_edge_from();
+  public:
+  uint32_t edge_from(int index) const;
+  void set_edge_from(int index, uint32_t value);
+  void add_edge_from(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      edge_from() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_edge_from();
+
+  // repeated uint32 edge_to = 3;
+  int edge_to_size() const;
+  private:
+  int _internal_edge_to_size() const;
+  public:
+  void clear_edge_to();
+  private:
+  uint32_t _internal_edge_to(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_edge_to() const;
+  void _internal_add_edge_to(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_edge_to();
+  public:
+  uint32_t edge_to(int index) const;
+  void set_edge_to(int index, uint32_t value);
+  void add_edge_to(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      edge_to() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_edge_to();
+
+  // repeated double edge_weight = 4;
+  int edge_weight_size() const;
+  private:
+  int _internal_edge_weight_size() const;
+  public:
+  void clear_edge_weight();
+  private:
+  double _internal_edge_weight(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_edge_weight() const;
+  void _internal_add_edge_weight(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_edge_weight();
+  public:
+  double edge_weight(int index) const;
+  void set_edge_weight(int index, double value);
+  void add_edge_weight(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      edge_weight() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_edge_weight();
+
+  // repeated uint32 original_edge = 5;
+  int original_edge_size() const;
+  private:
+  int _internal_original_edge_size() const;
+  public:
+  void clear_original_edge();
+  private:
+  uint32_t _internal_original_edge(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_original_edge() const;
+  void _internal_add_original_edge(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_original_edge();
+  public:
+  uint32_t original_edge(int index) const;
+  void set_original_edge(int index, uint32_t value);
+  void add_original_edge(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      original_edge() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_original_edge();
+
+  // repeated uint32 first_child = 6;
+  int first_child_size() const;
+  private:
+  int _internal_first_child_size() const;
+  public:
+  void clear_first_child();
+  private:
+  uint32_t _internal_first_child(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_first_child() const;
+  void _internal_add_first_child(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_first_child();
+  public:
+  uint32_t first_child(int index) const;
+  void set_first_child(int index, uint32_t value);
+  void add_first_child(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      first_child() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_first_child();
+
+  // repeated uint32 second_child = 7;
+  int second_child_size() const;
+  private:
+  int _internal_second_child_size() const;
+  public:
+  void clear_second_child();
+  private:
+  uint32_t _internal_second_child(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_second_child() const;
+  void _internal_add_second_child(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_second_child();
+  public:
+  uint32_t second_child(int index) const;
+  void set_second_child(int index, uint32_t value);
+  void add_second_child(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      second_child() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_second_child();
+
+  // @@protoc_insertion_point(class_scope:TransCatSerial.ContractionHierarchy)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > vertex_rank_;
+    mutable std::atomic<int> _vertex_rank_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > edge_from_;
+    mutable std::atomic<int> _edge_from_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > edge_to_;
+    mutable std::atomic<int> _edge_to_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > edge_weight_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > original_edge_;
+    mutable std::atomic<int> _original_edge_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > first_child_;
+    mutable std::atomic<int> _first_child_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > second_child_;
+    mutable std::atomic<int> _second_child_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_graph_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HubLabels final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TransCatSerial.HubLabels) */ {
+ public:
+  inline HubLabels() : HubLabels(nullptr) {}
+  ~HubLabels() override;
+  explicit PROTOBUF_CONSTEXPR HubLabels(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HubLabels(const HubLabels& from);
+  HubLabels(HubLabels&& from) noexcept
+    : HubLabels() {
+    *this = ::std::move(from);
+  }
+
+  inline HubLabels& operator=(const HubLabels& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HubLabels& operator=(HubLabels&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HubLabels& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HubLabels* internal_default_instance() {
+    return reinterpret_cast<const HubLabels*>(
+               &_HubLabels_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(HubLabels& a, HubLabels& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HubLabels* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HubLabels* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HubLabels* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HubLabels>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HubLabels& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HubLabels& from) {
+    HubLabels::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HubLabels* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TransCatSerial.HubLabels";
+  }
+  protected:
+  explicit HubLabels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHubVertexFieldNumber = 1,
+    kInLabelCountFieldNumber = 2,
+    kInHubDeltaFieldNumber = 3,
+    kInWeightFieldNumber = 4,
+    kInEdgeFieldNumber = 5,
+    kOutLabelCountFieldNumber = 6,
+    kOutHubDeltaFieldNumber = 7,
+    kOutWeightFieldNumber = 8,
+    kOutEdgeFieldNumber = 9,
+  };
+  // repeated uint32 hub_vertex = 1;
+  int hub_vertex_size() const;
+  private:
+  int _internal_hub_vertex_size() const;
+  public:
+  void clear_hub_vertex();
+  private:
+  uint32_t _internal_hub_vertex(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_hub_vertex() const;
+  void _internal_add_hub_vertex(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_hub_vertex();
+  public:
+  uint32_t hub_vertex(int index) const;
+  void set_hub_vertex(int index, uint32_t value);
+  void add_hub_vertex(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      hub_vertex() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_hub_vertex();
+
+  // repeated uint32 in_label_count = 2;
+  int in_label_count_size() const;
+  private:
+  int _internal_in_label_count_size() const;
+  public:
+  void clear_in_label_count();
+  private:
+  uint32_t _internal_in_label_count(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_in_label_count() const;
+  void _internal_add_in_label_count(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_in_label_count();
+  public:
+  uint32_t in_label_count(int index) const;
+  void set_in_label_count(int index, uint32_t value);
+  void add_in_label_count(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      in_label_count() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_in_label_count();
+
+  // repeated uint32 in_hub_delta = 3;
+  int in_hub_delta_size() const;
+  private:
+  int _internal_in_hub_delta_size() const;
+  public:
+  void clear_in_hub_delta();
+  private:
+  uint32_t _internal_in_hub_delta(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_in_hub_delta() const;
+  void _internal_add_in_hub_delta(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_in_hub_delta();
+  public:
+  uint32_t in_hub_delta(int index) const;
+  void set_in_hub_delta(int index, uint32_t value);
+  void add_in_hub_delta(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      in_hub_delta() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_in_hub_delta();
+
+  // repeated double in_weight = 4;
+  int in_weight_size() const;
+  private:
+  int _internal_in_weight_size() const;
+  public:
+  void clear_in_weight();
+  private:
+  double _internal_in_weight(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_in_weight() const;
+  void _internal_add_in_weight(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_in_weight();
+  public:
+  double in_weight(int index) const;
+  void set_in_weight(int index, double value);
+  void add_in_weight(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      in_weight() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_in_weight();
+
+  // repeated uint32 in_edge = 5;
+  int in_edge_size() const;
+  private:
+  int _internal_in_edge_size() const;
+  public:
+  void clear_in_edge();
+  private:
+  uint32_t _internal_in_edge(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_in_edge() const;
+  void _internal_add_in_edge(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_in_edge();
+  public:
+  uint32_t in_edge(int index) const;
+  void set_in_edge(int index, uint32_t value);
+  void add_in_edge(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      in_edge() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_in_edge();
+
+  // repeated uint32 out_label_count = 6;
+  int out_label_count_size() const;
+  private:
+  int _internal_out_label_count_size() const;
+  public:
+  void clear_out_label_count();
+  private:
+  uint32_t _internal_out_label_count(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_out_label_count() const;
+  void _internal_add_out_label_count(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_out_label_count();
+  public:
+  uint32_t out_label_count(int index) const;
+  void set_out_label_count(int index, uint32_t value);
+  void add_out_label_count(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      out_label_count() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_out_label_count();
+
+  // repeated uint32 out_hub_delta = 7;
+  int out_hub_delta_size() const;
+  private:
+  int _internal_out_hub_delta_size() const;
+  public:
+  void clear_out_hub_delta();
+  private:
+  uint32_t _internal_out_hub_delta(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_out_hub_delta() const;
+  void _internal_add_out_hub_delta(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_out_hub_delta();
+  public:
+  uint32_t out_hub_delta(int index) const;
+  void set_out_hub_delta(int index, uint32_t value);
+  void add_out_hub_delta(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      out_hub_delta() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_out_hub_delta();
+
+  // repeated double out_weight = 8;
+  int out_weight_size() const;
+  private:
+  int _internal_out_weight_size() const;
+  public:
+  void clear_out_weight();
+  private:
+  double _internal_out_weight(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_out_weight() const;
+  void _internal_add_out_weight(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_out_weight();
+  public:
+  double out_weight(int index) const;
+  void set_out_weight(int index, double value);
+  void add_out_weight(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      out_weight() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_out_weight();
+
+  // repeated uint32 out_edge = 9;
+  int out_edge_size() const;
+  private:
+  int _internal_out_edge_size() const;
+  public:
+  void clear_out_edge();
+  private:
+  uint32_t _internal_out_edge(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_out_edge() const;
+  void _internal_add_out_edge(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_out_edge();
+  public:
+  uint32_t out_edge(int index) const;
+  void set_out_edge(int index, uint32_t value);
+  void add_out_edge(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      out_edge() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_out_edge();
+
+  // @@protoc_insertion_point(class_scope:TransCatSerial.HubLabels)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > hub_vertex_;
+    mutable std::atomic<int> _hub_vertex_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > in_label_count_;
+    mutable std::atomic<int> _in_label_count_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > in_hub_delta_;
+    mutable std::atomic<int> _in_hub_delta_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > in_weight_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > in_edge_;
+    mutable std::atomic<int> _in_edge_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > out_label_count_;
+    mutable std::atomic<int> _out_label_count_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > out_hub_delta_;
+    mutable std::atomic<int> _out_hub_delta_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > out_weight_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > out_edge_;
+    mutable std::atomic<int> _out_edge_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_graph_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Edge
+
+// uint32 from = 1;
+inline void Edge::clear_from() {
+  _impl_.from_ = 0u;
+}
+inline uint32_t Edge::_internal_from() const {
+  return _impl_.from_;
+}
+inline uint32_t Edge::from() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.Edge.from)
+  return _internal_from();
+}
+inline void Edge::_internal_set_from(uint32_t value) {
+  
+  _impl_.from_ = value;
+}
+inline void Edge::set_from(uint32_t value) {
+  _internal_set_from(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.Edge.from)
+}
+
+// uint32 to = 2;
+inline void Edge::clear_to() {
+  _impl_.to_ = 0u;
+}
+inline uint32_t Edge::_internal_to() const {
+  return _impl_.to_;
+}
+inline uint32_t Edge::to() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.Edge.to)
+  return _internal_to();
+}
+inline void Edge::_internal_set_to(uint32_t value) {
+  
+  _impl_.to_ = value;
+}
+inline void Edge::set_to(uint32_t value) {
+  _internal_set_to(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.Edge.to)
+}
+
+// double weight = 3;
+inline void Edge::clear_weight() {
+  _impl_.weight_ = 0;
+}
+inline double Edge::_internal_weight() const {
+  return _impl_.weight_;
+}
+inline double Edge::weight() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.Edge.weight)
+  return _internal_weight();
+}
+inline void Edge::_internal_set_weight(double value) {
+  
+  _impl_.weight_ = value;
+}
+inline void Edge::set_weight(double value) {
+  _internal_set_weight(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.Edge.weight)
+}
+
+// -------------------------------------------------------------------
+
+// Edges
+
+// repeated .TransCatSerial.Edge edges = 1;
+inline int Edges::_internal_edges_size() const {
+  return _impl_.edges_.size();
+}
+inline int Edges::edges_size() const {
+  return _internal_edges_size();
+}
+inline void Edges::clear_edges() {
+  _impl_.edges_.Clear();
+}
+inline ::TransCatSerial::Edge* Edges::mutable_edges(int index) {
+  // @@protoc_insertion_point(field_mutable:TransCatSerial.Edges.edges)
+  return _impl_.edges_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Edge >*
+Edges::mutable_edges() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.Edges.edges)
+  return &_impl_.edges_;
+}
+inline const ::TransCatSerial::Edge& Edges::_internal_edges(int index) const {
+  return _impl_.edges_.Get(index);
+}
+inline const ::TransCatSerial::Edge& Edges::edges(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.Edges.edges)
+  return _internal_edges(index);
+}
+inline ::TransCatSerial::Edge* Edges::_internal_add_edges() {
+  return _impl_.edges_.Add();
+}
+inline ::TransCatSerial::Edge* Edges::add_edges() {
+  ::TransCatSerial::Edge* _add = _internal_add_edges();
+  // @@protoc_insertion_point(field_add:TransCatSerial.Edges.edges)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Edge >&
+Edges::edges() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.Edges.edges)
+  return _impl_.edges_;
+}
+
+// -------------------------------------------------------------------
+
+// IncidenceList
+
+// repeated uint32 edge_id = 1;
+inline int IncidenceList::_internal_edge_id_size() const {
+  return _impl_.edge_id_.size();
+}
+inline int IncidenceList::edge_id_size() const {
+  return _internal_edge_id_size();
+}
+inline void IncidenceList::clear_edge_id() {
+  _impl_.edge_id_.Clear();
+}
+inline uint32_t IncidenceList::_internal_edge_id(int index) const {
+  return _impl_.edge_id_.Get(index);
+}
+inline uint32_t IncidenceList::edge_id(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.IncidenceList.edge_id)
+  return _internal_edge_id(index);
+}
+inline void IncidenceList::set_edge_id(int index, uint32_t value) {
+  _impl_.edge_id_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.IncidenceList.edge_id)
+}
+inline void IncidenceList::_internal_add_edge_id(uint32_t value) {
+  _impl_.edge_id_.Add(value);
+}
+inline void IncidenceList::add_edge_id(uint32_t value) {
+  _internal_add_edge_id(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.IncidenceList.edge_id)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+IncidenceList::_internal_edge_id() const {
+  return _impl_.edge_id_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+IncidenceList::edge_id() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.IncidenceList.edge_id)
+  return _internal_edge_id();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+IncidenceList::_internal_mutable_edge_id() {
+  return &_impl_.edge_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+IncidenceList::mutable_edge_id() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.IncidenceList.edge_id)
+  return _internal_mutable_edge_id();
+}
+
+// -------------------------------------------------------------------
+
+// IncidenceLists
+
+// repeated .TransCatSerial.IncidenceList incidence_list = 1;
+inline int IncidenceLists::_internal_incidence_list_size() const {
+  return _impl_.incidence_list_.size();
+}
+inline int IncidenceLists::incidence_list_size() const {
+  return _internal_incidence_list_size();
+}
+inline void IncidenceLists::clear_incidence_list() {
+  _impl_.incidence_list_.Clear();
+}
+inline ::TransCatSerial::IncidenceList* IncidenceLists::mutable_incidence_list(int index) {
+  // @@protoc_insertion_point(field_mutable:TransCatSerial.IncidenceLists.incidence_list)
+  return _impl_.incidence_list_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::IncidenceList >*
+IncidenceLists::mutable_incidence_list() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.IncidenceLists.incidence_list)
+  return &_impl_.incidence_list_;
+}
+inline const ::TransCatSerial::IncidenceList& IncidenceLists::_internal_incidence_list(int index) const {
+  return _impl_.incidence_list_.Get(index);
+}
+inline const ::TransCatSerial::IncidenceList& IncidenceLists::incidence_list(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.IncidenceLists.incidence_list)
+  return _internal_incidence_list(index);
+}
+inline ::TransCatSerial::IncidenceList* IncidenceLists::_internal_add_incidence_list() {
+  return _impl_.incidence_list_.Add();
+}
+inline ::TransCatSerial::IncidenceList* IncidenceLists::add_incidence_list() {
+  ::TransCatSerial::IncidenceList* _add = _internal_add_incidence_list();
   // @@protoc_insertion_point(field_add:TransCatSerial.IncidenceLists.incidence_list)
   return _add;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::IncidenceList >&
-IncidenceLists::incidence_list() const {
-  // @@protoc_insertion_point(field_list:TransCatSerial.IncidenceLists.incidence_list)
-  return incidence_list_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::IncidenceList >&
+IncidenceLists::incidence_list() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.IncidenceLists.incidence_list)
+  return _impl_.incidence_list_;
+}
+
+// -------------------------------------------------------------------
+
+// RouteData
+
+// bool has_value = 1;
+inline void RouteData::clear_has_value() {
+  _impl_.has_value_ = false;
+}
+inline bool RouteData::_internal_has_value() const {
+  return _impl_.has_value_;
+}
+inline bool RouteData::has_value() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.RouteData.has_value)
+  return _internal_has_value();
+}
+inline void RouteData::_internal_set_has_value(bool value) {
+  
+  _impl_.has_value_ = value;
+}
+inline void RouteData::set_has_value(bool value) {
+  _internal_set_has_value(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.RouteData.has_value)
+}
+
+// double weight = 2;
+inline void RouteData::clear_weight() {
+  _impl_.weight_ = 0;
+}
+inline double RouteData::_internal_weight() const {
+  return _impl_.weight_;
+}
+inline double RouteData::weight() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.RouteData.weight)
+  return _internal_weight();
+}
+inline void RouteData::_internal_set_weight(double value) {
+  
+  _impl_.weight_ = value;
+}
+inline void RouteData::set_weight(double value) {
+  _internal_set_weight(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.RouteData.weight)
+}
+
+// bool has_prev_edge_value = 3;
+inline void RouteData::clear_has_prev_edge_value() {
+  _impl_.has_prev_edge_value_ = false;
+}
+inline bool RouteData::_internal_has_prev_edge_value() const {
+  return _impl_.has_prev_edge_value_;
+}
+inline bool RouteData::has_prev_edge_value() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.RouteData.has_prev_edge_value)
+  return _internal_has_prev_edge_value();
+}
+inline void RouteData::_internal_set_has_prev_edge_value(bool value) {
+  
+  _impl_.has_prev_edge_value_ = value;
+}
+inline void RouteData::set_has_prev_edge_value(bool value) {
+  _internal_set_has_prev_edge_value(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.RouteData.has_prev_edge_value)
+}
+
+// uint32 prev_edge = 4;
+inline void RouteData::clear_prev_edge() {
+  _impl_.prev_edge_ = 0u;
+}
+inline uint32_t RouteData::_internal_prev_edge() const {
+  return _impl_.prev_edge_;
+}
+inline uint32_t RouteData::prev_edge() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.RouteData.prev_edge)
+  return _internal_prev_edge();
+}
+inline void RouteData::_internal_set_prev_edge(uint32_t value) {
+  
+  _impl_.prev_edge_ = value;
+}
+inline void RouteData::set_prev_edge(uint32_t value) {
+  _internal_set_prev_edge(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.RouteData.prev_edge)
+}
+
+// -------------------------------------------------------------------
+
+// RoutesSecIndexData
+
+// repeated .TransCatSerial.RouteData sec_routes_data = 1;
+inline int RoutesSecIndexData::_internal_sec_routes_data_size() const {
+  return _impl_.sec_routes_data_.size();
+}
+inline int RoutesSecIndexData::sec_routes_data_size() const {
+  return _internal_sec_routes_data_size();
+}
+inline void RoutesSecIndexData::clear_sec_routes_data() {
+  _impl_.sec_routes_data_.Clear();
+}
+inline ::TransCatSerial::RouteData* RoutesSecIndexData::mutable_sec_routes_data(int index) {
+  // @@protoc_insertion_point(field_mutable:TransCatSerial.RoutesSecIndexData.sec_routes_data)
+  return _impl_.sec_routes_data_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::RouteData >*
+RoutesSecIndexData::mutable_sec_routes_data() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.RoutesSecIndexData.sec_routes_data)
+  return &_impl_.sec_routes_data_;
+}
+inline const ::TransCatSerial::RouteData& RoutesSecIndexData::_internal_sec_routes_data(int index) const {
+  return _impl_.sec_routes_data_.Get(index);
+}
+inline const ::TransCatSerial::RouteData& RoutesSecIndexData::sec_routes_data(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.RoutesSecIndexData.sec_routes_data)
+  return _internal_sec_routes_data(index);
+}
+inline ::TransCatSerial::RouteData* RoutesSecIndexData::_internal_add_sec_routes_data() {
+  return _impl_.sec_routes_data_.Add();
+}
+inline ::TransCatSerial::RouteData* RoutesSecIndexData::add_sec_routes_data() {
+  ::TransCatSerial::RouteData* _add = _internal_add_sec_routes_data();
+  // @@protoc_insertion_point(field_add:TransCatSerial.RoutesSecIndexData.sec_routes_data)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::RouteData >&
+RoutesSecIndexData::sec_routes_data() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.RoutesSecIndexData.sec_routes_data)
+  return _impl_.sec_routes_data_;
+}
+
+// -------------------------------------------------------------------
+
+// RoutesData
+
+// repeated .TransCatSerial.RoutesSecIndexData first_routes_data = 1;
+inline int RoutesData::_internal_first_routes_data_size() const {
+  return _impl_.first_routes_data_.size();
+}
+inline int RoutesData::first_routes_data_size() const {
+  return _internal_first_routes_data_size();
+}
+inline void RoutesData::clear_first_routes_data() {
+  _impl_.first_routes_data_.Clear();
+}
+inline ::TransCatSerial::RoutesSecIndexData* RoutesData::mutable_first_routes_data(int index) {
+  // @@protoc_insertion_point(field_mutable:TransCatSerial.RoutesData.first_routes_data)
+  return _impl_.first_routes_data_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::RoutesSecIndexData >*
+RoutesData::mutable_first_routes_data() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.RoutesData.first_routes_data)
+  return &_impl_.first_routes_data_;
+}
+inline const ::TransCatSerial::RoutesSecIndexData& RoutesData::_internal_first_routes_data(int index) const {
+  return _impl_.first_routes_data_.Get(index);
+}
+inline const ::TransCatSerial::RoutesSecIndexData& RoutesData::first_routes_data(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.RoutesData.first_routes_data)
+  return _internal_first_routes_data(index);
+}
+inline ::TransCatSerial::RoutesSecIndexData* RoutesData::_internal_add_first_routes_data() {
+  return _impl_.first_routes_data_.Add();
+}
+inline ::TransCatSerial::RoutesSecIndexData* RoutesData::add_first_routes_data() {
+  ::TransCatSerial::RoutesSecIndexData* _add = _internal_add_first_routes_data();
+  // @@protoc_insertion_point(field_add:TransCatSerial.RoutesData.first_routes_data)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::RoutesSecIndexData >&
+RoutesData::first_routes_data() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.RoutesData.first_routes_data)
+  return _impl_.first_routes_data_;
+}
+
+// -------------------------------------------------------------------
+
+// PackedRoutesData
+
+// uint32 vertex_count = 1;
+inline void PackedRoutesData::clear_vertex_count() {
+  _impl_.vertex_count_ = 0u;
+}
+inline uint32_t PackedRoutesData::_internal_vertex_count() const {
+  return _impl_.vertex_count_;
+}
+inline uint32_t PackedRoutesData::vertex_count() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.PackedRoutesData.vertex_count)
+  return _internal_vertex_count();
+}
+inline void PackedRoutesData::_internal_set_vertex_count(uint32_t value) {
+  
+  _impl_.vertex_count_ = value;
+}
+inline void PackedRoutesData::set_vertex_count(uint32_t value) {
+  _internal_set_vertex_count(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.PackedRoutesData.vertex_count)
+}
+
+// bool delta_encoded = 2;
+inline void PackedRoutesData::clear_delta_encoded() {
+  _impl_.delta_encoded_ = false;
+}
+inline bool PackedRoutesData::_internal_delta_encoded() const {
+  return _impl_.delta_encoded_;
+}
+inline bool PackedRoutesData::delta_encoded() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.PackedRoutesData.delta_encoded)
+  return _internal_delta_encoded();
+}
+inline void PackedRoutesData::_internal_set_delta_encoded(bool value) {
+  
+  _impl_.delta_encoded_ = value;
+}
+inline void PackedRoutesData::set_delta_encoded(bool value) {
+  _internal_set_delta_encoded(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.PackedRoutesData.delta_encoded)
+}
+
+// repeated uint32 prev_edge = 3;
+inline int PackedRoutesData::_internal_prev_edge_size() const {
+  return _impl_.prev_edge_.size();
+}
+inline int PackedRoutesData::prev_edge_size() const {
+  return _internal_prev_edge_size();
+}
+inline void PackedRoutesData::clear_prev_edge() {
+  _impl_.prev_edge_.Clear();
+}
+inline uint32_t PackedRoutesData::_internal_prev_edge(int index) const {
+  return _impl_.prev_edge_.Get(index);
+}
+inline uint32_t PackedRoutesData::prev_edge(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.PackedRoutesData.prev_edge)
+  return _internal_prev_edge(index);
+}
+inline void PackedRoutesData::set_prev_edge(int index, uint32_t value) {
+  _impl_.prev_edge_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.PackedRoutesData.prev_edge)
+}
+inline void PackedRoutesData::_internal_add_prev_edge(uint32_t value) {
+  _impl_.prev_edge_.Add(value);
+}
+inline void PackedRoutesData::add_prev_edge(uint32_t value) {
+  _internal_add_prev_edge(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.PackedRoutesData.prev_edge)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+PackedRoutesData::_internal_prev_edge() const {
+  return _impl_.prev_edge_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+PackedRoutesData::prev_edge() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.PackedRoutesData.prev_edge)
+  return _internal_prev_edge();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+PackedRoutesData::_internal_mutable_prev_edge() {
+  return &_impl_.prev_edge_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+PackedRoutesData::mutable_prev_edge() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.PackedRoutesData.prev_edge)
+  return _internal_mutable_prev_edge();
+}
+
+// repeated sint32 prev_edge_delta = 4;
+inline int PackedRoutesData::_internal_prev_edge_delta_size() const {
+  return _impl_.prev_edge_delta_.size();
+}
+inline int PackedRoutesData::prev_edge_delta_size() const {
+  return _internal_prev_edge_delta_size();
+}
+inline void PackedRoutesData::clear_prev_edge_delta() {
+  _impl_.prev_edge_delta_.Clear();
+}
+inline int32_t PackedRoutesData::_internal_prev_edge_delta(int index) const {
+  return _impl_.prev_edge_delta_.Get(index);
+}
+inline int32_t PackedRoutesData::prev_edge_delta(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.PackedRoutesData.prev_edge_delta)
+  return _internal_prev_edge_delta(index);
+}
+inline void PackedRoutesData::set_prev_edge_delta(int index, int32_t value) {
+  _impl_.prev_edge_delta_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.PackedRoutesData.prev_edge_delta)
+}
+inline void PackedRoutesData::_internal_add_prev_edge_delta(int32_t value) {
+  _impl_.prev_edge_delta_.Add(value);
+}
+inline void PackedRoutesData::add_prev_edge_delta(int32_t value) {
+  _internal_add_prev_edge_delta(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.PackedRoutesData.prev_edge_delta)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+PackedRoutesData::_internal_prev_edge_delta() const {
+  return _impl_.prev_edge_delta_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+PackedRoutesData::prev_edge_delta() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.PackedRoutesData.prev_edge_delta)
+  return _internal_prev_edge_delta();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+PackedRoutesData::_internal_mutable_prev_edge_delta() {
+  return &_impl_.prev_edge_delta_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+PackedRoutesData::mutable_prev_edge_delta() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.PackedRoutesData.prev_edge_delta)
+  return _internal_mutable_prev_edge_delta();
+}
+
+// repeated double weight = 5;
+inline int PackedRoutesData::_internal_weight_size() const {
+  return _impl_.weight_.size();
+}
+inline int PackedRoutesData::weight_size() const {
+  return _internal_weight_size();
+}
+inline void PackedRoutesData::clear_weight() {
+  _impl_.weight_.Clear();
+}
+inline double PackedRoutesData::_internal_weight(int index) const {
+  return _impl_.weight_.Get(index);
+}
+inline double PackedRoutesData::weight(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.PackedRoutesData.weight)
+  return _internal_weight(index);
+}
+inline void PackedRoutesData::set_weight(int index, double value) {
+  _impl_.weight_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.PackedRoutesData.weight)
+}
+inline void PackedRoutesData::_internal_add_weight(double value) {
+  _impl_.weight_.Add(value);
+}
+inline void PackedRoutesData::add_weight(double value) {
+  _internal_add_weight(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.PackedRoutesData.weight)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+PackedRoutesData::_internal_weight() const {
+  return _impl_.weight_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+PackedRoutesData::weight() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.PackedRoutesData.weight)
+  return _internal_weight();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+PackedRoutesData::_internal_mutable_weight() {
+  return &_impl_.weight_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+PackedRoutesData::mutable_weight() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.PackedRoutesData.weight)
+  return _internal_mutable_weight();
+}
+
+// -------------------------------------------------------------------
+
+// ContractionHierarchy
+
+// repeated uint32 vertex_rank = 1;
+inline int ContractionHierarchy::_internal_vertex_rank_size() const {
+  return _impl_.vertex_rank_.size();
+}
+inline int ContractionHierarchy::vertex_rank_size() const {
+  return _internal_vertex_rank_size();
+}
+inline void ContractionHierarchy::clear_vertex_rank() {
+  _impl_.vertex_rank_.Clear();
+}
+inline uint32_t ContractionHierarchy::_internal_vertex_rank(int index) const {
+  return _impl_.vertex_rank_.Get(index);
+}
+inline uint32_t ContractionHierarchy::vertex_rank(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.ContractionHierarchy.vertex_rank)
+  return _internal_vertex_rank(index);
+}
+inline void ContractionHierarchy::set_vertex_rank(int index, uint32_t value) {
+  _impl_.vertex_rank_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.ContractionHierarchy.vertex_rank)
+}
+inline void ContractionHierarchy::_internal_add_vertex_rank(uint32_t value) {
+  _impl_.vertex_rank_.Add(value);
+}
+inline void ContractionHierarchy::add_vertex_rank(uint32_t value) {
+  _internal_add_vertex_rank(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.ContractionHierarchy.vertex_rank)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::_internal_vertex_rank() const {
+  return _impl_.vertex_rank_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::vertex_rank() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.ContractionHierarchy.vertex_rank)
+  return _internal_vertex_rank();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::_internal_mutable_vertex_rank() {
+  return &_impl_.vertex_rank_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::mutable_vertex_rank() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.ContractionHierarchy.vertex_rank)
+  return _internal_mutable_vertex_rank();
+}
+
+// repeated uint32 edge_from = 2;
+inline int ContractionHierarchy::_internal_edge_from_size() const {
+  return _impl_.edge_from_.size();
+}
+inline int ContractionHierarchy::edge_from_size() const {
+  return _internal_edge_from_size();
+}
+inline void ContractionHierarchy::clear_edge_from() {
+  _impl_.edge_from_.Clear();
+}
+inline uint32_t ContractionHierarchy::_internal_edge_from(int index) const {
+  return _impl_.edge_from_.Get(index);
+}
+inline uint32_t ContractionHierarchy::edge_from(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.ContractionHierarchy.edge_from)
+  return _internal_edge_from(index);
+}
+inline void ContractionHierarchy::set_edge_from(int index, uint32_t value) {
+  _impl_.edge_from_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.ContractionHierarchy.edge_from)
+}
+inline void ContractionHierarchy::_internal_add_edge_from(uint32_t value) {
+  _impl_.edge_from_.Add(value);
+}
+inline void ContractionHierarchy::add_edge_from(uint32_t value) {
+  _internal_add_edge_from(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.ContractionHierarchy.edge_from)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::_internal_edge_from() const {
+  return _impl_.edge_from_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::edge_from() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.ContractionHierarchy.edge_from)
+  return _internal_edge_from();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::_internal_mutable_edge_from() {
+  return &_impl_.edge_from_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::mutable_edge_from() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.ContractionHierarchy.edge_from)
+  return _internal_mutable_edge_from();
+}
+
+// repeated uint32 edge_to = 3;
+inline int ContractionHierarchy::_internal_edge_to_size() const {
+  return _impl_.edge_to_.size();
+}
+inline int ContractionHierarchy::edge_to_size() const {
+  return _internal_edge_to_size();
+}
+inline void ContractionHierarchy::clear_edge_to() {
+  _impl_.edge_to_.Clear();
+}
+inline uint32_t ContractionHierarchy::_internal_edge_to(int index) const {
+  return _impl_.edge_to_.Get(index);
+}
+inline uint32_t ContractionHierarchy::edge_to(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.ContractionHierarchy.edge_to)
+  return _internal_edge_to(index);
+}
+inline void ContractionHierarchy::set_edge_to(int index, uint32_t value) {
+  _impl_.edge_to_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.ContractionHierarchy.edge_to)
+}
+inline void ContractionHierarchy::_internal_add_edge_to(uint32_t value) {
+  _impl_.edge_to_.Add(value);
+}
+inline void ContractionHierarchy::add_edge_to(uint32_t value) {
+  _internal_add_edge_to(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.ContractionHierarchy.edge_to)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::_internal_edge_to() const {
+  return _impl_.edge_to_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::edge_to() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.ContractionHierarchy.edge_to)
+  return _internal_edge_to();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::_internal_mutable_edge_to() {
+  return &_impl_.edge_to_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::mutable_edge_to() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.ContractionHierarchy.edge_to)
+  return _internal_mutable_edge_to();
+}
+
+// repeated double edge_weight = 4;
+inline int ContractionHierarchy::_internal_edge_weight_size() const {
+  return _impl_.edge_weight_.size();
+}
+inline int ContractionHierarchy::edge_weight_size() const {
+  return _internal_edge_weight_size();
+}
+inline void ContractionHierarchy::clear_edge_weight() {
+  _impl_.edge_weight_.Clear();
+}
+inline double ContractionHierarchy::_internal_edge_weight(int index) const {
+  return _impl_.edge_weight_.Get(index);
+}
+inline double ContractionHierarchy::edge_weight(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.ContractionHierarchy.edge_weight)
+  return _internal_edge_weight(index);
+}
+inline void ContractionHierarchy::set_edge_weight(int index, double value) {
+  _impl_.edge_weight_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.ContractionHierarchy.edge_weight)
+}
+inline void ContractionHierarchy::_internal_add_edge_weight(double value) {
+  _impl_.edge_weight_.Add(value);
+}
+inline void ContractionHierarchy::add_edge_weight(double value) {
+  _internal_add_edge_weight(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.ContractionHierarchy.edge_weight)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+ContractionHierarchy::_internal_edge_weight() const {
+  return _impl_.edge_weight_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+ContractionHierarchy::edge_weight() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.ContractionHierarchy.edge_weight)
+  return _internal_edge_weight();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+ContractionHierarchy::_internal_mutable_edge_weight() {
+  return &_impl_.edge_weight_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+ContractionHierarchy::mutable_edge_weight() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.ContractionHierarchy.edge_weight)
+  return _internal_mutable_edge_weight();
 }
 
-// -------------------------------------------------------------------
+// repeated uint32 original_edge = 5;
+inline int ContractionHierarchy::_internal_original_edge_size() const {
+  return _impl_.original_edge_.size();
+}
+inline int ContractionHierarchy::original_edge_size() const {
+  return _internal_original_edge_size();
+}
+inline void ContractionHierarchy::clear_original_edge() {
+  _impl_.original_edge_.Clear();
+}
+inline uint32_t ContractionHierarchy::_internal_original_edge(int index) const {
+  return _impl_.original_edge_.Get(index);
+}
+inline uint32_t ContractionHierarchy::original_edge(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.ContractionHierarchy.original_edge)
+  return _internal_original_edge(index);
+}
+inline void ContractionHierarchy::set_original_edge(int index, uint32_t value) {
+  _impl_.original_edge_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.ContractionHierarchy.original_edge)
+}
+inline void ContractionHierarchy::_internal_add_original_edge(uint32_t value) {
+  _impl_.original_edge_.Add(value);
+}
+inline void ContractionHierarchy::add_original_edge(uint32_t value) {
+  _internal_add_original_edge(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.ContractionHierarchy.original_edge)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::_internal_original_edge() const {
+  return _impl_.original_edge_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::original_edge() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.ContractionHierarchy.original_edge)
+  return _internal_original_edge();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::_internal_mutable_original_edge() {
+  return &_impl_.original_edge_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::mutable_original_edge() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.ContractionHierarchy.original_edge)
+  return _internal_mutable_original_edge();
+}
 
-// RouteData
+// repeated uint32 first_child = 6;
+inline int ContractionHierarchy::_internal_first_child_size() const {
+  return _impl_.first_child_.size();
+}
+inline int ContractionHierarchy::first_child_size() const {
+  return _internal_first_child_size();
+}
+inline void ContractionHierarchy::clear_first_child() {
+  _impl_.first_child_.Clear();
+}
+inline uint32_t ContractionHierarchy::_internal_first_child(int index) const {
+  return _impl_.first_child_.Get(index);
+}
+inline uint32_t ContractionHierarchy::first_child(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.ContractionHierarchy.first_child)
+  return _internal_first_child(index);
+}
+inline void ContractionHierarchy::set_first_child(int index, uint32_t value) {
+  _impl_.first_child_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.ContractionHierarchy.first_child)
+}
+inline void ContractionHierarchy::_internal_add_first_child(uint32_t value) {
+  _impl_.first_child_.Add(value);
+}
+inline void ContractionHierarchy::add_first_child(uint32_t value) {
+  _internal_add_first_child(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.ContractionHierarchy.first_child)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::_internal_first_child() const {
+  return _impl_.first_child_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::first_child() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.ContractionHierarchy.first_child)
+  return _internal_first_child();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::_internal_mutable_first_child() {
+  return &_impl_.first_child_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::mutable_first_child() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.ContractionHierarchy.first_child)
+  return _internal_mutable_first_child();
+}
 
-// bool has_value = 1;
-inline void RouteData::clear_has_value() {
-  has_value_ = false;
+// repeated uint32 second_child = 7;
+inline int ContractionHierarchy::_internal_second_child_size() const {
+  return _impl_.second_child_.size();
 }
-inline bool RouteData::_internal_has_value() const {
-  return has_value_;
+inline int ContractionHierarchy::second_child_size() const {
+  return _internal_second_child_size();
 }
-inline bool RouteData::has_value() const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.RouteData.has_value)
-  return _internal_has_value();
+inline void ContractionHierarchy::clear_second_child() {
+  _impl_.second_child_.Clear();
 }
-inline void RouteData::_internal_set_has_value(bool value) {
-  
-  has_value_ = value;
+inline uint32_t ContractionHierarchy::_internal_second_child(int index) const {
+  return _impl_.second_child_.Get(index);
 }
-inline void RouteData::set_has_value(bool value) {
-  _internal_set_has_value(value);
-  // @@protoc_insertion_point(field_set:TransCatSerial.RouteData.has_value)
+inline uint32_t ContractionHierarchy::second_child(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.ContractionHierarchy.second_child)
+  return _internal_second_child(index);
+}
+inline void ContractionHierarchy::set_second_child(int index, uint32_t value) {
+  _impl_.second_child_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.ContractionHierarchy.second_child)
+}
+inline void ContractionHierarchy::_internal_add_second_child(uint32_t value) {
+  _impl_.second_child_.Add(value);
+}
+inline void ContractionHierarchy::add_second_child(uint32_t value) {
+  _internal_add_second_child(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.ContractionHierarchy.second_child)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::_internal_second_child() const {
+  return _impl_.second_child_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::second_child() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.ContractionHierarchy.second_child)
+  return _internal_second_child();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::_internal_mutable_second_child() {
+  return &_impl_.second_child_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::mutable_second_child() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.ContractionHierarchy.second_child)
+  return _internal_mutable_second_child();
 }
 
-// double weight = 2;
-inline void RouteData::clear_weight() {
-  weight_ = 0;
+// -------------------------------------------------------------------
+
+// HubLabels
+
+// repeated uint32 hub_vertex = 1;
+inline int HubLabels::_internal_hub_vertex_size() const {
+  return _impl_.hub_vertex_.size();
 }
-inline double RouteData::_internal_weight() const {
-  return weight_;
+inline int HubLabels::hub_vertex_size() const {
+  return _internal_hub_vertex_size();
 }
-inline double RouteData::weight() const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.RouteData.weight)
-  return _internal_weight();
+inline void HubLabels::clear_hub_vertex() {
+  _impl_.hub_vertex_.Clear();
 }
-inline void RouteData::_internal_set_weight(double value) {
-  
-  weight_ = value;
+inline uint32_t HubLabels::_internal_hub_vertex(int index) const {
+  return _impl_.hub_vertex_.Get(index);
 }
-inline void RouteData::set_weight(double value) {
-  _internal_set_weight(value);
-  // @@protoc_insertion_point(field_set:TransCatSerial.RouteData.weight)
+inline uint32_t HubLabels::hub_vertex(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.HubLabels.hub_vertex)
+  return _internal_hub_vertex(index);
+}
+inline void HubLabels::set_hub_vertex(int index, uint32_t value) {
+  _impl_.hub_vertex_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.HubLabels.hub_vertex)
+}
+inline void HubLabels::_internal_add_hub_vertex(uint32_t value) {
+  _impl_.hub_vertex_.Add(value);
+}
+inline void HubLabels::add_hub_vertex(uint32_t value) {
+  _internal_add_hub_vertex(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.HubLabels.hub_vertex)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+HubLabels::_internal_hub_vertex() const {
+  return _impl_.hub_vertex_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+HubLabels::hub_vertex() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.HubLabels.hub_vertex)
+  return _internal_hub_vertex();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+HubLabels::_internal_mutable_hub_vertex() {
+  return &_impl_.hub_vertex_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+HubLabels::mutable_hub_vertex() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.HubLabels.hub_vertex)
+  return _internal_mutable_hub_vertex();
 }
 
-// bool has_prev_edge_value = 3;
-inline void RouteData::clear_has_prev_edge_value() {
-  has_prev_edge_value_ = false;
+// repeated uint32 in_label_count = 2;
+inline int HubLabels::_internal_in_label_count_size() const {
+  return _impl_.in_label_count_.size();
 }
-inline bool RouteData::_internal_has_prev_edge_value() const {
-  return has_prev_edge_value_;
+inline int HubLabels::in_label_count_size() const {
+  return _internal_in_label_count_size();
 }
-inline bool RouteData::has_prev_edge_value() const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.RouteData.has_prev_edge_value)
-  return _internal_has_prev_edge_value();
+inline void HubLabels::clear_in_label_count() {
+  _impl_.in_label_count_.Clear();
 }
-inline void RouteData::_internal_set_has_prev_edge_value(bool value) {
-  
-  has_prev_edge_value_ = value;
+inline uint32_t HubLabels::_internal_in_label_count(int index) const {
+  return _impl_.in_label_count_.Get(index);
 }
-inline void RouteData::set_has_prev_edge_value(bool value) {
-  _internal_set_has_prev_edge_value(value);
-  // @@protoc_insertion_point(field_set:TransCatSerial.RouteData.has_prev_edge_value)
+inline uint32_t HubLabels::in_label_count(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.HubLabels.in_label_count)
+  return _internal_in_label_count(index);
+}
+inline void HubLabels::set_in_label_count(int index, uint32_t value) {
+  _impl_.in_label_count_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.HubLabels.in_label_count)
+}
+inline void HubLabels::_internal_add_in_label_count(uint32_t value) {
+  _impl_.in_label_count_.Add(value);
+}
+inline void HubLabels::add_in_label_count(uint32_t value) {
+  _internal_add_in_label_count(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.HubLabels.in_label_count)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+HubLabels::_internal_in_label_count() const {
+  return _impl_.in_label_count_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+HubLabels::in_label_count() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.HubLabels.in_label_count)
+  return _internal_in_label_count();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+HubLabels::_internal_mutable_in_label_count() {
+  return &_impl_.in_label_count_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+HubLabels::mutable_in_label_count() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.HubLabels.in_label_count)
+  return _internal_mutable_in_label_count();
 }
 
-// uint32 prev_edge = 4;
-inline void RouteData::clear_prev_edge() {
-  prev_edge_ = 0u;
+// repeated uint32 in_hub_delta = 3;
+inline int HubLabels::_internal_in_hub_delta_size() const {
+  return _impl_.in_hub_delta_.size();
 }
-inline uint32_t RouteData::_internal_prev_edge() const {
-  return prev_edge_;
+inline int HubLabels::in_hub_delta_size() const {
+  return _internal_in_hub_delta_size();
 }
-inline uint32_t RouteData::prev_edge() const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.RouteData.prev_edge)
-  return _internal_prev_edge();
+inline void HubLabels::clear_in_hub_delta() {
+  _impl_.in_hub_delta_.Clear();
 }
-inline void RouteData::_internal_set_prev_edge(uint32_t value) {
-  
-  prev_edge_ = value;
+inline uint32_t HubLabels::_internal_in_hub_delta(int index) const {
+  return _impl_.in_hub_delta_.Get(index);
 }
-inline void RouteData::set_prev_edge(uint32_t value) {
-  _internal_set_prev_edge(value);
-  // @@protoc_insertion_point(field_set:TransCatSerial.RouteData.prev_edge)
+inline uint32_t HubLabels::in_hub_delta(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.HubLabels.in_hub_delta)
+  return _internal_in_hub_delta(index);
+}
+inline void HubLabels::set_in_hub_delta(int index, uint32_t value) {
+  _impl_.in_hub_delta_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.HubLabels.in_hub_delta)
+}
+inline void HubLabels::_internal_add_in_hub_delta(uint32_t value) {
+  _impl_.in_hub_delta_.Add(value);
+}
+inline void HubLabels::add_in_hub_delta(uint32_t value) {
+  _internal_add_in_hub_delta(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.HubLabels.in_hub_delta)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+HubLabels::_internal_in_hub_delta() const {
+  return _impl_.in_hub_delta_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+HubLabels::in_hub_delta() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.HubLabels.in_hub_delta)
+  return _internal_in_hub_delta();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+HubLabels::_internal_mutable_in_hub_delta() {
+  return &_impl_.in_hub_delta_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+HubLabels::mutable_in_hub_delta() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.HubLabels.in_hub_delta)
+  return _internal_mutable_in_hub_delta();
 }
 
-// -------------------------------------------------------------------
+// repeated double in_weight = 4;
+inline int HubLabels::_internal_in_weight_size() const {
+  return _impl_.in_weight_.size();
+}
+inline int HubLabels::in_weight_size() const {
+  return _internal_in_weight_size();
+}
+inline void HubLabels::clear_in_weight() {
+  _impl_.in_weight_.Clear();
+}
+inline double HubLabels::_internal_in_weight(int index) const {
+  return _impl_.in_weight_.Get(index);
+}
+inline double HubLabels::in_weight(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.HubLabels.in_weight)
+  return _internal_in_weight(index);
+}
+inline void HubLabels::set_in_weight(int index, double value) {
+  _impl_.in_weight_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.HubLabels.in_weight)
+}
+inline void HubLabels::_internal_add_in_weight(double value) {
+  _impl_.in_weight_.Add(value);
+}
+inline void HubLabels::add_in_weight(double value) {
+  _internal_add_in_weight(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.HubLabels.in_weight)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+HubLabels::_internal_in_weight() const {
+  return _impl_.in_weight_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+HubLabels::in_weight() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.HubLabels.in_weight)
+  return _internal_in_weight();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+HubLabels::_internal_mutable_in_weight() {
+  return &_impl_.in_weight_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+HubLabels::mutable_in_weight() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.HubLabels.in_weight)
+  return _internal_mutable_in_weight();
+}
 
-// RoutesSecIndexData
+// repeated uint32 in_edge = 5;
+inline int HubLabels::_internal_in_edge_size() const {
+  return _impl_.in_edge_.size();
+}
+inline int HubLabels::in_edge_size() const {
+  return _internal_in_edge_size();
+}
+inline void HubLabels::clear_in_edge() {
+  _impl_.in_edge_.Clear();
+}
+inline uint32_t HubLabels::_internal_in_edge(int index) const {
+  return _impl_.in_edge_.Get(index);
+}
+inline uint32_t HubLabels::in_edge(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.HubLabels.in_edge)
+  return _internal_in_edge(index);
+}
+inline void HubLabels::set_in_edge(int index, uint32_t value) {
+  _impl_.in_edge_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.HubLabels.in_edge)
+}
+inline void HubLabels::_internal_add_in_edge(uint32_t value) {
+  _impl_.in_edge_.Add(value);
+}
+inline void HubLabels::add_in_edge(uint32_t value) {
+  _internal_add_in_edge(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.HubLabels.in_edge)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+HubLabels::_internal_in_edge() const {
+  return _impl_.in_edge_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+HubLabels::in_edge() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.HubLabels.in_edge)
+  return _internal_in_edge();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+HubLabels::_internal_mutable_in_edge() {
+  return &_impl_.in_edge_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+HubLabels::mutable_in_edge() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.HubLabels.in_edge)
+  return _internal_mutable_in_edge();
+}
 
-// repeated .TransCatSerial.RouteData sec_routes_data = 1;
-inline int RoutesSecIndexData::_internal_sec_routes_data_size() const {
-  return sec_routes_data_.size();
+// repeated uint32 out_label_count = 6;
+inline int HubLabels::_internal_out_label_count_size() const {
+  return _impl_.out_label_count_.size();
 }
-inline int RoutesSecIndexData::sec_routes_data_size() const {
-  return _internal_sec_routes_data_size();
+inline int HubLabels::out_label_count_size() const {
+  return _internal_out_label_count_size();
 }
-inline void RoutesSecIndexData::clear_sec_routes_data() {
-  sec_routes_data_.Clear();
+inline void HubLabels::clear_out_label_count() {
+  _impl_.out_label_count_.Clear();
 }
-inline ::TransCatSerial::RouteData* RoutesSecIndexData::mutable_sec_routes_data(int index) {
-  // @@protoc_insertion_point(field_mutable:TransCatSerial.RoutesSecIndexData.sec_routes_data)
-  return sec_routes_data_.Mutable(index);
+inline uint32_t HubLabels::_internal_out_label_count(int index) const {
+  return _impl_.out_label_count_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::RouteData >*
-RoutesSecIndexData::mutable_sec_routes_data() {
-  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.RoutesSecIndexData.sec_routes_data)
-  return &sec_routes_data_;
+inline uint32_t HubLabels::out_label_count(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.HubLabels.out_label_count)
+  return _internal_out_label_count(index);
 }
-inline const ::TransCatSerial::RouteData& RoutesSecIndexData::_internal_sec_routes_data(int index) const {
-  return sec_routes_data_.Get(index);
+inline void HubLabels::set_out_label_count(int index, uint32_t value) {
+  _impl_.out_label_count_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.HubLabels.out_label_count)
 }
-inline const ::TransCatSerial::RouteData& RoutesSecIndexData::sec_routes_data(int index) const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.RoutesSecIndexData.sec_routes_data)
-  return _internal_sec_routes_data(index);
+inline void HubLabels::_internal_add_out_label_count(uint32_t value) {
+  _impl_.out_label_count_.Add(value);
 }
-inline ::TransCatSerial::RouteData* RoutesSecIndexData::_internal_add_sec_routes_data() {
-  return sec_routes_data_.Add();
+inline void HubLabels::add_out_label_count(uint32_t value) {
+  _internal_add_out_label_count(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.HubLabels.out_label_count)
 }
-inline ::TransCatSerial::RouteData* RoutesSecIndexData::add_sec_routes_data() {
-  ::TransCatSerial::RouteData* _add = _internal_add_sec_routes_data();
-  // @@protoc_insertion_point(field_add:TransCatSerial.RoutesSecIndexData.sec_routes_data)
-  return _add;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+HubLabels::_internal_out_label_count() const {
+  return _impl_.out_label_count_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::RouteData >&
-RoutesSecIndexData::sec_routes_data() const {
-  // @@protoc_insertion_point(field_list:TransCatSerial.RoutesSecIndexData.sec_routes_data)
-  return sec_routes_data_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+HubLabels::out_label_count() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.HubLabels.out_label_count)
+  return _internal_out_label_count();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+HubLabels::_internal_mutable_out_label_count() {
+  return &_impl_.out_label_count_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+HubLabels::mutable_out_label_count() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.HubLabels.out_label_count)
+  return _internal_mutable_out_label_count();
 }
 
-// -------------------------------------------------------------------
+// repeated uint32 out_hub_delta = 7;
+inline int HubLabels::_internal_out_hub_delta_size() const {
+  return _impl_.out_hub_delta_.size();
+}
+inline int HubLabels::out_hub_delta_size() const {
+  return _internal_out_hub_delta_size();
+}
+inline void HubLabels::clear_out_hub_delta() {
+  _impl_.out_hub_delta_.Clear();
+}
+inline uint32_t HubLabels::_internal_out_hub_delta(int index) const {
+  return _impl_.out_hub_delta_.Get(index);
+}
+inline uint32_t HubLabels::out_hub_delta(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.HubLabels.out_hub_delta)
+  return _internal_out_hub_delta(index);
+}
+inline void HubLabels::set_out_hub_delta(int index, uint32_t value) {
+  _impl_.out_hub_delta_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.HubLabels.out_hub_delta)
+}
+inline void HubLabels::_internal_add_out_hub_delta(uint32_t value) {
+  _impl_.out_hub_delta_.Add(value);
+}
+inline void HubLabels::add_out_hub_delta(uint32_t value) {
+  _internal_add_out_hub_delta(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.HubLabels.out_hub_delta)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+HubLabels::_internal_out_hub_delta() const {
+  return _impl_.out_hub_delta_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+HubLabels::out_hub_delta() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.HubLabels.out_hub_delta)
+  return _internal_out_hub_delta();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+HubLabels::_internal_mutable_out_hub_delta() {
+  return &_impl_.out_hub_delta_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+HubLabels::mutable_out_hub_delta() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.HubLabels.out_hub_delta)
+  return _internal_mutable_out_hub_delta();
+}
 
-// RoutesData
+// repeated double out_weight = 8;
+inline int HubLabels::_internal_out_weight_size() const {
+  return _impl_.out_weight_.size();
+}
+inline int HubLabels::out_weight_size() const {
+  return _internal_out_weight_size();
+}
+inline void HubLabels::clear_out_weight() {
+  _impl_.out_weight_.Clear();
+}
+inline double HubLabels::_internal_out_weight(int index) const {
+  return _impl_.out_weight_.Get(index);
+}
+inline double HubLabels::out_weight(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.HubLabels.out_weight)
+  return _internal_out_weight(index);
+}
+inline void HubLabels::set_out_weight(int index, double value) {
+  _impl_.out_weight_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.HubLabels.out_weight)
+}
+inline void HubLabels::_internal_add_out_weight(double value) {
+  _impl_.out_weight_.Add(value);
+}
+inline void HubLabels::add_out_weight(double value) {
+  _internal_add_out_weight(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.HubLabels.out_weight)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+HubLabels::_internal_out_weight() const {
+  return _impl_.out_weight_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+HubLabels::out_weight() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.HubLabels.out_weight)
+  return _internal_out_weight();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+HubLabels::_internal_mutable_out_weight() {
+  return &_impl_.out_weight_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+HubLabels::mutable_out_weight() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.HubLabels.out_weight)
+  return _internal_mutable_out_weight();
+}
 
-// repeated .TransCatSerial.RoutesSecIndexData first_routes_data = 1;
-inline int RoutesData::_internal_first_routes_data_size() const {
-  return first_routes_data_.size();
+// repeated uint32 out_edge = 9;
+inline int HubLabels::_internal_out_edge_size() const {
+  return _impl_.out_edge_.size();
 }
-inline int RoutesData::first_routes_data_size() const {
-  return _internal_first_routes_data_size();
+inline int HubLabels::out_edge_size() const {
+  return _internal_out_edge_size();
 }
-inline void RoutesData::clear_first_routes_data() {
-  first_routes_data_.Clear();
+inline void HubLabels::clear_out_edge() {
+  _impl_.out_edge_.Clear();
 }
-inline ::TransCatSerial::RoutesSecIndexData* RoutesData::mutable_first_routes_data(int index) {
-  // @@protoc_insertion_point(field_mutable:TransCatSerial.RoutesData.first_routes_data)
-  return first_routes_data_.Mutable(index);
+inline uint32_t HubLabels::_internal_out_edge(int index) const {
+  return _impl_.out_edge_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::RoutesSecIndexData >*
-RoutesData::mutable_first_routes_data() {
-  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.RoutesData.first_routes_data)
-  return &first_routes_data_;
+inline uint32_t HubLabels::out_edge(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.HubLabels.out_edge)
+  return _internal_out_edge(index);
 }
-inline const ::TransCatSerial::RoutesSecIndexData& RoutesData::_internal_first_routes_data(int index) const {
-  return first_routes_data_.Get(index);
+inline void HubLabels::set_out_edge(int index, uint32_t value) {
+  _impl_.out_edge_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.HubLabels.out_edge)
 }
-inline const ::TransCatSerial::RoutesSecIndexData& RoutesData::first_routes_data(int index) const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.RoutesData.first_routes_data)
-  return _internal_first_routes_data(index);
+inline void HubLabels::_internal_add_out_edge(uint32_t value) {
+  _impl_.out_edge_.Add(value);
 }
-inline ::TransCatSerial::RoutesSecIndexData* RoutesData::_internal_add_first_routes_data() {
-  return first_routes_data_.Add();
+inline void HubLabels::add_out_edge(uint32_t value) {
+  _internal_add_out_edge(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.HubLabels.out_edge)
 }
-inline ::TransCatSerial::RoutesSecIndexData* RoutesData::add_first_routes_data() {
-  ::TransCatSerial::RoutesSecIndexData* _add = _internal_add_first_routes_data();
-  // @@protoc_insertion_point(field_add:TransCatSerial.RoutesData.first_routes_data)
-  return _add;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+HubLabels::_internal_out_edge() const {
+  return _impl_.out_edge_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::RoutesSecIndexData >&
-RoutesData::first_routes_data() const {
-  // @@protoc_insertion_point(field_list:TransCatSerial.RoutesData.first_routes_data)
-  return first_routes_data_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+HubLabels::out_edge() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.HubLabels.out_edge)
+  return _internal_out_edge();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+HubLabels::_internal_mutable_out_edge() {
+  return &_impl_.out_edge_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+HubLabels::mutable_out_edge() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.HubLabels.out_edge)
+  return _internal_mutable_out_edge();
 }
 
 #ifdef __GNUC__
@@ -1611,6 +3477,12 @@ RoutesData::first_routes_data() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
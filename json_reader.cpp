@@ -1,12 +1,18 @@
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
-#include <unordered_set>
+#include <unordered_map>
 #include <algorithm>
 #include <optional>
 #include <variant>
 #include <fstream>
+#include <stdexcept>
+#include <memory>
+#include <functional>
+#include <chrono>
+#include <cmath>
 
 #include "json_reader.h"
 #include "domain.h"
@@ -15,6 +21,9 @@
 #include "json_builder.h"
 #include "transport_router.h"
 #include "serialization.h"
+#include "base_snapshot.h"
+#include "stats.h"
+#include "parallel.h"
 
 using namespace transport;
 using namespace detail;
@@ -49,12 +58,44 @@ namespace transport::reader
     {
         serial_context_.input_file = rndc.at("file").AsString();
         serial_context_.output_file = rndc.at("file").AsString();
+        if (rndc.count("output_file"))
+            serial_context_.output_file = rndc.at("output_file").AsString();
+        if (rndc.count("routes_delta_encoding"))
+            serial_context_.routes_delta_encoding = rndc.at("routes_delta_encoding").AsBool();
+        if (rndc.count("compression"))
+        {
+            const string& compression = rndc.at("compression").AsString();
+            if (compression == "lz"s)
+                serial_context_.compression = serial::BaseCompression::LZ;
+            else if (compression == "none"s)
+                serial_context_.compression = serial::BaseCompression::NONE;
+            else
+                throw invalid_argument("Unknown base compression type "s + compression);
+        }
     }
 
     void JSONReader::ReadRouterContext(const Dict& rndc)
     {
         router_context_.bus_wait_time = rndc.at("bus_wait_time").AsDouble();
         router_context_.bus_velocity = rndc.at("bus_velocity").AsDouble();
+        if (rndc.count("routing_algorithm"))
+        {
+            const string& routing_algorithm = rndc.at("routing_algorithm").AsString();
+            if (routing_algorithm == "matrix"s)
+                router_context_.route_search = graph::RouteSearch::ROUTES_MATRIX;
+            else if (routing_algorithm == "dijkstra"s)
+                router_context_.route_search = graph::RouteSearch::DIJKSTRA;
+            else if (routing_algorithm == "bidirectional"s)
+                router_context_.route_search = graph::RouteSearch::BIDIRECTIONAL;
+            else if (routing_algorithm == "astar"s)
+                router_context_.route_search = graph::RouteSearch::ASTAR;
+            else if (routing_algorithm == "contraction_hierarchy"s)
+                router_context_.route_search = graph::RouteSearch::CONTRACTION_HIERARCHY;
+            else if (routing_algorithm == "hub_labels"s)
+                router_context_.route_search = graph::RouteSearch::HUB_LABELS;
+            else
+                throw invalid_argument("Unknown routing algorithm "s + routing_algorithm);
+        }
     }
 
     void JSONReader::ReadRenderContext(const Dict& rndc)
@@ -82,6 +123,11 @@ namespace transport::reader
             render_context_.color_palette.push_back(DecodeJSONColor(node));
     }
 
+    JSONReader::JSONReader(const SerializationContext& serial_context, TransportCatalogue& trans_cat) :
+                           json_document_(Node{}), trans_cat_(trans_cat), serial_context_(serial_context),
+                           bus_router_ptr_(nullptr)
+    {}
+
     JSONReader::JSONReader(std::istream& input, TransportCatalogue& trans_cat) :
                            json_document_(Load(input)), trans_cat_(trans_cat), bus_router_ptr_(nullptr)
     {
@@ -101,7 +147,7 @@ namespace transport::reader
         }
     }
 
-    void JSONReader::ProcessAddStopRequest(const Dict& cur_dict)
+    StopDescriptor JSONReader::ReadStopDescriptor(const Dict& cur_dict)
     {
         struct StopDescriptor stop;
         stop.stop_name = cur_dict.at("name").AsString();
@@ -111,11 +157,35 @@ namespace transport::reader
         //Разбираем параметры длины дорожных расстояний
         for (auto road_dist_pair : cur_dict.at("road_distances").AsDict())
             stop.distance_to_stop[road_dist_pair.first] = road_dist_pair.second.AsDouble();
+        if (cur_dict.count("wait_time"))
+        {
+            stop.wait_time = cur_dict.at("wait_time").AsDouble();
+            if (*stop.wait_time < 0)
+                throw invalid_argument("Stop "s + stop.stop_name + " has negative wait time"s);
+        }
+        return stop;
+    }
 
-        trans_cat_.AddStop(stop);
+    void JSONReader::ProcessAddStopRequest(const Dict& cur_dict, TransportCatalogue::Builder& builder)
+    {
+        builder.AddStop(ReadStopDescriptor(cur_dict));
+    }
+
+    void JSONReader::ProcessUpdateStopRequest(const Dict& cur_dict, TransportCatalogue::Builder& builder)
+    {
+        const string& stop_name = cur_dict.at("name").AsString();
+        if (cur_dict.count("removed") && cur_dict.at("removed").AsBool())
+        {
+            builder.RemoveStop(stop_name);
+            return;
+        }
+        builder.UpdateStop(ReadStopDescriptor(cur_dict));
+        if (cur_dict.count("removed_road_distances"))
+            for (const Node& to_stop_node : cur_dict.at("removed_road_distances").AsArray())
+                builder.RemoveDistance(stop_name, to_stop_node.AsString());
     }
 
-    void JSONReader::ProcessAddBusRequest(const Dict& cur_dict)
+    void JSONReader::ProcessAddBusRequest(const Dict& cur_dict, TransportCatalogue::Builder& builder)
     {
         struct BusDescriptor bus;
         bus.bus_name = cur_dict.at("name").AsString();
@@ -127,17 +197,57 @@ namespace transport::reader
 
         for (auto stop_node: cur_dict.at("stops").AsArray())
             bus.bus_stops.push_back(stop_node.AsString());
-        trans_cat_.AddBus(bus);
+
+        // Расписание задаётся списком времён отправления "departures" и (или) интервалом движения "interval"
+        // между первым "first_departure" и последним "last_departure" рейсами.
+        if (cur_dict.count("departures"))
+            for (const Node& departure_node : cur_dict.at("departures").AsArray())
+                bus.departures.push_back(departure_node.AsDouble());
+        if (cur_dict.count("interval"))
+        {
+            const double interval = cur_dict.at("interval").AsDouble();
+            const double first_departure = cur_dict.at("first_departure").AsDouble();
+            const double last_departure = cur_dict.at("last_departure").AsDouble();
+            if (interval <= 0)
+                throw invalid_argument("Bus "s + bus.bus_name + " has non-positive interval"s);
+            // Число рейсов считается заранее, а время каждого - от первого, без накопления ошибки округления:
+            // последний рейс, отстоящий от первого на целое число интервалов, не теряется и не добавляется лишний.
+            if (first_departure <= last_departure)
+            {
+                const auto departure_count =
+                    static_cast<size_t>(floor((last_departure - first_departure) / interval + DEPARTURE_COUNT_TOLERANCE)) + 1;
+                for (size_t departure_num = 0; departure_num < departure_count; ++departure_num)
+                    bus.departures.push_back(first_departure + departure_num * interval);
+            }
+        }
+        if (cur_dict.count("velocity"))
+        {
+            bus.velocity = cur_dict.at("velocity").AsDouble();
+            if (*bus.velocity <= 0)
+                throw invalid_argument("Bus "s + bus.bus_name + " has non-positive velocity"s);
+        }
+        builder.AddBus(bus);
     }
 
     void JSONReader::ProcessAddInfoRequests()
     {
+        // Отложенный раздел маршрутизатора к изменённому справочнику уже не относится,
+        // а контекст картографии дочитывается, чтобы не потерять его.
+        if (base_loader_)
+        {
+            base_loader_->LoadDeferredRenderContext();
+            base_loader_.reset();
+        }
         if (bus_router_ptr_)
         {
             delete bus_router_ptr_;
             bus_router_ptr_ = nullptr;
         }
 
+        // Новые сведения дописываются к уже имеющемуся содержимому справочника, после чего
+        // справочник заменяется вновь построенным.
+        stats::ScopedTimer timer("catalogue_build"sv);
+        TransportCatalogue::Builder builder(trans_cat_);
         for (const Node& cur_request: base_requests_)
         {
             if (!cur_request.IsDict())
@@ -150,104 +260,203 @@ namespace transport::reader
             string request_code = cur_dict.at("type").AsString();
 
             if (request_code == "Stop")
-                ProcessAddStopRequest(cur_dict);
+                ProcessAddStopRequest(cur_dict, builder);
             else if (request_code == "Bus")
-                ProcessAddBusRequest(cur_dict);
+                ProcessAddBusRequest(cur_dict, builder);
         }
+        trans_cat_ = builder.Finalize();
     }
 
-    void JSONReader::ProcessGetBusRequest(const Dict& cur_dict, Builder& result)
+    void JSONReader::ProcessDeltaRequests()
     {
-        string bus_name = cur_dict.at("name").AsString();
-        BusDescriptor bus = trans_cat_.GetBus(bus_name);
+        // Прежний маршрутизатор нужен для пересчёта маршрутной матрицы, а все разделы базы - для
+        // записи новой базы, поэтому отложенные разделы дочитываются до изменения справочника.
+        if (base_loader_)
+        {
+            base_loader_->LoadDeferredRenderContext();
+            base_loader_->LoadDeferredRouter();
+            base_loader_.reset();
+        }
+        unique_ptr<BusRouter> prev_router(bus_router_ptr_);
+        bus_router_ptr_ = nullptr;
+
+        // Раздел "routing_settings" документа изменений задаёт новые общие параметры маршрутизации. При загрузке
+        // базы они были заменены записанными в ней, поэтому читаются повторно.
+        const RouterContext base_router_context = router_context_;
+        if (const Node& root = json_document_.GetRoot();
+            root.IsDict() && root.AsDict().count(ROUTER_SETTINGS_NAME) && root.AsDict().at(ROUTER_SETTINGS_NAME).IsDict())
+            ReadRouterContext(root.AsDict().at(ROUTER_SETTINGS_NAME).AsDict());
+        const bool is_weights_changed = router_context_.bus_wait_time != base_router_context.bus_wait_time ||
+                                        router_context_.bus_velocity != base_router_context.bus_velocity;
+        const bool is_search_changed = router_context_.route_search != base_router_context.route_search;
+        // Если справочник не меняется, граф остаётся прежним: при новых скорости или времени ожидания веса
+        // его рёбер пересчитываются на месте, а маршрутная матрица, иерархия сжатия или метки хабов
+        // рассчитываются по ним заново. Если у базы прежней версии позиции остановок поездных рёбер
+        // восстановить не удалось, маршрутизатор строится заново - иначе они не попадут и в новую базу.
+        if (base_requests_.empty() && prev_router && !is_search_changed && prev_router->CanReweight())
+        {
+            if (is_weights_changed)
+                prev_router->Reweight(router_context_);
+            bus_router_ptr_ = prev_router.release();
+            return;
+        }
 
-        if (bus.bus_type == BusType::BUSTYPE_UNDEFINED)
+        // Изменённый маршрут описывается заново целиком, поэтому прежнее его описание всегда удаляется.
+        stats::ScopedTimer update_timer("catalogue_update"sv);
+        TransportCatalogue::Builder builder(trans_cat_);
+        for (const Node& cur_request: base_requests_)
+        {
+            if (!cur_request.IsDict())
+                continue;
+
+            const Dict& cur_dict = cur_request.AsDict();
+            if (!cur_dict.count("type") || !cur_dict.at("type").IsString())
+                continue;
+
+            string request_code = cur_dict.at("type").AsString();
+
+            if (request_code == "Stop")
+            {
+                ProcessUpdateStopRequest(cur_dict, builder);
+            }
+            else if (request_code == "Bus")
+            {
+                builder.RemoveBus(cur_dict.at("name").AsString());
+                if (!cur_dict.count("removed") || !cur_dict.at("removed").AsBool())
+                    ProcessAddBusRequest(cur_dict, builder);
+            }
+        }
+        trans_cat_ = builder.Finalize();
+        update_timer.Stop();
+
+        // Прежний маршрутизатор ссылается на объект справочника, уже заменённый новым, поэтому
+        // из него используются только граф, маршрутная матрица и имена остановок вершин графа.
+        // Маршрутизатор без маршрутной матрицы быстрее построить заново, а матрица, рассчитанная при прежних
+        // параметрах маршрутизации, для пересчёта не годится.
+        if (prev_router && router_context_.route_search == graph::RouteSearch::ROUTES_MATRIX &&
+            !is_weights_changed && !is_search_changed)
+        {
+            stats::ScopedTimer timer("router_repair"sv);
+            bus_router_ptr_ = new router::BusRouter(router_context_, trans_cat_, *prev_router);
+        }
+        else
+            BuildBusRouter();
+    }
+
+    void JSONReader::ProcessGetBusRequest(const TransportCatalogue& tc, const Dict& cur_dict, Builder& result) const
+    {
+        const uint32_t bus_id = tc.FindBusId(cur_dict.at("name").AsString());
+        const BusType bus_type = bus_id == TransportCatalogue::NO_ID ? BusType::BUSTYPE_UNDEFINED : tc.GetBusType(bus_id);
+
+        if (bus_type == BusType::BUSTYPE_UNDEFINED)
         {
             result.Key("error_message"s).Value("not found"s);
         }
         else
         {
+            const BusDistanceTable& dist_table = tc.GetBusDistanceTable(bus_id);
+            const TransportCatalogue::StopIdsRange bus_stop_ids = tc.GetBusStopIds(bus_id);
+            int stop_counter = 0, stops_all = bus_stop_ids.end() - bus_stop_ids.begin();
             double sum_road_distance = 0, sum_geo_distance = 0;
-            int stop_counter = 0, stops_all = bus.bus_stops.size();
-            unordered_set<string> stops_name;
+            // Число различных остановок - по упорядоченной копии номеров остановок маршрута
+            vector<uint32_t> unique_stop_ids(bus_stop_ids.begin(), bus_stop_ids.end());
+            sort(unique_stop_ids.begin(), unique_stop_ids.end());
+            unique_stop_ids.erase(unique(unique_stop_ids.begin(), unique_stop_ids.end()), unique_stop_ids.end());
 
             if (stops_all)
-                stops_name.insert(bus.bus_stops[0]);
-
-            for (int stop_num = 0; stop_num < stops_all - 1; ++stop_num)
             {
-                auto distance_pair = trans_cat_.CountNeighborsDistance(bus.bus_stops[stop_num],
-                                                                       bus.bus_stops[stop_num + 1]);
-                sum_road_distance += distance_pair.first;
-                sum_geo_distance += distance_pair.second;
-                stops_name.insert(bus.bus_stops[stop_num + 1]);
+                sum_road_distance = dist_table.ForwardRoadDistance(0, stops_all - 1);
+                sum_geo_distance = dist_table.GeoDistance(0, stops_all - 1);
             }
 
-            if (bus.bus_type == BusType::BUSTYPE_ORDINAR)
+            if (bus_type == BusType::BUSTYPE_ORDINAR)
             {
-                for (int stop_num = stops_all - 1; stop_num > 0; --stop_num)
+                if (stops_all)
                 {
-                    auto distance_pair = trans_cat_.CountNeighborsDistance(bus.bus_stops[stop_num],
-                                                                           bus.bus_stops[stop_num - 1]);
-                    sum_road_distance += distance_pair.first;
-                    sum_geo_distance += distance_pair.second;
+                    sum_road_distance += dist_table.BackwardRoadDistance(stops_all - 1, 0);
+                    sum_geo_distance *= 2;
                 }
                 stop_counter = stops_all * 2 - 1;
             }
-            else if (bus.bus_type == BusType::BUSTYPE_CIRCULAR)
+            else if (bus_type == BusType::BUSTYPE_CIRCULAR)
             {
                 stop_counter = stops_all;
             }
 
             result.Key("stop_count"s).Value(stop_counter)
-                  .Key("unique_stop_count").Value(static_cast<int>(stops_name.size()));
+                  .Key("unique_stop_count").Value(static_cast<int>(unique_stop_ids.size()));
             result.Key("route_length"s).Value(sum_road_distance)
                   .Key("curvature"s).Value(sum_road_distance / sum_geo_distance);
         }
     }
 
-    void JSONReader::ProcessGetStopRequest(const Dict& cur_dict, Builder& result)
+    void JSONReader::ProcessGetStopRequest(const TransportCatalogue& tc, const Dict& cur_dict, Builder& result) const
     {
-        string stop_name = cur_dict.at("name").AsString();
-        StopDescriptor stop = trans_cat_.GetStop(stop_name);
-        int buses_all = stop.buses_at_stop.size();
+        const string& stop_name = cur_dict.at("name").AsString();
+        auto buses_at_stop = tc.GetBusesAtStop(stop_name);
 
-        if (stop.stop_type == StopType::STOPTYPE_UNDEFINED)
+        if (!buses_at_stop)
         {
             result.Key("error_message"s).Value("not found"s);
         }
-        else if (!buses_all)
-        {
-            result.Key("buses"s).StartArray().EndArray();
-        }
         else
         {
+            // Имена маршрутов уже хранятся в справочнике без повторов и в нужном порядке.
             result.Key("buses"s).StartArray();
-            for_each(stop.buses_at_stop.begin(), stop.buses_at_stop.end(),
-                     [&result](const string& stop_name)
-                     {result.Value(stop_name);});
+            for (const string& bus_name : *buses_at_stop)
+                result.Value(bus_name);
             result.EndArray();
         }
     }
 
     void JSONReader::BuildBusRouter()
     {
+        stats::ScopedTimer timer("router_build"sv);
         if (bus_router_ptr_)
             delete bus_router_ptr_;
         bus_router_ptr_ = new router::BusRouter(router_context_, trans_cat_);
     }
 
-    void JSONReader::ProcessRouteRequest(const Dict& cur_dict, Builder& result)
+    void JSONReader::ProcessRouteRequest(const router::BusRouter& bus_router, const Dict& cur_dict, Builder& result) const
     {
-        if (!bus_router_ptr_)
-            BuildBusRouter();
-        auto route_result = bus_router_ptr_->DoRoute(cur_dict.at("from").AsString(), cur_dict.at("to").AsString());
-        if (route_result)
+        // Альтернативные маршруты строятся только по требованию: "alternatives" - их наибольшее количество,
+        // "max_stretch" - наибольшее отношение времени поездки по ним к кратчайшему времени. Если задан момент
+        // отправления "departure_time", маршрут строится по расписаниям автобусов, и альтернатив у него нет.
+        const bool is_timetable_route = cur_dict.count("departure_time") > 0;
+        const int max_alternatives = !is_timetable_route && cur_dict.count("alternatives") ?
+                                     cur_dict.at("alternatives").AsInt() : 0;
+        vector<RouteResult> route_results;
+        if (is_timetable_route)
+        {
+            if (auto route_result = bus_router.DoTimetableRoute(cur_dict.at("from").AsString(), cur_dict.at("to").AsString(),
+                                                                cur_dict.at("departure_time").AsDouble()))
+                route_results.push_back(move(*route_result));
+        }
+        else if (max_alternatives > 0)
+        {
+            const double max_stretch = cur_dict.count("max_stretch") ? cur_dict.at("max_stretch").AsDouble()
+                                                                     : DEFAULT_ALTERNATIVE_MAX_STRETCH;
+            route_results = bus_router.DoAlternativeRoutes(cur_dict.at("from").AsString(), cur_dict.at("to").AsString(),
+                                                           max_alternatives, max_stretch);
+        }
+        else if (auto route_result = bus_router.DoRoute(cur_dict.at("from").AsString(), cur_dict.at("to").AsString()))
+        {
+            route_results.push_back(move(*route_result));
+        }
+        PrintRouteResults(route_results, cur_dict, result);
+    }
+
+    void JSONReader::PrintRouteResults(const vector<RouteResult>& route_results, const Dict& cur_dict, Builder& result) const
+    {
+        const bool is_timetable_route = cur_dict.count("departure_time") > 0;
+        const int max_alternatives = !is_timetable_route && cur_dict.count("alternatives") ?
+                                     cur_dict.at("alternatives").AsInt() : 0;
+        auto print_route = [&result](const RouteResult& route_result)
         {
-            result.Key("total_time"s).Value(route_result->total_time);
+            result.Key("total_time"s).Value(route_result.total_time);
             result.Key("items"s).StartArray();
 
-            for (const RouteItem& route_item: route_result->route_items)
+            for (const RouteItem& route_item: route_result.route_items)
                 if (holds_alternative<WaitEvent>(route_item))
                 {
                     const WaitEvent& we = get<WaitEvent>(route_item);
@@ -267,6 +476,25 @@ namespace transport::reader
                 }
 
             result.EndArray();
+        };
+
+        if (!route_results.empty())
+        {
+            print_route(route_results.front());
+            if (is_timetable_route)
+                result.Key("arrival_time"s).Value(cur_dict.at("departure_time").AsDouble() +
+                                                  route_results.front().total_time);
+            if (max_alternatives > 0)
+            {
+                result.Key("alternatives"s).StartArray();
+                for (size_t route_num = 1; route_num < route_results.size(); ++route_num)
+                {
+                    result.StartDict();
+                    print_route(route_results[route_num]);
+                    result.EndDict();
+                }
+                result.EndArray();
+            }
         }
         else
         {
@@ -274,13 +502,168 @@ namespace transport::reader
         }
     }
 
+    bool JSONReader::IsBatchableRouteRequest(const Dict& cur_dict)
+    {
+        return cur_dict.count("type") && cur_dict.at("type").IsString() && cur_dict.at("type").AsString() == "Route" &&
+               cur_dict.count("id") && cur_dict.at("id").IsInt() &&
+               cur_dict.count("from") && cur_dict.at("from").IsString() && cur_dict.count("to") && cur_dict.at("to").IsString() &&
+               !cur_dict.count("departure_time") &&
+               !(cur_dict.count("alternatives") && cur_dict.at("alternatives").IsInt() && cur_dict.at("alternatives").AsInt() > 0);
+    }
+
+    JSONReader::BatchedRoutes JSONReader::BuildBatchedRoutes(const BusRouter& bus_router) const
+    {
+        // Обычные запросы "Route" (без расписания и альтернатив) группируются по начальной остановке, и маршруты
+        // до всех конечных остановок группы строятся одним поиском, а группы обрабатываются параллельно.
+        // Время поиска группы делится поровну между её запросами.
+        struct RouteGroup
+        {
+            string from;
+            vector<string> targets;
+            vector<size_t> request_nums;
+        };
+        vector<RouteGroup> groups;
+        unordered_map<string, size_t> from_to_group;
+        for (size_t request_num = 0; request_num < stat_requests_.size(); ++request_num)
+        {
+            const Node& cur_request = stat_requests_[request_num];
+            if (!cur_request.IsDict() || !IsBatchableRouteRequest(cur_request.AsDict()))
+                continue;
+            const Dict& cur_dict = cur_request.AsDict();
+            const string& from = cur_dict.at("from").AsString();
+            auto [group_it, is_added] = from_to_group.emplace(from, groups.size());
+            if (is_added)
+                groups.push_back({from, {}, {}});
+            RouteGroup& group = groups[group_it->second];
+            group.targets.push_back(cur_dict.at("to").AsString());
+            group.request_nums.push_back(request_num);
+        }
+
+        const bool is_stats_enabled = stats::IsEnabled();
+        BatchedRoutes result;
+        result.routes.resize(stat_requests_.size());
+        if (is_stats_enabled)
+            result.search_times.resize(stat_requests_.size());
+        parallel::ParallelFor(groups.size(), 0, [&](size_t group_num)
+        {
+            const RouteGroup& group = groups[group_num];
+            const auto search_start = is_stats_enabled ? chrono::steady_clock::now() : chrono::steady_clock::time_point{};
+            auto routes = bus_router.DoRoutes(group.from, group.targets);
+            const auto search_time = is_stats_enabled ?
+                (chrono::steady_clock::now() - search_start) / static_cast<int>(routes.size()) : chrono::steady_clock::duration{};
+            for (size_t i = 0; i < routes.size(); ++i)
+            {
+                vector<RouteResult>& route_results = result.routes[group.request_nums[i]].emplace();
+                if (routes[i])
+                    route_results.push_back(move(*routes[i]));
+                if (is_stats_enabled)
+                    result.search_times[group.request_nums[i]] = search_time;
+            }
+        });
+        return result;
+    }
+
+    void JSONReader::ProcessMatrixRequest(const router::BusRouter& bus_router, const Dict& cur_dict, Builder& result) const
+    {
+        auto read_stop_names = [](const Node& node)
+        {
+            vector<string> stop_names;
+            for (const Node& stop_name : node.AsArray())
+                stop_names.push_back(stop_name.AsString());
+            return stop_names;
+        };
+        const auto travel_times = bus_router.ComputeTravelTimes(read_stop_names(cur_dict.at("sources")),
+                                                                read_stop_names(cur_dict.at("targets")));
+        // Отсутствующий маршрут обозначается значением null.
+        result.Key("total_times"s).StartArray();
+        for (const auto& row : travel_times)
+        {
+            result.StartArray();
+            for (const optional<double>& travel_time : row)
+                if (travel_time)
+                    result.Value(*travel_time);
+                else
+                    result.Value(nullptr);
+            result.EndArray();
+        }
+        result.EndArray();
+    }
+
+    void JSONReader::ProcessIsochroneRequest(const TransportCatalogue& tc,
+                                             const function<const MapRendererContext&()>& get_render_context,
+                                             const router::BusRouter& bus_router, const Dict& cur_dict,
+                                             Builder& result) const
+    {
+        const double max_time = cur_dict.at("max_time").AsDouble();
+        const auto arrivals = bus_router.ComputeIsochrone(cur_dict.at("from").AsString(), max_time);
+        if (!arrivals)
+        {
+            result.Key("error_message"s).Value("not found"s);
+            return;
+        }
+        result.Key("stops"s).StartArray();
+        for (const StopArrival& arrival : *arrivals)
+            result.StartDict().Key("stop_name"s).Value(string(arrival.stop_name))
+                              .Key("time"s).Value(arrival.time)
+                              .EndDict();
+        result.EndArray();
+        // Изображение изохроны строится только по требованию.
+        if (cur_dict.count("render_map") && cur_dict.at("render_map").AsBool())
+        {
+            svg::Document doc = MapRenderer(get_render_context()).RenderIsochrone(tc, *arrivals, max_time);
+            ostringstream ostr;
+            doc.Render(ostr);
+            result.Key("map"s).Value(ostr.str());
+        }
+    }
+
     json::Document JSONReader::ProcessGetInfoRequests()
     {
+        // Контекст картографии и маршрутизатор загружаются или строятся при первом запросе, которому они нужны.
+        return ProcessStatRequests(trans_cat_,
+                                   [this]() -> const MapRendererContext&
+                                   {
+                                       if (base_loader_)
+                                           base_loader_->LoadDeferredRenderContext();
+                                       return render_context_;
+                                   },
+                                   [this]() -> const BusRouter&
+                                   {
+                                       if (!bus_router_ptr_ && !(base_loader_ && base_loader_->LoadDeferredRouter()))
+                                           BuildBusRouter();
+                                       return *bus_router_ptr_;
+                                   });
+    }
+
+    json::Document JSONReader::ProcessGetInfoRequests(const BaseSnapshot& snapshot) const
+    {
+        return ProcessStatRequests(snapshot.catalogue,
+                                   [&snapshot]() -> const MapRendererContext& {return snapshot.render_context;},
+                                   [&snapshot]() -> const BusRouter& {return *snapshot.bus_router;});
+    }
+
+    json::Document JSONReader::ProcessStatRequests(const TransportCatalogue& tc,
+                                                   const function<const MapRendererContext&()>& get_render_context,
+                                                   const function<const BusRouter&()>& get_bus_router) const
+    {
+        stats::ScopedTimer timer("stat_requests"sv);
+        const bool is_stats_enabled = stats::IsEnabled();
         Builder result;
         result.StartArray();
 
-        for (const Node& cur_request: stat_requests_)
+        // Маршрутизатор загружается до начала замера пакета, чтобы его загрузка не попала в этап "route_batch".
+        BatchedRoutes batched_routes;
+        if (any_of(stat_requests_.begin(), stat_requests_.end(),
+                   [](const Node& cur_request) {return cur_request.IsDict() && IsBatchableRouteRequest(cur_request.AsDict());}))
         {
+            const BusRouter& bus_router = get_bus_router();
+            stats::ScopedTimer batch_timer("route_batch"sv);
+            batched_routes = BuildBatchedRoutes(bus_router);
+        }
+
+        for (size_t request_num = 0; request_num < stat_requests_.size(); ++request_num)
+        {
+            const Node& cur_request = stat_requests_[request_num];
             if (!cur_request.IsDict())
                 continue;
 
@@ -291,44 +674,84 @@ namespace transport::reader
 
             string request_code = cur_dict.at("type").AsString();
             int request_id = cur_dict.at("id").AsInt();
+            auto request_start = is_stats_enabled ? chrono::steady_clock::now() : chrono::steady_clock::time_point{};
+            string_view latency_type = request_code;
             result.StartDict();
 
             if (request_code == "Bus")
             {
-                ProcessGetBusRequest(cur_dict, result);
+                ProcessGetBusRequest(tc, cur_dict, result);
             }
             else if (request_code == "Stop")
             {
-                ProcessGetStopRequest(cur_dict, result);
+                ProcessGetStopRequest(tc, cur_dict, result);
             }
             else if (request_code == "Map")
             {
-                svg::Document doc = MapRenderer(render_context_).Render(trans_cat_);
+                svg::Document doc = MapRenderer(get_render_context()).Render(tc);
                 ostringstream ostr;
                 doc.Render(ostr);
                 result.Key("map"s).Value(ostr.str());
             }
             else if (request_code == "Route")
             {
-                ProcessRouteRequest(cur_dict, result);
+                if (request_num < batched_routes.routes.size() && batched_routes.routes[request_num])
+                {
+                    // Пакетный запрос учитывается отдельно: его время - доля поиска группы и вывод ответа.
+                    PrintRouteResults(*batched_routes.routes[request_num], cur_dict, result);
+                    latency_type = "RouteBatched"sv;
+                    if (is_stats_enabled)
+                        request_start -= batched_routes.search_times[request_num];
+                }
+                else
+                    ProcessRouteRequest(get_bus_router(), cur_dict, result);
+            }
+            else if (request_code == "Matrix")
+            {
+                ProcessMatrixRequest(get_bus_router(), cur_dict, result);
+            }
+            else if (request_code == "Isochrone")
+            {
+                ProcessIsochroneRequest(tc, get_render_context, get_bus_router(), cur_dict, result);
             }
 
             result.Key("request_id"s).Value(request_id).EndDict();
+            if (is_stats_enabled)
+                stats::RecordLatency(latency_type, chrono::steady_clock::now() - request_start);
         }
 
         return json::Document(result.EndArray().Build());
     }
 
+    void JSONReader::ExportSnapshot(BaseSnapshot& snapshot)
+    {
+        if (base_loader_)
+        {
+            base_loader_->LoadDeferredRenderContext();
+            if (!bus_router_ptr_)
+                base_loader_->LoadDeferredRouter();
+            base_loader_.reset();
+        }
+        if (!bus_router_ptr_)
+            BuildBusRouter();
+        snapshot.router_context = router_context_;
+        snapshot.render_context = render_context_;
+        snapshot.bus_router.reset(bus_router_ptr_);
+        bus_router_ptr_ = nullptr;
+    }
+
     void JSONReader::ProcessSerialize()
     {
+        stats::ScopedTimer timer("serialize"sv);
         Serializer sr(*this);
         sr.Serialize();
     }
 
     void JSONReader::ProcessDeserialize()
     {
-        Serializer sr(*this);
-        sr.Deserialize();
+        stats::ScopedTimer timer("deserialize"sv);
+        base_loader_ = make_unique<Serializer>(*this);
+        base_loader_->Deserialize();
     }
 
 } //namespace transport::reader
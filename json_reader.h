@@ -1,6 +1,9 @@
 #pragma once
 #include <iostream>
 #include <string>
+#include <memory>
+#include <functional>
+#include <chrono>
 
 #include "json.h"
 #include "json_builder.h"
@@ -10,6 +13,11 @@
 #include "transport_router.h"
 #include "serialization.h"
 
+namespace transport
+{
+    struct BaseSnapshot;
+}
+
 namespace transport::reader
 {
     class JSONReader
@@ -17,16 +25,28 @@ namespace transport::reader
     public:
         friend class serial::Serializer;
         JSONReader(std::istream& input, TransportCatalogue& trans_cat);
+        // Посредник без документа запросов - для загрузки базы с заданными настройками сериализации.
+        JSONReader(const serial::SerializationContext& serial_context, TransportCatalogue& trans_cat);
         // Публичный метод для исполнения запросов на ввод информации в базу данных
         void ProcessAddInfoRequests();
+        // Публичный метод для внесения изменений в загруженную из базы информацию: запросы на ввод
+        // добавляют, заменяют или удаляют остановки, маршруты и расстояния, а маршрутная матрица
+        // пересчитывается по прежней без полного перестроения. Новые общие параметры маршрутизации из
+        // "routing_settings" при неизменном справочнике применяются пересчётом весов рёбер прежнего графа.
+        void ProcessDeltaRequests();
         // Публичный метод для исполнения запросов для получения информации из базы данных
         json::Document ProcessGetInfoRequests();
+        // Исполняет запросы на получение информации по данным снимка snapshot, а не собственного справочника.
+        json::Document ProcessGetInfoRequests(const BaseSnapshot& snapshot) const;
         // Метод для принудительной постройки или перестройки маршрутизирующего графа на основе
         // текущего состояния базы данных транспортного справочника.
         void BuildBusRouter();
         // Исполнители запросов на упоследование/распоследование
         void ProcessSerialize();
         void ProcessDeserialize();
+        // Переносит загруженное состояние в снимок, справочник которого служит справочником
+        // этого посредника (см. LoadBaseSnapshot). Недостающие разделы базы догружаются.
+        void ExportSnapshot(BaseSnapshot& snapshot);
 
         inline size_t GetRequestsSize(bool is_get_info_reqs)
         {
@@ -46,6 +66,11 @@ namespace transport::reader
         static constexpr char RENDER_SETTINGS_NAME[] = "render_settings";
         static constexpr char ROUTER_SETTINGS_NAME[] = "routing_settings";
         static constexpr char SERIAL_SETTINGS_NAME[] = "serialization_settings";
+        // Наибольшее отношение времени поездки по альтернативному маршруту к кратчайшему, если в запросе
+        // "Route" оно не задано
+        static constexpr double DEFAULT_ALTERNATIVE_MAX_STRETCH = 1.5;
+        // Допуск при подсчёте числа рейсов между "first_departure" и "last_departure" (в долях интервала)
+        static constexpr double DEPARTURE_COUNT_TOLERANCE = 1e-9;
 
         json::Document json_document_;
         transport::TransportCatalogue& trans_cat_;
@@ -55,18 +80,41 @@ namespace transport::reader
         serial::SerializationContext serial_context_;
         router::RouterContext router_context_;
         router::BusRouter *bus_router_ptr_;
+        // Загрузчик распоследованной базы, хранящий сведения о ещё не прочитанных её разделах
+        std::unique_ptr<serial::Serializer> base_loader_;
 
         // Считыватели контекстной информации
         void ReadRouterContext(const json::Dict& rndc);
         void ReadRenderContext(const json::Dict& rndc);
         void ReadSerializationContext(const json::Dict& rndc);
         // Исполнители запросов на ввод
-        void ProcessAddBusRequest(const json::Dict& cur_dict);
-        void ProcessAddStopRequest(const json::Dict& cur_dict);
+        void ProcessAddBusRequest(const json::Dict& cur_dict, TransportCatalogue::Builder& builder);
+        void ProcessAddStopRequest(const json::Dict& cur_dict, TransportCatalogue::Builder& builder);
+        void ProcessUpdateStopRequest(const json::Dict& cur_dict, TransportCatalogue::Builder& builder);
+        static StopDescriptor ReadStopDescriptor(const json::Dict& cur_dict);
         // Исполнители запросов на вывод
-        void ProcessGetBusRequest(const json::Dict& cur_dict, json::Builder& result);
-        void ProcessGetStopRequest(const json::Dict& cur_dict, json::Builder& result);
-        void ProcessRouteRequest(const json::Dict& cur_dict, json::Builder& result);
+        json::Document ProcessStatRequests(const TransportCatalogue& tc,
+                                           const std::function<const renderer::MapRendererContext&()>& get_render_context,
+                                           const std::function<const router::BusRouter&()>& get_bus_router) const;
+        void ProcessGetBusRequest(const TransportCatalogue& tc, const json::Dict& cur_dict, json::Builder& result) const;
+        void ProcessGetStopRequest(const TransportCatalogue& tc, const json::Dict& cur_dict, json::Builder& result) const;
+        void ProcessRouteRequest(const router::BusRouter& bus_router, const json::Dict& cur_dict, json::Builder& result) const;
+        void PrintRouteResults(const std::vector<router::RouteResult>& route_results, const json::Dict& cur_dict,
+                               json::Builder& result) const;
+        static bool IsBatchableRouteRequest(const json::Dict& cur_dict);
+        // Маршруты пакетных запросов "Route", индексированные номерами запросов (nullopt - запрос в пакет не вошёл),
+        // и приходящиеся на каждый запрос доли времени поиска его группы (только при сборе статистики).
+        struct BatchedRoutes
+        {
+            std::vector<std::optional<std::vector<router::RouteResult>>> routes;
+            std::vector<std::chrono::steady_clock::duration> search_times;
+        };
+        BatchedRoutes BuildBatchedRoutes(const router::BusRouter& bus_router) const;
+        void ProcessMatrixRequest(const router::BusRouter& bus_router, const json::Dict& cur_dict, json::Builder& result) const;
+        void ProcessIsochroneRequest(const TransportCatalogue& tc,
+                                     const std::function<const renderer::MapRendererContext&()>& get_render_context,
+                                     const router::BusRouter& bus_router, const json::Dict& cur_dict,
+                                     json::Builder& result) const;
         // Вспомогательные методы класса
         svg::Color DecodeJSONColor(const json::Node& node);
     };
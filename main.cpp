@@ -3,9 +3,11 @@
 #include <string_view>
 #include <filesystem>
 #include <stdexcept>
+#include <vector>
 
 #include "json_reader.h"
 #include "transport_catalogue.h"
+#include "stats.h"
 
 using namespace std;
 using namespace std::filesystem;
@@ -24,7 +26,8 @@ enum class ErrCodes
 
 void PrintUsage(std::ostream& stream = std::cerr)
 {
-    stream << " : transport_catalogue [make_base|process_requests] <_>\n"sv;
+    stream << " : transport_catalogue [--stats] [make_base|make_delta|process_requests] <_>\n"
+              "    --stats -         ,    \n"sv;
 }
 
 void ErrorCodeAnalize(ErrCodes err_code)
@@ -49,11 +52,21 @@ int main(int argc, char* argv[])
 {
     ErrCodes err_code = ErrCodes::ERRCODE_NO_ERROR;
 
-    if (argc != 3)
+    //  --stats       
+    vector<string_view> args;
+    bool print_stats = false;
+    for (int i = 1; i < argc; ++i)
+        if (argv[i] == "--stats"sv)
+            print_stats = true;
+        else
+            args.push_back(argv[i]);
+    if (args.size() != 2)
         ErrorCodeAnalize(ErrCodes::ERRCODE_BAD_COMMAND);
+    if (print_stats)
+        stats::Enable();
 
-    const string_view mode(argv[1]);
-    path infile_path(argv[2]);
+    const string_view mode(args[0]);
+    path infile_path(args[1]);
     if (!exists(infile_path))
         ErrorCodeAnalize(ErrCodes::ERRCODE_INPUT_FILE_NOT_FOUND);
     ifstream ifile(infile_path.c_str());
@@ -65,7 +78,10 @@ int main(int argc, char* argv[])
         transport::TransportCatalogue trans_cat;
         try
         {
+            stats::ScopedTimer mode_timer(mode);
+            stats::ScopedTimer parse_timer("json_parse"sv);
             transport::reader::JSONReader jsr(ifile, trans_cat);
+            parse_timer.Stop();
             jsr.ProcessAddInfoRequests();
             jsr.BuildBusRouter();
             jsr.ProcessSerialize();
@@ -76,6 +92,25 @@ int main(int argc, char* argv[])
             ErrorCodeAnalize(ErrCodes::ERRCODE_TRANSPORT_CATALOGUE_REQUEST_ERROR);
         }
     }
+    else if (mode == "make_delta"sv)
+    {
+        transport::TransportCatalogue trans_cat;
+        try
+        {
+            stats::ScopedTimer mode_timer(mode);
+            stats::ScopedTimer parse_timer("json_parse"sv);
+            transport::reader::JSONReader jsr(ifile, trans_cat);
+            parse_timer.Stop();
+            jsr.ProcessDeserialize();
+            jsr.ProcessDeltaRequests();
+            jsr.ProcessSerialize();
+        }
+        catch (const exception& exc)
+        {
+            cerr << exc.what() << endl;
+            ErrorCodeAnalize(ErrCodes::ERRCODE_TRANSPORT_CATALOGUE_REQUEST_ERROR);
+        }
+    }
     else if (mode == "process_requests"sv)
     {
         ofstream ofile(infile_path.stem().concat(".out"sv).c_str());
@@ -84,9 +119,13 @@ int main(int argc, char* argv[])
         transport::TransportCatalogue trans_cat;
         try
         {
+            stats::ScopedTimer mode_timer(mode);
+            stats::ScopedTimer parse_timer("json_parse"sv);
             transport::reader::JSONReader jsr(ifile, trans_cat);
+            parse_timer.Stop();
             jsr.ProcessDeserialize();
             json::Document doc = jsr.ProcessGetInfoRequests();
+            stats::ScopedTimer output_timer("output"sv);
             Print(doc, cout);
             Print(doc, ofile);
         }
@@ -100,4 +139,7 @@ int main(int argc, char* argv[])
     {
         ErrorCodeAnalize(ErrCodes::ERRCODE_BAD_COMMAND);
     }
+
+    if (print_stats)
+        stats::PrintReport(cerr);
 }
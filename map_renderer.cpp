@@ -69,6 +69,17 @@ namespace renderer
     }
 
     svg::Document MapRenderer::Render(const TransportCatalogue& tc)
+    {
+        return Render(tc, nullptr, 0);
+    }
+
+    svg::Document MapRenderer::RenderIsochrone(const TransportCatalogue& tc, const vector<StopArrival>& arrivals,
+                                               double max_time)
+    {
+        return Render(tc, &arrivals, max_time);
+    }
+
+    svg::Document MapRenderer::Render(const TransportCatalogue& tc, const vector<StopArrival>* arrivals, double max_time)
     {
         svg::Document result;
         struct BusDescriptorComparator
@@ -164,6 +175,21 @@ namespace renderer
             if (color_number >= render_context_.color_palette.size())
                 color_number = 0;
         }
+        //Изохрона - полупрозрачные круги под кругами достижимых остановок
+        if (arrivals)
+            for (const StopArrival& arrival : *arrivals)
+            {
+                auto stop_coords_it = stop_coords.find(string(arrival.stop_name));
+                if (stop_coords_it == stop_coords.end())
+                    continue;
+                const double time_share = max_time > ZERO_TOLERANCE ? clamp(arrival.time / max_time, 0.0, 1.0) : 0.0;
+                Circle circle;
+                circle.SetCenter(ConvertToRenderCoords(stop_coords_it->second, mp))
+                      .SetRadius(render_context_.stop_radius * 2)
+                      .SetFillColor(Rgba(static_cast<uint8_t>(lround(255 * time_share)),
+                                         static_cast<uint8_t>(lround(255 * (1 - time_share))), 0, 0.7));
+                result.Add(circle);
+            }
         //Рисуем круги остановок
         for (auto stop_coords_pair : stop_coords)
         {
@@ -37,6 +37,10 @@ namespace renderer
         MapRenderer(const MapRendererContext& rc) : render_context_(rc)
         {}
         svg::Document Render(const transport::TransportCatalogue& tc);
+        // Изображение сети с наложенной изохроной: остановки из arrivals выделяются кругами, цвет которых
+        // меняется от зелёного (время поездки 0) до красного (время поездки max_time).
+        svg::Document RenderIsochrone(const transport::TransportCatalogue& tc,
+                                      const std::vector<transport::StopArrival>& arrivals, double max_time);
 
     private:
 
@@ -59,5 +63,7 @@ namespace renderer
                                  bool is_undertext, const std::string& data) const;
         svg::Text FormStopCaption(svg::Point stop_point,
                                   bool is_undertext, const std::string& data) const;
+        svg::Document Render(const transport::TransportCatalogue& tc,
+                             const std::vector<transport::StopArrival>* arrivals, double max_time);
     };
 }
@@ -16,47 +16,54 @@
 #include <google/protobuf/port_def.inc>
 
 PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
 namespace TransCatSerial {
-constexpr MapRendererContext::MapRendererContext(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : color_palette_()
-  , bus_label_offset_(nullptr)
-  , stop_label_offset_(nullptr)
-  , underlayer_color_(nullptr)
-  , width_(0)
-  , height_(0)
-  , padding_(0)
-  , line_width_(0)
-  , stop_radius_(0)
-  , bus_label_font_size_(0)
-  , stop_label_font_size_(0)
-  , underlayer_width_(0){}
+PROTOBUF_CONSTEXPR MapRendererContext::MapRendererContext(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.color_palette_)*/{}
+  , /*decltype(_impl_.bus_label_offset_)*/nullptr
+  , /*decltype(_impl_.stop_label_offset_)*/nullptr
+  , /*decltype(_impl_.underlayer_color_)*/nullptr
+  , /*decltype(_impl_.width_)*/0
+  , /*decltype(_impl_.height_)*/0
+  , /*decltype(_impl_.padding_)*/0
+  , /*decltype(_impl_.line_width_)*/0
+  , /*decltype(_impl_.stop_radius_)*/0
+  , /*decltype(_impl_.bus_label_font_size_)*/0
+  , /*decltype(_impl_.stop_label_font_size_)*/0
+  , /*decltype(_impl_.underlayer_width_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct MapRendererContextDefaultTypeInternal {
-  constexpr MapRendererContextDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR MapRendererContextDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~MapRendererContextDefaultTypeInternal() {}
   union {
     MapRendererContext _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT MapRendererContextDefaultTypeInternal _MapRendererContext_default_instance_;
-constexpr RouterContext::RouterContext(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : bus_wait_time_(0)
-  , bus_velocity_(0){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MapRendererContextDefaultTypeInternal _MapRendererContext_default_instance_;
+PROTOBUF_CONSTEXPR RouterContext::RouterContext(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bus_wait_time_)*/0
+  , /*decltype(_impl_.bus_velocity_)*/0
+  , /*decltype(_impl_.route_search_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct RouterContextDefaultTypeInternal {
-  constexpr RouterContextDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR RouterContextDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~RouterContextDefaultTypeInternal() {}
   union {
     RouterContext _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT RouterContextDefaultTypeInternal _RouterContext_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RouterContextDefaultTypeInternal _RouterContext_default_instance_;
 }  // namespace TransCatSerial
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_map_5frenderer_2eproto[2];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_map_5frenderer_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_map_5frenderer_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_map_5frenderer_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_map_5frenderer_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_map_5frenderer_2eproto = nullptr;
 
 const uint32_t TableStruct_map_5frenderer_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
@@ -65,35 +72,36 @@ const uint32_t TableStruct_map_5frenderer_2eproto::offsets[] PROTOBUF_SECTION_VA
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, width_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, height_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, padding_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, line_width_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, stop_radius_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, bus_label_font_size_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, bus_label_offset_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, stop_label_font_size_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, stop_label_offset_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, underlayer_color_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, underlayer_width_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, color_palette_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, _impl_.width_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, _impl_.padding_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, _impl_.line_width_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, _impl_.stop_radius_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, _impl_.bus_label_font_size_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, _impl_.bus_label_offset_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, _impl_.stop_label_font_size_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, _impl_.stop_label_offset_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, _impl_.underlayer_color_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, _impl_.underlayer_width_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::MapRendererContext, _impl_.color_palette_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::RouterContext, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RouterContext, bus_wait_time_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RouterContext, bus_velocity_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RouterContext, _impl_.bus_wait_time_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RouterContext, _impl_.bus_velocity_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::RouterContext, _impl_.route_search_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::TransCatSerial::MapRendererContext)},
   { 18, -1, -1, sizeof(::TransCatSerial::RouterContext)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_MapRendererContext_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_RouterContext_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::TransCatSerial::_MapRendererContext_default_instance_._instance,
+  &::TransCatSerial::_RouterContext_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_map_5frenderer_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -107,27 +115,63 @@ const char descriptor_table_protodef_map_5frenderer_2eproto[] PROTOBUF_SECTION_V
   "l_offset\030\t \001(\0132\025.TransCatSerial.Point\022/\n"
   "\020underlayer_color\030\n \001(\0132\025.TransCatSerial"
   ".Color\022\030\n\020underlayer_width\030\013 \001(\001\022,\n\rcolo"
-  "r_palette\030\014 \003(\0132\025.TransCatSerial.Color\"<"
-  "\n\rRouterContext\022\025\n\rbus_wait_time\030\001 \001(\001\022\024"
-  "\n\014bus_velocity\030\002 \001(\001b\006proto3"
+  "r_palette\030\014 \003(\0132\025.TransCatSerial.Color\"\366"
+  "\001\n\rRouterContext\022\025\n\rbus_wait_time\030\001 \001(\001\022"
+  "\024\n\014bus_velocity\030\002 \001(\001\022\?\n\014route_search\030\003 "
+  "\001(\0162).TransCatSerial.RouterContext.Route"
+  "Search\"w\n\013RouteSearch\022\021\n\rROUTES_MATRIX\020\000"
+  "\022\014\n\010DIJKSTRA\020\001\022\021\n\rBIDIRECTIONAL\020\002\022\t\n\005AST"
+  "AR\020\003\022\031\n\025CONTRACTION_HIERARCHY\020\004\022\016\n\nHUB_L"
+  "ABELS\020\005b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_map_5frenderer_2eproto_deps[1] = {
+static const ::_pbi::DescriptorTable* const descriptor_table_map_5frenderer_2eproto_deps[1] = {
   &::descriptor_table_svg_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_map_5frenderer_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_map_5frenderer_2eproto = {
-  false, false, 508, descriptor_table_protodef_map_5frenderer_2eproto, "map_renderer.proto", 
-  &descriptor_table_map_5frenderer_2eproto_once, descriptor_table_map_5frenderer_2eproto_deps, 1, 2,
-  schemas, file_default_instances, TableStruct_map_5frenderer_2eproto::offsets,
-  file_level_metadata_map_5frenderer_2eproto, file_level_enum_descriptors_map_5frenderer_2eproto, file_level_service_descriptors_map_5frenderer_2eproto,
+static ::_pbi::once_flag descriptor_table_map_5frenderer_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_map_5frenderer_2eproto = {
+    false, false, 695, descriptor_table_protodef_map_5frenderer_2eproto,
+    "map_renderer.proto",
+    &descriptor_table_map_5frenderer_2eproto_once, descriptor_table_map_5frenderer_2eproto_deps, 1, 2,
+    schemas, file_default_instances, TableStruct_map_5frenderer_2eproto::offsets,
+    file_level_metadata_map_5frenderer_2eproto, file_level_enum_descriptors_map_5frenderer_2eproto,
+    file_level_service_descriptors_map_5frenderer_2eproto,
 };
-PROTOBUF_ATTRIBUTE_WEAK const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable* descriptor_table_map_5frenderer_2eproto_getter() {
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_map_5frenderer_2eproto_getter() {
   return &descriptor_table_map_5frenderer_2eproto;
 }
 
 // Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY static ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptorsRunner dynamic_init_dummy_map_5frenderer_2eproto(&descriptor_table_map_5frenderer_2eproto);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_map_5frenderer_2eproto(&descriptor_table_map_5frenderer_2eproto);
 namespace TransCatSerial {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RouterContext_RouteSearch_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_map_5frenderer_2eproto);
+  return file_level_enum_descriptors_map_5frenderer_2eproto[0];
+}
+bool RouterContext_RouteSearch_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr RouterContext_RouteSearch RouterContext::ROUTES_MATRIX;
+constexpr RouterContext_RouteSearch RouterContext::DIJKSTRA;
+constexpr RouterContext_RouteSearch RouterContext::BIDIRECTIONAL;
+constexpr RouterContext_RouteSearch RouterContext::ASTAR;
+constexpr RouterContext_RouteSearch RouterContext::CONTRACTION_HIERARCHY;
+constexpr RouterContext_RouteSearch RouterContext::HUB_LABELS;
+constexpr RouterContext_RouteSearch RouterContext::RouteSearch_MIN;
+constexpr RouterContext_RouteSearch RouterContext::RouteSearch_MAX;
+constexpr int RouterContext::RouteSearch_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
@@ -140,101 +184,117 @@ class MapRendererContext::_Internal {
 
 const ::TransCatSerial::Point&
 MapRendererContext::_Internal::bus_label_offset(const MapRendererContext* msg) {
-  return *msg->bus_label_offset_;
+  return *msg->_impl_.bus_label_offset_;
 }
 const ::TransCatSerial::Point&
 MapRendererContext::_Internal::stop_label_offset(const MapRendererContext* msg) {
-  return *msg->stop_label_offset_;
+  return *msg->_impl_.stop_label_offset_;
 }
 const ::TransCatSerial::Color&
 MapRendererContext::_Internal::underlayer_color(const MapRendererContext* msg) {
-  return *msg->underlayer_color_;
+  return *msg->_impl_.underlayer_color_;
 }
 void MapRendererContext::clear_bus_label_offset() {
-  if (GetArenaForAllocation() == nullptr && bus_label_offset_ != nullptr) {
-    delete bus_label_offset_;
+  if (GetArenaForAllocation() == nullptr && _impl_.bus_label_offset_ != nullptr) {
+    delete _impl_.bus_label_offset_;
   }
-  bus_label_offset_ = nullptr;
+  _impl_.bus_label_offset_ = nullptr;
 }
 void MapRendererContext::clear_stop_label_offset() {
-  if (GetArenaForAllocation() == nullptr && stop_label_offset_ != nullptr) {
-    delete stop_label_offset_;
+  if (GetArenaForAllocation() == nullptr && _impl_.stop_label_offset_ != nullptr) {
+    delete _impl_.stop_label_offset_;
   }
-  stop_label_offset_ = nullptr;
+  _impl_.stop_label_offset_ = nullptr;
 }
 void MapRendererContext::clear_underlayer_color() {
-  if (GetArenaForAllocation() == nullptr && underlayer_color_ != nullptr) {
-    delete underlayer_color_;
+  if (GetArenaForAllocation() == nullptr && _impl_.underlayer_color_ != nullptr) {
+    delete _impl_.underlayer_color_;
   }
-  underlayer_color_ = nullptr;
+  _impl_.underlayer_color_ = nullptr;
 }
 void MapRendererContext::clear_color_palette() {
-  color_palette_.Clear();
+  _impl_.color_palette_.Clear();
 }
 MapRendererContext::MapRendererContext(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  color_palette_(arena) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.MapRendererContext)
 }
 MapRendererContext::MapRendererContext(const MapRendererContext& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      color_palette_(from.color_palette_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MapRendererContext* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.color_palette_){from._impl_.color_palette_}
+    , decltype(_impl_.bus_label_offset_){nullptr}
+    , decltype(_impl_.stop_label_offset_){nullptr}
+    , decltype(_impl_.underlayer_color_){nullptr}
+    , decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}
+    , decltype(_impl_.padding_){}
+    , decltype(_impl_.line_width_){}
+    , decltype(_impl_.stop_radius_){}
+    , decltype(_impl_.bus_label_font_size_){}
+    , decltype(_impl_.stop_label_font_size_){}
+    , decltype(_impl_.underlayer_width_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_bus_label_offset()) {
-    bus_label_offset_ = new ::TransCatSerial::Point(*from.bus_label_offset_);
-  } else {
-    bus_label_offset_ = nullptr;
+    _this->_impl_.bus_label_offset_ = new ::TransCatSerial::Point(*from._impl_.bus_label_offset_);
   }
   if (from._internal_has_stop_label_offset()) {
-    stop_label_offset_ = new ::TransCatSerial::Point(*from.stop_label_offset_);
-  } else {
-    stop_label_offset_ = nullptr;
+    _this->_impl_.stop_label_offset_ = new ::TransCatSerial::Point(*from._impl_.stop_label_offset_);
   }
   if (from._internal_has_underlayer_color()) {
-    underlayer_color_ = new ::TransCatSerial::Color(*from.underlayer_color_);
-  } else {
-    underlayer_color_ = nullptr;
+    _this->_impl_.underlayer_color_ = new ::TransCatSerial::Color(*from._impl_.underlayer_color_);
   }
-  ::memcpy(&width_, &from.width_,
-    static_cast<size_t>(reinterpret_cast<char*>(&underlayer_width_) -
-    reinterpret_cast<char*>(&width_)) + sizeof(underlayer_width_));
+  ::memcpy(&_impl_.width_, &from._impl_.width_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.underlayer_width_) -
+    reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.underlayer_width_));
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.MapRendererContext)
 }
 
-inline void MapRendererContext::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&bus_label_offset_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&underlayer_width_) -
-    reinterpret_cast<char*>(&bus_label_offset_)) + sizeof(underlayer_width_));
+inline void MapRendererContext::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.color_palette_){arena}
+    , decltype(_impl_.bus_label_offset_){nullptr}
+    , decltype(_impl_.stop_label_offset_){nullptr}
+    , decltype(_impl_.underlayer_color_){nullptr}
+    , decltype(_impl_.width_){0}
+    , decltype(_impl_.height_){0}
+    , decltype(_impl_.padding_){0}
+    , decltype(_impl_.line_width_){0}
+    , decltype(_impl_.stop_radius_){0}
+    , decltype(_impl_.bus_label_font_size_){0}
+    , decltype(_impl_.stop_label_font_size_){0}
+    , decltype(_impl_.underlayer_width_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 MapRendererContext::~MapRendererContext() {
   // @@protoc_insertion_point(destructor:TransCatSerial.MapRendererContext)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void MapRendererContext::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete bus_label_offset_;
-  if (this != internal_default_instance()) delete stop_label_offset_;
-  if (this != internal_default_instance()) delete underlayer_color_;
+  _impl_.color_palette_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.bus_label_offset_;
+  if (this != internal_default_instance()) delete _impl_.stop_label_offset_;
+  if (this != internal_default_instance()) delete _impl_.underlayer_color_;
 }
 
-void MapRendererContext::ArenaDtor(void* object) {
-  MapRendererContext* _this = reinterpret_cast< MapRendererContext* >(object);
-  (void)_this;
-}
-void MapRendererContext::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void MapRendererContext::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void MapRendererContext::Clear() {
@@ -243,35 +303,35 @@ void MapRendererContext::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  color_palette_.Clear();
-  if (GetArenaForAllocation() == nullptr && bus_label_offset_ != nullptr) {
-    delete bus_label_offset_;
+  _impl_.color_palette_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.bus_label_offset_ != nullptr) {
+    delete _impl_.bus_label_offset_;
   }
-  bus_label_offset_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && stop_label_offset_ != nullptr) {
-    delete stop_label_offset_;
+  _impl_.bus_label_offset_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.stop_label_offset_ != nullptr) {
+    delete _impl_.stop_label_offset_;
   }
-  stop_label_offset_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && underlayer_color_ != nullptr) {
-    delete underlayer_color_;
+  _impl_.stop_label_offset_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.underlayer_color_ != nullptr) {
+    delete _impl_.underlayer_color_;
   }
-  underlayer_color_ = nullptr;
-  ::memset(&width_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&underlayer_width_) -
-      reinterpret_cast<char*>(&width_)) + sizeof(underlayer_width_));
+  _impl_.underlayer_color_ = nullptr;
+  ::memset(&_impl_.width_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.underlayer_width_) -
+      reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.underlayer_width_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* MapRendererContext::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* MapRendererContext::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // double width = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
-          width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -279,7 +339,7 @@ const char* MapRendererContext::_InternalParse(const char* ptr, ::PROTOBUF_NAMES
       // double height = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
-          height_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -287,7 +347,7 @@ const char* MapRendererContext::_InternalParse(const char* ptr, ::PROTOBUF_NAMES
       // double padding = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
-          padding_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.padding_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -295,7 +355,7 @@ const char* MapRendererContext::_InternalParse(const char* ptr, ::PROTOBUF_NAMES
       // double line_width = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
-          line_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.line_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -303,7 +363,7 @@ const char* MapRendererContext::_InternalParse(const char* ptr, ::PROTOBUF_NAMES
       // double stop_radius = 5;
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
-          stop_radius_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.stop_radius_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -311,7 +371,7 @@ const char* MapRendererContext::_InternalParse(const char* ptr, ::PROTOBUF_NAMES
       // int32 bus_label_font_size = 6;
       case 6:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
-          bus_label_font_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.bus_label_font_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -327,7 +387,7 @@ const char* MapRendererContext::_InternalParse(const char* ptr, ::PROTOBUF_NAMES
       // int32 stop_label_font_size = 8;
       case 8:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
-          stop_label_font_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.stop_label_font_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -351,7 +411,7 @@ const char* MapRendererContext::_InternalParse(const char* ptr, ::PROTOBUF_NAMES
       // double underlayer_width = 11;
       case 11:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
-          underlayer_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.underlayer_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -405,7 +465,7 @@ uint8_t* MapRendererContext::_InternalSerialize(
   memcpy(&raw_width, &tmp_width, sizeof(tmp_width));
   if (raw_width != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(1, this->_internal_width(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_width(), target);
   }
 
   // double height = 2;
@@ -415,7 +475,7 @@ uint8_t* MapRendererContext::_InternalSerialize(
   memcpy(&raw_height, &tmp_height, sizeof(tmp_height));
   if (raw_height != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_height(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_height(), target);
   }
 
   // double padding = 3;
@@ -425,7 +485,7 @@ uint8_t* MapRendererContext::_InternalSerialize(
   memcpy(&raw_padding, &tmp_padding, sizeof(tmp_padding));
   if (raw_padding != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(3, this->_internal_padding(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_padding(), target);
   }
 
   // double line_width = 4;
@@ -435,7 +495,7 @@ uint8_t* MapRendererContext::_InternalSerialize(
   memcpy(&raw_line_width, &tmp_line_width, sizeof(tmp_line_width));
   if (raw_line_width != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(4, this->_internal_line_width(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_line_width(), target);
   }
 
   // double stop_radius = 5;
@@ -445,43 +505,40 @@ uint8_t* MapRendererContext::_InternalSerialize(
   memcpy(&raw_stop_radius, &tmp_stop_radius, sizeof(tmp_stop_radius));
   if (raw_stop_radius != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(5, this->_internal_stop_radius(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_stop_radius(), target);
   }
 
   // int32 bus_label_font_size = 6;
   if (this->_internal_bus_label_font_size() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(6, this->_internal_bus_label_font_size(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_bus_label_font_size(), target);
   }
 
   // .TransCatSerial.Point bus_label_offset = 7;
   if (this->_internal_has_bus_label_offset()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        7, _Internal::bus_label_offset(this), target, stream);
+      InternalWriteMessage(7, _Internal::bus_label_offset(this),
+        _Internal::bus_label_offset(this).GetCachedSize(), target, stream);
   }
 
   // int32 stop_label_font_size = 8;
   if (this->_internal_stop_label_font_size() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(8, this->_internal_stop_label_font_size(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_stop_label_font_size(), target);
   }
 
   // .TransCatSerial.Point stop_label_offset = 9;
   if (this->_internal_has_stop_label_offset()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        9, _Internal::stop_label_offset(this), target, stream);
+      InternalWriteMessage(9, _Internal::stop_label_offset(this),
+        _Internal::stop_label_offset(this).GetCachedSize(), target, stream);
   }
 
   // .TransCatSerial.Color underlayer_color = 10;
   if (this->_internal_has_underlayer_color()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        10, _Internal::underlayer_color(this), target, stream);
+      InternalWriteMessage(10, _Internal::underlayer_color(this),
+        _Internal::underlayer_color(this).GetCachedSize(), target, stream);
   }
 
   // double underlayer_width = 11;
@@ -491,19 +548,19 @@ uint8_t* MapRendererContext::_InternalSerialize(
   memcpy(&raw_underlayer_width, &tmp_underlayer_width, sizeof(tmp_underlayer_width));
   if (raw_underlayer_width != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(11, this->_internal_underlayer_width(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_underlayer_width(), target);
   }
 
   // repeated .TransCatSerial.Color color_palette = 12;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_color_palette_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_color_palette_size()); i < n; i++) {
+    const auto& repfield = this->_internal_color_palette(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(12, this->_internal_color_palette(i), target, stream);
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.MapRendererContext)
@@ -520,7 +577,7 @@ size_t MapRendererContext::ByteSizeLong() const {
 
   // repeated .TransCatSerial.Color color_palette = 12;
   total_size += 1UL * this->_internal_color_palette_size();
-  for (const auto& msg : this->color_palette_) {
+  for (const auto& msg : this->_impl_.color_palette_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
@@ -529,21 +586,21 @@ size_t MapRendererContext::ByteSizeLong() const {
   if (this->_internal_has_bus_label_offset()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *bus_label_offset_);
+        *_impl_.bus_label_offset_);
   }
 
   // .TransCatSerial.Point stop_label_offset = 9;
   if (this->_internal_has_stop_label_offset()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *stop_label_offset_);
+        *_impl_.stop_label_offset_);
   }
 
   // .TransCatSerial.Color underlayer_color = 10;
   if (this->_internal_has_underlayer_color()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *underlayer_color_);
+        *_impl_.underlayer_color_);
   }
 
   // double width = 1;
@@ -593,12 +650,12 @@ size_t MapRendererContext::ByteSizeLong() const {
 
   // int32 bus_label_font_size = 6;
   if (this->_internal_bus_label_font_size() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_bus_label_font_size());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_bus_label_font_size());
   }
 
   // int32 stop_label_font_size = 8;
   if (this->_internal_stop_label_font_size() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_stop_label_font_size());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_stop_label_font_size());
   }
 
   // double underlayer_width = 11;
@@ -610,87 +667,86 @@ size_t MapRendererContext::ByteSizeLong() const {
     total_size += 1 + 8;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MapRendererContext::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     MapRendererContext::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MapRendererContext::GetClassData() const { return &_class_data_; }
 
-void MapRendererContext::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<MapRendererContext *>(to)->MergeFrom(
-      static_cast<const MapRendererContext &>(from));
-}
 
-
-void MapRendererContext::MergeFrom(const MapRendererContext& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.MapRendererContext)
-  GOOGLE_DCHECK_NE(&from, this);
+void MapRendererContext::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MapRendererContext*>(&to_msg);
+  auto& from = static_cast<const MapRendererContext&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.MapRendererContext)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  color_palette_.MergeFrom(from.color_palette_);
+  _this->_impl_.color_palette_.MergeFrom(from._impl_.color_palette_);
   if (from._internal_has_bus_label_offset()) {
-    _internal_mutable_bus_label_offset()->::TransCatSerial::Point::MergeFrom(from._internal_bus_label_offset());
+    _this->_internal_mutable_bus_label_offset()->::TransCatSerial::Point::MergeFrom(
+        from._internal_bus_label_offset());
   }
   if (from._internal_has_stop_label_offset()) {
-    _internal_mutable_stop_label_offset()->::TransCatSerial::Point::MergeFrom(from._internal_stop_label_offset());
+    _this->_internal_mutable_stop_label_offset()->::TransCatSerial::Point::MergeFrom(
+        from._internal_stop_label_offset());
   }
   if (from._internal_has_underlayer_color()) {
-    _internal_mutable_underlayer_color()->::TransCatSerial::Color::MergeFrom(from._internal_underlayer_color());
+    _this->_internal_mutable_underlayer_color()->::TransCatSerial::Color::MergeFrom(
+        from._internal_underlayer_color());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_width = from._internal_width();
   uint64_t raw_width;
   memcpy(&raw_width, &tmp_width, sizeof(tmp_width));
   if (raw_width != 0) {
-    _internal_set_width(from._internal_width());
+    _this->_internal_set_width(from._internal_width());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_height = from._internal_height();
   uint64_t raw_height;
   memcpy(&raw_height, &tmp_height, sizeof(tmp_height));
   if (raw_height != 0) {
-    _internal_set_height(from._internal_height());
+    _this->_internal_set_height(from._internal_height());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_padding = from._internal_padding();
   uint64_t raw_padding;
   memcpy(&raw_padding, &tmp_padding, sizeof(tmp_padding));
   if (raw_padding != 0) {
-    _internal_set_padding(from._internal_padding());
+    _this->_internal_set_padding(from._internal_padding());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_line_width = from._internal_line_width();
   uint64_t raw_line_width;
   memcpy(&raw_line_width, &tmp_line_width, sizeof(tmp_line_width));
   if (raw_line_width != 0) {
-    _internal_set_line_width(from._internal_line_width());
+    _this->_internal_set_line_width(from._internal_line_width());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_stop_radius = from._internal_stop_radius();
   uint64_t raw_stop_radius;
   memcpy(&raw_stop_radius, &tmp_stop_radius, sizeof(tmp_stop_radius));
   if (raw_stop_radius != 0) {
-    _internal_set_stop_radius(from._internal_stop_radius());
+    _this->_internal_set_stop_radius(from._internal_stop_radius());
   }
   if (from._internal_bus_label_font_size() != 0) {
-    _internal_set_bus_label_font_size(from._internal_bus_label_font_size());
+    _this->_internal_set_bus_label_font_size(from._internal_bus_label_font_size());
   }
   if (from._internal_stop_label_font_size() != 0) {
-    _internal_set_stop_label_font_size(from._internal_stop_label_font_size());
+    _this->_internal_set_stop_label_font_size(from._internal_stop_label_font_size());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_underlayer_width = from._internal_underlayer_width();
   uint64_t raw_underlayer_width;
   memcpy(&raw_underlayer_width, &tmp_underlayer_width, sizeof(tmp_underlayer_width));
   if (raw_underlayer_width != 0) {
-    _internal_set_underlayer_width(from._internal_underlayer_width());
+    _this->_internal_set_underlayer_width(from._internal_underlayer_width());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MapRendererContext::CopyFrom(const MapRendererContext& from) {
@@ -707,17 +763,17 @@ bool MapRendererContext::IsInitialized() const {
 void MapRendererContext::InternalSwap(MapRendererContext* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  color_palette_.InternalSwap(&other->color_palette_);
+  _impl_.color_palette_.InternalSwap(&other->_impl_.color_palette_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(MapRendererContext, underlayer_width_)
-      + sizeof(MapRendererContext::underlayer_width_)
-      - PROTOBUF_FIELD_OFFSET(MapRendererContext, bus_label_offset_)>(
-          reinterpret_cast<char*>(&bus_label_offset_),
-          reinterpret_cast<char*>(&other->bus_label_offset_));
+      PROTOBUF_FIELD_OFFSET(MapRendererContext, _impl_.underlayer_width_)
+      + sizeof(MapRendererContext::_impl_.underlayer_width_)
+      - PROTOBUF_FIELD_OFFSET(MapRendererContext, _impl_.bus_label_offset_)>(
+          reinterpret_cast<char*>(&_impl_.bus_label_offset_),
+          reinterpret_cast<char*>(&other->_impl_.bus_label_offset_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata MapRendererContext::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_map_5frenderer_2eproto_getter, &descriptor_table_map_5frenderer_2eproto_once,
       file_level_metadata_map_5frenderer_2eproto[0]);
 }
@@ -731,47 +787,52 @@ class RouterContext::_Internal {
 RouterContext::RouterContext(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.RouterContext)
 }
 RouterContext::RouterContext(const RouterContext& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RouterContext* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_wait_time_){}
+    , decltype(_impl_.bus_velocity_){}
+    , decltype(_impl_.route_search_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&bus_wait_time_, &from.bus_wait_time_,
-    static_cast<size_t>(reinterpret_cast<char*>(&bus_velocity_) -
-    reinterpret_cast<char*>(&bus_wait_time_)) + sizeof(bus_velocity_));
+  ::memcpy(&_impl_.bus_wait_time_, &from._impl_.bus_wait_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.route_search_) -
+    reinterpret_cast<char*>(&_impl_.bus_wait_time_)) + sizeof(_impl_.route_search_));
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.RouterContext)
 }
 
-inline void RouterContext::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&bus_wait_time_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&bus_velocity_) -
-    reinterpret_cast<char*>(&bus_wait_time_)) + sizeof(bus_velocity_));
+inline void RouterContext::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_wait_time_){0}
+    , decltype(_impl_.bus_velocity_){0}
+    , decltype(_impl_.route_search_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 RouterContext::~RouterContext() {
   // @@protoc_insertion_point(destructor:TransCatSerial.RouterContext)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void RouterContext::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void RouterContext::ArenaDtor(void* object) {
-  RouterContext* _this = reinterpret_cast< RouterContext* >(object);
-  (void)_this;
-}
-void RouterContext::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void RouterContext::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void RouterContext::Clear() {
@@ -780,22 +841,22 @@ void RouterContext::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&bus_wait_time_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&bus_velocity_) -
-      reinterpret_cast<char*>(&bus_wait_time_)) + sizeof(bus_velocity_));
+  ::memset(&_impl_.bus_wait_time_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.route_search_) -
+      reinterpret_cast<char*>(&_impl_.bus_wait_time_)) + sizeof(_impl_.route_search_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RouterContext::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* RouterContext::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // double bus_wait_time = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
-          bus_wait_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.bus_wait_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -803,11 +864,20 @@ const char* RouterContext::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_
       // double bus_velocity = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
-          bus_velocity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.bus_velocity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
         continue;
+      // .TransCatSerial.RouterContext.RouteSearch route_search = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_route_search(static_cast<::TransCatSerial::RouterContext_RouteSearch>(val));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -844,7 +914,7 @@ uint8_t* RouterContext::_InternalSerialize(
   memcpy(&raw_bus_wait_time, &tmp_bus_wait_time, sizeof(tmp_bus_wait_time));
   if (raw_bus_wait_time != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(1, this->_internal_bus_wait_time(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_bus_wait_time(), target);
   }
 
   // double bus_velocity = 2;
@@ -854,11 +924,18 @@ uint8_t* RouterContext::_InternalSerialize(
   memcpy(&raw_bus_velocity, &tmp_bus_velocity, sizeof(tmp_bus_velocity));
   if (raw_bus_velocity != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_bus_velocity(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_bus_velocity(), target);
+  }
+
+  // .TransCatSerial.RouterContext.RouteSearch route_search = 3;
+  if (this->_internal_route_search() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_route_search(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.RouterContext)
@@ -891,25 +968,27 @@ size_t RouterContext::ByteSizeLong() const {
     total_size += 1 + 8;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  // .TransCatSerial.RouterContext.RouteSearch route_search = 3;
+  if (this->_internal_route_search() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_route_search());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RouterContext::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     RouterContext::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RouterContext::GetClassData() const { return &_class_data_; }
 
-void RouterContext::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<RouterContext *>(to)->MergeFrom(
-      static_cast<const RouterContext &>(from));
-}
-
 
-void RouterContext::MergeFrom(const RouterContext& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.RouterContext)
-  GOOGLE_DCHECK_NE(&from, this);
+void RouterContext::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RouterContext*>(&to_msg);
+  auto& from = static_cast<const RouterContext&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.RouterContext)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -918,16 +997,19 @@ void RouterContext::MergeFrom(const RouterContext& from) {
   uint64_t raw_bus_wait_time;
   memcpy(&raw_bus_wait_time, &tmp_bus_wait_time, sizeof(tmp_bus_wait_time));
   if (raw_bus_wait_time != 0) {
-    _internal_set_bus_wait_time(from._internal_bus_wait_time());
+    _this->_internal_set_bus_wait_time(from._internal_bus_wait_time());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_bus_velocity = from._internal_bus_velocity();
   uint64_t raw_bus_velocity;
   memcpy(&raw_bus_velocity, &tmp_bus_velocity, sizeof(tmp_bus_velocity));
   if (raw_bus_velocity != 0) {
-    _internal_set_bus_velocity(from._internal_bus_velocity());
+    _this->_internal_set_bus_velocity(from._internal_bus_velocity());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_route_search() != 0) {
+    _this->_internal_set_route_search(from._internal_route_search());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RouterContext::CopyFrom(const RouterContext& from) {
@@ -945,15 +1027,15 @@ void RouterContext::InternalSwap(RouterContext* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RouterContext, bus_velocity_)
-      + sizeof(RouterContext::bus_velocity_)
-      - PROTOBUF_FIELD_OFFSET(RouterContext, bus_wait_time_)>(
-          reinterpret_cast<char*>(&bus_wait_time_),
-          reinterpret_cast<char*>(&other->bus_wait_time_));
+      PROTOBUF_FIELD_OFFSET(RouterContext, _impl_.route_search_)
+      + sizeof(RouterContext::_impl_.route_search_)
+      - PROTOBUF_FIELD_OFFSET(RouterContext, _impl_.bus_wait_time_)>(
+          reinterpret_cast<char*>(&_impl_.bus_wait_time_),
+          reinterpret_cast<char*>(&other->_impl_.bus_wait_time_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata RouterContext::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_map_5frenderer_2eproto_getter, &descriptor_table_map_5frenderer_2eproto_once,
       file_level_metadata_map_5frenderer_2eproto[1]);
 }
@@ -961,10 +1043,12 @@ void RouterContext::InternalSwap(RouterContext* other) {
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace TransCatSerial
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::TransCatSerial::MapRendererContext* Arena::CreateMaybeMessage< ::TransCatSerial::MapRendererContext >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::MapRendererContext*
+Arena::CreateMaybeMessage< ::TransCatSerial::MapRendererContext >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::MapRendererContext >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::RouterContext* Arena::CreateMaybeMessage< ::TransCatSerial::RouterContext >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::RouterContext*
+Arena::CreateMaybeMessage< ::TransCatSerial::RouterContext >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::RouterContext >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
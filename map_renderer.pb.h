@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3019000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3019003 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,13 +23,13 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 #include "svg.pb.h"
 // @@protoc_insertion_point(includes)
@@ -43,14 +43,6 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_map_5frenderer_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[2]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
   static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_map_5frenderer_2eproto;
@@ -68,6 +60,35 @@ template<> ::TransCatSerial::RouterContext* Arena::CreateMaybeMessage<::TransCat
 PROTOBUF_NAMESPACE_CLOSE
 namespace TransCatSerial {
 
+enum RouterContext_RouteSearch : int {
+  RouterContext_RouteSearch_ROUTES_MATRIX = 0,
+  RouterContext_RouteSearch_DIJKSTRA = 1,
+  RouterContext_RouteSearch_BIDIRECTIONAL = 2,
+  RouterContext_RouteSearch_ASTAR = 3,
+  RouterContext_RouteSearch_CONTRACTION_HIERARCHY = 4,
+  RouterContext_RouteSearch_HUB_LABELS = 5,
+  RouterContext_RouteSearch_RouterContext_RouteSearch_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RouterContext_RouteSearch_RouterContext_RouteSearch_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool RouterContext_RouteSearch_IsValid(int value);
+constexpr RouterContext_RouteSearch RouterContext_RouteSearch_RouteSearch_MIN = RouterContext_RouteSearch_ROUTES_MATRIX;
+constexpr RouterContext_RouteSearch RouterContext_RouteSearch_RouteSearch_MAX = RouterContext_RouteSearch_HUB_LABELS;
+constexpr int RouterContext_RouteSearch_RouteSearch_ARRAYSIZE = RouterContext_RouteSearch_RouteSearch_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RouterContext_RouteSearch_descriptor();
+template<typename T>
+inline const std::string& RouterContext_RouteSearch_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RouterContext_RouteSearch>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RouterContext_RouteSearch_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RouterContext_RouteSearch_descriptor(), enum_t_value);
+}
+inline bool RouterContext_RouteSearch_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RouterContext_RouteSearch* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RouterContext_RouteSearch>(
+    RouterContext_RouteSearch_descriptor(), name, value);
+}
 // ===================================================================
 
 class MapRendererContext final :
@@ -75,7 +96,7 @@ class MapRendererContext final :
  public:
   inline MapRendererContext() : MapRendererContext(nullptr) {}
   ~MapRendererContext() override;
-  explicit constexpr MapRendererContext(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR MapRendererContext(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MapRendererContext(const MapRendererContext& from);
   MapRendererContext(MapRendererContext&& from) noexcept
@@ -150,9 +171,11 @@ class MapRendererContext final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MapRendererContext& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const MapRendererContext& from);
+  void MergeFrom( const MapRendererContext& from) {
+    MapRendererContext::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -161,10 +184,10 @@ class MapRendererContext final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(MapRendererContext* other);
@@ -177,9 +200,6 @@ class MapRendererContext final :
   protected:
   explicit MapRendererContext(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -356,19 +376,22 @@ class MapRendererContext final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Color > color_palette_;
-  ::TransCatSerial::Point* bus_label_offset_;
-  ::TransCatSerial::Point* stop_label_offset_;
-  ::TransCatSerial::Color* underlayer_color_;
-  double width_;
-  double height_;
-  double padding_;
-  double line_width_;
-  double stop_radius_;
-  int32_t bus_label_font_size_;
-  int32_t stop_label_font_size_;
-  double underlayer_width_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Color > color_palette_;
+    ::TransCatSerial::Point* bus_label_offset_;
+    ::TransCatSerial::Point* stop_label_offset_;
+    ::TransCatSerial::Color* underlayer_color_;
+    double width_;
+    double height_;
+    double padding_;
+    double line_width_;
+    double stop_radius_;
+    int32_t bus_label_font_size_;
+    int32_t stop_label_font_size_;
+    double underlayer_width_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_map_5frenderer_2eproto;
 };
 // -------------------------------------------------------------------
@@ -378,7 +401,7 @@ class RouterContext final :
  public:
   inline RouterContext() : RouterContext(nullptr) {}
   ~RouterContext() override;
-  explicit constexpr RouterContext(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR RouterContext(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RouterContext(const RouterContext& from);
   RouterContext(RouterContext&& from) noexcept
@@ -453,9 +476,11 @@ class RouterContext final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RouterContext& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const RouterContext& from);
+  void MergeFrom( const RouterContext& from) {
+    RouterContext::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -464,10 +489,10 @@ class RouterContext final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RouterContext* other);
@@ -480,9 +505,6 @@ class RouterContext final :
   protected:
   explicit RouterContext(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -492,11 +514,50 @@ class RouterContext final :
 
   // nested types ----------------------------------------------------
 
+  typedef RouterContext_RouteSearch RouteSearch;
+  static constexpr RouteSearch ROUTES_MATRIX =
+    RouterContext_RouteSearch_ROUTES_MATRIX;
+  static constexpr RouteSearch DIJKSTRA =
+    RouterContext_RouteSearch_DIJKSTRA;
+  static constexpr RouteSearch BIDIRECTIONAL =
+    RouterContext_RouteSearch_BIDIRECTIONAL;
+  static constexpr RouteSearch ASTAR =
+    RouterContext_RouteSearch_ASTAR;
+  static constexpr RouteSearch CONTRACTION_HIERARCHY =
+    RouterContext_RouteSearch_CONTRACTION_HIERARCHY;
+  static constexpr RouteSearch HUB_LABELS =
+    RouterContext_RouteSearch_HUB_LABELS;
+  static inline bool RouteSearch_IsValid(int value) {
+    return RouterContext_RouteSearch_IsValid(value);
+  }
+  static constexpr RouteSearch RouteSearch_MIN =
+    RouterContext_RouteSearch_RouteSearch_MIN;
+  static constexpr RouteSearch RouteSearch_MAX =
+    RouterContext_RouteSearch_RouteSearch_MAX;
+  static constexpr int RouteSearch_ARRAYSIZE =
+    RouterContext_RouteSearch_RouteSearch_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  RouteSearch_descriptor() {
+    return RouterContext_RouteSearch_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& RouteSearch_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, RouteSearch>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function RouteSearch_Name.");
+    return RouterContext_RouteSearch_Name(enum_t_value);
+  }
+  static inline bool RouteSearch_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      RouteSearch* value) {
+    return RouterContext_RouteSearch_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
     kBusWaitTimeFieldNumber = 1,
     kBusVelocityFieldNumber = 2,
+    kRouteSearchFieldNumber = 3,
   };
   // double bus_wait_time = 1;
   void clear_bus_wait_time();
@@ -516,6 +577,15 @@ class RouterContext final :
   void _internal_set_bus_velocity(double value);
   public:
 
+  // .TransCatSerial.RouterContext.RouteSearch route_search = 3;
+  void clear_route_search();
+  ::TransCatSerial::RouterContext_RouteSearch route_search() const;
+  void set_route_search(::TransCatSerial::RouterContext_RouteSearch value);
+  private:
+  ::TransCatSerial::RouterContext_RouteSearch _internal_route_search() const;
+  void _internal_set_route_search(::TransCatSerial::RouterContext_RouteSearch value);
+  public:
+
   // @@protoc_insertion_point(class_scope:TransCatSerial.RouterContext)
  private:
   class _Internal;
@@ -523,9 +593,13 @@ class RouterContext final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  double bus_wait_time_;
-  double bus_velocity_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    double bus_wait_time_;
+    double bus_velocity_;
+    int route_search_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_map_5frenderer_2eproto;
 };
 // ===================================================================
@@ -541,10 +615,10 @@ class RouterContext final :
 
 // double width = 1;
 inline void MapRendererContext::clear_width() {
-  width_ = 0;
+  _impl_.width_ = 0;
 }
 inline double MapRendererContext::_internal_width() const {
-  return width_;
+  return _impl_.width_;
 }
 inline double MapRendererContext::width() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.MapRendererContext.width)
@@ -552,7 +626,7 @@ inline double MapRendererContext::width() const {
 }
 inline void MapRendererContext::_internal_set_width(double value) {
   
-  width_ = value;
+  _impl_.width_ = value;
 }
 inline void MapRendererContext::set_width(double value) {
   _internal_set_width(value);
@@ -561,10 +635,10 @@ inline void MapRendererContext::set_width(double value) {
 
 // double height = 2;
 inline void MapRendererContext::clear_height() {
-  height_ = 0;
+  _impl_.height_ = 0;
 }
 inline double MapRendererContext::_internal_height() const {
-  return height_;
+  return _impl_.height_;
 }
 inline double MapRendererContext::height() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.MapRendererContext.height)
@@ -572,7 +646,7 @@ inline double MapRendererContext::height() const {
 }
 inline void MapRendererContext::_internal_set_height(double value) {
   
-  height_ = value;
+  _impl_.height_ = value;
 }
 inline void MapRendererContext::set_height(double value) {
   _internal_set_height(value);
@@ -581,10 +655,10 @@ inline void MapRendererContext::set_height(double value) {
 
 // double padding = 3;
 inline void MapRendererContext::clear_padding() {
-  padding_ = 0;
+  _impl_.padding_ = 0;
 }
 inline double MapRendererContext::_internal_padding() const {
-  return padding_;
+  return _impl_.padding_;
 }
 inline double MapRendererContext::padding() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.MapRendererContext.padding)
@@ -592,7 +666,7 @@ inline double MapRendererContext::padding() const {
 }
 inline void MapRendererContext::_internal_set_padding(double value) {
   
-  padding_ = value;
+  _impl_.padding_ = value;
 }
 inline void MapRendererContext::set_padding(double value) {
   _internal_set_padding(value);
@@ -601,10 +675,10 @@ inline void MapRendererContext::set_padding(double value) {
 
 // double line_width = 4;
 inline void MapRendererContext::clear_line_width() {
-  line_width_ = 0;
+  _impl_.line_width_ = 0;
 }
 inline double MapRendererContext::_internal_line_width() const {
-  return line_width_;
+  return _impl_.line_width_;
 }
 inline double MapRendererContext::line_width() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.MapRendererContext.line_width)
@@ -612,7 +686,7 @@ inline double MapRendererContext::line_width() const {
 }
 inline void MapRendererContext::_internal_set_line_width(double value) {
   
-  line_width_ = value;
+  _impl_.line_width_ = value;
 }
 inline void MapRendererContext::set_line_width(double value) {
   _internal_set_line_width(value);
@@ -621,10 +695,10 @@ inline void MapRendererContext::set_line_width(double value) {
 
 // double stop_radius = 5;
 inline void MapRendererContext::clear_stop_radius() {
-  stop_radius_ = 0;
+  _impl_.stop_radius_ = 0;
 }
 inline double MapRendererContext::_internal_stop_radius() const {
-  return stop_radius_;
+  return _impl_.stop_radius_;
 }
 inline double MapRendererContext::stop_radius() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.MapRendererContext.stop_radius)
@@ -632,7 +706,7 @@ inline double MapRendererContext::stop_radius() const {
 }
 inline void MapRendererContext::_internal_set_stop_radius(double value) {
   
-  stop_radius_ = value;
+  _impl_.stop_radius_ = value;
 }
 inline void MapRendererContext::set_stop_radius(double value) {
   _internal_set_stop_radius(value);
@@ -641,10 +715,10 @@ inline void MapRendererContext::set_stop_radius(double value) {
 
 // int32 bus_label_font_size = 6;
 inline void MapRendererContext::clear_bus_label_font_size() {
-  bus_label_font_size_ = 0;
+  _impl_.bus_label_font_size_ = 0;
 }
 inline int32_t MapRendererContext::_internal_bus_label_font_size() const {
-  return bus_label_font_size_;
+  return _impl_.bus_label_font_size_;
 }
 inline int32_t MapRendererContext::bus_label_font_size() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.MapRendererContext.bus_label_font_size)
@@ -652,7 +726,7 @@ inline int32_t MapRendererContext::bus_label_font_size() const {
 }
 inline void MapRendererContext::_internal_set_bus_label_font_size(int32_t value) {
   
-  bus_label_font_size_ = value;
+  _impl_.bus_label_font_size_ = value;
 }
 inline void MapRendererContext::set_bus_label_font_size(int32_t value) {
   _internal_set_bus_label_font_size(value);
@@ -661,13 +735,13 @@ inline void MapRendererContext::set_bus_label_font_size(int32_t value) {
 
 // .TransCatSerial.Point bus_label_offset = 7;
 inline bool MapRendererContext::_internal_has_bus_label_offset() const {
-  return this != internal_default_instance() && bus_label_offset_ != nullptr;
+  return this != internal_default_instance() && _impl_.bus_label_offset_ != nullptr;
 }
 inline bool MapRendererContext::has_bus_label_offset() const {
   return _internal_has_bus_label_offset();
 }
 inline const ::TransCatSerial::Point& MapRendererContext::_internal_bus_label_offset() const {
-  const ::TransCatSerial::Point* p = bus_label_offset_;
+  const ::TransCatSerial::Point* p = _impl_.bus_label_offset_;
   return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::Point&>(
       ::TransCatSerial::_Point_default_instance_);
 }
@@ -678,9 +752,9 @@ inline const ::TransCatSerial::Point& MapRendererContext::bus_label_offset() con
 inline void MapRendererContext::unsafe_arena_set_allocated_bus_label_offset(
     ::TransCatSerial::Point* bus_label_offset) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bus_label_offset_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.bus_label_offset_);
   }
-  bus_label_offset_ = bus_label_offset;
+  _impl_.bus_label_offset_ = bus_label_offset;
   if (bus_label_offset) {
     
   } else {
@@ -690,8 +764,8 @@ inline void MapRendererContext::unsafe_arena_set_allocated_bus_label_offset(
 }
 inline ::TransCatSerial::Point* MapRendererContext::release_bus_label_offset() {
   
-  ::TransCatSerial::Point* temp = bus_label_offset_;
-  bus_label_offset_ = nullptr;
+  ::TransCatSerial::Point* temp = _impl_.bus_label_offset_;
+  _impl_.bus_label_offset_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -706,17 +780,17 @@ inline ::TransCatSerial::Point* MapRendererContext::release_bus_label_offset() {
 inline ::TransCatSerial::Point* MapRendererContext::unsafe_arena_release_bus_label_offset() {
   // @@protoc_insertion_point(field_release:TransCatSerial.MapRendererContext.bus_label_offset)
   
-  ::TransCatSerial::Point* temp = bus_label_offset_;
-  bus_label_offset_ = nullptr;
+  ::TransCatSerial::Point* temp = _impl_.bus_label_offset_;
+  _impl_.bus_label_offset_ = nullptr;
   return temp;
 }
 inline ::TransCatSerial::Point* MapRendererContext::_internal_mutable_bus_label_offset() {
   
-  if (bus_label_offset_ == nullptr) {
+  if (_impl_.bus_label_offset_ == nullptr) {
     auto* p = CreateMaybeMessage<::TransCatSerial::Point>(GetArenaForAllocation());
-    bus_label_offset_ = p;
+    _impl_.bus_label_offset_ = p;
   }
-  return bus_label_offset_;
+  return _impl_.bus_label_offset_;
 }
 inline ::TransCatSerial::Point* MapRendererContext::mutable_bus_label_offset() {
   ::TransCatSerial::Point* _msg = _internal_mutable_bus_label_offset();
@@ -726,12 +800,11 @@ inline ::TransCatSerial::Point* MapRendererContext::mutable_bus_label_offset() {
 inline void MapRendererContext::set_allocated_bus_label_offset(::TransCatSerial::Point* bus_label_offset) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(bus_label_offset_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.bus_label_offset_);
   }
   if (bus_label_offset) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<
-            ::PROTOBUF_NAMESPACE_ID::MessageLite>::GetOwningArena(
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
                 reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bus_label_offset));
     if (message_arena != submessage_arena) {
       bus_label_offset = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
@@ -741,16 +814,16 @@ inline void MapRendererContext::set_allocated_bus_label_offset(::TransCatSerial:
   } else {
     
   }
-  bus_label_offset_ = bus_label_offset;
+  _impl_.bus_label_offset_ = bus_label_offset;
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.MapRendererContext.bus_label_offset)
 }
 
 // int32 stop_label_font_size = 8;
 inline void MapRendererContext::clear_stop_label_font_size() {
-  stop_label_font_size_ = 0;
+  _impl_.stop_label_font_size_ = 0;
 }
 inline int32_t MapRendererContext::_internal_stop_label_font_size() const {
-  return stop_label_font_size_;
+  return _impl_.stop_label_font_size_;
 }
 inline int32_t MapRendererContext::stop_label_font_size() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.MapRendererContext.stop_label_font_size)
@@ -758,7 +831,7 @@ inline int32_t MapRendererContext::stop_label_font_size() const {
 }
 inline void MapRendererContext::_internal_set_stop_label_font_size(int32_t value) {
   
-  stop_label_font_size_ = value;
+  _impl_.stop_label_font_size_ = value;
 }
 inline void MapRendererContext::set_stop_label_font_size(int32_t value) {
   _internal_set_stop_label_font_size(value);
@@ -767,13 +840,13 @@ inline void MapRendererContext::set_stop_label_font_size(int32_t value) {
 
 // .TransCatSerial.Point stop_label_offset = 9;
 inline bool MapRendererContext::_internal_has_stop_label_offset() const {
-  return this != internal_default_instance() && stop_label_offset_ != nullptr;
+  return this != internal_default_instance() && _impl_.stop_label_offset_ != nullptr;
 }
 inline bool MapRendererContext::has_stop_label_offset() const {
   return _internal_has_stop_label_offset();
 }
 inline const ::TransCatSerial::Point& MapRendererContext::_internal_stop_label_offset() const {
-  const ::TransCatSerial::Point* p = stop_label_offset_;
+  const ::TransCatSerial::Point* p = _impl_.stop_label_offset_;
   return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::Point&>(
       ::TransCatSerial::_Point_default_instance_);
 }
@@ -784,9 +857,9 @@ inline const ::TransCatSerial::Point& MapRendererContext::stop_label_offset() co
 inline void MapRendererContext::unsafe_arena_set_allocated_stop_label_offset(
     ::TransCatSerial::Point* stop_label_offset) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(stop_label_offset_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stop_label_offset_);
   }
-  stop_label_offset_ = stop_label_offset;
+  _impl_.stop_label_offset_ = stop_label_offset;
   if (stop_label_offset) {
     
   } else {
@@ -796,8 +869,8 @@ inline void MapRendererContext::unsafe_arena_set_allocated_stop_label_offset(
 }
 inline ::TransCatSerial::Point* MapRendererContext::release_stop_label_offset() {
   
-  ::TransCatSerial::Point* temp = stop_label_offset_;
-  stop_label_offset_ = nullptr;
+  ::TransCatSerial::Point* temp = _impl_.stop_label_offset_;
+  _impl_.stop_label_offset_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -812,17 +885,17 @@ inline ::TransCatSerial::Point* MapRendererContext::release_stop_label_offset()
 inline ::TransCatSerial::Point* MapRendererContext::unsafe_arena_release_stop_label_offset() {
   // @@protoc_insertion_point(field_release:TransCatSerial.MapRendererContext.stop_label_offset)
   
-  ::TransCatSerial::Point* temp = stop_label_offset_;
-  stop_label_offset_ = nullptr;
+  ::TransCatSerial::Point* temp = _impl_.stop_label_offset_;
+  _impl_.stop_label_offset_ = nullptr;
   return temp;
 }
 inline ::TransCatSerial::Point* MapRendererContext::_internal_mutable_stop_label_offset() {
   
-  if (stop_label_offset_ == nullptr) {
+  if (_impl_.stop_label_offset_ == nullptr) {
     auto* p = CreateMaybeMessage<::TransCatSerial::Point>(GetArenaForAllocation());
-    stop_label_offset_ = p;
+    _impl_.stop_label_offset_ = p;
   }
-  return stop_label_offset_;
+  return _impl_.stop_label_offset_;
 }
 inline ::TransCatSerial::Point* MapRendererContext::mutable_stop_label_offset() {
   ::TransCatSerial::Point* _msg = _internal_mutable_stop_label_offset();
@@ -832,12 +905,11 @@ inline ::TransCatSerial::Point* MapRendererContext::mutable_stop_label_offset()
 inline void MapRendererContext::set_allocated_stop_label_offset(::TransCatSerial::Point* stop_label_offset) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(stop_label_offset_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stop_label_offset_);
   }
   if (stop_label_offset) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<
-            ::PROTOBUF_NAMESPACE_ID::MessageLite>::GetOwningArena(
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
                 reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(stop_label_offset));
     if (message_arena != submessage_arena) {
       stop_label_offset = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
@@ -847,19 +919,19 @@ inline void MapRendererContext::set_allocated_stop_label_offset(::TransCatSerial
   } else {
     
   }
-  stop_label_offset_ = stop_label_offset;
+  _impl_.stop_label_offset_ = stop_label_offset;
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.MapRendererContext.stop_label_offset)
 }
 
 // .TransCatSerial.Color underlayer_color = 10;
 inline bool MapRendererContext::_internal_has_underlayer_color() const {
-  return this != internal_default_instance() && underlayer_color_ != nullptr;
+  return this != internal_default_instance() && _impl_.underlayer_color_ != nullptr;
 }
 inline bool MapRendererContext::has_underlayer_color() const {
   return _internal_has_underlayer_color();
 }
 inline const ::TransCatSerial::Color& MapRendererContext::_internal_underlayer_color() const {
-  const ::TransCatSerial::Color* p = underlayer_color_;
+  const ::TransCatSerial::Color* p = _impl_.underlayer_color_;
   return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::Color&>(
       ::TransCatSerial::_Color_default_instance_);
 }
@@ -870,9 +942,9 @@ inline const ::TransCatSerial::Color& MapRendererContext::underlayer_color() con
 inline void MapRendererContext::unsafe_arena_set_allocated_underlayer_color(
     ::TransCatSerial::Color* underlayer_color) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(underlayer_color_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.underlayer_color_);
   }
-  underlayer_color_ = underlayer_color;
+  _impl_.underlayer_color_ = underlayer_color;
   if (underlayer_color) {
     
   } else {
@@ -882,8 +954,8 @@ inline void MapRendererContext::unsafe_arena_set_allocated_underlayer_color(
 }
 inline ::TransCatSerial::Color* MapRendererContext::release_underlayer_color() {
   
-  ::TransCatSerial::Color* temp = underlayer_color_;
-  underlayer_color_ = nullptr;
+  ::TransCatSerial::Color* temp = _impl_.underlayer_color_;
+  _impl_.underlayer_color_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -898,17 +970,17 @@ inline ::TransCatSerial::Color* MapRendererContext::release_underlayer_color() {
 inline ::TransCatSerial::Color* MapRendererContext::unsafe_arena_release_underlayer_color() {
   // @@protoc_insertion_point(field_release:TransCatSerial.MapRendererContext.underlayer_color)
   
-  ::TransCatSerial::Color* temp = underlayer_color_;
-  underlayer_color_ = nullptr;
+  ::TransCatSerial::Color* temp = _impl_.underlayer_color_;
+  _impl_.underlayer_color_ = nullptr;
   return temp;
 }
 inline ::TransCatSerial::Color* MapRendererContext::_internal_mutable_underlayer_color() {
   
-  if (underlayer_color_ == nullptr) {
+  if (_impl_.underlayer_color_ == nullptr) {
     auto* p = CreateMaybeMessage<::TransCatSerial::Color>(GetArenaForAllocation());
-    underlayer_color_ = p;
+    _impl_.underlayer_color_ = p;
   }
-  return underlayer_color_;
+  return _impl_.underlayer_color_;
 }
 inline ::TransCatSerial::Color* MapRendererContext::mutable_underlayer_color() {
   ::TransCatSerial::Color* _msg = _internal_mutable_underlayer_color();
@@ -918,12 +990,11 @@ inline ::TransCatSerial::Color* MapRendererContext::mutable_underlayer_color() {
 inline void MapRendererContext::set_allocated_underlayer_color(::TransCatSerial::Color* underlayer_color) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(underlayer_color_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.underlayer_color_);
   }
   if (underlayer_color) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<
-            ::PROTOBUF_NAMESPACE_ID::MessageLite>::GetOwningArena(
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
                 reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(underlayer_color));
     if (message_arena != submessage_arena) {
       underlayer_color = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
@@ -933,16 +1004,16 @@ inline void MapRendererContext::set_allocated_underlayer_color(::TransCatSerial:
   } else {
     
   }
-  underlayer_color_ = underlayer_color;
+  _impl_.underlayer_color_ = underlayer_color;
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.MapRendererContext.underlayer_color)
 }
 
 // double underlayer_width = 11;
 inline void MapRendererContext::clear_underlayer_width() {
-  underlayer_width_ = 0;
+  _impl_.underlayer_width_ = 0;
 }
 inline double MapRendererContext::_internal_underlayer_width() const {
-  return underlayer_width_;
+  return _impl_.underlayer_width_;
 }
 inline double MapRendererContext::underlayer_width() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.MapRendererContext.underlayer_width)
@@ -950,7 +1021,7 @@ inline double MapRendererContext::underlayer_width() const {
 }
 inline void MapRendererContext::_internal_set_underlayer_width(double value) {
   
-  underlayer_width_ = value;
+  _impl_.underlayer_width_ = value;
 }
 inline void MapRendererContext::set_underlayer_width(double value) {
   _internal_set_underlayer_width(value);
@@ -959,29 +1030,29 @@ inline void MapRendererContext::set_underlayer_width(double value) {
 
 // repeated .TransCatSerial.Color color_palette = 12;
 inline int MapRendererContext::_internal_color_palette_size() const {
-  return color_palette_.size();
+  return _impl_.color_palette_.size();
 }
 inline int MapRendererContext::color_palette_size() const {
   return _internal_color_palette_size();
 }
 inline ::TransCatSerial::Color* MapRendererContext::mutable_color_palette(int index) {
   // @@protoc_insertion_point(field_mutable:TransCatSerial.MapRendererContext.color_palette)
-  return color_palette_.Mutable(index);
+  return _impl_.color_palette_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Color >*
 MapRendererContext::mutable_color_palette() {
   // @@protoc_insertion_point(field_mutable_list:TransCatSerial.MapRendererContext.color_palette)
-  return &color_palette_;
+  return &_impl_.color_palette_;
 }
 inline const ::TransCatSerial::Color& MapRendererContext::_internal_color_palette(int index) const {
-  return color_palette_.Get(index);
+  return _impl_.color_palette_.Get(index);
 }
 inline const ::TransCatSerial::Color& MapRendererContext::color_palette(int index) const {
   // @@protoc_insertion_point(field_get:TransCatSerial.MapRendererContext.color_palette)
   return _internal_color_palette(index);
 }
 inline ::TransCatSerial::Color* MapRendererContext::_internal_add_color_palette() {
-  return color_palette_.Add();
+  return _impl_.color_palette_.Add();
 }
 inline ::TransCatSerial::Color* MapRendererContext::add_color_palette() {
   ::TransCatSerial::Color* _add = _internal_add_color_palette();
@@ -991,7 +1062,7 @@ inline ::TransCatSerial::Color* MapRendererContext::add_color_palette() {
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Color >&
 MapRendererContext::color_palette() const {
   // @@protoc_insertion_point(field_list:TransCatSerial.MapRendererContext.color_palette)
-  return color_palette_;
+  return _impl_.color_palette_;
 }
 
 // -------------------------------------------------------------------
@@ -1000,10 +1071,10 @@ MapRendererContext::color_palette() const {
 
 // double bus_wait_time = 1;
 inline void RouterContext::clear_bus_wait_time() {
-  bus_wait_time_ = 0;
+  _impl_.bus_wait_time_ = 0;
 }
 inline double RouterContext::_internal_bus_wait_time() const {
-  return bus_wait_time_;
+  return _impl_.bus_wait_time_;
 }
 inline double RouterContext::bus_wait_time() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.RouterContext.bus_wait_time)
@@ -1011,7 +1082,7 @@ inline double RouterContext::bus_wait_time() const {
 }
 inline void RouterContext::_internal_set_bus_wait_time(double value) {
   
-  bus_wait_time_ = value;
+  _impl_.bus_wait_time_ = value;
 }
 inline void RouterContext::set_bus_wait_time(double value) {
   _internal_set_bus_wait_time(value);
@@ -1020,10 +1091,10 @@ inline void RouterContext::set_bus_wait_time(double value) {
 
 // double bus_velocity = 2;
 inline void RouterContext::clear_bus_velocity() {
-  bus_velocity_ = 0;
+  _impl_.bus_velocity_ = 0;
 }
 inline double RouterContext::_internal_bus_velocity() const {
-  return bus_velocity_;
+  return _impl_.bus_velocity_;
 }
 inline double RouterContext::bus_velocity() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.RouterContext.bus_velocity)
@@ -1031,13 +1102,33 @@ inline double RouterContext::bus_velocity() const {
 }
 inline void RouterContext::_internal_set_bus_velocity(double value) {
   
-  bus_velocity_ = value;
+  _impl_.bus_velocity_ = value;
 }
 inline void RouterContext::set_bus_velocity(double value) {
   _internal_set_bus_velocity(value);
   // @@protoc_insertion_point(field_set:TransCatSerial.RouterContext.bus_velocity)
 }
 
+// .TransCatSerial.RouterContext.RouteSearch route_search = 3;
+inline void RouterContext::clear_route_search() {
+  _impl_.route_search_ = 0;
+}
+inline ::TransCatSerial::RouterContext_RouteSearch RouterContext::_internal_route_search() const {
+  return static_cast< ::TransCatSerial::RouterContext_RouteSearch >(_impl_.route_search_);
+}
+inline ::TransCatSerial::RouterContext_RouteSearch RouterContext::route_search() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.RouterContext.route_search)
+  return _internal_route_search();
+}
+inline void RouterContext::_internal_set_route_search(::TransCatSerial::RouterContext_RouteSearch value) {
+  
+  _impl_.route_search_ = value;
+}
+inline void RouterContext::set_route_search(::TransCatSerial::RouterContext_RouteSearch value) {
+  _internal_set_route_search(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.RouterContext.route_search)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -1048,6 +1139,16 @@ inline void RouterContext::set_bus_velocity(double value) {
 
 }  // namespace TransCatSerial
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::TransCatSerial::RouterContext_RouteSearch> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::TransCatSerial::RouterContext_RouteSearch>() {
+  return ::TransCatSerial::RouterContext_RouteSearch_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
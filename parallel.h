@@ -0,0 +1,53 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+#include <cstddef>
+
+namespace parallel
+{
+    // Выполняет func(i) для i = 0..count-1 в thread_count потоках (0 - по числу аппаратных потоков).
+    // Задания раздаются по одному, поэтому порядок их выполнения не определён, и func должна
+    // записывать результат i-го задания только в его собственное место. Исключение, возникшее
+    // в любом из потоков, прекращает раздачу заданий и передаётся вызывающему.
+    template <typename Func>
+    void ParallelFor(size_t count, unsigned thread_count, Func func)
+    {
+        if (!thread_count)
+            thread_count = std::max(1u, std::thread::hardware_concurrency());
+        thread_count = static_cast<unsigned>(std::min<size_t>(thread_count, count));
+        if (thread_count <= 1)
+        {
+            for (size_t i = 0; i < count; ++i)
+                func(i);
+            return;
+        }
+
+        std::atomic<size_t> next_index{0};
+        std::vector<std::exception_ptr> errors(thread_count);
+        std::vector<std::thread> workers;
+        workers.reserve(thread_count);
+        for (unsigned thread_num = 0; thread_num < thread_count; ++thread_num)
+            workers.emplace_back([&, thread_num]()
+            {
+                try
+                {
+                    for (size_t i = next_index++; i < count; i = next_index++)
+                        func(i);
+                }
+                catch (...)
+                {
+                    errors[thread_num] = std::current_exception();
+                    next_index = count;
+                }
+            });
+        for (std::thread& worker : workers)
+            worker.join();
+        for (const std::exception_ptr& error : errors)
+            if (error)
+                std::rethrow_exception(error);
+    }
+} // namespace parallel
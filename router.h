@@ -5,8 +5,12 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <functional>
 #include <iterator>
+#include <limits>
+#include <numeric>
 #include <optional>
+#include <queue>
 #include <stdexcept>
 #include <unordered_map>
 #include <utility>
@@ -17,6 +21,34 @@
 
 namespace graph
 {
+    // Способ построения маршрутов. ROUTES_MATRIX - маршрутная матрица всех пар вершин рассчитывается
+    // заранее, и маршрут строится за время, пропорциональное числу его рёбер, ценой памяти порядка
+    // квадрата числа вершин. Остальные способы ничего не рассчитывают заранее, а ищут каждый маршрут
+    // заново: DIJKSTRA - алгоритм Дейкстры от начальной вершины до конечной, BIDIRECTIONAL - встречный
+    // алгоритм Дейкстры от обеих вершин, ASTAR - алгоритм A* с нижней оценкой веса маршрута до конечной вершины.
+    // CONTRACTION_HIERARCHY - заранее строится иерархия сжатия графа (вершины упорядочиваются по важности,
+    // и для сохранения кратчайших маршрутов в граф добавляются рёбра-сокращения), а маршрут ищется встречным
+    // поиском только по рёбрам, ведущим вверх по иерархии; память - порядка числа рёбер графа.
+    // HUB_LABELS - заранее рассчитываются метки хабов: каждой вершине сопоставляются упорядоченные списки
+    // вершин-хабов с весами маршрутов от них и до них, так что кратчайший маршрут проходит через общий хаб
+    // начальной и конечной вершин, и его вес находится слиянием двух коротких списков.
+    enum class RouteSearch
+    {
+        ROUTES_MATRIX = 0,
+        DIJKSTRA,
+        BIDIRECTIONAL,
+        ASTAR,
+        CONTRACTION_HIERARCHY,
+        HUB_LABELS
+    };
+
+    // Способ построения маршрутов, данные которого рассчитываются заранее и хранятся в базе.
+    inline bool IsPrecomputedRouteSearch(RouteSearch route_search)
+    {
+        return route_search == RouteSearch::ROUTES_MATRIX || route_search == RouteSearch::CONTRACTION_HIERARCHY ||
+               route_search == RouteSearch::HUB_LABELS;
+    }
+
     template <typename Weight>
     class Router
     {
@@ -26,6 +58,30 @@ namespace graph
     public:
         friend class serial::Serializer;
         explicit Router(const Graph& graph);
+        // Признак создания маршрутизатора без предварительного расчёта - маршрутная матрица, иерархия сжатия
+        // или метки хабов (в зависимости от route_search) будут восстановлены из сохранённой базы.
+        struct DeferredRoutes
+        {
+            RouteSearch route_search = RouteSearch::ROUTES_MATRIX;
+        };
+        Router(const Graph& graph, DeferredRoutes deferred_routes);
+        // Рассчитывает маршрутную матрицу изменённого графа, используя матрицу прежнего графа prev_router
+        // (её граф должен существовать до окончания работы конструктора). prev_vertex_to_vertex
+        // отображает номера вершин прежнего графа в номера вершин нового, nullopt - вершина удалена.
+        Router(const Graph& graph, const Router& prev_router,
+               const std::vector<std::optional<VertexId>>& prev_vertex_to_vertex);
+        // Нижняя оценка веса маршрута между двумя вершинами для поиска ASTAR. Оценка должна быть
+        // согласованной: для любого ребра from -> to оценка для from не больше суммы веса ребра
+        // и оценки для to (при этом она не превышает и веса кратчайшего маршрута).
+        using LowerBound = std::function<Weight(VertexId from, VertexId to)>;
+        // Маршрутизатор с заданным способом построения маршрутов. При ROUTES_MATRIX рассчитывает
+        // маршрутную матрицу, как и конструктор Router(graph). Оценка lower_bound нужна только для ASTAR,
+        // без неё поиск ASTAR вырождается в алгоритм Дейкстры.
+        Router(const Graph& graph, RouteSearch route_search, LowerBound lower_bound = {});
+        // Пересчитывает маршрутную матрицу, иерархию сжатия или метки хабов после изменения весов рёбер графа
+        // при прежней его структуре. Нижняя оценка для ASTAR остаётся прежней и должна оставаться верной
+        // и для новых весов.
+        void UpdateWeights();
 
         struct RouteInfo
         {
@@ -33,7 +89,50 @@ namespace graph
             std::vector<EdgeId> edges;
         };
 
-        std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const;
+        // Сведения о работе поиска маршрута - для замеров производительности.
+        struct SearchStats
+        {
+            size_t settled_vertexes = 0; // Вершин, до которых поиск нашёл окончательный маршрут
+        };
+
+        // Маршрут между вершинами. Может одновременно вызываться из нескольких потоков.
+        std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to, SearchStats* search_stats = nullptr) const;
+        // Веса маршрутов из вершины from во все вершины targets (nullopt - маршрута нет) без восстановления
+        // самих маршрутов. Может одновременно вызываться из нескольких потоков.
+        std::vector<std::optional<Weight>> BuildRouteWeights(VertexId from, const std::vector<VertexId>& targets) const;
+        // Маршруты из вершины from во все вершины targets (nullopt - маршрута нет). При поиске по запросу все
+        // маршруты находятся одним поиском Дейкстры от from; при DIJKSTRA они совпадают с построенными
+        // BuildRoute, а при BIDIRECTIONAL и ASTAR из равных по весу маршрутов может быть выбран другой.
+        // Может одновременно вызываться из нескольких потоков.
+        std::vector<std::optional<RouteInfo>> BuildRoutes(VertexId from, const std::vector<VertexId>& targets) const;
+        // Вершины, маршруты до которых из вершины from весят не более max_weight, с весами этих маршрутов
+        // в порядке неубывания весов. Поиск не выходит за пределы достижимой области графа.
+        // Может одновременно вызываться из нескольких потоков.
+        std::vector<std::pair<VertexId, Weight>> BuildReachableVertexes(VertexId from, Weight max_weight) const;
+        // Кратчайший маршрут (первым элементом, как его строит BuildRoute) и до max_alternatives заметно
+        // отличающихся от него и друг от друга альтернативных маршрутов, вес которых не более чем в
+        // max_stretch раз больше кратчайшего, в порядке возрастания веса. Пустой результат - маршрута нет.
+        // Если задан is_distinct, он вызывается для кратчайшего маршрута и затем для каждого подходящего
+        // кандидата; кандидат, для которого он вернул false, отбрасывается, и перебор продолжается, пока не
+        // будет принято max_alternatives альтернатив или не кончатся кандидаты. Для кратчайшего маршрута
+        // возвращённое значение не учитывается. Может одновременно вызываться из нескольких потоков.
+        std::vector<RouteInfo> BuildAlternativeRoutes(VertexId from, VertexId to, size_t max_alternatives,
+                                                      double max_stretch,
+                                                      const std::function<bool(const RouteInfo&)>& is_distinct = {}) const;
+
+        RouteSearch GetRouteSearch() const
+        {
+            return route_search_;
+        }
+
+        // Общее число меток хабов всех вершин (для способа HUB_LABELS) - для оценки объёма данных.
+        size_t GetHubLabelCount() const
+        {
+            size_t label_count = 0;
+            for (size_t vertex = 0; vertex < in_labels_.size(); ++vertex)
+                label_count += in_labels_[vertex].size() + out_labels_[vertex].size();
+            return label_count;
+        }
 
     private:
         struct RouteInternalData
@@ -86,9 +185,147 @@ namespace graph
             }
         }
 
+        using RouteQueue = std::priority_queue<std::pair<Weight, VertexId>, std::vector<std::pair<Weight, VertexId>>,
+                                               std::greater<std::pair<Weight, VertexId>>>;
+
+        // Алгоритм Дейкстры для строки vertex_from маршрутной матрицы: уточняет маршруты, начиная с вершин
+        // из очереди queue, веса которых уже занесены в строку.
+        void RelaxRouteRow(VertexId vertex_from, RouteQueue& queue)
+        {
+            auto& row = routes_internal_data_[vertex_from];
+            while (!queue.empty())
+            {
+                const auto [weight, vertex] = queue.top();
+                queue.pop();
+                if (row[vertex]->weight < weight)
+                    continue;
+                for (const EdgeId edge_id : graph_.GetIncidentEdges(vertex))
+                {
+                    const auto& edge = graph_.GetEdge(edge_id);
+                    const Weight candidate_weight = weight + edge.weight;
+                    auto& route_to = row[edge.to];
+                    if (!route_to || candidate_weight < route_to->weight)
+                    {
+                        route_to = RouteInternalData{candidate_weight, edge_id};
+                        queue.emplace(candidate_weight, edge.to);
+                    }
+                }
+            }
+        }
+
+        // Состояние поиска маршрута из одной вершины (или, для встречного поиска, в одну вершину).
+        // Массивы размером в число вершин выделяются один раз на поток и после каждого поиска
+        // возвращаются в исходное состояние только в тех вершинах, которых поиск достиг.
+        struct SearchSide
+        {
+            std::vector<Weight> weights;     // Вес лучшего найденного маршрута, MAX_WEIGHT - вершина не достигнута
+            std::vector<EdgeId> route_edges; // Ребро маршрута, инцидентное вершине, NO_EDGE - у маршрута нет рёбер
+            std::vector<bool> settled;
+            std::vector<VertexId> reached_vertexes;
+            RouteQueue queue;
+
+            void Prepare(size_t vertex_count)
+            {
+                if (weights.size() < vertex_count)
+                {
+                    weights.resize(vertex_count, MAX_WEIGHT);
+                    route_edges.resize(vertex_count, NO_EDGE);
+                    settled.resize(vertex_count, false);
+                }
+            }
+
+            void Reach(VertexId vertex, Weight weight, EdgeId edge_id, Weight key)
+            {
+                if (weights[vertex] == MAX_WEIGHT)
+                    reached_vertexes.push_back(vertex);
+                weights[vertex] = weight;
+                route_edges[vertex] = edge_id;
+                queue.emplace(key, vertex);
+            }
+
+            void Reset()
+            {
+                for (const VertexId vertex : reached_vertexes)
+                {
+                    weights[vertex] = MAX_WEIGHT;
+                    route_edges[vertex] = NO_EDGE;
+                    settled[vertex] = false;
+                }
+                reached_vertexes.clear();
+                queue = RouteQueue();
+            }
+        };
+
+        // Ребро иерархии сжатия: либо самое лёгкое из рёбер исходного графа между парой вершин (original_edge),
+        // либо сокращение, заменяющее путь из двух рёбер иерархии first_child и second_child.
+        struct HierarchyEdge
+        {
+            VertexId from;
+            VertexId to;
+            Weight weight;
+            EdgeId original_edge; // NO_EDGE - ребро-сокращение
+            EdgeId first_child;
+            EdgeId second_child;
+        };
+
+        // Метка хаба. Во входящих метках вершины weight - вес маршрута от хаба до вершины, edge - последнее ребро
+        // этого маршрута; в исходящих - вес маршрута от вершины до хаба и его первое ребро. Для самого хаба
+        // edge = NO_EDGE. Ребро ведёт к соседней вершине, у которой тоже есть метка этого хаба, - по таким
+        // ссылкам восстанавливается маршрут.
+        struct HubLabel
+        {
+            uint32_t hub; // Номер хаба в hub_vertexes_
+            Weight weight;
+            EdgeId edge;
+        };
+        using HubLabels = std::vector<std::vector<HubLabel>>;
+
+        void InitializeSearchData();
+        void Precompute();
+        void BuildContractionHierarchy();
+        void BuildHubLabels();
+        std::optional<RouteInfo> BuildMatrixRoute(VertexId from, VertexId to) const;
+        std::optional<RouteInfo> SearchRoute(VertexId from, VertexId to, SearchStats& search_stats) const;
+        std::optional<RouteInfo> SearchRouteBidirectional(VertexId from, VertexId to, SearchStats& search_stats) const;
+        std::optional<RouteInfo> SearchRouteHierarchy(VertexId from, VertexId to, SearchStats& search_stats) const;
+        void UnpackHierarchyEdge(EdgeId hierarchy_edge, std::vector<EdgeId>& edges) const;
+        std::optional<RouteInfo> BuildLabelRoute(VertexId from, VertexId to) const;
+        std::pair<Weight, uint32_t> FindLabelRouteWeight(VertexId from, VertexId to) const;
+        std::vector<std::optional<Weight>> SearchRouteWeights(VertexId from, const std::vector<VertexId>& targets) const;
+        std::vector<std::optional<RouteInfo>> SearchRoutes(VertexId from, const std::vector<VertexId>& targets) const;
+        void SearchTargets(VertexId from, const std::vector<VertexId>& targets, SearchSide& search) const;
+        static const HubLabel& FindHubLabel(const std::vector<HubLabel>& labels, uint32_t hub);
+
         static constexpr Weight ZERO_WEIGHT{};
+        static constexpr Weight MAX_WEIGHT = std::numeric_limits<Weight>::max();
+        static constexpr EdgeId NO_EDGE = std::numeric_limits<EdgeId>::max();
         const Graph& graph_;
+        RouteSearch route_search_ = RouteSearch::ROUTES_MATRIX;
+        LowerBound lower_bound_;
         RoutesInternalData routes_internal_data_;
+        // Входящие рёбра вершин - для обратных поисков (встречного поиска и поиска альтернативных маршрутов)
+        std::vector<std::vector<EdgeId>> incoming_edges_;
+        // Иерархия сжатия: ранги вершин (порядок их сжатия) и рёбра иерархии. Из рёбер строятся списки
+        // рёбер, выходящих из вершины в вершины большего ранга (upward_edges_), и рёбер, входящих
+        // в вершину из вершин большего ранга (downward_edges_).
+        std::vector<size_t> vertex_ranks_;
+        std::vector<HierarchyEdge> hierarchy_edges_;
+        std::vector<std::vector<EdgeId>> upward_edges_;
+        std::vector<std::vector<EdgeId>> downward_edges_;
+        // Ограничение числа вершин, просматриваемых при поиске обходного пути во время сжатия вершины.
+        // Не найденный из-за него обходной путь приводит лишь к лишнему ребру-сокращению.
+        static constexpr size_t WITNESS_SETTLED_LIMIT = 64;
+        // Приоритет вершины - лишь оценка, поэтому при его расчёте обходные пути ищутся дешевле: с меньшим
+        // числом просматриваемых вершин и не длиннее заданного числа рёбер.
+        static constexpr size_t PRIORITY_WITNESS_SETTLED_LIMIT = 16;
+        static constexpr size_t PRIORITY_WITNESS_HOP_LIMIT = 3;
+        // Наибольшая доля веса альтернативного маршрута, приходящаяся на рёбра уже выбранных маршрутов
+        static constexpr double MAX_ALTERNATIVE_OVERLAP = 0.7;
+        // Метки хабов: вершины-хабы в порядке убывания важности, входящие и исходящие метки вершин,
+        // упорядоченные по номерам хабов.
+        std::vector<VertexId> hub_vertexes_;
+        HubLabels in_labels_;
+        HubLabels out_labels_;
     };
 
     template <typename Weight>
@@ -102,11 +339,561 @@ namespace graph
         const size_t vertex_count = graph.GetVertexCount();
         for (VertexId vertex_through = 0; vertex_through < vertex_count; ++vertex_through)
             RelaxRoutesInternalDataThroughVertex(vertex_count, vertex_through);
+        InitializeSearchData();
+    }
+
+    template <typename Weight>
+    Router<Weight>::Router(const Graph& graph, DeferredRoutes deferred_routes)
+        : graph_(graph)
+        , route_search_(deferred_routes.route_search)
+    {}
+
+    template <typename Weight>
+    Router<Weight>::Router(const Graph& graph, RouteSearch route_search, LowerBound lower_bound)
+        : graph_(graph)
+        , route_search_(route_search)
+        , lower_bound_(std::move(lower_bound))
+    {
+        Precompute();
+        InitializeSearchData();
+    }
+
+    template <typename Weight>
+    void Router<Weight>::UpdateWeights()
+    {
+        Precompute();
+        InitializeSearchData();
+    }
+
+    template <typename Weight>
+    void Router<Weight>::Precompute()
+    {
+        if (route_search_ == RouteSearch::ROUTES_MATRIX)
+        {
+            routes_internal_data_.assign(graph_.GetVertexCount(),
+                                         std::vector<std::optional<RouteInternalData>>(graph_.GetVertexCount()));
+            InitializeRoutesInternalData(graph_);
+            const size_t vertex_count = graph_.GetVertexCount();
+            for (VertexId vertex_through = 0; vertex_through < vertex_count; ++vertex_through)
+                RelaxRoutesInternalDataThroughVertex(vertex_count, vertex_through);
+        }
+        else if (route_search_ == RouteSearch::CONTRACTION_HIERARCHY)
+        {
+            BuildContractionHierarchy();
+        }
+        else if (route_search_ == RouteSearch::HUB_LABELS)
+        {
+            BuildHubLabels();
+        }
+    }
+
+    template <typename Weight>
+    void Router<Weight>::InitializeSearchData()
+    {
+        for (EdgeId edge_id = 0; edge_id < graph_.GetEdgeCount(); ++edge_id)
+            if (graph_.GetEdge(edge_id).weight < ZERO_WEIGHT)
+                throw std::domain_error("Edges' weights should be non-negative");
+        incoming_edges_.assign(graph_.GetVertexCount(), {});
+        for (EdgeId edge_id = 0; edge_id < graph_.GetEdgeCount(); ++edge_id)
+            incoming_edges_[graph_.GetEdge(edge_id).to].push_back(edge_id);
+        upward_edges_.clear();
+        downward_edges_.clear();
+        if (route_search_ == RouteSearch::CONTRACTION_HIERARCHY)
+        {
+            if (vertex_ranks_.size() != graph_.GetVertexCount())
+                throw std::invalid_argument("Contraction hierarchy does not match the graph");
+            upward_edges_.resize(graph_.GetVertexCount());
+            downward_edges_.resize(graph_.GetVertexCount());
+            for (EdgeId edge_id = 0; edge_id < hierarchy_edges_.size(); ++edge_id)
+            {
+                const HierarchyEdge& edge = hierarchy_edges_[edge_id];
+                if (vertex_ranks_[edge.from] < vertex_ranks_[edge.to])
+                    upward_edges_[edge.from].push_back(edge_id);
+                else
+                    downward_edges_[edge.to].push_back(edge_id);
+            }
+        }
+        else if (route_search_ == RouteSearch::HUB_LABELS)
+        {
+            if (in_labels_.size() != graph_.GetVertexCount() || out_labels_.size() != graph_.GetVertexCount())
+                throw std::invalid_argument("Hub labels do not match the graph");
+        }
+    }
+
+    template <typename Weight>
+    void Router<Weight>::BuildHubLabels()
+    {
+        // Разметка с отсечением: хабы обходятся в порядке убывания важности (за важность принята степень
+        // вершины), и из каждого хаба h алгоритмом Дейкстры строятся маршруты до всех вершин (прямой поиск)
+        // и от всех вершин (обратный). Вершина u получает метку хаба h, только если маршрут между ними
+        // короче найденного по уже имеющимся меткам; иначе поиск через u не продолжается. Вершина, из
+        // которой поиск продолжился, сама получила метку хаба h, поэтому ссылки меток ведут по цепочке до хаба.
+        const size_t vertex_count = graph_.GetVertexCount();
+        std::vector<std::vector<EdgeId>> incoming_edges(vertex_count);
+        for (EdgeId edge_id = 0; edge_id < graph_.GetEdgeCount(); ++edge_id)
+        {
+            if (graph_.GetEdge(edge_id).weight < ZERO_WEIGHT)
+                throw std::domain_error("Edges' weights should be non-negative");
+            incoming_edges[graph_.GetEdge(edge_id).to].push_back(edge_id);
+        }
+        std::vector<size_t> vertex_degrees(vertex_count);
+        for (VertexId vertex = 0; vertex < vertex_count; ++vertex)
+        {
+            const auto outgoing_edges = graph_.GetIncidentEdges(vertex);
+            vertex_degrees[vertex] = std::distance(outgoing_edges.begin(), outgoing_edges.end()) + incoming_edges[vertex].size();
+        }
+        hub_vertexes_.resize(vertex_count);
+        std::iota(hub_vertexes_.begin(), hub_vertexes_.end(), VertexId{0});
+        std::stable_sort(hub_vertexes_.begin(), hub_vertexes_.end(), [&vertex_degrees](VertexId lhs, VertexId rhs)
+        {
+            return vertex_degrees[lhs] > vertex_degrees[rhs];
+        });
+        in_labels_.assign(vertex_count, {});
+        out_labels_.assign(vertex_count, {});
+
+        SearchSide search;
+        search.Prepare(vertex_count);
+        std::vector<Weight> hub_weights(vertex_count, MAX_WEIGHT); // Метки хаба h, разложенные по номерам хабов
+        auto label_from_hub = [&](uint32_t hub, bool is_forward)
+        {
+            const VertexId hub_vertex = hub_vertexes_[hub];
+            // Прямой поиск размечает входящие метки, и маршрут до вершины u по имеющимся меткам складывается из
+            // исходящей метки хаба и входящей метки u; для обратного поиска - наоборот.
+            HubLabels& labels = is_forward ? in_labels_ : out_labels_;
+            const std::vector<HubLabel>& hub_labels = is_forward ? out_labels_[hub_vertex] : in_labels_[hub_vertex];
+            for (const HubLabel& label : hub_labels)
+                hub_weights[label.hub] = label.weight;
+            search.Reach(hub_vertex, ZERO_WEIGHT, NO_EDGE, ZERO_WEIGHT);
+            while (!search.queue.empty())
+            {
+                const auto [weight, vertex] = search.queue.top();
+                search.queue.pop();
+                if (search.settled[vertex])
+                    continue;
+                search.settled[vertex] = true;
+                const bool is_covered = std::any_of(labels[vertex].begin(), labels[vertex].end(), [&](const HubLabel& label)
+                {
+                    return hub_weights[label.hub] != MAX_WEIGHT && !(weight < hub_weights[label.hub] + label.weight);
+                });
+                if (is_covered)
+                    continue;
+                labels[vertex].push_back({hub, weight, search.route_edges[vertex]});
+                for (const EdgeId edge_id : is_forward ? graph_.GetIncidentEdges(vertex) : ranges::AsRange(incoming_edges[vertex]))
+                {
+                    const auto& edge = graph_.GetEdge(edge_id);
+                    const VertexId vertex_to = is_forward ? edge.to : edge.from;
+                    const Weight candidate_weight = weight + edge.weight;
+                    if (!search.settled[vertex_to] && candidate_weight < search.weights[vertex_to])
+                        search.Reach(vertex_to, candidate_weight, edge_id, candidate_weight);
+                }
+            }
+            search.Reset();
+            for (const HubLabel& label : hub_labels)
+                hub_weights[label.hub] = MAX_WEIGHT;
+        };
+        for (uint32_t hub = 0; hub < vertex_count; ++hub)
+        {
+            label_from_hub(hub, true);
+            label_from_hub(hub, false);
+        }
+    }
+
+    template <typename Weight>
+    void Router<Weight>::BuildContractionHierarchy()
+    {
+        // Вершины сжимаются по одной. При сжатии вершины v для каждой пары её соседей u -> v -> x, ещё не
+        // сжатых, добавляется ребро-сокращение u -> x, если ограниченный поиск из u в обход v не находит
+        // пути не тяжелее. Очерёдность сжатия определяется приоритетом: разностью числа добавляемых
+        // сокращений и числа удаляемых рёбер плюс число уже сжатых соседей (чтобы сжатие шло по графу
+        // равномерно). Приоритеты пересчитываются лениво - при извлечении вершины из очереди, если с момента
+        // их расчёта окрестность вершины изменилась.
+        const size_t vertex_count = graph_.GetVertexCount();
+        struct WorkEdge
+        {
+            VertexId vertex; // Другой конец ребра
+            Weight weight;
+            EdgeId hierarchy_edge;
+        };
+        std::vector<std::vector<WorkEdge>> out_edges(vertex_count), in_edges(vertex_count);
+        std::vector<HierarchyEdge> all_edges;
+        std::vector<bool> is_kept_edge;
+
+        // Добавляет ребро в рабочий граф, если между его концами ещё нет ребра не тяжелее.
+        auto add_edge = [&](VertexId from, VertexId to, Weight weight, EdgeId original_edge,
+                            EdgeId first_child, EdgeId second_child)
+        {
+            auto out_it = std::find_if(out_edges[from].begin(), out_edges[from].end(),
+                                       [to](const WorkEdge& edge) {return edge.vertex == to;});
+            if (out_it != out_edges[from].end() && !(weight < out_it->weight))
+                return;
+            const EdgeId hierarchy_edge = all_edges.size();
+            all_edges.push_back({from, to, weight, original_edge, first_child, second_child});
+            is_kept_edge.push_back(false);
+            if (out_it != out_edges[from].end())
+            {
+                *out_it = {to, weight, hierarchy_edge};
+                *std::find_if(in_edges[to].begin(), in_edges[to].end(),
+                              [from](const WorkEdge& edge) {return edge.vertex == from;}) = {from, weight, hierarchy_edge};
+            }
+            else
+            {
+                out_edges[from].push_back({to, weight, hierarchy_edge});
+                in_edges[to].push_back({from, weight, hierarchy_edge});
+            }
+        };
+        for (EdgeId edge_id = 0; edge_id < graph_.GetEdgeCount(); ++edge_id)
+        {
+            const auto& edge = graph_.GetEdge(edge_id);
+            if (edge.weight < ZERO_WEIGHT)
+                throw std::domain_error("Edges' weights should be non-negative");
+            if (edge.from != edge.to)
+                add_edge(edge.from, edge.to, edge.weight, edge_id, NO_EDGE, NO_EDGE);
+        }
+
+        // Ограниченный поиск обходных путей из вершины from, минуя вершину skipped_vertex: просматривается
+        // не более settled_limit вершин, и пути не длиннее hop_limit рёбер. Поиск прекращается, как только
+        // найдены пути во все target_count целевых вершин, а вершины тяжелее max_weight в очередь не попадают.
+        SearchSide witness;
+        witness.Prepare(vertex_count);
+        std::vector<size_t> witness_hops(vertex_count);
+        std::vector<bool> is_witness_target(vertex_count, false);
+        auto search_witnesses = [&](VertexId from, VertexId skipped_vertex, Weight max_weight,
+                                    size_t target_count, size_t settled_limit, size_t hop_limit)
+        {
+            witness.Reset();
+            witness.Reach(from, ZERO_WEIGHT, NO_EDGE, ZERO_WEIGHT);
+            witness_hops[from] = 0;
+            size_t settled_count = 0;
+            while (!witness.queue.empty() && settled_count < settled_limit)
+            {
+                const auto [weight, vertex] = witness.queue.top();
+                witness.queue.pop();
+                if (witness.settled[vertex])
+                    continue;
+                if (max_weight < weight)
+                    break;
+                witness.settled[vertex] = true;
+                ++settled_count;
+                if (is_witness_target[vertex] && --target_count == 0)
+                    break;
+                if (witness_hops[vertex] >= hop_limit)
+                    continue;
+                for (const WorkEdge& edge : out_edges[vertex])
+                {
+                    const Weight candidate_weight = weight + edge.weight;
+                    if (edge.vertex != skipped_vertex && !(max_weight < candidate_weight) &&
+                        candidate_weight < witness.weights[edge.vertex])
+                    {
+                        witness.Reach(edge.vertex, candidate_weight, NO_EDGE, candidate_weight);
+                        witness_hops[edge.vertex] = witness_hops[vertex] + 1;
+                    }
+                }
+            }
+        };
+        // Перебирает сокращения, необходимые при сжатии вершины vertex (с точностью до ограничений поиска).
+        auto for_each_shortcut = [&](VertexId vertex, size_t settled_limit, size_t hop_limit, auto on_shortcut)
+        {
+            for (const WorkEdge& out_edge : out_edges[vertex])
+                is_witness_target[out_edge.vertex] = true;
+            for (const WorkEdge& in_edge : in_edges[vertex])
+            {
+                Weight max_weight = ZERO_WEIGHT;
+                size_t target_count = 0;
+                for (const WorkEdge& out_edge : out_edges[vertex])
+                    if (out_edge.vertex != in_edge.vertex)
+                    {
+                        max_weight = std::max(max_weight, in_edge.weight + out_edge.weight);
+                        ++target_count;
+                    }
+                if (target_count == 0)
+                    continue;
+                const bool is_from_target = is_witness_target[in_edge.vertex];
+                is_witness_target[in_edge.vertex] = false;
+                search_witnesses(in_edge.vertex, vertex, max_weight, target_count, settled_limit, hop_limit);
+                is_witness_target[in_edge.vertex] = is_from_target;
+                for (const WorkEdge& out_edge : out_edges[vertex])
+                    if (out_edge.vertex != in_edge.vertex &&
+                        in_edge.weight + out_edge.weight < witness.weights[out_edge.vertex])
+                        on_shortcut(in_edge, out_edge);
+            }
+            for (const WorkEdge& out_edge : out_edges[vertex])
+                is_witness_target[out_edge.vertex] = false;
+        };
+        // Приоритет оценивается удешевлённым поиском и пересчитывается, только если окрестность вершины
+        // изменилась (сжат один из её соседей). Сокращения для сжатия ищутся полным поиском.
+        std::vector<long long> contracted_neighbors(vertex_count);
+        std::vector<bool> is_priority_stale(vertex_count, false);
+        auto compute_priority = [&](VertexId vertex)
+        {
+            long long shortcut_count = 0;
+            for_each_shortcut(vertex, PRIORITY_WITNESS_SETTLED_LIMIT, PRIORITY_WITNESS_HOP_LIMIT,
+                              [&shortcut_count](const WorkEdge&, const WorkEdge&) {++shortcut_count;});
+            is_priority_stale[vertex] = false;
+            return shortcut_count - static_cast<long long>(in_edges[vertex].size() + out_edges[vertex].size())
+                   + contracted_neighbors[vertex];
+        };
+
+        using PriorityQueue = std::priority_queue<std::pair<long long, VertexId>, std::vector<std::pair<long long, VertexId>>,
+                                                  std::greater<std::pair<long long, VertexId>>>;
+        PriorityQueue queue;
+        for (VertexId vertex = 0; vertex < vertex_count; ++vertex)
+            queue.emplace(compute_priority(vertex), vertex);
+
+        vertex_ranks_.assign(vertex_count, 0);
+        size_t next_rank = 0;
+        std::vector<std::pair<WorkEdge, WorkEdge>> shortcuts;
+        while (!queue.empty())
+        {
+            const VertexId vertex = queue.top().second;
+            queue.pop();
+            if (is_priority_stale[vertex])
+            {
+                const long long priority = compute_priority(vertex);
+                if (!queue.empty() && queue.top().first < priority)
+                {
+                    queue.emplace(priority, vertex);
+                    continue;
+                }
+            }
+            shortcuts.clear();
+            for_each_shortcut(vertex, WITNESS_SETTLED_LIMIT, std::numeric_limits<size_t>::max(),
+                              [&shortcuts](const WorkEdge& in_edge, const WorkEdge& out_edge)
+                              {
+                                  shortcuts.emplace_back(in_edge, out_edge);
+                              });
+
+            // Рёбра сжимаемой вершины остаются в иерархии и удаляются из рабочего графа.
+            for (const WorkEdge& in_edge : in_edges[vertex])
+            {
+                is_kept_edge[in_edge.hierarchy_edge] = true;
+                auto& neighbor_edges = out_edges[in_edge.vertex];
+                neighbor_edges.erase(std::find_if(neighbor_edges.begin(), neighbor_edges.end(),
+                                                  [vertex](const WorkEdge& edge) {return edge.vertex == vertex;}));
+                ++contracted_neighbors[in_edge.vertex];
+                is_priority_stale[in_edge.vertex] = true;
+            }
+            for (const WorkEdge& out_edge : out_edges[vertex])
+            {
+                is_kept_edge[out_edge.hierarchy_edge] = true;
+                auto& neighbor_edges = in_edges[out_edge.vertex];
+                neighbor_edges.erase(std::find_if(neighbor_edges.begin(), neighbor_edges.end(),
+                                                  [vertex](const WorkEdge& edge) {return edge.vertex == vertex;}));
+                ++contracted_neighbors[out_edge.vertex];
+                is_priority_stale[out_edge.vertex] = true;
+            }
+            for (const auto& [in_edge, out_edge] : shortcuts)
+                add_edge(in_edge.vertex, out_edge.vertex, in_edge.weight + out_edge.weight, NO_EDGE,
+                         in_edge.hierarchy_edge, out_edge.hierarchy_edge);
+            in_edges[vertex].clear();
+            out_edges[vertex].clear();
+            vertex_ranks_[vertex] = next_rank++;
+        }
+
+        // В иерархии остаются только рёбра, которые были в рабочем графе на момент сжатия одного из их концов:
+        // рёбра, заменённые более лёгкими, для маршрутов не нужны. Составляющие сокращений всегда остаются.
+        std::vector<EdgeId> new_edge_ids(all_edges.size(), NO_EDGE);
+        hierarchy_edges_.clear();
+        for (EdgeId edge_id = 0; edge_id < all_edges.size(); ++edge_id)
+        {
+            if (!is_kept_edge[edge_id])
+                continue;
+            new_edge_ids[edge_id] = hierarchy_edges_.size();
+            HierarchyEdge edge = all_edges[edge_id];
+            if (edge.original_edge == NO_EDGE)
+            {
+                edge.first_child = new_edge_ids[edge.first_child];
+                edge.second_child = new_edge_ids[edge.second_child];
+            }
+            hierarchy_edges_.push_back(edge);
+        }
+    }
+
+    template <typename Weight>
+    Router<Weight>::Router(const Graph& graph, const Router& prev_router,
+                           const std::vector<std::optional<VertexId>>& prev_vertex_to_vertex)
+        : graph_(graph)
+        , routes_internal_data_(graph.GetVertexCount(),
+                                std::vector<std::optional<RouteInternalData>>(graph.GetVertexCount()))
+    {
+        const Graph& prev_graph = prev_router.graph_;
+        const size_t vertex_count = graph.GetVertexCount();
+        const size_t prev_vertex_count = prev_graph.GetVertexCount();
+        std::vector<std::optional<VertexId>> vertex_to_prev_vertex(vertex_count);
+        for (VertexId prev_vertex = 0; prev_vertex < prev_vertex_count; ++prev_vertex)
+            if (const auto& vertex = prev_vertex_to_vertex[prev_vertex])
+                vertex_to_prev_vertex[*vertex] = prev_vertex;
+
+        // Для маршрутов важно лишь самое лёгкое из параллельных рёбер, поэтому графы сравниваются
+        // по парам вершин. Ребро прежнего графа сохраняется, если в новом графе между теми же вершинами
+        // есть ребро не тяжелее его, и отображается в самое лёгкое из них. Самое лёгкое ребро пары
+        // вершин нового графа считается улучшенным, если в прежнем графе все рёбра этой пары были
+        // тяжелее или их не было вовсе.
+        std::vector<EdgeId> prev_edge_to_edge(prev_graph.GetEdgeCount(), NO_EDGE);
+        std::vector<EdgeId> improved_edges;
+        std::vector<EdgeId> best_edge(vertex_count, NO_EDGE), prev_best_edge(vertex_count, NO_EDGE);
+        std::vector<VertexId> touched_vertexes, prev_touched_vertexes;
+        for (VertexId vertex = 0; vertex < vertex_count; ++vertex)
+        {
+            for (const EdgeId edge_id : graph.GetIncidentEdges(vertex))
+            {
+                const auto& edge = graph.GetEdge(edge_id);
+                if (edge.weight < ZERO_WEIGHT)
+                    throw std::domain_error("Edges' weights should be non-negative");
+                EdgeId& best = best_edge[edge.to];
+                if (best == NO_EDGE)
+                    touched_vertexes.push_back(edge.to);
+                if (best == NO_EDGE || edge.weight < graph.GetEdge(best).weight)
+                    best = edge_id;
+            }
+            if (const auto& prev_vertex = vertex_to_prev_vertex[vertex])
+                for (const EdgeId prev_edge_id : prev_graph.GetIncidentEdges(*prev_vertex))
+                {
+                    const auto& prev_edge = prev_graph.GetEdge(prev_edge_id);
+                    const auto& vertex_to = prev_vertex_to_vertex[prev_edge.to];
+                    if (!vertex_to)
+                        continue;
+                    const EdgeId best = best_edge[*vertex_to];
+                    if (best != NO_EDGE && !(prev_edge.weight < graph.GetEdge(best).weight))
+                        prev_edge_to_edge[prev_edge_id] = best;
+                    EdgeId& prev_best = prev_best_edge[*vertex_to];
+                    if (prev_best == NO_EDGE)
+                        prev_touched_vertexes.push_back(*vertex_to);
+                    if (prev_best == NO_EDGE || prev_edge.weight < prev_graph.GetEdge(prev_best).weight)
+                        prev_best = prev_edge_id;
+                }
+            for (const VertexId vertex_to : touched_vertexes)
+            {
+                const EdgeId prev_best = prev_best_edge[vertex_to];
+                if (prev_best == NO_EDGE || graph.GetEdge(best_edge[vertex_to]).weight < prev_graph.GetEdge(prev_best).weight)
+                    improved_edges.push_back(best_edge[vertex_to]);
+                best_edge[vertex_to] = NO_EDGE;
+            }
+            for (const VertexId vertex_to : prev_touched_vertexes)
+                prev_best_edge[vertex_to] = NO_EDGE;
+            touched_vertexes.clear();
+            prev_touched_vertexes.clear();
+        }
+
+        // Входящие рёбра нового графа - для восстановления маршрутов, ставших недопустимыми.
+        std::vector<std::vector<EdgeId>> incoming_edges(vertex_count);
+        for (EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id)
+            incoming_edges[graph.GetEdge(edge_id).to].push_back(edge_id);
+
+        // Строки матрицы обрабатываются независимо. Строка прежней матрицы задаёт дерево кратчайших
+        // маршрутов из её вершины. Маршруты, все рёбра которых сохранились, остаются допустимыми,
+        // а маршруты, проходящие через несохранившееся ребро (вся ветвь дерева за ним), сбрасываются.
+        // Затем алгоритм Дейкстры уточняет строку, начиная с концов улучшенных рёбер и рёбер, входящих
+        // в вершины сброшенных маршрутов. Строки новых вершин рассчитываются заново.
+        enum class RouteState : uint8_t {UNKNOWN, KEPT, BROKEN};
+        std::vector<RouteState> route_states(vertex_count);
+        std::vector<VertexId> broken_vertexes, route_chain;
+        for (VertexId vertex_from = 0; vertex_from < vertex_count; ++vertex_from)
+        {
+            auto& row = routes_internal_data_[vertex_from];
+            RouteQueue queue;
+            const auto& prev_vertex_from = vertex_to_prev_vertex[vertex_from];
+            if (!prev_vertex_from)
+            {
+                row[vertex_from] = RouteInternalData{ZERO_WEIGHT, std::nullopt};
+                queue.emplace(ZERO_WEIGHT, vertex_from);
+                RelaxRouteRow(vertex_from, queue);
+                continue;
+            }
+
+            std::fill(route_states.begin(), route_states.end(), RouteState::UNKNOWN);
+            const auto& prev_row = prev_router.routes_internal_data_[*prev_vertex_from];
+            for (VertexId prev_vertex_to = 0; prev_vertex_to < prev_vertex_count; ++prev_vertex_to)
+            {
+                const auto& prev_route = prev_row[prev_vertex_to];
+                const auto& vertex_to = prev_vertex_to_vertex[prev_vertex_to];
+                if (!prev_route || !vertex_to)
+                    continue;
+                if (!prev_route->prev_edge)
+                {
+                    row[*vertex_to] = RouteInternalData{prev_route->weight, std::nullopt};
+                    route_states[*vertex_to] = RouteState::KEPT;
+                }
+                else if (const EdgeId edge_id = prev_edge_to_edge[*prev_route->prev_edge]; edge_id != NO_EDGE)
+                    row[*vertex_to] = RouteInternalData{prev_route->weight, edge_id};
+                else
+                    route_states[*vertex_to] = RouteState::BROKEN;
+            }
+
+            // Маршрут допустим, если допустим маршрут до начала его последнего ребра. Состояния
+            // определяются проходом по цепочке последних рёбер до вершины с уже известным состоянием.
+            broken_vertexes.clear();
+            for (VertexId vertex_to = 0; vertex_to < vertex_count; ++vertex_to)
+            {
+                if (route_states[vertex_to] == RouteState::UNKNOWN && row[vertex_to])
+                {
+                    route_chain.clear();
+                    VertexId vertex = vertex_to;
+                    while (route_states[vertex] == RouteState::UNKNOWN && row[vertex] && route_chain.size() <= vertex_count)
+                    {
+                        route_chain.push_back(vertex);
+                        vertex = graph.GetEdge(*row[vertex]->prev_edge).from;
+                    }
+                    const RouteState chain_state = route_states[vertex] == RouteState::KEPT && route_chain.size() <= vertex_count
+                                                   ? RouteState::KEPT : RouteState::BROKEN;
+                    for (const VertexId chain_vertex : route_chain)
+                        route_states[chain_vertex] = chain_state;
+                }
+                if (route_states[vertex_to] == RouteState::BROKEN)
+                {
+                    row[vertex_to].reset();
+                    broken_vertexes.push_back(vertex_to);
+                }
+            }
+
+            auto relax_edge = [&graph, &row, &queue](EdgeId edge_id)
+            {
+                const auto& edge = graph.GetEdge(edge_id);
+                const auto& route_from = row[edge.from];
+                if (!route_from)
+                    return;
+                const Weight candidate_weight = route_from->weight + edge.weight;
+                auto& route_to = row[edge.to];
+                if (!route_to || candidate_weight < route_to->weight)
+                {
+                    route_to = RouteInternalData{candidate_weight, edge_id};
+                    queue.emplace(candidate_weight, edge.to);
+                }
+            };
+            for (const VertexId vertex_to : broken_vertexes)
+                for (const EdgeId edge_id : incoming_edges[vertex_to])
+                    relax_edge(edge_id);
+            for (const EdgeId edge_id : improved_edges)
+                relax_edge(edge_id);
+            RelaxRouteRow(vertex_from, queue);
+        }
+        InitializeSearchData();
+    }
+
+    template <typename Weight>
+    std::optional<typename Router<Weight>::RouteInfo> Router<Weight>::BuildRoute(VertexId from, VertexId to,
+                                                                                 SearchStats* search_stats) const
+    {
+        SearchStats local_stats;
+        SearchStats& stats = search_stats ? *search_stats : local_stats;
+        stats = SearchStats{};
+        switch (route_search_)
+        {
+        case RouteSearch::ROUTES_MATRIX:
+            return BuildMatrixRoute(from, to);
+        case RouteSearch::BIDIRECTIONAL:
+            return SearchRouteBidirectional(from, to, stats);
+        case RouteSearch::CONTRACTION_HIERARCHY:
+            return SearchRouteHierarchy(from, to, stats);
+        case RouteSearch::HUB_LABELS:
+            return BuildLabelRoute(from, to);
+        default:
+            return SearchRoute(from, to, stats);
+        }
     }
 
     template <typename Weight>
-    std::optional<typename Router<Weight>::RouteInfo> Router<Weight>::BuildRoute(VertexId from,
-                                                                                 VertexId to) const
+    std::optional<typename Router<Weight>::RouteInfo> Router<Weight>::BuildMatrixRoute(VertexId from,
+                                                                                       VertexId to) const
     {
         const auto& route_internal_data = routes_internal_data_.at(from).at(to);
         if (!route_internal_data)
@@ -125,4 +912,584 @@ namespace graph
         return RouteInfo{weight, std::move(edges)};
     }
 
+    template <typename Weight>
+    std::optional<typename Router<Weight>::RouteInfo> Router<Weight>::SearchRoute(VertexId from, VertexId to,
+                                                                                  SearchStats& search_stats) const
+    {
+        // Алгоритм Дейкстры, останавливающийся, как только найден окончательный маршрут до вершины to.
+        // Для ASTAR вершины извлекаются из очереди в порядке суммы веса маршрута и нижней оценки
+        // остатка пути, что при согласованной оценке сохраняет правильность алгоритма.
+        const size_t vertex_count = graph_.GetVertexCount();
+        if (from >= vertex_count || to >= vertex_count)
+            throw std::out_of_range("Invalid route vertex");
+        const bool use_bound = route_search_ == RouteSearch::ASTAR && lower_bound_;
+        thread_local SearchSide side;
+        side.Prepare(vertex_count);
+        side.Reach(from, ZERO_WEIGHT, NO_EDGE, use_bound ? lower_bound_(from, to) : ZERO_WEIGHT);
+        while (!side.queue.empty())
+        {
+            const VertexId vertex = side.queue.top().second;
+            side.queue.pop();
+            if (side.settled[vertex])
+                continue;
+            side.settled[vertex] = true;
+            ++search_stats.settled_vertexes;
+            if (vertex == to)
+                break;
+            const Weight weight = side.weights[vertex];
+            for (const EdgeId edge_id : graph_.GetIncidentEdges(vertex))
+            {
+                const auto& edge = graph_.GetEdge(edge_id);
+                const Weight candidate_weight = weight + edge.weight;
+                if (!side.settled[edge.to] && candidate_weight < side.weights[edge.to])
+                    side.Reach(edge.to, candidate_weight, edge_id,
+                               use_bound ? candidate_weight + lower_bound_(edge.to, to) : candidate_weight);
+            }
+        }
+
+        std::optional<RouteInfo> result;
+        if (side.settled[to])
+        {
+            result = RouteInfo{side.weights[to], {}};
+            for (VertexId vertex = to; side.route_edges[vertex] != NO_EDGE; vertex = graph_.GetEdge(side.route_edges[vertex]).from)
+                result->edges.push_back(side.route_edges[vertex]);
+            std::reverse(result->edges.begin(), result->edges.end());
+        }
+        side.Reset();
+        return result;
+    }
+
+    template <typename Weight>
+    std::optional<typename Router<Weight>::RouteInfo> Router<Weight>::SearchRouteBidirectional(VertexId from, VertexId to,
+                                                                                               SearchStats& search_stats) const
+    {
+        // Прямой поиск идёт от from по исходящим рёбрам, обратный - от to по входящим. На каждом шаге
+        // продвигается поиск с меньшим весом в голове очереди. Каждое ребро, ведущее в вершину, уже
+        // достигнутую встречным поиском, даёт маршрут-кандидат через эту вершину. Поиск завершается, когда
+        // сумма весов в головах обеих очередей не меньше веса лучшего кандидата - более лёгкого маршрута
+        // уже не найти.
+        const size_t vertex_count = graph_.GetVertexCount();
+        if (from >= vertex_count || to >= vertex_count)
+            throw std::out_of_range("Invalid route vertex");
+        thread_local SearchSide forward, backward;
+        forward.Prepare(vertex_count);
+        backward.Prepare(vertex_count);
+        forward.Reach(from, ZERO_WEIGHT, NO_EDGE, ZERO_WEIGHT);
+        backward.Reach(to, ZERO_WEIGHT, NO_EDGE, ZERO_WEIGHT);
+        Weight best_weight = from == to ? ZERO_WEIGHT : MAX_WEIGHT;
+        VertexId meeting_vertex = from;
+
+        while (!forward.queue.empty() && !backward.queue.empty() &&
+               forward.queue.top().first + backward.queue.top().first < best_weight)
+        {
+            const bool is_forward = !(backward.queue.top().first < forward.queue.top().first);
+            SearchSide& side = is_forward ? forward : backward;
+            const SearchSide& other_side = is_forward ? backward : forward;
+            const VertexId vertex = side.queue.top().second;
+            side.queue.pop();
+            if (side.settled[vertex])
+                continue;
+            side.settled[vertex] = true;
+            ++search_stats.settled_vertexes;
+            const Weight weight = side.weights[vertex];
+            auto relax_edge = [&](EdgeId edge_id, VertexId vertex_to)
+            {
+                const Weight candidate_weight = weight + graph_.GetEdge(edge_id).weight;
+                if (side.settled[vertex_to] || !(candidate_weight < side.weights[vertex_to]))
+                    return;
+                side.Reach(vertex_to, candidate_weight, edge_id, candidate_weight);
+                if (other_side.weights[vertex_to] != MAX_WEIGHT &&
+                    candidate_weight + other_side.weights[vertex_to] < best_weight)
+                {
+                    best_weight = candidate_weight + other_side.weights[vertex_to];
+                    meeting_vertex = vertex_to;
+                }
+            };
+            if (is_forward)
+                for (const EdgeId edge_id : graph_.GetIncidentEdges(vertex))
+                    relax_edge(edge_id, graph_.GetEdge(edge_id).to);
+            else
+                for (const EdgeId edge_id : incoming_edges_[vertex])
+                    relax_edge(edge_id, graph_.GetEdge(edge_id).from);
+        }
+
+        std::optional<RouteInfo> result;
+        if (best_weight != MAX_WEIGHT)
+        {
+            result = RouteInfo{best_weight, {}};
+            for (VertexId vertex = meeting_vertex; forward.route_edges[vertex] != NO_EDGE;
+                 vertex = graph_.GetEdge(forward.route_edges[vertex]).from)
+                result->edges.push_back(forward.route_edges[vertex]);
+            std::reverse(result->edges.begin(), result->edges.end());
+            for (VertexId vertex = meeting_vertex; backward.route_edges[vertex] != NO_EDGE;
+                 vertex = graph_.GetEdge(backward.route_edges[vertex]).to)
+                result->edges.push_back(backward.route_edges[vertex]);
+        }
+        forward.Reset();
+        backward.Reset();
+        return result;
+    }
+
+    template <typename Weight>
+    std::optional<typename Router<Weight>::RouteInfo> Router<Weight>::SearchRouteHierarchy(VertexId from, VertexId to,
+                                                                                           SearchStats& search_stats) const
+    {
+        // Прямой поиск идёт от from, а обратный - от to по рёбрам, ведущим только к вершинам большего ранга.
+        // Кратчайший маршрут проходит через вершину наибольшего ранга, до которой доходят оба поиска, поэтому
+        // каждый из них продолжается, пока вес в голове его очереди меньше веса лучшего маршрута-кандидата.
+        const size_t vertex_count = graph_.GetVertexCount();
+        if (from >= vertex_count || to >= vertex_count)
+            throw std::out_of_range("Invalid route vertex");
+        thread_local SearchSide forward, backward;
+        forward.Prepare(vertex_count);
+        backward.Prepare(vertex_count);
+        forward.Reach(from, ZERO_WEIGHT, NO_EDGE, ZERO_WEIGHT);
+        backward.Reach(to, ZERO_WEIGHT, NO_EDGE, ZERO_WEIGHT);
+        Weight best_weight = from == to ? ZERO_WEIGHT : MAX_WEIGHT;
+        VertexId meeting_vertex = from;
+
+        auto is_active = [&best_weight](const SearchSide& side)
+        {
+            return !side.queue.empty() && side.queue.top().first < best_weight;
+        };
+        while (is_active(forward) || is_active(backward))
+        {
+            const bool is_forward = !is_active(backward) ||
+                                    (is_active(forward) && !(backward.queue.top().first < forward.queue.top().first));
+            SearchSide& side = is_forward ? forward : backward;
+            const SearchSide& other_side = is_forward ? backward : forward;
+            const VertexId vertex = side.queue.top().second;
+            side.queue.pop();
+            if (side.settled[vertex])
+                continue;
+            side.settled[vertex] = true;
+            ++search_stats.settled_vertexes;
+            const Weight weight = side.weights[vertex];
+            // Остановка по требованию: если до вершины есть более короткий путь через вершину большего ранга,
+            // идущий против направления поиска, то кратчайший маршрут через неё не проходит и продолжать поиск
+            // из неё не нужно.
+            const bool is_stalled = std::any_of(
+                (is_forward ? downward_edges_[vertex] : upward_edges_[vertex]).begin(),
+                (is_forward ? downward_edges_[vertex] : upward_edges_[vertex]).end(),
+                [&](EdgeId edge_id)
+                {
+                    const HierarchyEdge& edge = hierarchy_edges_[edge_id];
+                    const Weight neighbor_weight = side.weights[is_forward ? edge.from : edge.to];
+                    return neighbor_weight != MAX_WEIGHT && neighbor_weight + edge.weight < weight;
+                });
+            if (is_stalled)
+                continue;
+            for (const EdgeId edge_id : is_forward ? upward_edges_[vertex] : downward_edges_[vertex])
+            {
+                const HierarchyEdge& edge = hierarchy_edges_[edge_id];
+                const VertexId vertex_to = is_forward ? edge.to : edge.from;
+                const Weight candidate_weight = weight + edge.weight;
+                if (side.settled[vertex_to] || !(candidate_weight < side.weights[vertex_to]))
+                    continue;
+                side.Reach(vertex_to, candidate_weight, edge_id, candidate_weight);
+                if (other_side.weights[vertex_to] != MAX_WEIGHT &&
+                    candidate_weight + other_side.weights[vertex_to] < best_weight)
+                {
+                    best_weight = candidate_weight + other_side.weights[vertex_to];
+                    meeting_vertex = vertex_to;
+                }
+            }
+        }
+
+        std::optional<RouteInfo> result;
+        if (best_weight != MAX_WEIGHT)
+        {
+            std::vector<EdgeId> route_hierarchy_edges;
+            for (VertexId vertex = meeting_vertex; forward.route_edges[vertex] != NO_EDGE;
+                 vertex = hierarchy_edges_[forward.route_edges[vertex]].from)
+                route_hierarchy_edges.push_back(forward.route_edges[vertex]);
+            std::reverse(route_hierarchy_edges.begin(), route_hierarchy_edges.end());
+            for (VertexId vertex = meeting_vertex; backward.route_edges[vertex] != NO_EDGE;
+                 vertex = hierarchy_edges_[backward.route_edges[vertex]].to)
+                route_hierarchy_edges.push_back(backward.route_edges[vertex]);
+
+            result = RouteInfo{best_weight, {}};
+            for (const EdgeId hierarchy_edge : route_hierarchy_edges)
+                UnpackHierarchyEdge(hierarchy_edge, result->edges);
+        }
+        forward.Reset();
+        backward.Reset();
+        return result;
+    }
+
+    template <typename Weight>
+    void Router<Weight>::UnpackHierarchyEdge(EdgeId hierarchy_edge, std::vector<EdgeId>& edges) const
+    {
+        // Сокращение раскрывается в рёбра исходного графа в порядке их следования по маршруту.
+        std::vector<EdgeId> pending{hierarchy_edge};
+        while (!pending.empty())
+        {
+            const HierarchyEdge& edge = hierarchy_edges_[pending.back()];
+            pending.pop_back();
+            if (edge.original_edge != NO_EDGE)
+            {
+                edges.push_back(edge.original_edge);
+            }
+            else
+            {
+                pending.push_back(edge.second_child);
+                pending.push_back(edge.first_child);
+            }
+        }
+    }
+
+    template <typename Weight>
+    std::vector<std::optional<Weight>> Router<Weight>::BuildRouteWeights(VertexId from,
+                                                                         const std::vector<VertexId>& targets) const
+    {
+        std::vector<std::optional<Weight>> result;
+        result.reserve(targets.size());
+        switch (route_search_)
+        {
+        case RouteSearch::ROUTES_MATRIX:
+            for (const VertexId to : targets)
+                if (const auto& route_internal_data = routes_internal_data_.at(from).at(to))
+                    result.push_back(route_internal_data->weight);
+                else
+                    result.push_back(std::nullopt);
+            return result;
+        case RouteSearch::HUB_LABELS:
+            for (const VertexId to : targets)
+                if (const Weight weight = FindLabelRouteWeight(from, to).first; weight != MAX_WEIGHT)
+                    result.push_back(weight);
+                else
+                    result.push_back(std::nullopt);
+            return result;
+        default:
+            return SearchRouteWeights(from, targets);
+        }
+    }
+
+    template <typename Weight>
+    std::vector<std::optional<typename Router<Weight>::RouteInfo>> Router<Weight>::BuildRoutes(
+        VertexId from, const std::vector<VertexId>& targets) const
+    {
+        if (route_search_ == RouteSearch::DIJKSTRA || route_search_ == RouteSearch::BIDIRECTIONAL ||
+            route_search_ == RouteSearch::ASTAR)
+            return SearchRoutes(from, targets);
+        // Маршрутная матрица, иерархия сжатия и метки хабов и так строят каждый маршрут быстро.
+        std::vector<std::optional<RouteInfo>> result;
+        result.reserve(targets.size());
+        for (const VertexId to : targets)
+            result.push_back(BuildRoute(from, to));
+        return result;
+    }
+
+    template <typename Weight>
+    std::vector<std::pair<VertexId, Weight>> Router<Weight>::BuildReachableVertexes(VertexId from, Weight max_weight) const
+    {
+        // Поиск Дейкстры, не достигающий вершин дальше max_weight: вершины за пределами бюджета
+        // даже не помещаются в очередь.
+        const size_t vertex_count = graph_.GetVertexCount();
+        if (from >= vertex_count)
+            throw std::out_of_range("Invalid route vertex");
+        std::vector<std::pair<VertexId, Weight>> result;
+        if (max_weight < ZERO_WEIGHT)
+            return result;
+        thread_local SearchSide search;
+        search.Prepare(vertex_count);
+        search.Reach(from, ZERO_WEIGHT, NO_EDGE, ZERO_WEIGHT);
+        while (!search.queue.empty())
+        {
+            const auto [weight, vertex] = search.queue.top();
+            search.queue.pop();
+            if (search.settled[vertex])
+                continue;
+            search.settled[vertex] = true;
+            result.emplace_back(vertex, weight);
+            for (const EdgeId edge_id : graph_.GetIncidentEdges(vertex))
+            {
+                const auto& edge = graph_.GetEdge(edge_id);
+                const Weight candidate_weight = weight + edge.weight;
+                if (!search.settled[edge.to] && !(max_weight < candidate_weight) &&
+                    candidate_weight < search.weights[edge.to])
+                    search.Reach(edge.to, candidate_weight, edge_id, candidate_weight);
+            }
+        }
+        search.Reset();
+        return result;
+    }
+
+    template <typename Weight>
+    std::vector<typename Router<Weight>::RouteInfo> Router<Weight>::BuildAlternativeRoutes(VertexId from, VertexId to,
+                                                                                           size_t max_alternatives,
+                                                                                           double max_stretch,
+                                                                                           const std::function<bool(const RouteInfo&)>& is_distinct) const
+    {
+        // Метод плато. Строятся дерево кратчайших маршрутов из from и дерево кратчайших маршрутов в to, оба
+        // ограниченные весом max_stretch * (вес кратчайшего маршрута). Цепочка рёбер, входящих в оба дерева
+        // (плато), задаёт маршрут-кандидат: по первому дереву до начала плато, по второму - от него до to.
+        // Такой маршрут на всём протяжении плато кратчайший, а в целом - локально оптимален. Кандидаты
+        // перебираются в порядке возрастания веса, и принимаются те, что не слишком совпадают с уже принятыми.
+        // Все кандидаты берутся из одной пары поисков.
+        std::vector<RouteInfo> result;
+        auto main_route = BuildRoute(from, to);
+        if (!main_route)
+            return result;
+        result.push_back(std::move(*main_route));
+        if (is_distinct)
+            is_distinct(result.front());
+        if (!max_alternatives || result.front().edges.empty())
+            return result;
+        const Weight max_weight = result.front().weight * max_stretch;
+
+        thread_local SearchSide forward, backward;
+        forward.Prepare(graph_.GetVertexCount());
+        backward.Prepare(graph_.GetVertexCount());
+        auto search = [this, max_weight](SearchSide& side, VertexId start, bool is_forward)
+        {
+            side.Reach(start, ZERO_WEIGHT, NO_EDGE, ZERO_WEIGHT);
+            while (!side.queue.empty())
+            {
+                const auto [weight, vertex] = side.queue.top();
+                side.queue.pop();
+                if (side.settled[vertex])
+                    continue;
+                side.settled[vertex] = true;
+                for (const EdgeId edge_id : is_forward ? graph_.GetIncidentEdges(vertex) : ranges::AsRange(incoming_edges_[vertex]))
+                {
+                    const auto& edge = graph_.GetEdge(edge_id);
+                    const VertexId vertex_to = is_forward ? edge.to : edge.from;
+                    const Weight candidate_weight = weight + edge.weight;
+                    if (!side.settled[vertex_to] && !(max_weight < candidate_weight) &&
+                        candidate_weight < side.weights[vertex_to])
+                        side.Reach(vertex_to, candidate_weight, edge_id, candidate_weight);
+                }
+            }
+        };
+        search(forward, from, true);
+        search(backward, to, false);
+
+        // Ребро входит в плато, если оно - последнее ребро кратчайшего маршрута из from в его конец
+        // и первое ребро кратчайшего маршрута из его начала в to.
+        auto is_plateau_edge = [&](EdgeId edge_id)
+        {
+            return edge_id != NO_EDGE && backward.settled[graph_.GetEdge(edge_id).from] &&
+                   backward.route_edges[graph_.GetEdge(edge_id).from] == edge_id;
+        };
+        struct Candidate
+        {
+            Weight weight;
+            VertexId plateau_start;
+        };
+        std::vector<Candidate> candidates;
+        for (const VertexId vertex : forward.reached_vertexes)
+        {
+            // Начало плато: вершина обоих деревьев, из которой выходит ребро плато, но в которую ребро плато не входит.
+            if (!forward.settled[vertex] || !backward.settled[vertex] || is_plateau_edge(forward.route_edges[vertex]))
+                continue;
+            const EdgeId next_edge = backward.route_edges[vertex];
+            const Weight weight = forward.weights[vertex] + backward.weights[vertex];
+            if ((vertex == to || (next_edge != NO_EDGE && forward.route_edges[graph_.GetEdge(next_edge).to] == next_edge)) &&
+                !(max_weight < weight))
+                candidates.push_back({weight, vertex});
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const Candidate& lhs, const Candidate& rhs)
+        {
+            return lhs.weight < rhs.weight || (!(rhs.weight < lhs.weight) && lhs.plateau_start < rhs.plateau_start);
+        });
+
+        std::vector<EdgeId> accepted_edges(result.front().edges); // Рёбра принятых маршрутов, упорядоченные
+        std::sort(accepted_edges.begin(), accepted_edges.end());
+        std::vector<VertexId> route_vertexes;
+        for (const Candidate& candidate : candidates)
+        {
+            if (result.size() > max_alternatives)
+                break;
+            RouteInfo route{candidate.weight, {}};
+            for (VertexId vertex = candidate.plateau_start; forward.route_edges[vertex] != NO_EDGE;
+                 vertex = graph_.GetEdge(forward.route_edges[vertex]).from)
+                route.edges.push_back(forward.route_edges[vertex]);
+            std::reverse(route.edges.begin(), route.edges.end());
+            for (VertexId vertex = candidate.plateau_start; backward.route_edges[vertex] != NO_EDGE;
+                 vertex = graph_.GetEdge(backward.route_edges[vertex]).to)
+                route.edges.push_back(backward.route_edges[vertex]);
+
+            // Маршрут не должен проходить дважды через одну вершину и слишком совпадать с уже принятыми.
+            route_vertexes.assign(1, from);
+            Weight overlap_weight = ZERO_WEIGHT;
+            for (const EdgeId edge_id : route.edges)
+            {
+                route_vertexes.push_back(graph_.GetEdge(edge_id).to);
+                if (std::binary_search(accepted_edges.begin(), accepted_edges.end(), edge_id))
+                    overlap_weight += graph_.GetEdge(edge_id).weight;
+            }
+            std::sort(route_vertexes.begin(), route_vertexes.end());
+            if (std::adjacent_find(route_vertexes.begin(), route_vertexes.end()) != route_vertexes.end() ||
+                MAX_ALTERNATIVE_OVERLAP * route.weight < overlap_weight || (is_distinct && !is_distinct(route)))
+                continue;
+            accepted_edges.insert(accepted_edges.end(), route.edges.begin(), route.edges.end());
+            std::sort(accepted_edges.begin(), accepted_edges.end());
+            result.push_back(std::move(route));
+        }
+        forward.Reset();
+        backward.Reset();
+        return result;
+    }
+
+    template <typename Weight>
+    std::vector<std::optional<Weight>> Router<Weight>::SearchRouteWeights(VertexId from,
+                                                                          const std::vector<VertexId>& targets) const
+    {
+        thread_local SearchSide search;
+        SearchTargets(from, targets, search);
+        std::vector<std::optional<Weight>> result;
+        result.reserve(targets.size());
+        for (const VertexId to : targets)
+            result.push_back(search.settled[to] ? std::optional<Weight>(search.weights[to]) : std::nullopt);
+        search.Reset();
+        return result;
+    }
+
+    template <typename Weight>
+    std::vector<std::optional<typename Router<Weight>::RouteInfo>> Router<Weight>::SearchRoutes(
+        VertexId from, const std::vector<VertexId>& targets) const
+    {
+        thread_local SearchSide search;
+        SearchTargets(from, targets, search);
+        std::vector<std::optional<RouteInfo>> result;
+        result.reserve(targets.size());
+        for (const VertexId to : targets)
+        {
+            auto& route = result.emplace_back();
+            if (!search.settled[to])
+                continue;
+            route = RouteInfo{search.weights[to], {}};
+            for (VertexId vertex = to; search.route_edges[vertex] != NO_EDGE; vertex = graph_.GetEdge(search.route_edges[vertex]).from)
+                route->edges.push_back(search.route_edges[vertex]);
+            std::reverse(route->edges.begin(), route->edges.end());
+        }
+        search.Reset();
+        return result;
+    }
+
+    template <typename Weight>
+    void Router<Weight>::SearchTargets(VertexId from, const std::vector<VertexId>& targets, SearchSide& search) const
+    {
+        // Поиск Дейкстры от from ведётся, пока окончательные маршруты найдены не до всех вершин targets.
+        // Порядок извлечения вершин из очереди тот же, что и у SearchRoute без нижней оценки, поэтому
+        // найденные маршруты совпадают с маршрутами, которые он строит для каждой из вершин targets.
+        const size_t vertex_count = graph_.GetVertexCount();
+        if (from >= vertex_count)
+            throw std::out_of_range("Invalid route vertex");
+        thread_local std::vector<bool> is_target;
+        search.Prepare(vertex_count);
+        if (is_target.size() < vertex_count)
+            is_target.resize(vertex_count, false);
+        size_t remaining_targets = 0;
+        for (const VertexId to : targets)
+        {
+            if (to >= vertex_count)
+                throw std::out_of_range("Invalid route vertex");
+            if (!is_target[to])
+            {
+                is_target[to] = true;
+                ++remaining_targets;
+            }
+        }
+
+        search.Reach(from, ZERO_WEIGHT, NO_EDGE, ZERO_WEIGHT);
+        while (!search.queue.empty() && remaining_targets)
+        {
+            const auto [weight, vertex] = search.queue.top();
+            search.queue.pop();
+            if (search.settled[vertex])
+                continue;
+            search.settled[vertex] = true;
+            if (is_target[vertex])
+                --remaining_targets;
+            for (const EdgeId edge_id : graph_.GetIncidentEdges(vertex))
+            {
+                const auto& edge = graph_.GetEdge(edge_id);
+                const Weight candidate_weight = weight + edge.weight;
+                if (!search.settled[edge.to] && candidate_weight < search.weights[edge.to])
+                    search.Reach(edge.to, candidate_weight, edge_id, candidate_weight);
+            }
+        }
+        for (const VertexId to : targets)
+            is_target[to] = false;
+    }
+
+    template <typename Weight>
+    std::optional<typename Router<Weight>::RouteInfo> Router<Weight>::BuildLabelRoute(VertexId from, VertexId to) const
+    {
+        const auto [best_weight, best_hub] = FindLabelRouteWeight(from, to);
+        if (best_weight == MAX_WEIGHT)
+            return std::nullopt;
+
+        // Маршрут до хаба восстанавливается по исходящим меткам от начальной вершины, от хаба - по входящим
+        // меткам от конечной вершины в обратном порядке.
+        RouteInfo result{best_weight, {}};
+        for (VertexId vertex = from; ;)
+        {
+            const EdgeId edge_id = FindHubLabel(out_labels_[vertex], best_hub).edge;
+            if (edge_id == NO_EDGE)
+                break;
+            result.edges.push_back(edge_id);
+            vertex = graph_.GetEdge(edge_id).to;
+        }
+        const size_t to_hub_edge_count = result.edges.size();
+        for (VertexId vertex = to; ;)
+        {
+            const EdgeId edge_id = FindHubLabel(in_labels_[vertex], best_hub).edge;
+            if (edge_id == NO_EDGE)
+                break;
+            result.edges.push_back(edge_id);
+            vertex = graph_.GetEdge(edge_id).from;
+        }
+        std::reverse(result.edges.begin() + to_hub_edge_count, result.edges.end());
+        return result;
+    }
+
+    template <typename Weight>
+    std::pair<Weight, uint32_t> Router<Weight>::FindLabelRouteWeight(VertexId from, VertexId to) const
+    {
+        // Возвращает вес маршрута (MAX_WEIGHT - маршрута нет) и хаб, через который он проходит.
+        if (from >= out_labels_.size() || to >= in_labels_.size())
+            throw std::out_of_range("Invalid route vertex");
+        // Слияние упорядоченных исходящих меток начальной вершины и входящих меток конечной.
+        const std::vector<HubLabel>& from_labels = out_labels_[from];
+        const std::vector<HubLabel>& to_labels = in_labels_[to];
+        Weight best_weight = MAX_WEIGHT;
+        uint32_t best_hub = 0;
+        for (auto from_it = from_labels.begin(), to_it = to_labels.begin();
+             from_it != from_labels.end() && to_it != to_labels.end();)
+        {
+            if (from_it->hub < to_it->hub)
+            {
+                ++from_it;
+            }
+            else if (to_it->hub < from_it->hub)
+            {
+                ++to_it;
+            }
+            else
+            {
+                if (from_it->weight + to_it->weight < best_weight)
+                {
+                    best_weight = from_it->weight + to_it->weight;
+                    best_hub = from_it->hub;
+                }
+                ++from_it;
+                ++to_it;
+            }
+        }
+        return {best_weight, best_hub};
+    }
+
+    template <typename Weight>
+    const typename Router<Weight>::HubLabel& Router<Weight>::FindHubLabel(const std::vector<HubLabel>& labels, uint32_t hub)
+    {
+        auto label_it = std::lower_bound(labels.begin(), labels.end(), hub,
+                                         [](const HubLabel& label, uint32_t hub) {return label.hub < hub;});
+        if (label_it == labels.end() || label_it->hub != hub)
+            throw std::logic_error("Inconsistent hub labels");
+        return *label_it;
+    }
+
 }  // namespace graph
@@ -4,6 +4,10 @@
 #include <vector>
 #include <map>
 #include <variant>
+#include <stdexcept>
+#include <tuple>
+#include <cmath>
+#include <algorithm>
 
 #include "svg.h"
 #include "json.h"
@@ -17,6 +21,8 @@
 #include "map_renderer.pb.h"
 #include "transport_catalogue.pb.h"
 #include "serialization.h"
+#include "compression.h"
+#include "stats.h"
 
 using namespace std;
 using namespace transport;
@@ -26,7 +32,15 @@ namespace serial
     Serializer::Serializer(transport::reader::JSONReader& jsr) : jsr_(jsr)
     {}
 
-    svg::Color Serializer::ConvertColorRev(TransCatSerial::Color& pb_color)
+    google::protobuf::ArenaOptions Serializer::MakeArenaOptions()
+    {
+        google::protobuf::ArenaOptions options;
+        options.start_block_size = ARENA_START_BLOCK_SIZE;
+        options.max_block_size = ARENA_MAX_BLOCK_SIZE;
+        return options;
+    }
+
+    svg::Color Serializer::ConvertColorRev(const TransCatSerial::Color& pb_color)
     {
         switch (pb_color.encoding_type())
         {
@@ -46,8 +60,8 @@ namespace serial
     // Перечень информационных элементов, подлежащих упоследованию/распоследованию для полного
     // сохранения/восстановления состояния системы, полученного после обработки запросов первой
     // стадии (запросов типа make_base).
-    // 1. список (множество) остановок transport::TransportCatalogue::stops_ (jsr_._tc_.stops_).
-    // 2. список (множество) автобусных маршрутов transport::TransportCatalogue::buses_ (jsr_.tc_.buses_).
+    // 1. список остановок transport::TransportCatalogue::stops_ (jsr_._tc_.stops_) вместе с таблицей расстояний.
+    // 2. список автобусных маршрутов transport::TransportCatalogue::buses_ (jsr_.tc_.buses_).
     //----------------------------------------------------------------------------------------------------
     // Группу переменных, хронящих служебный контекст для поддержки исполнения запросов второй стадии:
     // 3. Параметры маршрутизации router::RouterContext::router_context_ (jsr_.router_context_ ).
@@ -61,7 +75,7 @@ namespace serial
     // отправления - router::BusRouter::stop_name_to_enter_vertex_ (jsr_.bus_router_ptr_->stop_name_to_enter_vertex_)
     // 6. Словарь-преобразователь имён остановок в номера вершин графа, соответствующие их перронам
     // прибытия - router::BusRouter::stop_name_to_exit_vertex_ (jsr_.bus_router_ptr_->stop_name_to_exit_vertex_)
-    // 7. Словарь-преобразователь номеров рёбер в их структуры-описатели типа router::BusRouter::EdgeDescriptor -
+    // 7. Вектор структур-описателей рёбер типа router::BusRouter::EdgeDescriptor, индексированный номерами рёбер -
     // - (jsr_.bus_router_ptr_->edge_to_desc_)
     // 8. Список (вектор) рёбер графа, каждому ребру соответствует описатель ребра типа graph::Edge - 
     // - (jsr_.bus_router_ptr_->router_.graph_.edges_)
@@ -73,12 +87,10 @@ namespace serial
     // любой другой вершине. Матрица хранится как вектор векторов, размер этих векторов равен количеству вершин графа, на пересечении
     // (в элементах второго вектора) хранится элемент типа RouteInternalData (jsr_.bus_router_ptr_->router_.routes_internal_data_)
 
-    TransCatSerial::MapRendererContext Serializer::SerializeRenderContext()
+    void Serializer::SerializeRenderContext(TransCatSerial::MapRendererContext& pb_render_context)
     {
         // Функция заполняет структуру типа TransCatSerial::MapRendererContext, служащую
         // для упоследования контекста, применяемого для построения карт программой - jsr_.render_context_.
-        TransCatSerial::MapRendererContext pb_render_context;
-        pb_render_context.set_width(jsr_.render_context_.width);
         pb_render_context.set_width(jsr_.render_context_.width);
         pb_render_context.set_height(jsr_.render_context_.height);
         pb_render_context.set_padding(jsr_.render_context_.padding);
@@ -87,31 +99,25 @@ namespace serial
         pb_render_context.set_bus_label_font_size(jsr_.render_context_.bus_label_font_size);
         pb_render_context.set_stop_label_font_size(jsr_.render_context_.stop_label_font_size);
         pb_render_context.set_underlayer_width(jsr_.render_context_.underlayer_width);
-        TransCatSerial::Point pb_point;
-        pb_point.set_x(jsr_.render_context_.bus_label_offset.x);
-        pb_point.set_y(jsr_.render_context_.bus_label_offset.y);
-        *pb_render_context.mutable_bus_label_offset() = pb_point;
-        pb_point.set_x(jsr_.render_context_.stop_label_offset.x);
-        pb_point.set_y(jsr_.render_context_.stop_label_offset.y);
-        *pb_render_context.mutable_stop_label_offset() = pb_point;
-        TransCatSerial::Color pb_color(visit(ColorConvertClass{}, jsr_.render_context_.underlayer_color));
-        *pb_render_context.mutable_underlayer_color() = pb_color;
+        TransCatSerial::Point* pb_point = pb_render_context.mutable_bus_label_offset();
+        pb_point->set_x(jsr_.render_context_.bus_label_offset.x);
+        pb_point->set_y(jsr_.render_context_.bus_label_offset.y);
+        pb_point = pb_render_context.mutable_stop_label_offset();
+        pb_point->set_x(jsr_.render_context_.stop_label_offset.x);
+        pb_point->set_y(jsr_.render_context_.stop_label_offset.y);
+        visit(ColorConvertClass{*pb_render_context.mutable_underlayer_color()}, jsr_.render_context_.underlayer_color);
         for (const svg::Color& col : jsr_.render_context_.color_palette)
-        {
-            pb_color = visit(ColorConvertClass{}, col);
-            *pb_render_context.add_color_palette() = pb_color;
-        }
-        return pb_render_context;
+            visit(ColorConvertClass{*pb_render_context.add_color_palette()}, col);
     }
 
-    TransCatSerial::RouterContext Serializer::SerializeRouterContext()
+    void Serializer::SerializeRouterContext(TransCatSerial::RouterContext& pb_router_context)
     { 
         // Функция заполняет структуру типа TransCatSerial::RouterContext, служащую для
         // сериализации контекста построения маршрутов - jsr_.router_context_.
-        TransCatSerial::RouterContext pb_router_context;
         pb_router_context.set_bus_velocity(jsr_.router_context_.bus_velocity);
         pb_router_context.set_bus_wait_time(jsr_.router_context_.bus_wait_time);
-        return pb_router_context;
+        pb_router_context.set_route_search(
+            static_cast<TransCatSerial::RouterContext::RouteSearch>(jsr_.router_context_.route_search));
     }
 
     void Serializer::SerializeStopsBusesPrepare(Serializer::NameConvertSet& cnv)
@@ -139,130 +145,135 @@ namespace serial
         }
     }
 
-    TransCatSerial::StopList Serializer::SerializeStops(Serializer::NameConvertSet& cnv)
+    void Serializer::SerializeStops(TransCatSerial::StopList& pb_stop_list, Serializer::NameConvertSet& cnv)
     {
-        TransCatSerial::StopList pb_stop_list;
         // Сначала займёмся заполнением первого массива упоследующей структуры TransCatSerial::StopBusList - stops.
+        pb_stop_list.mutable_stops()->Reserve(static_cast<int>(cnv.stop_name_to_pb_number_.size()));
         for (auto stop_it = jsr_.trans_cat_.stop_begin(); stop_it != jsr_.trans_cat_.stop_end(); ++stop_it)
         {
             StopDescriptor stopd = *stop_it;
-            TransCatSerial::Stop pb_stop;
+            // Описатель остановки создаётся прямо в массиве pb_stop_list.stops
+            TransCatSerial::Stop& pb_stop = *pb_stop_list.add_stops();
             pb_stop.set_stop_type(static_cast<TransCatSerial::Stop_StopType>(static_cast<int>(stopd.stop_type)));
             pb_stop.set_stop_name(stopd.stop_name);
             // Заполним поле pb_stop.stop_coords
-            TransCatSerial::Coordinates pb_stop_coords;
+            TransCatSerial::Coordinates& pb_stop_coords = *pb_stop.mutable_stop_coords();
             pb_stop_coords.set_lat(stopd.stop_coords.lat);
             pb_stop_coords.set_lng(stopd.stop_coords.lng);
-            *pb_stop.mutable_stop_coords() = pb_stop_coords;
             // Заполняем массив pb_stop.buses_at_stop
             for (const string& bus_name : stopd.buses_at_stop)
                 pb_stop.add_buses_at_stop(cnv.bus_name_to_pb_number_[bus_name]);
             // Наконец, заполним массив pb_stop.distance_to_stop
-            TransCatSerial::DistanceToStop pb_distance_to_stop;
-            for (auto distance_to_stop_pair : stopd.distance_to_stop)
+            for (const auto& distance_to_stop_pair : stopd.distance_to_stop)
             {
+                TransCatSerial::DistanceToStop& pb_distance_to_stop = *pb_stop.add_distance_to_stop();
                 pb_distance_to_stop.set_stop_num(cnv.stop_name_to_pb_number_[distance_to_stop_pair.first]);
                 pb_distance_to_stop.set_distance(distance_to_stop_pair.second);
-                *pb_stop.add_distance_to_stop() = pb_distance_to_stop;
             }
-            // Окончательно, добавляем сформированный описатель остановки к массиву pb_transport_cataloque.stops
-            *pb_stop_list.add_stops() = pb_stop;
+            if (stopd.wait_time)
+                pb_stop.set_wait_time(*stopd.wait_time);
         }
-        return pb_stop_list;
     }
 
-    TransCatSerial::BusList Serializer::SerializeBuses(Serializer::NameConvertSet& cnv)
+    void Serializer::SerializeBuses(TransCatSerial::BusList& pb_bus_list, Serializer::NameConvertSet& cnv)
     {
-        TransCatSerial::BusList pb_bus_list;
         // Здесь займёмся заполнением второго массива упоследующей структуры TransCatSerial::StopBusList - buses.
+        pb_bus_list.mutable_buses()->Reserve(static_cast<int>(cnv.bus_name_to_pb_number_.size()));
         for (BusDescriptor busd : jsr_.trans_cat_)
         {
-            TransCatSerial::Bus pb_bus;
+            // Описатель маршрута создаётся прямо в массиве pb_bus_list.buses
+            TransCatSerial::Bus& pb_bus = *pb_bus_list.add_buses();
             pb_bus.set_bus_type(static_cast<TransCatSerial::Bus_BusType>(static_cast<int>(busd.bus_type)));
             pb_bus.set_bus_name(busd.bus_name);
             // Заполняем массив pb_bus.bus_stops
+            pb_bus.mutable_bus_stops()->Reserve(static_cast<int>(busd.bus_stops.size()));
             for (const string& stop_name : busd.bus_stops)
                 pb_bus.add_bus_stops(cnv.stop_name_to_pb_number_[stop_name]);
-            // Окончательно, добавляем сформированный описатель маршрута к массиву pb_transport_cataloque.buses
-            *pb_bus_list.add_buses() = pb_bus;
+            pb_bus.mutable_departures()->Add(busd.departures.begin(), busd.departures.end());
+            if (busd.velocity)
+                pb_bus.set_velocity(*busd.velocity);
         }
-        return pb_bus_list;
     }
 
-    TransCatSerial::StopNameToVertexList Serializer::SerializeStopNameToVertex(bool EnterOrExitList, Serializer::NameConvertSet& cnv)
+    void Serializer::SerializeStopNameToVertex(TransCatSerial::StopNameToVertexList& pb_stop_name_to_vertex_list,
+                                               bool EnterOrExitList, Serializer::NameConvertSet& cnv)
     {
-        TransCatSerial::StopNameToVertexList pb_stop_name_to_vertex_list;
-        router::BusRouter::StopToVertexT *stop_name_to_vertex_ptr =
+        const router::BusRouter::StopToVertexT& stop_name_to_vertex =
             EnterOrExitList ?
-            &jsr_.bus_router_ptr_->stop_name_to_enter_vertex_ :
-            &jsr_.bus_router_ptr_->stop_name_to_exit_vertex_;
-        for (auto& stop_to_vertex_pair : *stop_name_to_vertex_ptr)
+            jsr_.bus_router_ptr_->stop_name_to_enter_vertex_ :
+            jsr_.bus_router_ptr_->stop_name_to_exit_vertex_;
+        pb_stop_name_to_vertex_list.mutable_stop_name_to_vertex()->Reserve(static_cast<int>(stop_name_to_vertex.size()));
+        for (const auto& stop_to_vertex_pair : stop_name_to_vertex)
         {
-            TransCatSerial::StopNameToVertex pb_stop_name_to_vertex;
+            TransCatSerial::StopNameToVertex& pb_stop_name_to_vertex = *pb_stop_name_to_vertex_list.add_stop_name_to_vertex();
             pb_stop_name_to_vertex.set_stop_name_num(cnv.stop_name_to_pb_number_[stop_to_vertex_pair.first]);
             pb_stop_name_to_vertex.set_vertex_id(stop_to_vertex_pair.second);
-            *pb_stop_name_to_vertex_list.add_stop_name_to_vertex() = pb_stop_name_to_vertex;
         }
-        return pb_stop_name_to_vertex_list;
     }
 
-    TransCatSerial::EdgeToDescList Serializer::SerializeEdgeToDesc(NameConvertSet& cnv)
+    void Serializer::SerializeEdgeToDesc(TransCatSerial::EdgeToDescList& pb_edge_to_desc_list, NameConvertSet& cnv)
     {
-        TransCatSerial::EdgeToDescList pb_edge_to_desc_list;
-        for (auto& edge_to_desc_pair : jsr_.bus_router_ptr_->edge_to_desc_)
+        // Номера остановок и маршрутов справочника переводятся в их порядковые номера в сериализованном
+        // виде через имена. Время прохождения ребра записывается из веса соответствующего ребра графа.
+        const TransportCatalogue& tc = jsr_.trans_cat_;
+        const auto& edge_to_desc = jsr_.bus_router_ptr_->edge_to_desc_;
+        pb_edge_to_desc_list.mutable_edge_to_desc()->Reserve(static_cast<int>(edge_to_desc.size()));
+        for (size_t edge_id = 0; edge_id < edge_to_desc.size(); ++edge_id)
         {
-            TransCatSerial::EdgeToDesc pb_edge_to_desc;
-            pb_edge_to_desc.set_edge_id(edge_to_desc_pair.first);
-            TransCatSerial::EdgeDescriptor pb_edge_desc;
+            const router::BusRouter::EdgeDescriptor& edge_desc = edge_to_desc[edge_id];
+            TransCatSerial::EdgeToDesc& pb_edge_to_desc = *pb_edge_to_desc_list.add_edge_to_desc();
+            pb_edge_to_desc.set_edge_id(edge_id);
+            TransCatSerial::EdgeDescriptor& pb_edge_desc = *pb_edge_to_desc.mutable_edge_descriptor();
             pb_edge_desc.set_edge_type(static_cast<TransCatSerial::EdgeDescriptor_EdgeType>
-                                      (static_cast<int>(edge_to_desc_pair.second.edge_type)));
-            pb_edge_desc.set_from_stop_num(cnv.stop_name_to_pb_number_[edge_to_desc_pair.second.from_stop]);
-            pb_edge_desc.set_to_stop_num(cnv.stop_name_to_pb_number_[edge_to_desc_pair.second.to_stop]);
-            pb_edge_desc.set_bus_name_num(cnv.bus_name_to_pb_number_[edge_to_desc_pair.second.bus_name]);
-            pb_edge_desc.set_span_count(edge_to_desc_pair.second.span_count);
-            pb_edge_desc.set_time_length(edge_to_desc_pair.second.time_length);
-            *pb_edge_to_desc.mutable_edge_descriptor() = pb_edge_desc;
-            *pb_edge_to_desc_list.add_edge_to_desc() = pb_edge_to_desc;
+                                      (static_cast<int>(edge_desc.edge_type)));
+            pb_edge_desc.set_from_stop_num(cnv.stop_name_to_pb_number_[tc.GetStopName(edge_desc.from_stop_id)]);
+            pb_edge_desc.set_to_stop_num(cnv.stop_name_to_pb_number_[tc.GetStopName(edge_desc.to_stop_id)]);
+            if (edge_desc.bus_id != TransportCatalogue::NO_ID)
+                pb_edge_desc.set_bus_name_num(cnv.bus_name_to_pb_number_[tc.GetBusName(edge_desc.bus_id)]);
+            pb_edge_desc.set_span_count(edge_desc.span_count);
+            pb_edge_desc.set_from_position(edge_desc.from_position);
+            pb_edge_desc.set_is_backward(edge_desc.is_backward);
+            pb_edge_desc.set_time_length(jsr_.bus_router_ptr_->catalogue_graph_.GetEdge(edge_id).weight);
         }
-        return pb_edge_to_desc_list;
     }
 
-    TransCatSerial::Edges Serializer::SerializeEdges()
+    void Serializer::SerializeEdges(TransCatSerial::Edges& pb_edges_list)
     {
-        TransCatSerial::Edges pb_edges_list;
-        for (auto& edge_def : jsr_.bus_router_ptr_->router_.graph_.edges_)
+        const auto& edges = jsr_.bus_router_ptr_->router_.graph_.edges_;
+        pb_edges_list.mutable_edges()->Reserve(static_cast<int>(edges.size()));
+        for (const auto& edge_def : edges)
         {
-            TransCatSerial::Edge pb_edge_list_elem;
+            TransCatSerial::Edge& pb_edge_list_elem = *pb_edges_list.add_edges();
             pb_edge_list_elem.set_from(edge_def.from);
             pb_edge_list_elem.set_to(edge_def.to);
             pb_edge_list_elem.set_weight(edge_def.weight);
-            *pb_edges_list.add_edges() = pb_edge_list_elem;
         }
-        return pb_edges_list;
     }
 
-    TransCatSerial::IncidenceLists Serializer::SerializeIncidenceLists()
+    void Serializer::SerializeIncidenceLists(TransCatSerial::IncidenceLists& pb_vertex_incidence_list)
     {
-        TransCatSerial::IncidenceLists pb_vertex_incidence_list;
-        for (auto& incidence_list : jsr_.bus_router_ptr_->router_.graph_.incidence_lists_)
+        const auto& incidence_lists = jsr_.bus_router_ptr_->router_.graph_.incidence_lists_;
+        pb_vertex_incidence_list.mutable_incidence_list()->Reserve(static_cast<int>(incidence_lists.size()));
+        for (const auto& incidence_list : incidence_lists)
         {
-            TransCatSerial::IncidenceList pb_incidence_list;
+            auto& pb_edge_ids = *pb_vertex_incidence_list.add_incidence_list()->mutable_edge_id();
+            pb_edge_ids.Reserve(static_cast<int>(incidence_list.size()));
             for (auto edge_id : incidence_list)
-                pb_incidence_list.add_edge_id(edge_id);
-            *pb_vertex_incidence_list.add_incidence_list() = pb_incidence_list;
+                pb_edge_ids.AddAlreadyReserved(edge_id);
         }
-        return pb_vertex_incidence_list;
     }
 
-    TransCatSerial::RoutesData Serializer::SerializeRoutesData()
+    void Serializer::SerializeRoutesData(TransCatSerial::RoutesData& pb_routes_data)
     {
-        TransCatSerial::RoutesData pb_routes_data;
-        for (auto& routes_sec_index_data : jsr_.bus_router_ptr_->router_.routes_internal_data_)
+        const auto& routes_internal_data = jsr_.bus_router_ptr_->router_.routes_internal_data_;
+        pb_routes_data.mutable_first_routes_data()->Reserve(static_cast<int>(routes_internal_data.size()));
+        for (const auto& routes_sec_index_data : routes_internal_data)
         {
-            TransCatSerial::RoutesSecIndexData pb_sec_index_routes_data;
-            for (auto& opt_route_data : routes_sec_index_data)
+            TransCatSerial::RoutesSecIndexData& pb_sec_index_routes_data = *pb_routes_data.add_first_routes_data();
+            pb_sec_index_routes_data.mutable_sec_routes_data()->Reserve(static_cast<int>(routes_sec_index_data.size()));
+            for (const auto& opt_route_data : routes_sec_index_data)
             {
-                TransCatSerial::RouteData pb_route_data;
+                TransCatSerial::RouteData& pb_route_data = *pb_sec_index_routes_data.add_sec_routes_data();
                 if (opt_route_data)
                 {
                     pb_route_data.set_has_value(true);
@@ -281,141 +292,264 @@ namespace serial
                 {
                     pb_route_data.set_has_value(false);
                 }
-                *pb_sec_index_routes_data.add_sec_routes_data() = pb_route_data;
             }
-            *pb_routes_data.add_first_routes_data() = pb_sec_index_routes_data;
         }
-        return pb_routes_data;
+    }
+
+    void Serializer::SerializePackedRoutesData(TransCatSerial::PackedRoutesData& pb_packed_routes_data)
+    {
+        // Маршрутная матрица записывается построчно в упакованные массивы: коды последних рёбер
+        // (или их разности с предыдущей строкой) - в prev_edge (prev_edge_delta), веса имеющихся
+        // маршрутов - в weight.
+        const auto& routes_internal_data = jsr_.bus_router_ptr_->router_.routes_internal_data_;
+        const size_t vertex_count = routes_internal_data.size();
+        const bool delta_encoded = jsr_.serial_context_.routes_delta_encoding;
+        pb_packed_routes_data.set_vertex_count(vertex_count);
+        pb_packed_routes_data.set_delta_encoded(delta_encoded);
+        auto& pb_prev_edge = *pb_packed_routes_data.mutable_prev_edge();
+        auto& pb_prev_edge_delta = *pb_packed_routes_data.mutable_prev_edge_delta();
+        auto& pb_weight = *pb_packed_routes_data.mutable_weight();
+        if (delta_encoded)
+            pb_prev_edge_delta.Reserve(static_cast<int>(vertex_count * vertex_count));
+        else
+            pb_prev_edge.Reserve(static_cast<int>(vertex_count * vertex_count));
+
+        vector<uint32_t> prev_row_codes(vertex_count, PACKED_NO_ROUTE);
+        for (const auto& routes_sec_index_data : routes_internal_data)
+        {
+            for (size_t to_vertex = 0; to_vertex < vertex_count; ++to_vertex)
+            {
+                const auto& opt_route_data = routes_sec_index_data[to_vertex];
+                uint32_t code = PACKED_NO_ROUTE;
+                if (opt_route_data)
+                {
+                    code = opt_route_data->prev_edge ? static_cast<uint32_t>(*opt_route_data->prev_edge) + PACKED_EDGE_BASE :
+                                                       PACKED_NO_PREV_EDGE;
+                    pb_weight.Add(opt_route_data->weight);
+                }
+                if (delta_encoded)
+                {
+                    pb_prev_edge_delta.AddAlreadyReserved(static_cast<int32_t>(code - prev_row_codes[to_vertex]));
+                    prev_row_codes[to_vertex] = code;
+                }
+                else
+                {
+                    pb_prev_edge.AddAlreadyReserved(code);
+                }
+            }
+        }
+    }
+
+    void Serializer::SerializeContractionHierarchy(TransCatSerial::ContractionHierarchy& pb_contraction_hierarchy)
+    {
+        const auto& router = jsr_.bus_router_ptr_->router_;
+        pb_contraction_hierarchy.mutable_vertex_rank()->Reserve(static_cast<int>(router.vertex_ranks_.size()));
+        for (size_t vertex_rank : router.vertex_ranks_)
+            pb_contraction_hierarchy.add_vertex_rank(static_cast<uint32_t>(vertex_rank));
+        for (const auto& edge : router.hierarchy_edges_)
+        {
+            pb_contraction_hierarchy.add_edge_from(static_cast<uint32_t>(edge.from));
+            pb_contraction_hierarchy.add_edge_to(static_cast<uint32_t>(edge.to));
+            pb_contraction_hierarchy.add_edge_weight(edge.weight);
+            if (edge.original_edge != router.NO_EDGE)
+            {
+                pb_contraction_hierarchy.add_original_edge(static_cast<uint32_t>(edge.original_edge) + HIERARCHY_EDGE_BASE);
+            }
+            else
+            {
+                pb_contraction_hierarchy.add_original_edge(HIERARCHY_SHORTCUT);
+                pb_contraction_hierarchy.add_first_child(static_cast<uint32_t>(edge.first_child));
+                pb_contraction_hierarchy.add_second_child(static_cast<uint32_t>(edge.second_child));
+            }
+        }
+    }
+
+    void Serializer::SerializeHubLabels(TransCatSerial::HubLabels& pb_hub_labels)
+    {
+        const auto& router = jsr_.bus_router_ptr_->router_;
+        for (graph::VertexId hub_vertex : router.hub_vertexes_)
+            pb_hub_labels.add_hub_vertex(static_cast<uint32_t>(hub_vertex));
+        auto serialize_labels = [&router](const auto& labels, auto& pb_label_count, auto& pb_hub_delta,
+                                          auto& pb_weight, auto& pb_edge)
+        {
+            for (const auto& vertex_labels : labels)
+            {
+                pb_label_count.Add(static_cast<uint32_t>(vertex_labels.size()));
+                uint32_t prev_hub = 0;
+                for (const auto& label : vertex_labels)
+                {
+                    pb_hub_delta.Add(label.hub - prev_hub);
+                    prev_hub = label.hub;
+                    pb_weight.Add(label.weight);
+                    pb_edge.Add(label.edge == router.NO_EDGE ? HUB_LABEL_NO_EDGE :
+                                                               static_cast<uint32_t>(label.edge) + HUB_LABEL_EDGE_BASE);
+                }
+            }
+        };
+        serialize_labels(router.in_labels_, *pb_hub_labels.mutable_in_label_count(), *pb_hub_labels.mutable_in_hub_delta(),
+                         *pb_hub_labels.mutable_in_weight(), *pb_hub_labels.mutable_in_edge());
+        serialize_labels(router.out_labels_, *pb_hub_labels.mutable_out_label_count(), *pb_hub_labels.mutable_out_hub_delta(),
+                         *pb_hub_labels.mutable_out_weight(), *pb_hub_labels.mutable_out_edge());
+    }
+
+    void Serializer::AppendSection(TransCatSerial::BaseIndex& pb_index, string& sections_data,
+                                   TransCatSerial::BaseSection::SectionType section_type,
+                                   const TransCatSerial::TransportCatalogue& pb_section)
+    {
+        // Раздел упоследуется отдельно от остальных и, если задано сжатие, упаковывается в свой
+        // собственный сжатый контейнер, чтобы его можно было прочитать и распаковать независимо.
+        string section_data;
+        pb_section.SerializeToString(&section_data);
+        const bool compressed = jsr_.serial_context_.compression != BaseCompression::NONE;
+        if (compressed)
+            section_data = compression::PackContainer(section_data);
+        TransCatSerial::BaseSection& pb_section_entry = *pb_index.add_sections();
+        pb_section_entry.set_type(section_type);
+        pb_section_entry.set_offset(sections_data.size());
+        pb_section_entry.set_size(section_data.size());
+        pb_section_entry.set_compressed(compressed);
+        sections_data += section_data;
+    }
+
+    void Serializer::WriteBaseFile(const TransCatSerial::BaseIndex& pb_index, const string& sections_data)
+    {
+        // Файл базы: сигнатура, длина оглавления (4 байта, little-endian), оглавление и разделы.
+        string index_data;
+        pb_index.SerializeToString(&index_data);
+        char index_size[4];
+        for (int i = 0; i < 4; ++i)
+            index_size[i] = static_cast<char>((index_data.size() >> (8 * i)) & 0xFF);
+        ofstream ofs(jsr_.serial_context_.output_file, ios_base::binary);
+        ofs.write(SECTIONED_BASE_MAGIC.data(), SECTIONED_BASE_MAGIC.size());
+        ofs.write(index_size, sizeof(index_size));
+        ofs.write(index_data.data(), index_data.size());
+        ofs.write(sections_data.data(), sections_data.size());
     }
 
     void Serializer::Serialize()
     {
-        TransCatSerial::TransportCatalogue pb_transport_cataloque;
+        // Все сообщения упоследующей структуры размещаются в арене: вместо сотен тысяч отдельных выделений
+        // памяти под вложенные сообщения (по одному на каждый элемент маршрутной матрицы) память берётся
+        // крупными блоками и освобождается разом при уничтожении арены. Вложенные сообщения создаются
+        // сразу на своём месте вызовами add_*()/mutable_*() и не копируются.
+        google::protobuf::Arena arena(MakeArenaOptions());
+        auto new_section = [&arena]() -> TransCatSerial::TransportCatalogue&
+        {
+            TransCatSerial::TransportCatalogue& pb_section =
+                *google::protobuf::Arena::CreateMessage<TransCatSerial::TransportCatalogue>(&arena);
+            pb_section.set_format_version(BASE_FORMAT_VERSION);
+            return pb_section;
+        };
+        TransCatSerial::BaseIndex& pb_index = *google::protobuf::Arena::CreateMessage<TransCatSerial::BaseIndex>(&arena);
+        pb_index.set_format_version(BASE_FORMAT_VERSION);
+        string sections_data;
         NameConvertSet cnv;
-        // В данной функции последовательно, по этапам заполняется данными упоследующая структура TransCatSerial::TransportCatalogue,
-        // созданная по схеме transport_catalogue.proto транслятором protobuf. Начнём с автобусных остановок и маршрутов автобусов - элемент stops_buses.
+        // В данной функции последовательно, по разделам заполняется данными упоследующая структура TransCatSerial::TransportCatalogue,
+        // созданная по схеме transport_catalogue.proto транслятором protobuf. Каждый раздел базы - отдельный экземпляр этой структуры.
+        // Начнём с автобусных остановок и маршрутов автобусов.
         SerializeStopsBusesPrepare(cnv);
+        TransCatSerial::TransportCatalogue& pb_catalogue = new_section();
         // Сериализация списка остановок
-        *pb_transport_cataloque.mutable_stops() = SerializeStops(cnv);
+        SerializeStops(*pb_catalogue.mutable_stops(), cnv);
          // Затем сериализация списка автобусов
-        *pb_transport_cataloque.mutable_buses() = SerializeBuses(cnv);
+        SerializeBuses(*pb_catalogue.mutable_buses(), cnv);
+        AppendSection(pb_index, sections_data, TransCatSerial::BaseSection::SECTION_CATALOGUE, pb_catalogue);
         // Выполним сериализацию маршрутного контекста,
-        *pb_transport_cataloque.mutable_router_context() = SerializeRouterContext();
+        TransCatSerial::TransportCatalogue& pb_router_context = new_section();
+        SerializeRouterContext(*pb_router_context.mutable_router_context());
+        AppendSection(pb_index, sections_data, TransCatSerial::BaseSection::SECTION_ROUTER_CONTEXT, pb_router_context);
         // и сериализацию контекста картографии.
-        *pb_transport_cataloque.mutable_render_context() = SerializeRenderContext();
+        TransCatSerial::TransportCatalogue& pb_render_context = new_section();
+        SerializeRenderContext(*pb_render_context.mutable_render_context());
+        AppendSection(pb_index, sections_data, TransCatSerial::BaseSection::SECTION_RENDER_CONTEXT, pb_render_context);
         // Дальнейшее касается структур маршрутизатора и выполняется только при его наличии.
         if (jsr_.bus_router_ptr_)
         {
-            pb_transport_cataloque.set_is_routes_data(true);
+            TransCatSerial::TransportCatalogue& pb_router = new_section();
+            pb_router.set_is_routes_data(true);
             // Теперь последовательным вызовом соответствующих процедур сериализуем построенный граф маршрутизации.
             // Сначала - словари-отображатели имён остановок в соответствующие им номера вершин маршрутизирующего графа.
-            *pb_transport_cataloque.mutable_stop_name_to_enter_vertex() = SerializeStopNameToVertex(true, cnv);
-            *pb_transport_cataloque.mutable_stop_name_to_exit_vertex() = SerializeStopNameToVertex(false, cnv);
+            SerializeStopNameToVertex(*pb_router.mutable_stop_name_to_enter_vertex(), true, cnv);
+            SerializeStopNameToVertex(*pb_router.mutable_stop_name_to_exit_vertex(), false, cnv);
             // Упоследование словаря-преобразователя номеров рёбер в их содержательные описатели.
-            *pb_transport_cataloque.mutable_edge_to_desc() = SerializeEdgeToDesc(cnv);
+            SerializeEdgeToDesc(*pb_router.mutable_edge_to_desc(), cnv);
             // Сериализация списка рёбер графа
-            *pb_transport_cataloque.mutable_edges() = SerializeEdges();
+            SerializeEdges(*pb_router.mutable_edges());
             // Упоследование списков смежности вершин и выходящих из них рёбер.
-            *pb_transport_cataloque.mutable_incidence_lists() = SerializeIncidenceLists();
-            // И, наконец, сериализация разрешающей маршрутной матрицы.
-            *pb_transport_cataloque.mutable_routes_data() = SerializeRoutesData();
-            ofstream ofs(jsr_.serial_context_.output_file, ios_base::binary);
-            pb_transport_cataloque.SerializeToOstream(&ofs);
-        }
-        else
-        {
-            pb_transport_cataloque.set_is_routes_data(false);
+            SerializeIncidenceLists(*pb_router.mutable_incidence_lists());
+            // И, наконец, сериализация разрешающей маршрутной матрицы в упакованном виде, иерархии сжатия
+            // или меток хабов, если они рассчитывались.
+            if (jsr_.bus_router_ptr_->router_.GetRouteSearch() == graph::RouteSearch::ROUTES_MATRIX)
+                SerializePackedRoutesData(*pb_router.mutable_packed_routes_data());
+            else if (jsr_.bus_router_ptr_->router_.GetRouteSearch() == graph::RouteSearch::CONTRACTION_HIERARCHY)
+                SerializeContractionHierarchy(*pb_router.mutable_contraction_hierarchy());
+            else if (jsr_.bus_router_ptr_->router_.GetRouteSearch() == graph::RouteSearch::HUB_LABELS)
+                SerializeHubLabels(*pb_router.mutable_hub_labels());
+            AppendSection(pb_index, sections_data, TransCatSerial::BaseSection::SECTION_ROUTER, pb_router);
         }
+        WriteBaseFile(pb_index, sections_data);
     };
 
-    void Serializer::DeserializeStopsInit(TransCatSerial::StopList pb_stop_list, NameConvertSet& cnv)
+    void Serializer::DeserializeStops(const TransCatSerial::StopList& pb_stop_list, TransportCatalogue::Builder& builder,
+                                      NameConvertSet& cnv)
     {
-        jsr_.trans_cat_.stops_.clear();
-        // Сначала создадим список остановок stops_. Одновременно заполним там поля, не требующие знания
-        // указателей на другие объекты базы данных.
-        cnv.stop_iter_list.reserve(jsr_.trans_cat_.stops_.size());
+        // Сначала запомним имена всех остановок - они понадобятся для расшифровки номеров остановок
+        // в таблицах расстояний.
         for (int cur_stop_num = 0; cur_stop_num < pb_stop_list.stops_size(); ++cur_stop_num)
         {
-            TransCatSerial::Stop pb_stop = pb_stop_list.stops(cur_stop_num);
-            TransportCatalogue::Stop stopd;
+            const string& stop_name = pb_stop_list.stops(cur_stop_num).stop_name();
+            cnv.stop_name_to_pb_number_[stop_name] = cur_stop_num;
+            cnv.pb_number_to_stop_name_[cur_stop_num] = stop_name;
+        }
+        // Теперь передаём построителю справочника описания остановок вместе с расстояниями до соседних.
+        // Списки проходящих через остановки маршрутов построитель восстановит сам по спискам остановок маршрутов.
+        for (const TransCatSerial::Stop& pb_stop : pb_stop_list.stops())
+        {
+            StopDescriptor stopd;
             stopd.stop_type = static_cast<transport::StopType>(static_cast<int>(pb_stop.stop_type()));
             stopd.stop_name = pb_stop.stop_name();
-            TransCatSerial::Coordinates pb_coords = pb_stop.stop_coords();
-            stopd.stop_coords.lat = pb_coords.lat();
-            stopd.stop_coords.lng = pb_coords.lng();
-            auto stops_it_pair = jsr_.trans_cat_.stops_.insert(stopd);
-            cnv.stop_name_to_pb_number_[stopd.stop_name] = cur_stop_num;
-            cnv.pb_number_to_stop_name_[cur_stop_num] = stopd.stop_name;
-            cnv.stop_num_to_stop_ptr[cur_stop_num] = &(*stops_it_pair.first);
-            cnv.stop_iter_list.push_back(stops_it_pair.first);
+            stopd.stop_coords.lat = pb_stop.stop_coords().lat();
+            stopd.stop_coords.lng = pb_stop.stop_coords().lng();
+            for (const TransCatSerial::DistanceToStop& pb_distance_to_stop : pb_stop.distance_to_stop())
+                stopd.distance_to_stop[cnv.pb_number_to_stop_name_[pb_distance_to_stop.stop_num()]] =
+                    pb_distance_to_stop.distance();
+            if (pb_stop.has_wait_time())
+                stopd.wait_time = pb_stop.wait_time();
+            builder.AddStop(stopd);
         }
     }
 
-    void Serializer::DeserializeBusesInit(TransCatSerial::BusList pb_bus_list, NameConvertSet& cnv)
+    void Serializer::DeserializeBuses(const TransCatSerial::BusList& pb_bus_list, TransportCatalogue::Builder& builder,
+                                      NameConvertSet& cnv)
     {
-        jsr_.trans_cat_.buses_.clear();
-        // А здесь создаётся вторая часть базы данных - список маршрутов автобусов buses_. Аналогично, заполняем
-        // в элементах списка поля, не содержащие указателей на другие объекты базы.
-        cnv.bus_iter_list.reserve(jsr_.trans_cat_.buses_.size());
+        // А здесь восстанавливается вторая часть базы данных - список маршрутов автобусов.
         for (int cur_bus_num = 0; cur_bus_num < pb_bus_list.buses_size(); ++cur_bus_num)
         {
-            TransCatSerial::Bus pb_bus = pb_bus_list.buses(cur_bus_num);
-            TransportCatalogue::Bus busd;
+            const TransCatSerial::Bus& pb_bus = pb_bus_list.buses(cur_bus_num);
+            BusDescriptor busd;
             busd.bus_type = static_cast<transport::BusType>(static_cast<int>(pb_bus.bus_type()));
             busd.bus_name = pb_bus.bus_name();
-            auto buses_it_pair = jsr_.trans_cat_.buses_.insert(busd);
+            busd.bus_stops.reserve(pb_bus.bus_stops_size());
+            for (auto pb_stop_num : pb_bus.bus_stops())
+                busd.bus_stops.push_back(cnv.pb_number_to_stop_name_[pb_stop_num]);
+            busd.departures.assign(pb_bus.departures().begin(), pb_bus.departures().end());
+            if (pb_bus.has_velocity())
+                busd.velocity = pb_bus.velocity();
             cnv.bus_name_to_pb_number_[busd.bus_name] = cur_bus_num;
             cnv.pb_number_to_bus_name_[cur_bus_num] = busd.bus_name;
-            cnv.bus_num_to_bus_ptr[cur_bus_num] = &(*buses_it_pair.first);
-            cnv.bus_iter_list.push_back(buses_it_pair.first);
-        }
-    }
-
-    void Serializer::DeserializeStopsSec(TransCatSerial::StopList pb_stop_list, NameConvertSet& cnv)
-    {
-        // Заполняем поля списков, которые требуют для своего заполнения указателей на другие элементы списков.
-        // Сначала заполним поля buses_at_stop и distance_to_stop элементов списка (множества) stops_.
-        for (auto& cur_stop_it : cnv.stop_iter_list)
-        {
-            int src_stop_num = cnv.stop_name_to_pb_number_[cur_stop_it->stop_name];
-            TransCatSerial::Stop pb_stop = pb_stop_list.stops(src_stop_num);
-            auto stop_node = jsr_.trans_cat_.stops_.extract(cur_stop_it);
-            // Заполняем массив (вектор) buses_at_stop.
-            for (int cur_bus_num = 0; cur_bus_num < pb_stop.buses_at_stop_size(); ++cur_bus_num)
-                stop_node.value().buses_at_stop.push_back(cnv.bus_num_to_bus_ptr[pb_stop.buses_at_stop(cur_bus_num)]);
-            // А теперь - словарь distance_to_stop.
-            for (int cur_stop_num = 0; cur_stop_num < pb_stop.distance_to_stop_size(); ++cur_stop_num)
-            {
-                TransCatSerial::DistanceToStop pb_distance_to_stop = pb_stop.distance_to_stop(cur_stop_num);
-                stop_node.value().distance_to_stop[cnv.stop_num_to_stop_ptr[pb_distance_to_stop.stop_num()]] =
-                    pb_distance_to_stop.distance();
-            }
-            jsr_.trans_cat_.stops_.insert(move(stop_node));
-        }
-    }
-
-    void Serializer::DeserializeBusesSec(TransCatSerial::BusList pb_bus_list, NameConvertSet& cnv)
-    {
-        // Наконец, последняя операция. Заполним поле bus_stops списка (множества) buses_.
-        for (auto& cur_bus_it : cnv.bus_iter_list)
-        {
-            int src_bus_num = cnv.bus_name_to_pb_number_[cur_bus_it->bus_name];
-            TransCatSerial::Bus pb_bus = pb_bus_list.buses(src_bus_num);
-            auto bus_node = jsr_.trans_cat_.buses_.extract(cur_bus_it);
-            for (int cur_stop_num = 0; cur_stop_num < pb_bus.bus_stops_size(); ++cur_stop_num)
-                bus_node.value().bus_stops.push_back(cnv.stop_num_to_stop_ptr[pb_bus.bus_stops(cur_stop_num)]);
-            jsr_.trans_cat_.buses_.insert(move(bus_node));
+            builder.AddBus(busd);
         }
     }
 
-    void Serializer::DeserializeRouterContext(TransCatSerial::RouterContext pb_router_context)
+    void Serializer::DeserializeRouterContext(const TransCatSerial::RouterContext& pb_router_context)
     {
         // Считаем из TransCatSerial::TransportCatalogue и заполним структуру router_context_.
         jsr_.router_context_.bus_velocity = pb_router_context.bus_velocity();
         jsr_.router_context_.bus_wait_time = pb_router_context.bus_wait_time();
+        jsr_.router_context_.route_search = static_cast<graph::RouteSearch>(pb_router_context.route_search());
     }
 
-    void Serializer::DeserializeRenderContext(TransCatSerial::MapRendererContext pb_render_context)
+    void Serializer::DeserializeRenderContext(const TransCatSerial::MapRendererContext& pb_render_context)
     {
         // Считаем из TransCatSerial::TransportCatalogue и заполним структуру render_context_.
         jsr_.render_context_.width = pb_render_context.width();
@@ -426,73 +560,105 @@ namespace serial
         jsr_.render_context_.bus_label_font_size = pb_render_context.bus_label_font_size();
         jsr_.render_context_.stop_label_font_size = pb_render_context.stop_label_font_size();
         jsr_.render_context_.underlayer_width = pb_render_context.underlayer_width();
-        TransCatSerial::Point pb_point(pb_render_context.bus_label_offset());
-        jsr_.render_context_.bus_label_offset.x = pb_point.x();
-        jsr_.render_context_.bus_label_offset.y = pb_point.y();
-        pb_point = pb_render_context.stop_label_offset();
-        jsr_.render_context_.stop_label_offset.x = pb_point.x();
-        jsr_.render_context_.stop_label_offset.y = pb_point.y();
-        TransCatSerial::Color pb_color(pb_render_context.underlayer_color());
-        jsr_.render_context_.underlayer_color = ConvertColorRev(pb_color);
+        jsr_.render_context_.bus_label_offset.x = pb_render_context.bus_label_offset().x();
+        jsr_.render_context_.bus_label_offset.y = pb_render_context.bus_label_offset().y();
+        jsr_.render_context_.stop_label_offset.x = pb_render_context.stop_label_offset().x();
+        jsr_.render_context_.stop_label_offset.y = pb_render_context.stop_label_offset().y();
+        jsr_.render_context_.underlayer_color = ConvertColorRev(pb_render_context.underlayer_color());
         jsr_.render_context_.color_palette.clear();
-        for (int color_num = 0; color_num < pb_render_context.color_palette_size(); ++color_num)
-        {
-            pb_color = pb_render_context.color_palette(color_num);
+        for (const TransCatSerial::Color& pb_color : pb_render_context.color_palette())
             jsr_.render_context_.color_palette.push_back(ConvertColorRev(pb_color));
-        }
     }
 
-    void Serializer::DeserializeStopNameToVertex(TransCatSerial::StopNameToVertexList pb_stop_name_to_vertex_list,
+    void Serializer::DeserializeStopNameToVertex(const TransCatSerial::StopNameToVertexList& pb_stop_name_to_vertex_list,
                                                  bool EnterOrExitList, NameConvertSet& cnv)
     {
-        if (EnterOrExitList)
-            jsr_.bus_router_ptr_->stop_name_to_enter_vertex_.clear();
-        else
-            jsr_.bus_router_ptr_->stop_name_to_exit_vertex_.clear();
-
-        for (int stop_to_vertex_recnum = 0;
-            stop_to_vertex_recnum < pb_stop_name_to_vertex_list.stop_name_to_vertex_size();
-            ++stop_to_vertex_recnum)
-        {
-            TransCatSerial::StopNameToVertex stop_name_to_vertex =
-                pb_stop_name_to_vertex_list.stop_name_to_vertex(stop_to_vertex_recnum);
-            if (EnterOrExitList)
-                jsr_.bus_router_ptr_->stop_name_to_enter_vertex_[cnv.pb_number_to_stop_name_[stop_name_to_vertex.stop_name_num()]] =
-                    stop_name_to_vertex.vertex_id();
-            else
-                jsr_.bus_router_ptr_->stop_name_to_exit_vertex_[cnv.pb_number_to_stop_name_[stop_name_to_vertex.stop_name_num()]] =
-                    stop_name_to_vertex.vertex_id();
-        }
+        router::BusRouter::StopToVertexT& stop_name_to_vertex =
+            EnterOrExitList ?
+            jsr_.bus_router_ptr_->stop_name_to_enter_vertex_ :
+            jsr_.bus_router_ptr_->stop_name_to_exit_vertex_;
+        stop_name_to_vertex.clear();
+        stop_name_to_vertex.reserve(pb_stop_name_to_vertex_list.stop_name_to_vertex_size());
+        for (const TransCatSerial::StopNameToVertex& pb_stop_name_to_vertex : pb_stop_name_to_vertex_list.stop_name_to_vertex())
+            stop_name_to_vertex[cnv.pb_number_to_stop_name_[pb_stop_name_to_vertex.stop_name_num()]] =
+                pb_stop_name_to_vertex.vertex_id();
     }
 
-    void Serializer::DeserializeEdgeToDesc(TransCatSerial::EdgeToDescList pb_edge_to_desc_list, NameConvertSet& cnv)
+    void Serializer::DeserializeEdgeToDesc(const TransCatSerial::EdgeToDescList& pb_edge_to_desc_list, NameConvertSet& cnv,
+                                           uint32_t format_version)
     {
-        jsr_.bus_router_ptr_->edge_to_desc_.clear();
-        for (int edge_to_desc_recnum = 0;
-            edge_to_desc_recnum < pb_edge_to_desc_list.edge_to_desc_size();
-            ++edge_to_desc_recnum)
+        const TransportCatalogue& tc = jsr_.trans_cat_;
+        router::BusRouter& bus_router = *jsr_.bus_router_ptr_;
+        auto& edge_to_desc = bus_router.edge_to_desc_;
+        // До четвёртой версии формата позиции остановок поездных рёбер в базу не записывались. Граф, построенный
+        // по тому же справочнику, содержит те же поездные рёбра, но нумерация рёбер могла с тех пор измениться.
+        // Поэтому позиции берутся из описателя построенного ребра с теми же маршрутом, остановками и числом
+        // пролётов, время поездки по которому равно весу считанного ребра (маршрут может проходить одну пару
+        // остановок несколько раз). Если такого ребра нет, веса рёбер по позициям пересчитать нельзя.
+        using RideEdgeKey = tuple<uint32_t, uint32_t, uint32_t, uint32_t>;
+        map<RideEdgeKey, vector<router::BusRouter::EdgeDescriptor>> built_ride_descs;
+        if (format_version < 4)
+            for (const router::BusRouter::EdgeDescriptor& built_desc : edge_to_desc)
+                if (built_desc.edge_type == router::BusRouter::EdgeType::EDGE_STAGE)
+                    built_ride_descs[{built_desc.bus_id, built_desc.from_stop_id, built_desc.to_stop_id,
+                                      built_desc.span_count}].push_back(built_desc);
+        edge_to_desc.assign(pb_edge_to_desc_list.edge_to_desc_size(), {});
+        for (const TransCatSerial::EdgeToDesc& pb_edge_to_desc : pb_edge_to_desc_list.edge_to_desc())
         {
-            TransCatSerial::EdgeToDesc pb_edge_to_desc = pb_edge_to_desc_list.edge_to_desc(edge_to_desc_recnum);
-            TransCatSerial::EdgeDescriptor pb_edge_desc = pb_edge_to_desc.edge_descriptor();
+            const TransCatSerial::EdgeDescriptor& pb_edge_desc = pb_edge_to_desc.edge_descriptor();
             router::BusRouter::EdgeDescriptor edge_desc;
             edge_desc.edge_type = static_cast<router::BusRouter::EdgeType>(static_cast<int>(pb_edge_desc.edge_type()));
-            edge_desc.from_stop = cnv.pb_number_to_stop_name_[pb_edge_desc.from_stop_num()];
-            edge_desc.to_stop = cnv.pb_number_to_stop_name_[pb_edge_desc.to_stop_num()];
-            edge_desc.bus_name = cnv.pb_number_to_bus_name_[pb_edge_desc.bus_name_num()];
+            edge_desc.from_stop_id = tc.FindStopId(cnv.pb_number_to_stop_name_[pb_edge_desc.from_stop_num()]);
+            // У пересадочных рёбер нет ни маршрута, ни отдельной остановки назначения.
+            if (edge_desc.edge_type == router::BusRouter::EdgeType::EDGE_STAGE)
+            {
+                edge_desc.to_stop_id = tc.FindStopId(cnv.pb_number_to_stop_name_[pb_edge_desc.to_stop_num()]);
+                edge_desc.bus_id = tc.FindBusId(cnv.pb_number_to_bus_name_[pb_edge_desc.bus_name_num()]);
+            }
+            else
+            {
+                edge_desc.to_stop_id = edge_desc.from_stop_id;
+                edge_desc.bus_id = TransportCatalogue::NO_ID;
+            }
             edge_desc.span_count = pb_edge_desc.span_count();
-            edge_desc.time_length = pb_edge_desc.time_length();
-            jsr_.bus_router_ptr_->edge_to_desc_[pb_edge_to_desc.edge_id()] = edge_desc;
+            edge_desc.from_position = pb_edge_desc.from_position();
+            edge_desc.is_backward = pb_edge_desc.is_backward();
+            if (format_version < 4 && edge_desc.edge_type == router::BusRouter::EdgeType::EDGE_STAGE)
+            {
+                const auto& graph = bus_router.catalogue_graph_;
+                const auto built_it = built_ride_descs.find({edge_desc.bus_id, edge_desc.from_stop_id,
+                                                             edge_desc.to_stop_id, edge_desc.span_count});
+                bool is_position_found = false;
+                if (built_it != built_ride_descs.end() && pb_edge_to_desc.edge_id() < graph.GetEdgeCount())
+                {
+                    const double weight = graph.GetEdge(pb_edge_to_desc.edge_id()).weight;
+                    for (const router::BusRouter::EdgeDescriptor& built_desc : built_it->second)
+                        if (abs(bus_router.ComputeEdgeWeight(built_desc) - weight) <=
+                            router::BusRouter::ZERO_TOLERANCE * max(1.0, weight))
+                        {
+                            edge_desc.from_position = built_desc.from_position;
+                            edge_desc.is_backward = built_desc.is_backward;
+                            is_position_found = true;
+                            break;
+                        }
+                }
+                if (!is_position_found)
+                    bus_router.has_edge_positions_ = false;
+            }
+            if (pb_edge_to_desc.edge_id() >= edge_to_desc.size())
+                edge_to_desc.resize(pb_edge_to_desc.edge_id() + 1);
+            edge_to_desc[pb_edge_to_desc.edge_id()] = edge_desc;
         }
     }
 
-    void Serializer::DeserializeEdges(TransCatSerial::Edges pb_edges_list)
+    void Serializer::DeserializeEdges(const TransCatSerial::Edges& pb_edges_list)
     {
         using GraphNC = decay_t<decltype(jsr_.bus_router_ptr_->router_.graph_)>;
         GraphNC& graph_nc(const_cast<GraphNC&>(jsr_.bus_router_ptr_->router_.graph_));
         graph_nc.edges_.clear();
-        for (int edges_recnum = 0; edges_recnum < pb_edges_list.edges_size(); ++edges_recnum)
+        graph_nc.edges_.reserve(pb_edges_list.edges_size());
+        for (const TransCatSerial::Edge& pb_edge : pb_edges_list.edges())
         {
-            TransCatSerial::Edge pb_edge = pb_edges_list.edges(edges_recnum);
             decltype(graph_nc.edges_)::value_type edge;
             edge.from = pb_edge.from();
             edge.to = pb_edge.to();
@@ -501,39 +667,33 @@ namespace serial
         }
     }
 
-    void Serializer::DeserializeIncidenceList(TransCatSerial::IncidenceLists pb_vertex_incidence_lists)
+    void Serializer::DeserializeIncidenceList(const TransCatSerial::IncidenceLists& pb_vertex_incidence_lists)
     {
         using GraphNC = decay_t<decltype(jsr_.bus_router_ptr_->router_.graph_)>;
         GraphNC& graph_nc(const_cast<GraphNC&>(jsr_.bus_router_ptr_->router_.graph_));
         graph_nc.incidence_lists_.clear();
-        // Определённый далее incidence_list_num совпадает, фактически, с номером вершины графа,
+        // Номер списка смежности в массиве совпадает, фактически, с номером вершины графа,
         // для которой составлен данный список смежности.
-        for (int incidence_list_num = 0;
-            incidence_list_num < pb_vertex_incidence_lists.incidence_list_size();
-            ++incidence_list_num)
-        {
-            decltype(graph_nc.incidence_lists_)::value_type incidence_list;
-            TransCatSerial::IncidenceList pb_incidence_list(pb_vertex_incidence_lists.incidence_list(incidence_list_num));
-            for (int edge_id_num = 0; edge_id_num < pb_incidence_list.edge_id_size(); ++edge_id_num)
-                incidence_list.push_back(pb_incidence_list.edge_id(edge_id_num));
-            graph_nc.incidence_lists_.push_back(incidence_list);
-        }
+        graph_nc.incidence_lists_.reserve(pb_vertex_incidence_lists.incidence_list_size());
+        for (const TransCatSerial::IncidenceList& pb_incidence_list : pb_vertex_incidence_lists.incidence_list())
+            graph_nc.incidence_lists_.emplace_back(pb_incidence_list.edge_id().begin(), pb_incidence_list.edge_id().end());
     }
 
-    void Serializer::DeserializeRoutesData(TransCatSerial::RoutesData pb_routes_data)
+    void Serializer::DeserializeRoutesData(const TransCatSerial::RoutesData& pb_routes_data)
     {
-        jsr_.bus_router_ptr_->router_.routes_internal_data_.clear();
-        using RoutesSecIndexData = decltype(jsr_.bus_router_ptr_->router_.routes_internal_data_)::value_type;
+        auto& routes_internal_data = jsr_.bus_router_ptr_->router_.routes_internal_data_;
+        routes_internal_data.clear();
+        using RoutesSecIndexData = decay_t<decltype(routes_internal_data)>::value_type;
         using OptRouteData = RoutesSecIndexData::value_type;
         using RouteData = OptRouteData::value_type;
-        for (int first_index = 0; first_index < pb_routes_data.first_routes_data_size(); ++first_index)
+        routes_internal_data.reserve(pb_routes_data.first_routes_data_size());
+        for (const TransCatSerial::RoutesSecIndexData& pb_sec_routes_data : pb_routes_data.first_routes_data())
         {
-            RoutesSecIndexData sec_routes_data;
-            TransCatSerial::RoutesSecIndexData pb_sec_routes_data(pb_routes_data.first_routes_data(first_index));
-            for (int second_index = 0; second_index < pb_sec_routes_data.sec_routes_data_size(); ++second_index)
+            RoutesSecIndexData& sec_routes_data = routes_internal_data.emplace_back();
+            sec_routes_data.reserve(pb_sec_routes_data.sec_routes_data_size());
+            for (const TransCatSerial::RouteData& pb_routes_data_elem : pb_sec_routes_data.sec_routes_data())
             {
-                TransCatSerial::RouteData pb_routes_data_elem(pb_sec_routes_data.sec_routes_data(second_index));
-                OptRouteData opt_routes_data_elem;
+                OptRouteData& opt_routes_data_elem = sec_routes_data.emplace_back();
                 if (pb_routes_data_elem.has_value())
                 {
                     RouteData route_data_elem;
@@ -544,64 +704,300 @@ namespace serial
                         route_data_elem.prev_edge = nullopt;
                     opt_routes_data_elem = route_data_elem;
                 }
+            }
+        }
+    }
+
+    void Serializer::DeserializePackedRoutesData(const TransCatSerial::PackedRoutesData& pb_packed_routes_data)
+    {
+        auto& routes_internal_data = jsr_.bus_router_ptr_->router_.routes_internal_data_;
+        using RoutesSecIndexData = decay_t<decltype(routes_internal_data)>::value_type;
+        using OptRouteData = RoutesSecIndexData::value_type;
+        using RouteData = OptRouteData::value_type;
+        const size_t vertex_count = pb_packed_routes_data.vertex_count();
+        const bool delta_encoded = pb_packed_routes_data.delta_encoded();
+        const size_t code_count = delta_encoded ? pb_packed_routes_data.prev_edge_delta_size() :
+                                                  pb_packed_routes_data.prev_edge_size();
+        if (code_count != vertex_count * vertex_count)
+            throw invalid_argument("Invalid packed routes data size"s);
+
+        routes_internal_data.assign(vertex_count, RoutesSecIndexData(vertex_count));
+        vector<uint32_t> prev_row_codes(vertex_count, PACKED_NO_ROUTE);
+        int code_num = 0, weight_num = 0;
+        for (RoutesSecIndexData& sec_routes_data : routes_internal_data)
+        {
+            for (size_t to_vertex = 0; to_vertex < vertex_count; ++to_vertex, ++code_num)
+            {
+                uint32_t code;
+                if (delta_encoded)
+                {
+                    code = prev_row_codes[to_vertex] + static_cast<uint32_t>(pb_packed_routes_data.prev_edge_delta(code_num));
+                    prev_row_codes[to_vertex] = code;
+                }
                 else
                 {
-                    opt_routes_data_elem = nullopt;
+                    code = pb_packed_routes_data.prev_edge(code_num);
                 }
-                sec_routes_data.push_back(opt_routes_data_elem);
+                if (code == PACKED_NO_ROUTE)
+                    continue;
+                if (weight_num >= pb_packed_routes_data.weight_size())
+                    throw invalid_argument("Invalid packed routes data size"s);
+                RouteData route_data_elem;
+                route_data_elem.weight = pb_packed_routes_data.weight(weight_num++);
+                if (code != PACKED_NO_PREV_EDGE)
+                    route_data_elem.prev_edge = code - PACKED_EDGE_BASE;
+                sec_routes_data[to_vertex] = route_data_elem;
             }
-            jsr_.bus_router_ptr_->router_.routes_internal_data_.push_back(sec_routes_data);
         }
     }
 
-    void Serializer::Deserialize()
+    void Serializer::DeserializeCatalogue(const TransCatSerial::TransportCatalogue& pb_transport_cataloque)
     {
-        TransCatSerial::TransportCatalogue pb_transport_cataloque;
-        ifstream ifs(jsr_.serial_context_.input_file, ios_base::binary);
-        pb_transport_cataloque.ParseFromIstream(&ifs);
-        NameConvertSet cnv;
-        // Во-первых, заполним два основных массива транспортного справочника - множество остановок jsr_.trans_cat_.stops_
-        // и множество описателей автобусных маршрутов jsr_.trans_cat_.buses_.
-        // Создадим предварительную версию множества остановок
-        DeserializeStopsInit(pb_transport_cataloque.stops(), cnv);
-        // и автобусных маршрутов.
-        DeserializeBusesInit(pb_transport_cataloque.buses(), cnv);
-        // Закончим заполнение списков остановок и маршрутов, связав их теперь уже известными
-        // перекрёстными списками.
-        DeserializeStopsSec(pb_transport_cataloque.stops(), cnv);
-        DeserializeBusesSec(pb_transport_cataloque.buses(), cnv);
-        // Формирование списков-множеств остановок и автобусов завершено
-        // Далее считаем из TransCatSerial::TransportCatalogue и заполним структуру router_context_.
-        DeserializeRouterContext(pb_transport_cataloque.router_context());
-        // Считаем из TransCatSerial::TransportCatalogue и заполним структуру render_context_.
-        DeserializeRenderContext(pb_transport_cataloque.render_context());
+        // Справочник заново строится построителем из считанных описаний. Словари-преобразователи номеров
+        // сохраняются в base_cnv_ - они понадобятся и при отложенной загрузке маршрутизатора.
+        base_cnv_ = NameConvertSet{};
+        TransportCatalogue::Builder builder;
+        DeserializeStops(pb_transport_cataloque.stops(), builder, base_cnv_);
+        DeserializeBuses(pb_transport_cataloque.buses(), builder, base_cnv_);
+        jsr_.trans_cat_ = builder.Finalize();
+    }
+
+    void Serializer::DeserializeRouter(const TransCatSerial::TransportCatalogue& pb_transport_cataloque)
+    {
+        delete jsr_.bus_router_ptr_;
+        jsr_.bus_router_ptr_ = nullptr;
         // Все дальнейшие элементы относятся к структуре маршрутизатора (маршрутизирующего графа) и будут восстанавливаться
         // только при его наличии.
-        if (pb_transport_cataloque.is_routes_data())
-        {
-            if (!jsr_.bus_router_ptr_)
-                jsr_.BuildBusRouter();
-            // Восстановим ряд словарей, служащих для установления связи между именными элементами транспортного
-            // справочника и численными идентификаторами соответствующих им вершин и рёбер маршрутного графа.
-            // Сначала заполним словарь-преобразователь имён остановок в номера вершин - "перронов отправления".
-            DeserializeStopNameToVertex(pb_transport_cataloque.stop_name_to_enter_vertex(), true, cnv);
-            // Во-вторых, обрабатываем словарь-преобразователь имён остановок в номера вершин - "перронов прибытия".
-            DeserializeStopNameToVertex(pb_transport_cataloque.stop_name_to_exit_vertex(), false, cnv);
-            // Наконец, словарь-преобразователь номеров рёбер в их содержательное описание.
-            DeserializeEdgeToDesc(pb_transport_cataloque.edge_to_desc(), cnv);
-            // Заполняем список дескрипторов вершин маршрутного графа.
-            DeserializeEdges(pb_transport_cataloque.edges());
-            // Восстанавливаем списки смежности маршрутного графа.
-            DeserializeIncidenceList(pb_transport_cataloque.incidence_lists());
-            // Последняя операция - заполнение разрешающей (маршрутизирующей) матрицы.
+        if (!pb_transport_cataloque.is_routes_data())
+            return;
+        // Маршрутизатор создаётся без расчёта маршрутной матрицы - она будет считана из базы.
+        jsr_.bus_router_ptr_ = new router::BusRouter(jsr_.router_context_, jsr_.trans_cat_,
+                                                     graph::Router<double>::DeferredRoutes{});
+        // Восстановим ряд словарей, служащих для установления связи между именными элементами транспортного
+        // справочника и численными идентификаторами соответствующих им вершин и рёбер маршрутного графа.
+        // Сначала заполним словарь-преобразователь имён остановок в номера вершин - "перронов отправления".
+        DeserializeStopNameToVertex(pb_transport_cataloque.stop_name_to_enter_vertex(), true, base_cnv_);
+        // Во-вторых, обрабатываем словарь-преобразователь имён остановок в номера вершин - "перронов прибытия".
+        DeserializeStopNameToVertex(pb_transport_cataloque.stop_name_to_exit_vertex(), false, base_cnv_);
+        // Заполняем список дескрипторов рёбер маршрутного графа.
+        DeserializeEdges(pb_transport_cataloque.edges());
+        // Наконец, словарь-преобразователь номеров рёбер в их содержательное описание. Для баз прежних версий
+        // он дополняется по весам считанных рёбер, поэтому читается после них.
+        DeserializeEdgeToDesc(pb_transport_cataloque.edge_to_desc(), base_cnv_, pb_transport_cataloque.format_version());
+        // Восстанавливаем списки смежности маршрутного графа.
+        DeserializeIncidenceList(pb_transport_cataloque.incidence_lists());
+        // Данные, зависящие от нумерации вершин, строятся заново по считанным словарям и графу.
+        jsr_.bus_router_ptr_->RestoreStopVertexes();
+        jsr_.bus_router_ptr_->IndexVertexes(jsr_.bus_router_ptr_->catalogue_graph_);
+        // Затем - заполнение разрешающей (маршрутизирующей) матрицы. Начиная со второй версии формата базы
+        // она хранится в упакованном виде. При поиске по иерархии сжатия или меткам хабов вместо матрицы
+        // считываются иерархия или метки, а маршрутизатору, ищущему маршруты по запросу, считывать нечего.
+        const graph::RouteSearch route_search = jsr_.bus_router_ptr_->router_.GetRouteSearch();
+        if (route_search == graph::RouteSearch::CONTRACTION_HIERARCHY)
+            DeserializeContractionHierarchy(pb_transport_cataloque.contraction_hierarchy());
+        else if (route_search == graph::RouteSearch::HUB_LABELS)
+            DeserializeHubLabels(pb_transport_cataloque.hub_labels());
+        else if (route_search == graph::RouteSearch::ROUTES_MATRIX && pb_transport_cataloque.format_version() >= 2)
+            DeserializePackedRoutesData(pb_transport_cataloque.packed_routes_data());
+        else if (route_search == graph::RouteSearch::ROUTES_MATRIX)
             DeserializeRoutesData(pb_transport_cataloque.routes_data());
+        // Последняя операция - подготовка данных поиска по восстановленному графу.
+        jsr_.bus_router_ptr_->router_.InitializeSearchData();
+    }
+
+    void Serializer::DeserializeContractionHierarchy(const TransCatSerial::ContractionHierarchy& pb_contraction_hierarchy)
+    {
+        auto& router = jsr_.bus_router_ptr_->router_;
+        const int edge_count = pb_contraction_hierarchy.original_edge_size();
+        if (pb_contraction_hierarchy.edge_from_size() != edge_count || pb_contraction_hierarchy.edge_to_size() != edge_count ||
+            pb_contraction_hierarchy.edge_weight_size() != edge_count ||
+            pb_contraction_hierarchy.first_child_size() != pb_contraction_hierarchy.second_child_size())
+            throw invalid_argument("Invalid contraction hierarchy size"s);
+        const size_t vertex_count = router.graph_.GetVertexCount();
+        router.vertex_ranks_.assign(pb_contraction_hierarchy.vertex_rank().begin(), pb_contraction_hierarchy.vertex_rank().end());
+        router.hierarchy_edges_.clear();
+        router.hierarchy_edges_.reserve(edge_count);
+        int shortcut_num = 0;
+        for (int edge_num = 0; edge_num < edge_count; ++edge_num)
+        {
+            auto& edge = router.hierarchy_edges_.emplace_back();
+            edge.from = pb_contraction_hierarchy.edge_from(edge_num);
+            edge.to = pb_contraction_hierarchy.edge_to(edge_num);
+            edge.weight = pb_contraction_hierarchy.edge_weight(edge_num);
+            edge.first_child = edge.second_child = router.NO_EDGE;
+            if (edge.from >= vertex_count || edge.to >= vertex_count)
+                throw invalid_argument("Invalid contraction hierarchy edge"s);
+            const uint32_t code = pb_contraction_hierarchy.original_edge(edge_num);
+            if (code != HIERARCHY_SHORTCUT)
+            {
+                edge.original_edge = code - HIERARCHY_EDGE_BASE;
+                if (edge.original_edge >= router.graph_.GetEdgeCount())
+                    throw invalid_argument("Invalid contraction hierarchy edge"s);
+                continue;
+            }
+            // Сокращение заменяет рёбра, записанные раньше него.
+            if (shortcut_num >= pb_contraction_hierarchy.first_child_size())
+                throw invalid_argument("Invalid contraction hierarchy size"s);
+            edge.original_edge = router.NO_EDGE;
+            edge.first_child = pb_contraction_hierarchy.first_child(shortcut_num);
+            edge.second_child = pb_contraction_hierarchy.second_child(shortcut_num++);
+            if (edge.first_child >= static_cast<size_t>(edge_num) || edge.second_child >= static_cast<size_t>(edge_num))
+                throw invalid_argument("Invalid contraction hierarchy edge"s);
         }
-        else
+    }
+
+    void Serializer::DeserializeHubLabels(const TransCatSerial::HubLabels& pb_hub_labels)
+    {
+        auto& router = jsr_.bus_router_ptr_->router_;
+        const size_t vertex_count = router.graph_.GetVertexCount();
+        const size_t edge_count = router.graph_.GetEdgeCount();
+        if (static_cast<size_t>(pb_hub_labels.hub_vertex_size()) != vertex_count)
+            throw invalid_argument("Invalid hub labels size"s);
+        router.hub_vertexes_.assign(pb_hub_labels.hub_vertex().begin(), pb_hub_labels.hub_vertex().end());
+        auto deserialize_labels = [&router, vertex_count, edge_count](auto& labels, const auto& pb_label_count,
+                                                                     const auto& pb_hub_delta, const auto& pb_weight,
+                                                                     const auto& pb_edge)
+        {
+            if (static_cast<size_t>(pb_label_count.size()) != vertex_count || pb_weight.size() != pb_hub_delta.size() ||
+                pb_edge.size() != pb_hub_delta.size())
+                throw invalid_argument("Invalid hub labels size"s);
+            labels.assign(vertex_count, {});
+            int label_num = 0;
+            for (size_t vertex = 0; vertex < vertex_count; ++vertex)
+            {
+                if (pb_label_count.Get(vertex) > static_cast<uint32_t>(pb_hub_delta.size() - label_num))
+                    throw invalid_argument("Invalid hub labels size"s);
+                labels[vertex].resize(pb_label_count.Get(vertex));
+                uint32_t hub = 0;
+                for (auto& label : labels[vertex])
+                {
+                    hub += pb_hub_delta.Get(label_num);
+                    const uint32_t edge_code = pb_edge.Get(label_num);
+                    label.hub = hub;
+                    label.weight = pb_weight.Get(label_num++);
+                    label.edge = edge_code == HUB_LABEL_NO_EDGE ? router.NO_EDGE : edge_code - HUB_LABEL_EDGE_BASE;
+                    if (hub >= vertex_count || (edge_code != HUB_LABEL_NO_EDGE && label.edge >= edge_count))
+                        throw invalid_argument("Invalid hub label"s);
+                }
+            }
+        };
+        deserialize_labels(router.in_labels_, pb_hub_labels.in_label_count(), pb_hub_labels.in_hub_delta(),
+                           pb_hub_labels.in_weight(), pb_hub_labels.in_edge());
+        deserialize_labels(router.out_labels_, pb_hub_labels.out_label_count(), pb_hub_labels.out_hub_delta(),
+                           pb_hub_labels.out_weight(), pb_hub_labels.out_edge());
+    }
+
+    void Serializer::DeserializeWholeBase(istream& input)
+    {
+        // База первой и второй версий формата - единое сообщение, возможно, упакованное в сжатый контейнер.
+        // Файл считывается в память целиком и восстанавливается сразу полностью.
+        string data(istreambuf_iterator<char>(input), {});
+        if (compression::IsContainer(data))
+            data = compression::UnpackContainer(data);
+        google::protobuf::Arena arena(MakeArenaOptions());
+        TransCatSerial::TransportCatalogue& pb_transport_cataloque =
+            *google::protobuf::Arena::CreateMessage<TransCatSerial::TransportCatalogue>(&arena);
+        if (!pb_transport_cataloque.ParseFromString(data))
+            throw invalid_argument("Invalid base file "s + jsr_.serial_context_.input_file);
+        DeserializeCatalogue(pb_transport_cataloque);
+        DeserializeRouterContext(pb_transport_cataloque.router_context());
+        DeserializeRenderContext(pb_transport_cataloque.render_context());
+        DeserializeRouter(pb_transport_cataloque);
+    }
+
+    bool Serializer::ReadSection(TransCatSerial::BaseSection::SectionType section_type,
+                                 TransCatSerial::TransportCatalogue& pb_section)
+    {
+        auto section_it = base_sections_.find(section_type);
+        if (section_it == base_sections_.end())
+            return false;
+        const SectionLocation& location = section_it->second;
+        ifstream ifs(jsr_.serial_context_.input_file, ios_base::binary);
+        string data(location.size, '\0');
+        if (!ifs.seekg(sections_begin_ + location.offset) || !ifs.read(data.data(), data.size()))
+            throw invalid_argument("Unable to read base section from "s + jsr_.serial_context_.input_file);
+        if (location.compressed)
+            data = compression::UnpackContainer(data);
+        if (!pb_section.ParseFromString(data))
+            throw invalid_argument("Invalid base section in "s + jsr_.serial_context_.input_file);
+        base_sections_.erase(section_it);
+        return true;
+    }
+
+    bool Serializer::LoadDeferredRenderContext()
+    {
+        if (!base_sections_.count(TransCatSerial::BaseSection::SECTION_RENDER_CONTEXT))
+            return false;
+        stats::ScopedTimer timer("load_render_context"sv);
+        google::protobuf::Arena arena;
+        TransCatSerial::TransportCatalogue& pb_section =
+            *google::protobuf::Arena::CreateMessage<TransCatSerial::TransportCatalogue>(&arena);
+        if (!ReadSection(TransCatSerial::BaseSection::SECTION_RENDER_CONTEXT, pb_section))
+            return false;
+        DeserializeRenderContext(pb_section.render_context());
+        return true;
+    }
+
+    bool Serializer::LoadDeferredRouter()
+    {
+        if (!base_sections_.count(TransCatSerial::BaseSection::SECTION_ROUTER))
+            return false;
+        stats::ScopedTimer timer("load_router"sv);
+        google::protobuf::Arena arena(MakeArenaOptions());
+        TransCatSerial::TransportCatalogue& pb_section =
+            *google::protobuf::Arena::CreateMessage<TransCatSerial::TransportCatalogue>(&arena);
+        if (!ReadSection(TransCatSerial::BaseSection::SECTION_ROUTER, pb_section))
+            return false;
+        DeserializeRouter(pb_section);
+        return jsr_.bus_router_ptr_ != nullptr;
+    }
+
+    void Serializer::Deserialize()
+    {
+        base_sections_.clear();
+        ifstream ifs(jsr_.serial_context_.input_file, ios_base::binary);
+        if (!ifs)
+            throw invalid_argument("Unable to open base file "s + jsr_.serial_context_.input_file);
+        char header[8];
+        if (!ifs.read(header, sizeof(header)) || string_view(header, SECTIONED_BASE_MAGIC.size()) != SECTIONED_BASE_MAGIC)
         {
-            if (jsr_.bus_router_ptr_)
-                delete jsr_.bus_router_ptr_;        
+            // Базы прежних версий формата не разделены на разделы и читаются целиком.
+            ifs.clear();
+            ifs.seekg(0);
+            DeserializeWholeBase(ifs);
+            return;
         }
-        // Собственно, всё. Состояние программы полностью восстановлено в соответствии со входным
-        // сериализующим файлом.
+
+        // Секционированная база. Считываем оглавление и запоминаем положение разделов в файле.
+        size_t index_size = 0;
+        for (int i = 0; i < 4; ++i)
+            index_size |= static_cast<size_t>(static_cast<unsigned char>(header[SECTIONED_BASE_MAGIC.size() + i])) << (8 * i);
+        string index_data(index_size, '\0');
+        TransCatSerial::BaseIndex pb_index;
+        if (!ifs.read(index_data.data(), index_data.size()) || !pb_index.ParseFromString(index_data))
+            throw invalid_argument("Invalid base index in "s + jsr_.serial_context_.input_file);
+        sections_begin_ = sizeof(header) + index_size;
+        for (const TransCatSerial::BaseSection& pb_section : pb_index.sections())
+            base_sections_[pb_section.type()] = {pb_section.offset(), pb_section.size(), pb_section.compressed()};
+        ifs.close();
+
+        // Сразу восстанавливаются только сам справочник и маршрутный контекст - этого достаточно для
+        // запросов о маршрутах и остановках. Контекст картографии и маршрутизатор загружаются при первом
+        // запросе, которому они нужны (LoadDeferredRenderContext и LoadDeferredRouter). Маршрутизатор,
+        // построенный до загрузки базы, к новому справочнику не относится и удаляется.
+        delete jsr_.bus_router_ptr_;
+        jsr_.bus_router_ptr_ = nullptr;
+        google::protobuf::Arena arena(MakeArenaOptions());
+        TransCatSerial::TransportCatalogue& pb_catalogue =
+            *google::protobuf::Arena::CreateMessage<TransCatSerial::TransportCatalogue>(&arena);
+        if (!ReadSection(TransCatSerial::BaseSection::SECTION_CATALOGUE, pb_catalogue))
+            throw invalid_argument("No catalogue section in "s + jsr_.serial_context_.input_file);
+        DeserializeCatalogue(pb_catalogue);
+        TransCatSerial::TransportCatalogue& pb_router_context =
+            *google::protobuf::Arena::CreateMessage<TransCatSerial::TransportCatalogue>(&arena);
+        if (ReadSection(TransCatSerial::BaseSection::SECTION_ROUTER_CONTEXT, pb_router_context))
+            DeserializeRouterContext(pb_router_context.router_context());
+        // Собственно, всё. Состояние программы восстановлено в соответствии со входным сериализующим
+        // файлом, а отложенные разделы будут дочитаны по мере надобности.
     }
 } // namespace serial
@@ -1,7 +1,12 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <map>
+#include <istream>
+#include <cstdint>
+
+#include <google/protobuf/arena.h>
 
 #include "json.h"
 #include "svg.h"
@@ -20,49 +25,53 @@ namespace transport::reader
 
 namespace serial
 {
+    // Способ сжатия файла базы
+    enum class BaseCompression
+    {
+        NONE = 0,
+        LZ     // Контейнер из параллельно сжимаемых фрагментов (compression.h)
+    };
+
     struct SerializationContext
     {
         std::string input_file; //Имя входного файла при распоследовании
         std::string output_file; //Имя выходного файлп при упоследовании
+        bool routes_delta_encoding = false; //Разностное кодирование маршрутной матрицы при упоследовании
+        BaseCompression compression = BaseCompression::NONE; //Сжатие файла базы при упоследовании
     };
 
+    // Посетитель, заполняющий упоследующую структуру цвета pb_color по значению svg::Color.
     struct ColorConvertClass
     {
-        TransCatSerial::Color operator()(std::monostate)
+        TransCatSerial::Color& pb_color;
+
+        void operator()(std::monostate)
         {
-            TransCatSerial::Color result;
-            result.set_encoding_type(TransCatSerial::Color_ColorEncodingType::Color_ColorEncodingType_COLORTYPE_UNDEFINED);
-            return result;
+            pb_color.set_encoding_type(TransCatSerial::Color_ColorEncodingType::Color_ColorEncodingType_COLORTYPE_UNDEFINED);
         }
 
-        TransCatSerial::Color operator()(const std::string& col_str)
+        void operator()(const std::string& col_str)
         {
-            TransCatSerial::Color result;
-            result.set_encoding_type(TransCatSerial::Color_ColorEncodingType::Color_ColorEncodingType_COLORTYPE_STRING);
-            result.set_color_name(col_str);
-            return result;
+            pb_color.set_encoding_type(TransCatSerial::Color_ColorEncodingType::Color_ColorEncodingType_COLORTYPE_STRING);
+            pb_color.set_color_name(col_str);
         }
 
-        TransCatSerial::Color operator()(const svg::Rgb& col_rgb)
+        void operator()(const svg::Rgb& col_rgb)
         {
-            TransCatSerial::Color result;
-            result.set_encoding_type(TransCatSerial::Color_ColorEncodingType::Color_ColorEncodingType_COLORTYPE_RGB);
-            result.set_red(col_rgb.red);
-            result.set_green(col_rgb.green);
-            result.set_blue(col_rgb.blue);
-            result.set_opacity(1.0);
-            return result;
+            pb_color.set_encoding_type(TransCatSerial::Color_ColorEncodingType::Color_ColorEncodingType_COLORTYPE_RGB);
+            pb_color.set_red(col_rgb.red);
+            pb_color.set_green(col_rgb.green);
+            pb_color.set_blue(col_rgb.blue);
+            pb_color.set_opacity(1.0);
         }
 
-        TransCatSerial::Color operator()(const svg::Rgba& col_rgba)
+        void operator()(const svg::Rgba& col_rgba)
         {
-            TransCatSerial::Color result;
-            result.set_encoding_type(TransCatSerial::Color_ColorEncodingType::Color_ColorEncodingType_COLORTYPE_RGBA);
-            result.set_red(col_rgba.red);
-            result.set_green(col_rgba.green);
-            result.set_blue(col_rgba.blue);
-            result.set_opacity(col_rgba.opacity);
-            return result;
+            pb_color.set_encoding_type(TransCatSerial::Color_ColorEncodingType::Color_ColorEncodingType_COLORTYPE_RGBA);
+            pb_color.set_red(col_rgba.red);
+            pb_color.set_green(col_rgba.green);
+            pb_color.set_blue(col_rgba.blue);
+            pb_color.set_opacity(col_rgba.opacity);
         }
     };
 
@@ -72,11 +81,27 @@ namespace serial
 
         Serializer(transport::reader::JSONReader& jsr);
         void Serialize();
+        // Базы прежних версий формата восстанавливаются целиком. Из секционированной базы сразу
+        // восстанавливаются только справочник и маршрутный контекст, остальные разделы догружаются
+        // методами LoadDeferred*. Для этого объект Serializer должен существовать и после вызова Deserialize.
         void Deserialize();
+        // Догружают отложенный раздел базы. Возвращают false, если такого раздела в базе нет
+        // или он уже был загружен.
+        bool LoadDeferredRenderContext();
+        bool LoadDeferredRouter();
 
     private:
 
         transport::reader::JSONReader& jsr_;
+
+        // Положение раздела секционированной базы в её файле
+        struct SectionLocation
+        {
+            uint64_t offset;
+            uint64_t size;
+            bool compressed;
+        };
+
         struct NameConvertSet
         {   // Структура, которая будет хранить набор словарей, выполняющих прямое и обратное отражение
             // имён элементов транспортного справочника в их условные порядковые номера в сериализованном виде.
@@ -84,34 +109,79 @@ namespace serial
             std::unordered_map<std::string, int> bus_name_to_pb_number_;
             std::unordered_map<int, std::string> pb_number_to_stop_name_;
             std::unordered_map<int, std::string> pb_number_to_bus_name_;
-            std::unordered_map<size_t, const transport::TransportCatalogue::Stop*> stop_num_to_stop_ptr;
-            std::unordered_map<size_t, const transport::TransportCatalogue::Bus*> bus_num_to_bus_ptr;
-            std::vector<transport::TransportCatalogue::StopsListType::iterator> stop_iter_list;
-            std::vector<transport::TransportCatalogue::BusesListType::iterator> bus_iter_list;
         };
+
+        // Ещё не загруженные разделы секционированной базы и начало области разделов в файле
+        std::map<TransCatSerial::BaseSection::SectionType, SectionLocation> base_sections_;
+        uint64_t sections_begin_ = 0;
+        // Словари-преобразователи номеров загруженной базы
+        NameConvertSet base_cnv_;
+
+        // Размеры блоков памяти арены, в которой размещаются сообщения protobuf при упоследовании
+        // и распоследовании. Маршрутная матрица даёт миллионы мелких вложенных сообщений, поэтому
+        // арене позволено быстро наращивать блоки до крупного размера.
+        static constexpr size_t ARENA_START_BLOCK_SIZE = 64 * 1024;
+        static constexpr size_t ARENA_MAX_BLOCK_SIZE = 16 * 1024 * 1024;
+        // Версия формата записываемой базы. Начиная с третьей версии база делится на независимо
+        // читаемые разделы. Базы первой (с маршрутной матрицей в виде вложенных сообщений RoutesData)
+        // и второй версий по-прежнему читаются. В четвёртой версии в описатели поездных рёбер добавлены
+        // позиции их остановок в маршруте.
+        static constexpr uint32_t BASE_FORMAT_VERSION = 4;
+        static constexpr std::string_view SECTIONED_BASE_MAGIC = "TCSB";
+        // Коды последнего ребра маршрута в упакованной маршрутной матрице (см. graph.proto).
+        static constexpr uint32_t PACKED_NO_ROUTE = 0;
+        static constexpr uint32_t PACKED_NO_PREV_EDGE = 1;
+        static constexpr uint32_t PACKED_EDGE_BASE = 2;
+        // Коды рёбер иерархии сжатия (см. graph.proto).
+        static constexpr uint32_t HIERARCHY_SHORTCUT = 0;
+        static constexpr uint32_t HIERARCHY_EDGE_BASE = 1;
+        // Коды рёбер меток хабов (см. graph.proto).
+        static constexpr uint32_t HUB_LABEL_NO_EDGE = 0;
+        static constexpr uint32_t HUB_LABEL_EDGE_BASE = 1;
+
         // Приватные методы класса
-        svg::Color ConvertColorRev(TransCatSerial::Color& pb_color);
-        TransCatSerial::MapRendererContext SerializeRenderContext();
-        TransCatSerial::RouterContext SerializeRouterContext();        
+        static google::protobuf::ArenaOptions MakeArenaOptions();
+        svg::Color ConvertColorRev(const TransCatSerial::Color& pb_color);
+        void AppendSection(TransCatSerial::BaseIndex& pb_index, std::string& sections_data,
+                           TransCatSerial::BaseSection::SectionType section_type,
+                           const TransCatSerial::TransportCatalogue& pb_section);
+        void WriteBaseFile(const TransCatSerial::BaseIndex& pb_index, const std::string& sections_data);
+        void DeserializeWholeBase(std::istream& input);
+        bool ReadSection(TransCatSerial::BaseSection::SectionType section_type,
+                         TransCatSerial::TransportCatalogue& pb_section);
+        void DeserializeCatalogue(const TransCatSerial::TransportCatalogue& pb_transport_cataloque);
+        void DeserializeRouter(const TransCatSerial::TransportCatalogue& pb_transport_cataloque);
+        // Процедуры упоследования заполняют переданное им сообщение, уже размещённое на своём месте
+        // в итоговой структуре, а процедуры распоследования читают сообщения по константным ссылкам.
+        void SerializeRenderContext(TransCatSerial::MapRendererContext& pb_render_context);
+        void SerializeRouterContext(TransCatSerial::RouterContext& pb_router_context);
         void SerializeStopsBusesPrepare(NameConvertSet& cnv);
-        TransCatSerial::StopList SerializeStops(NameConvertSet& cnv);
-        TransCatSerial::BusList SerializeBuses(NameConvertSet& cnv);
-        TransCatSerial::StopNameToVertexList SerializeStopNameToVertex(bool EnterOrExitList, NameConvertSet& cnv);
-        TransCatSerial::EdgeToDescList SerializeEdgeToDesc(NameConvertSet& cnv);
-        TransCatSerial::Edges SerializeEdges();
-        TransCatSerial::IncidenceLists SerializeIncidenceLists();
-        TransCatSerial::RoutesData SerializeRoutesData();
-        void DeserializeStopsInit(TransCatSerial::StopList pb_stop_list, NameConvertSet& cnv);
-        void DeserializeBusesInit(TransCatSerial::BusList pb_bus_list, NameConvertSet& cnv);
-        void DeserializeStopsSec(TransCatSerial::StopList pb_stop_list, NameConvertSet& cnv);
-        void DeserializeBusesSec(TransCatSerial::BusList pb_bus_list, NameConvertSet& cnv);
-        void DeserializeRouterContext(TransCatSerial::RouterContext pb_router_context);
-        void DeserializeRenderContext(TransCatSerial::MapRendererContext pb_render_context);
-        void DeserializeStopNameToVertex(TransCatSerial::StopNameToVertexList pb_stop_name_to_vertex_list,
+        void SerializeStops(TransCatSerial::StopList& pb_stop_list, NameConvertSet& cnv);
+        void SerializeBuses(TransCatSerial::BusList& pb_bus_list, NameConvertSet& cnv);
+        void SerializeStopNameToVertex(TransCatSerial::StopNameToVertexList& pb_stop_name_to_vertex_list,
+                                       bool EnterOrExitList, NameConvertSet& cnv);
+        void SerializeEdgeToDesc(TransCatSerial::EdgeToDescList& pb_edge_to_desc_list, NameConvertSet& cnv);
+        void SerializeEdges(TransCatSerial::Edges& pb_edges_list);
+        void SerializeIncidenceLists(TransCatSerial::IncidenceLists& pb_vertex_incidence_list);
+        void SerializeRoutesData(TransCatSerial::RoutesData& pb_routes_data);
+        void SerializePackedRoutesData(TransCatSerial::PackedRoutesData& pb_packed_routes_data);
+        void SerializeContractionHierarchy(TransCatSerial::ContractionHierarchy& pb_contraction_hierarchy);
+        void SerializeHubLabels(TransCatSerial::HubLabels& pb_hub_labels);
+        void DeserializeStops(const TransCatSerial::StopList& pb_stop_list, transport::TransportCatalogue::Builder& builder,
+                              NameConvertSet& cnv);
+        void DeserializeBuses(const TransCatSerial::BusList& pb_bus_list, transport::TransportCatalogue::Builder& builder,
+                              NameConvertSet& cnv);
+        void DeserializeRouterContext(const TransCatSerial::RouterContext& pb_router_context);
+        void DeserializeRenderContext(const TransCatSerial::MapRendererContext& pb_render_context);
+        void DeserializeStopNameToVertex(const TransCatSerial::StopNameToVertexList& pb_stop_name_to_vertex_list,
                                          bool EnterOrExitList, NameConvertSet& cnv);
-        void DeserializeEdgeToDesc(TransCatSerial::EdgeToDescList pb_edge_to_desc_list, NameConvertSet& cnv);
-        void DeserializeEdges(TransCatSerial::Edges pb_edges_list);
-        void DeserializeIncidenceList(TransCatSerial::IncidenceLists pb_vertex_incidence_lists);
-        void DeserializeRoutesData(TransCatSerial::RoutesData pb_routes_data);
+        void DeserializeEdgeToDesc(const TransCatSerial::EdgeToDescList& pb_edge_to_desc_list, NameConvertSet& cnv,
+                                   uint32_t format_version);
+        void DeserializeEdges(const TransCatSerial::Edges& pb_edges_list);
+        void DeserializeIncidenceList(const TransCatSerial::IncidenceLists& pb_vertex_incidence_lists);
+        void DeserializeRoutesData(const TransCatSerial::RoutesData& pb_routes_data);
+        void DeserializePackedRoutesData(const TransCatSerial::PackedRoutesData& pb_packed_routes_data);
+        void DeserializeContractionHierarchy(const TransCatSerial::ContractionHierarchy& pb_contraction_hierarchy);
+        void DeserializeHubLabels(const TransCatSerial::HubLabels& pb_hub_labels);
     };
 } // namespace serial
@@ -0,0 +1,228 @@
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <iomanip>
+#include <cmath>
+
+#if defined(__linux__)
+#include <fstream>
+#endif
+
+#include "stats.h"
+
+using namespace std;
+
+namespace stats
+{
+    namespace
+    {
+        atomic<bool> stats_enabled{false};
+        atomic<uint64_t> alloc_count{0};
+        atomic<uint64_t> alloc_bytes{0};
+
+        struct PhaseRecord
+        {
+            string name;
+            uint64_t calls = 0;
+            chrono::steady_clock::duration time{};
+            uint64_t alloc_count = 0;
+            uint64_t alloc_bytes = 0;
+            uint64_t rss_bytes = 0; // Наибольший размер резидентной памяти по окончании этапа
+        };
+
+        struct StatsStorage
+        {
+            mutex lock;
+            vector<PhaseRecord> phases;
+            unordered_map<string, size_t> phase_index;
+            map<string, vector<chrono::steady_clock::duration>, less<>> latencies;
+        };
+
+        StatsStorage& GetStorage()
+        {
+            static StatsStorage storage;
+            return storage;
+        }
+
+        // Составное имя этапа, выполняющегося в данном потоке
+        thread_local string phase_path;
+
+        struct RssInfo
+        {
+            uint64_t current = 0;
+            uint64_t peak = 0;
+        };
+
+        // Текущий (VmRSS) и наибольший (VmHWM) размеры резидентной памяти процесса. Оба берутся
+        // из одного чтения /proc/self/status, чтобы размеры по этапам и наибольший были сравнимы.
+        // На платформах, где они не определяются, возвращаются нули.
+        RssInfo GetRss()
+        {
+            RssInfo result;
+#if defined(__linux__)
+            ifstream status("/proc/self/status");
+            string line;
+            while (getline(status, line))
+                if (line.rfind("VmRSS:", 0) == 0)
+                    result.current = stoull(line.substr(6)) * 1024;
+                else if (line.rfind("VmHWM:", 0) == 0)
+                    result.peak = stoull(line.substr(6)) * 1024;
+#endif
+            return result;
+        }
+
+        double ToMilliseconds(chrono::steady_clock::duration duration)
+        {
+            return chrono::duration<double, milli>(duration).count();
+        }
+
+        double ToMicroseconds(chrono::steady_clock::duration duration)
+        {
+            return chrono::duration<double, micro>(duration).count();
+        }
+
+        double ToMebibytes(uint64_t bytes)
+        {
+            return bytes / (1024.0 * 1024.0);
+        }
+
+        // Процентиль по методу ближайшего ранга; sorted_values упорядочен и не пуст.
+        chrono::steady_clock::duration Percentile(const vector<chrono::steady_clock::duration>& sorted_values,
+                                                  double percent)
+        {
+            size_t rank = static_cast<size_t>(ceil(percent / 100.0 * sorted_values.size()));
+            return sorted_values[max<size_t>(rank, 1) - 1];
+        }
+
+    } // namespace
+
+    void CountAllocation(size_t size)
+    {
+        if (stats_enabled.load(memory_order_relaxed))
+        {
+            alloc_count.fetch_add(1, memory_order_relaxed);
+            alloc_bytes.fetch_add(size, memory_order_relaxed);
+        }
+    }
+
+    void Enable()
+    {
+        GetStorage();
+        stats_enabled.store(true);
+    }
+
+    bool IsEnabled()
+    {
+        return stats_enabled.load(memory_order_relaxed);
+    }
+
+    ScopedTimer::ScopedTimer(string_view phase_name)
+    {
+        if (!IsEnabled())
+            return;
+        is_active_ = true;
+        parent_path_size_ = phase_path.size();
+        if (!phase_path.empty())
+            phase_path += '/';
+        phase_path += phase_name;
+        start_alloc_count_ = alloc_count.load(memory_order_relaxed);
+        start_alloc_bytes_ = alloc_bytes.load(memory_order_relaxed);
+        start_time_ = chrono::steady_clock::now();
+    }
+
+    ScopedTimer::~ScopedTimer()
+    {
+        Stop();
+    }
+
+    void ScopedTimer::Stop()
+    {
+        if (!is_active_)
+            return;
+        is_active_ = false;
+        const auto elapsed = chrono::steady_clock::now() - start_time_;
+        const uint64_t phase_alloc_count = alloc_count.load(memory_order_relaxed) - start_alloc_count_;
+        const uint64_t phase_alloc_bytes = alloc_bytes.load(memory_order_relaxed) - start_alloc_bytes_;
+        const uint64_t rss = GetRss().current;
+
+        StatsStorage& storage = GetStorage();
+        {
+            lock_guard guard(storage.lock);
+            auto [index_it, is_new] = storage.phase_index.emplace(phase_path, storage.phases.size());
+            if (is_new)
+                storage.phases.push_back({phase_path});
+            PhaseRecord& record = storage.phases[index_it->second];
+            ++record.calls;
+            record.time += elapsed;
+            record.alloc_count += phase_alloc_count;
+            record.alloc_bytes += phase_alloc_bytes;
+            record.rss_bytes = max(record.rss_bytes, rss);
+        }
+        phase_path.resize(parent_path_size_);
+    }
+
+    void RecordLatency(string_view request_type, chrono::steady_clock::duration latency)
+    {
+        if (!IsEnabled())
+            return;
+        StatsStorage& storage = GetStorage();
+        lock_guard guard(storage.lock);
+        auto latency_it = storage.latencies.find(request_type);
+        if (latency_it == storage.latencies.end())
+            latency_it = storage.latencies.emplace(string(request_type), vector<chrono::steady_clock::duration>()).first;
+        latency_it->second.push_back(latency);
+    }
+
+    void PrintReport(ostream& output)
+    {
+        StatsStorage& storage = GetStorage();
+        lock_guard guard(storage.lock);
+        const auto flags = output.flags();
+        const auto precision = output.precision();
+        output << fixed;
+
+        size_t name_width = 24;
+        for (const PhaseRecord& record : storage.phases)
+            name_width = max(name_width, record.name.size() + 2);
+        output << left << setw(name_width) << "phase" << right << setw(8) << "calls" << setw(14) << "time, ms"
+               << setw(14) << "allocs" << setw(14) << "alloc, MiB" << setw(12) << "RSS, MiB" << '\n';
+        for (const PhaseRecord& record : storage.phases)
+            output << left << setw(name_width) << record.name << right << setw(8) << record.calls
+                   << setw(14) << setprecision(2) << ToMilliseconds(record.time) << setw(14) << record.alloc_count
+                   << setw(14) << ToMebibytes(record.alloc_bytes) << setw(12) << ToMebibytes(record.rss_bytes) << '\n';
+        // Ядро обновляет VmHWM не при каждом изменении размера резидентной памяти, поэтому наибольший
+        // размер не может быть меньше ни одного из размеров, замеренных по окончании этапов.
+        uint64_t peak_rss = GetRss().peak;
+        for (const PhaseRecord& record : storage.phases)
+            peak_rss = max(peak_rss, record.rss_bytes);
+        output << "peak RSS, MiB: " << setprecision(2) << ToMebibytes(peak_rss) << '\n';
+
+        if (!storage.latencies.empty())
+        {
+            output << '\n' << left << setw(name_width) << "request" << right << setw(8) << "count"
+                   << setw(14) << "total, ms" << setw(14) << "p50, us" << setw(14) << "p99, us"
+                   << setw(12) << "max, us" << '\n';
+            for (auto& [request_type, latencies] : storage.latencies)
+            {
+                sort(latencies.begin(), latencies.end());
+                chrono::steady_clock::duration total{};
+                for (auto latency : latencies)
+                    total += latency;
+                output << left << setw(name_width) << request_type << right << setw(8) << latencies.size()
+                       << setw(14) << setprecision(2) << ToMilliseconds(total)
+                       << setw(14) << setprecision(1) << ToMicroseconds(Percentile(latencies, 50))
+                       << setw(14) << ToMicroseconds(Percentile(latencies, 99))
+                       << setw(12) << ToMicroseconds(latencies.back()) << '\n';
+            }
+        }
+
+        output.flags(flags);
+        output.precision(precision);
+    }
+} // namespace stats
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <ostream>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+namespace stats
+{
+    // Включает сбор статистики. До вызова Enable все средства этого модуля ничего не делают,
+    // а подсчёт выделений памяти сводится к одной проверке флага.
+    void Enable();
+    bool IsEnabled();
+
+    // Замеряет время выполнения этапа работы от создания объекта до его уничтожения или вызова Stop,
+    // а также количество и суммарный объём выделенной за это время памяти и размер резидентной памяти
+    // процесса по окончании этапа. Вложенные этапы одного потока получают составные имена вида
+    // "внешний/внутренний". Повторные замеры одного этапа суммируются.
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(std::string_view phase_name);
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+        ~ScopedTimer();
+
+        void Stop();
+
+    private:
+        bool is_active_ = false;
+        size_t parent_path_size_ = 0; // Длина составного имени внешнего этапа
+        std::chrono::steady_clock::time_point start_time_;
+        uint64_t start_alloc_count_ = 0;
+        uint64_t start_alloc_bytes_ = 0;
+    };
+
+    // Учитывает время исполнения одного запроса на получение информации типа request_type.
+    void RecordLatency(std::string_view request_type, std::chrono::steady_clock::duration latency);
+
+    // Учитывает выделение size байт памяти. Вызывается заменёнными глобальными операторами new
+    // (файл stats_alloc.cpp) при каждом выделении.
+    void CountAllocation(size_t size);
+
+    // Выводит собранную статистику: таблицу этапов в порядке их первого завершения и
+    // распределение времени исполнения запросов по типам.
+    void PrintReport(std::ostream& output);
+} // namespace stats
@@ -0,0 +1,56 @@
+#include <new>
+#include <cstdlib>
+#include <cstddef>
+
+#include "stats.h"
+
+using namespace std;
+
+// Глобальные операторы выделения памяти заменены, чтобы вести счёт выделений для ScopedTimer.
+// Остальные формы operator new и operator delete по умолчанию выражаются через эти; формы nothrow
+// заменены явно, так как, например, AddressSanitizer подменяет их собственными, не вызывающими эти.
+// Операторы вынесены в отдельный файл: там, где их определения видны вместе с кодом контейнеров,
+// компилятор после встраивания видит пару "operator new - free" и предупреждает
+// (-Wmismatched-new-delete), хотя память выделена malloc внутри самого operator new.
+void* operator new(size_t size)
+{
+    stats::CountAllocation(size);
+    if (size == 0)
+        size = 1;
+    while (true)
+    {
+        if (void* ptr = malloc(size))
+            return ptr;
+        new_handler handler = get_new_handler();
+        if (!handler)
+            throw bad_alloc();
+        handler();
+    }
+}
+
+void* operator new(size_t size, const nothrow_t&) noexcept
+{
+    try
+    {
+        return operator new(size);
+    }
+    catch (const bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void operator delete(void* ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void* ptr, const nothrow_t&) noexcept
+{
+    free(ptr);
+}
@@ -16,42 +16,47 @@
 #include <google/protobuf/port_def.inc>
 
 PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
 namespace TransCatSerial {
-constexpr Point::Point(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : x_(0)
-  , y_(0){}
+PROTOBUF_CONSTEXPR Point::Point(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct PointDefaultTypeInternal {
-  constexpr PointDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR PointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~PointDefaultTypeInternal() {}
   union {
     Point _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PointDefaultTypeInternal _Point_default_instance_;
-constexpr Color::Color(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : color_name_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , encoding_type_(0)
-
-  , red_(0u)
-  , green_(0u)
-  , blue_(0u)
-  , opacity_(0){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PointDefaultTypeInternal _Point_default_instance_;
+PROTOBUF_CONSTEXPR Color::Color(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.color_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.encoding_type_)*/0
+  , /*decltype(_impl_.red_)*/0u
+  , /*decltype(_impl_.green_)*/0u
+  , /*decltype(_impl_.blue_)*/0u
+  , /*decltype(_impl_.opacity_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct ColorDefaultTypeInternal {
-  constexpr ColorDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR ColorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~ColorDefaultTypeInternal() {}
   union {
     Color _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ColorDefaultTypeInternal _Color_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ColorDefaultTypeInternal _Color_default_instance_;
 }  // namespace TransCatSerial
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_svg_2eproto[2];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_svg_2eproto[1];
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_svg_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_svg_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_svg_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_svg_2eproto = nullptr;
 
 const uint32_t TableStruct_svg_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
@@ -60,29 +65,29 @@ const uint32_t TableStruct_svg_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(prot
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Point, x_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Point, y_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Point, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Point, _impl_.y_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::Color, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Color, encoding_type_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Color, red_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Color, green_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Color, blue_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Color, opacity_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Color, color_name_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Color, _impl_.encoding_type_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Color, _impl_.red_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Color, _impl_.green_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Color, _impl_.blue_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Color, _impl_.opacity_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Color, _impl_.color_name_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::TransCatSerial::Point)},
   { 8, -1, -1, sizeof(::TransCatSerial::Color)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_Point_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_Color_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::TransCatSerial::_Point_default_instance_._instance,
+  &::TransCatSerial::_Color_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_svg_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -96,19 +101,21 @@ const char descriptor_table_protodef_svg_2eproto[] PROTOBUF_SECTION_VARIABLE(pro
   "\021\n\rCOLORTYPE_RGB\020\002\022\022\n\016COLORTYPE_RGBA\020\003b\006"
   "proto3"
   ;
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_svg_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_svg_2eproto = {
-  false, false, 326, descriptor_table_protodef_svg_2eproto, "svg.proto", 
-  &descriptor_table_svg_2eproto_once, nullptr, 0, 2,
-  schemas, file_default_instances, TableStruct_svg_2eproto::offsets,
-  file_level_metadata_svg_2eproto, file_level_enum_descriptors_svg_2eproto, file_level_service_descriptors_svg_2eproto,
+static ::_pbi::once_flag descriptor_table_svg_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_svg_2eproto = {
+    false, false, 326, descriptor_table_protodef_svg_2eproto,
+    "svg.proto",
+    &descriptor_table_svg_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_svg_2eproto::offsets,
+    file_level_metadata_svg_2eproto, file_level_enum_descriptors_svg_2eproto,
+    file_level_service_descriptors_svg_2eproto,
 };
-PROTOBUF_ATTRIBUTE_WEAK const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable* descriptor_table_svg_2eproto_getter() {
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_svg_2eproto_getter() {
   return &descriptor_table_svg_2eproto;
 }
 
 // Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY static ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptorsRunner dynamic_init_dummy_svg_2eproto(&descriptor_table_svg_2eproto);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_svg_2eproto(&descriptor_table_svg_2eproto);
 namespace TransCatSerial {
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Color_ColorEncodingType_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_svg_2eproto);
@@ -145,47 +152,50 @@ class Point::_Internal {
 Point::Point(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.Point)
 }
 Point::Point(const Point& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Point* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&x_, &from.x_,
-    static_cast<size_t>(reinterpret_cast<char*>(&y_) -
-    reinterpret_cast<char*>(&x_)) + sizeof(y_));
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.y_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.Point)
 }
 
-inline void Point::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&x_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&y_) -
-    reinterpret_cast<char*>(&x_)) + sizeof(y_));
+inline void Point::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Point::~Point() {
   // @@protoc_insertion_point(destructor:TransCatSerial.Point)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void Point::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void Point::ArenaDtor(void* object) {
-  Point* _this = reinterpret_cast< Point* >(object);
-  (void)_this;
-}
-void Point::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Point::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void Point::Clear() {
@@ -194,22 +204,22 @@ void Point::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&y_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(y_));
+  ::memset(&_impl_.x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.y_) -
+      reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Point::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Point::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // double x = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
-          x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -217,7 +227,7 @@ const char* Point::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inte
       // double y = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
-          y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -258,7 +268,7 @@ uint8_t* Point::_InternalSerialize(
   memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
   if (raw_x != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(1, this->_internal_x(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_x(), target);
   }
 
   // double y = 2;
@@ -268,11 +278,11 @@ uint8_t* Point::_InternalSerialize(
   memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
   if (raw_y != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_y(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_y(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.Point)
@@ -305,25 +315,21 @@ size_t Point::ByteSizeLong() const {
     total_size += 1 + 8;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Point::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     Point::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Point::GetClassData() const { return &_class_data_; }
 
-void Point::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Point *>(to)->MergeFrom(
-      static_cast<const Point &>(from));
-}
 
-
-void Point::MergeFrom(const Point& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.Point)
-  GOOGLE_DCHECK_NE(&from, this);
+void Point::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Point*>(&to_msg);
+  auto& from = static_cast<const Point&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.Point)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -332,16 +338,16 @@ void Point::MergeFrom(const Point& from) {
   uint64_t raw_x;
   memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
   if (raw_x != 0) {
-    _internal_set_x(from._internal_x());
+    _this->_internal_set_x(from._internal_x());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_y = from._internal_y();
   uint64_t raw_y;
   memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
   if (raw_y != 0) {
-    _internal_set_y(from._internal_y());
+    _this->_internal_set_y(from._internal_y());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Point::CopyFrom(const Point& from) {
@@ -359,15 +365,15 @@ void Point::InternalSwap(Point* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Point, y_)
-      + sizeof(Point::y_)
-      - PROTOBUF_FIELD_OFFSET(Point, x_)>(
-          reinterpret_cast<char*>(&x_),
-          reinterpret_cast<char*>(&other->x_));
+      PROTOBUF_FIELD_OFFSET(Point, _impl_.y_)
+      + sizeof(Point::_impl_.y_)
+      - PROTOBUF_FIELD_OFFSET(Point, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Point::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_svg_2eproto_getter, &descriptor_table_svg_2eproto_once,
       file_level_metadata_svg_2eproto[0]);
 }
@@ -381,60 +387,71 @@ class Color::_Internal {
 Color::Color(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.Color)
 }
 Color::Color(const Color& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Color* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.color_name_){}
+    , decltype(_impl_.encoding_type_){}
+    , decltype(_impl_.red_){}
+    , decltype(_impl_.green_){}
+    , decltype(_impl_.blue_){}
+    , decltype(_impl_.opacity_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  color_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.color_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    color_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.color_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_color_name().empty()) {
-    color_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_color_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.color_name_.Set(from._internal_color_name(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&encoding_type_, &from.encoding_type_,
-    static_cast<size_t>(reinterpret_cast<char*>(&opacity_) -
-    reinterpret_cast<char*>(&encoding_type_)) + sizeof(opacity_));
+  ::memcpy(&_impl_.encoding_type_, &from._impl_.encoding_type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.opacity_) -
+    reinterpret_cast<char*>(&_impl_.encoding_type_)) + sizeof(_impl_.opacity_));
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.Color)
 }
 
-inline void Color::SharedCtor() {
-color_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  color_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&encoding_type_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&opacity_) -
-    reinterpret_cast<char*>(&encoding_type_)) + sizeof(opacity_));
+inline void Color::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.color_name_){}
+    , decltype(_impl_.encoding_type_){0}
+    , decltype(_impl_.red_){0u}
+    , decltype(_impl_.green_){0u}
+    , decltype(_impl_.blue_){0u}
+    , decltype(_impl_.opacity_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.color_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.color_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Color::~Color() {
   // @@protoc_insertion_point(destructor:TransCatSerial.Color)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void Color::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  color_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.color_name_.Destroy();
 }
 
-void Color::ArenaDtor(void* object) {
-  Color* _this = reinterpret_cast< Color* >(object);
-  (void)_this;
-}
-void Color::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Color::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void Color::Clear() {
@@ -443,18 +460,18 @@ void Color::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  color_name_.ClearToEmpty();
-  ::memset(&encoding_type_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&opacity_) -
-      reinterpret_cast<char*>(&encoding_type_)) + sizeof(opacity_));
+  _impl_.color_name_.ClearToEmpty();
+  ::memset(&_impl_.encoding_type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.opacity_) -
+      reinterpret_cast<char*>(&_impl_.encoding_type_)) + sizeof(_impl_.opacity_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Color::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Color::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .TransCatSerial.Color.ColorEncodingType encoding_type = 1;
       case 1:
@@ -468,7 +485,7 @@ const char* Color::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inte
       // uint32 red = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          red_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.red_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -476,7 +493,7 @@ const char* Color::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inte
       // uint32 green = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          green_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.green_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -484,7 +501,7 @@ const char* Color::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inte
       // uint32 blue = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          blue_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.blue_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -492,7 +509,7 @@ const char* Color::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inte
       // double opacity = 5;
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
-          opacity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.opacity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -501,7 +518,7 @@ const char* Color::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inte
       case 6:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
           auto str = _internal_mutable_color_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -538,26 +555,26 @@ uint8_t* Color::_InternalSerialize(
   // .TransCatSerial.Color.ColorEncodingType encoding_type = 1;
   if (this->_internal_encoding_type() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       1, this->_internal_encoding_type(), target);
   }
 
   // uint32 red = 2;
   if (this->_internal_red() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_red(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_red(), target);
   }
 
   // uint32 green = 3;
   if (this->_internal_green() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_green(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_green(), target);
   }
 
   // uint32 blue = 4;
   if (this->_internal_blue() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_blue(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_blue(), target);
   }
 
   // double opacity = 5;
@@ -567,7 +584,7 @@ uint8_t* Color::_InternalSerialize(
   memcpy(&raw_opacity, &tmp_opacity, sizeof(tmp_opacity));
   if (raw_opacity != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(5, this->_internal_opacity(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_opacity(), target);
   }
 
   // bytes color_name = 6;
@@ -577,7 +594,7 @@ uint8_t* Color::_InternalSerialize(
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.Color)
@@ -602,22 +619,22 @@ size_t Color::ByteSizeLong() const {
   // .TransCatSerial.Color.ColorEncodingType encoding_type = 1;
   if (this->_internal_encoding_type() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_encoding_type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_encoding_type());
   }
 
   // uint32 red = 2;
   if (this->_internal_red() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32SizePlusOne(this->_internal_red());
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_red());
   }
 
   // uint32 green = 3;
   if (this->_internal_green() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32SizePlusOne(this->_internal_green());
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_green());
   }
 
   // uint32 blue = 4;
   if (this->_internal_blue() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32SizePlusOne(this->_internal_blue());
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_blue());
   }
 
   // double opacity = 5;
@@ -629,51 +646,47 @@ size_t Color::ByteSizeLong() const {
     total_size += 1 + 8;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Color::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     Color::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Color::GetClassData() const { return &_class_data_; }
 
-void Color::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Color *>(to)->MergeFrom(
-      static_cast<const Color &>(from));
-}
 
-
-void Color::MergeFrom(const Color& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.Color)
-  GOOGLE_DCHECK_NE(&from, this);
+void Color::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Color*>(&to_msg);
+  auto& from = static_cast<const Color&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.Color)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_color_name().empty()) {
-    _internal_set_color_name(from._internal_color_name());
+    _this->_internal_set_color_name(from._internal_color_name());
   }
   if (from._internal_encoding_type() != 0) {
-    _internal_set_encoding_type(from._internal_encoding_type());
+    _this->_internal_set_encoding_type(from._internal_encoding_type());
   }
   if (from._internal_red() != 0) {
-    _internal_set_red(from._internal_red());
+    _this->_internal_set_red(from._internal_red());
   }
   if (from._internal_green() != 0) {
-    _internal_set_green(from._internal_green());
+    _this->_internal_set_green(from._internal_green());
   }
   if (from._internal_blue() != 0) {
-    _internal_set_blue(from._internal_blue());
+    _this->_internal_set_blue(from._internal_blue());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_opacity = from._internal_opacity();
   uint64_t raw_opacity;
   memcpy(&raw_opacity, &tmp_opacity, sizeof(tmp_opacity));
   if (raw_opacity != 0) {
-    _internal_set_opacity(from._internal_opacity());
+    _this->_internal_set_opacity(from._internal_opacity());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Color::CopyFrom(const Color& from) {
@@ -693,20 +706,19 @@ void Color::InternalSwap(Color* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &color_name_, lhs_arena,
-      &other->color_name_, rhs_arena
+      &_impl_.color_name_, lhs_arena,
+      &other->_impl_.color_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Color, opacity_)
-      + sizeof(Color::opacity_)
-      - PROTOBUF_FIELD_OFFSET(Color, encoding_type_)>(
-          reinterpret_cast<char*>(&encoding_type_),
-          reinterpret_cast<char*>(&other->encoding_type_));
+      PROTOBUF_FIELD_OFFSET(Color, _impl_.opacity_)
+      + sizeof(Color::_impl_.opacity_)
+      - PROTOBUF_FIELD_OFFSET(Color, _impl_.encoding_type_)>(
+          reinterpret_cast<char*>(&_impl_.encoding_type_),
+          reinterpret_cast<char*>(&other->_impl_.encoding_type_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Color::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_svg_2eproto_getter, &descriptor_table_svg_2eproto_once,
       file_level_metadata_svg_2eproto[1]);
 }
@@ -714,10 +726,12 @@ void Color::InternalSwap(Color* other) {
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace TransCatSerial
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::TransCatSerial::Point* Arena::CreateMaybeMessage< ::TransCatSerial::Point >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::Point*
+Arena::CreateMaybeMessage< ::TransCatSerial::Point >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::Point >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::Color* Arena::CreateMaybeMessage< ::TransCatSerial::Color >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::Color*
+Arena::CreateMaybeMessage< ::TransCatSerial::Color >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::Color >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3019000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3019003 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -43,14 +42,6 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_svg_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[2]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
   static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_svg_2eproto;
@@ -102,7 +93,7 @@ class Point final :
  public:
   inline Point() : Point(nullptr) {}
   ~Point() override;
-  explicit constexpr Point(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR Point(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Point(const Point& from);
   Point(Point&& from) noexcept
@@ -177,9 +168,11 @@ class Point final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Point& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Point& from);
+  void MergeFrom( const Point& from) {
+    Point::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -188,10 +181,10 @@ class Point final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Point* other);
@@ -204,9 +197,6 @@ class Point final :
   protected:
   explicit Point(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -247,9 +237,12 @@ class Point final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  double x_;
-  double y_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    double x_;
+    double y_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_svg_2eproto;
 };
 // -------------------------------------------------------------------
@@ -259,7 +252,7 @@ class Color final :
  public:
   inline Color() : Color(nullptr) {}
   ~Color() override;
-  explicit constexpr Color(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR Color(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Color(const Color& from);
   Color(Color&& from) noexcept
@@ -334,9 +327,11 @@ class Color final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Color& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Color& from);
+  void MergeFrom( const Color& from) {
+    Color::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -345,10 +340,10 @@ class Color final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Color* other);
@@ -361,9 +356,6 @@ class Color final :
   protected:
   explicit Color(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -483,13 +475,16 @@ class Color final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr color_name_;
-  int encoding_type_;
-  uint32_t red_;
-  uint32_t green_;
-  uint32_t blue_;
-  double opacity_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr color_name_;
+    int encoding_type_;
+    uint32_t red_;
+    uint32_t green_;
+    uint32_t blue_;
+    double opacity_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_svg_2eproto;
 };
 // ===================================================================
@@ -505,10 +500,10 @@ class Color final :
 
 // double x = 1;
 inline void Point::clear_x() {
-  x_ = 0;
+  _impl_.x_ = 0;
 }
 inline double Point::_internal_x() const {
-  return x_;
+  return _impl_.x_;
 }
 inline double Point::x() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Point.x)
@@ -516,7 +511,7 @@ inline double Point::x() const {
 }
 inline void Point::_internal_set_x(double value) {
   
-  x_ = value;
+  _impl_.x_ = value;
 }
 inline void Point::set_x(double value) {
   _internal_set_x(value);
@@ -525,10 +520,10 @@ inline void Point::set_x(double value) {
 
 // double y = 2;
 inline void Point::clear_y() {
-  y_ = 0;
+  _impl_.y_ = 0;
 }
 inline double Point::_internal_y() const {
-  return y_;
+  return _impl_.y_;
 }
 inline double Point::y() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Point.y)
@@ -536,7 +531,7 @@ inline double Point::y() const {
 }
 inline void Point::_internal_set_y(double value) {
   
-  y_ = value;
+  _impl_.y_ = value;
 }
 inline void Point::set_y(double value) {
   _internal_set_y(value);
@@ -549,10 +544,10 @@ inline void Point::set_y(double value) {
 
 // .TransCatSerial.Color.ColorEncodingType encoding_type = 1;
 inline void Color::clear_encoding_type() {
-  encoding_type_ = 0;
+  _impl_.encoding_type_ = 0;
 }
 inline ::TransCatSerial::Color_ColorEncodingType Color::_internal_encoding_type() const {
-  return static_cast< ::TransCatSerial::Color_ColorEncodingType >(encoding_type_);
+  return static_cast< ::TransCatSerial::Color_ColorEncodingType >(_impl_.encoding_type_);
 }
 inline ::TransCatSerial::Color_ColorEncodingType Color::encoding_type() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Color.encoding_type)
@@ -560,7 +555,7 @@ inline ::TransCatSerial::Color_ColorEncodingType Color::encoding_type() const {
 }
 inline void Color::_internal_set_encoding_type(::TransCatSerial::Color_ColorEncodingType value) {
   
-  encoding_type_ = value;
+  _impl_.encoding_type_ = value;
 }
 inline void Color::set_encoding_type(::TransCatSerial::Color_ColorEncodingType value) {
   _internal_set_encoding_type(value);
@@ -569,10 +564,10 @@ inline void Color::set_encoding_type(::TransCatSerial::Color_ColorEncodingType v
 
 // uint32 red = 2;
 inline void Color::clear_red() {
-  red_ = 0u;
+  _impl_.red_ = 0u;
 }
 inline uint32_t Color::_internal_red() const {
-  return red_;
+  return _impl_.red_;
 }
 inline uint32_t Color::red() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Color.red)
@@ -580,7 +575,7 @@ inline uint32_t Color::red() const {
 }
 inline void Color::_internal_set_red(uint32_t value) {
   
-  red_ = value;
+  _impl_.red_ = value;
 }
 inline void Color::set_red(uint32_t value) {
   _internal_set_red(value);
@@ -589,10 +584,10 @@ inline void Color::set_red(uint32_t value) {
 
 // uint32 green = 3;
 inline void Color::clear_green() {
-  green_ = 0u;
+  _impl_.green_ = 0u;
 }
 inline uint32_t Color::_internal_green() const {
-  return green_;
+  return _impl_.green_;
 }
 inline uint32_t Color::green() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Color.green)
@@ -600,7 +595,7 @@ inline uint32_t Color::green() const {
 }
 inline void Color::_internal_set_green(uint32_t value) {
   
-  green_ = value;
+  _impl_.green_ = value;
 }
 inline void Color::set_green(uint32_t value) {
   _internal_set_green(value);
@@ -609,10 +604,10 @@ inline void Color::set_green(uint32_t value) {
 
 // uint32 blue = 4;
 inline void Color::clear_blue() {
-  blue_ = 0u;
+  _impl_.blue_ = 0u;
 }
 inline uint32_t Color::_internal_blue() const {
-  return blue_;
+  return _impl_.blue_;
 }
 inline uint32_t Color::blue() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Color.blue)
@@ -620,7 +615,7 @@ inline uint32_t Color::blue() const {
 }
 inline void Color::_internal_set_blue(uint32_t value) {
   
-  blue_ = value;
+  _impl_.blue_ = value;
 }
 inline void Color::set_blue(uint32_t value) {
   _internal_set_blue(value);
@@ -629,10 +624,10 @@ inline void Color::set_blue(uint32_t value) {
 
 // double opacity = 5;
 inline void Color::clear_opacity() {
-  opacity_ = 0;
+  _impl_.opacity_ = 0;
 }
 inline double Color::_internal_opacity() const {
-  return opacity_;
+  return _impl_.opacity_;
 }
 inline double Color::opacity() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Color.opacity)
@@ -640,7 +635,7 @@ inline double Color::opacity() const {
 }
 inline void Color::_internal_set_opacity(double value) {
   
-  opacity_ = value;
+  _impl_.opacity_ = value;
 }
 inline void Color::set_opacity(double value) {
   _internal_set_opacity(value);
@@ -649,7 +644,7 @@ inline void Color::set_opacity(double value) {
 
 // bytes color_name = 6;
 inline void Color::clear_color_name() {
-  color_name_.ClearToEmpty();
+  _impl_.color_name_.ClearToEmpty();
 }
 inline const std::string& Color::color_name() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Color.color_name)
@@ -659,7 +654,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Color::set_color_name(ArgT0&& arg0, ArgT... args) {
  
- color_name_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.color_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:TransCatSerial.Color.color_name)
 }
 inline std::string* Color::mutable_color_name() {
@@ -668,19 +663,19 @@ inline std::string* Color::mutable_color_name() {
   return _s;
 }
 inline const std::string& Color::_internal_color_name() const {
-  return color_name_.Get();
+  return _impl_.color_name_.Get();
 }
 inline void Color::_internal_set_color_name(const std::string& value) {
   
-  color_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.color_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Color::_internal_mutable_color_name() {
   
-  return color_name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.color_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Color::release_color_name() {
   // @@protoc_insertion_point(field_release:TransCatSerial.Color.color_name)
-  return color_name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.color_name_.Release();
 }
 inline void Color::set_allocated_color_name(std::string* color_name) {
   if (color_name != nullptr) {
@@ -688,11 +683,10 @@ inline void Color::set_allocated_color_name(std::string* color_name) {
   } else {
     
   }
-  color_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), color_name,
-      GetArenaForAllocation());
+  _impl_.color_name_.SetAllocated(color_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (color_name_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    color_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.color_name_.IsDefault()) {
+    _impl_.color_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.Color.color_name)
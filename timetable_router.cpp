@@ -0,0 +1,234 @@
+
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <stdexcept>
+
+#include "domain.h"
+#include "timetable_router.h"
+#include "transport_catalogue.h"
+#include "stats.h"
+
+using namespace transport;
+using namespace std;
+
+namespace router
+{
+    // Метки всех раундов хранятся подряд: метки раунда k - labels[k * stop_count..(k + 1) * stop_count).
+    // После поиска в исходное состояние возвращаются только изменённые элементы массивов.
+    struct TimetableRouter::SearchState
+    {
+        size_t stop_count = 0;
+        vector<Label> labels;
+        vector<size_t> changed_labels;
+        vector<double> best_arrivals; // Наиболее раннее прибытие на остановку в любом из раундов
+        vector<uint32_t> reached_stops;
+        vector<bool> is_marked;       // Время прибытия на остановку улучшено в последнем раунде
+        vector<uint32_t> marked_stops;
+        vector<uint32_t> route_positions; // Позиция, с которой просматривается направление в текущем раунде
+        vector<uint32_t> queued_routes;
+
+        void Prepare(size_t stops, size_t routes)
+        {
+            stop_count = stops;
+            if (best_arrivals.size() < stops)
+            {
+                best_arrivals.resize(stops, NO_TIME);
+                is_marked.resize(stops, false);
+            }
+            if (route_positions.size() < routes)
+                route_positions.resize(routes, NO_POSITION);
+        }
+
+        void PrepareRound(size_t round)
+        {
+            if (labels.size() < (round + 1) * stop_count)
+                labels.resize((round + 1) * stop_count);
+        }
+
+        Label& GetLabel(size_t round, uint32_t stop_id)
+        {
+            return labels[round * stop_count + stop_id];
+        }
+
+        void SetLabel(size_t round, uint32_t stop_id, const Label& label)
+        {
+            GetLabel(round, stop_id) = label;
+            changed_labels.push_back(round * stop_count + stop_id);
+            if (best_arrivals[stop_id] == NO_TIME)
+                reached_stops.push_back(stop_id);
+            best_arrivals[stop_id] = label.arrival_time;
+            if (!is_marked[stop_id])
+            {
+                is_marked[stop_id] = true;
+                marked_stops.push_back(stop_id);
+            }
+        }
+
+        void Reset()
+        {
+            for (const size_t label_index : changed_labels)
+                labels[label_index] = Label();
+            changed_labels.clear();
+            for (const uint32_t stop_id : reached_stops)
+                best_arrivals[stop_id] = NO_TIME;
+            reached_stops.clear();
+            for (const uint32_t stop_id : marked_stops)
+                is_marked[stop_id] = false;
+            marked_stops.clear();
+        }
+    };
+
+    TimetableRouter::TimetableRouter(const TransportCatalogue& tc, const vector<double>& bus_velocities)
+    {
+        stats::ScopedTimer timer("timetable_construction"sv);
+        const TCCommonMetric metric = tc.GetCommonMetric();
+        vector<uint32_t> stop_ids;
+        vector<double> offsets;
+        for (uint32_t bus_id = 0; bus_id < metric.buses_count; ++bus_id)
+        {
+            const TransportCatalogue::DeparturesRange departures = tc.GetBusDepartures(bus_id);
+            const TransportCatalogue::StopIdsRange bus_stop_ids = tc.GetBusStopIds(bus_id);
+            if (departures.begin() == departures.end() || bus_stop_ids.end() - bus_stop_ids.begin() < 2)
+                continue;
+            const BusDistanceTable& dist_table = tc.GetBusDistanceTable(bus_id);
+            const double meters_per_minute = bus_velocities[bus_id] * 1000.0 / 60.0;
+            const size_t stop_count = bus_stop_ids.end() - bus_stop_ids.begin();
+
+            stop_ids.assign(bus_stop_ids.begin(), bus_stop_ids.end());
+            offsets.clear();
+            for (size_t i = 0; i < stop_count; ++i)
+                offsets.push_back(dist_table.ForwardRoadDistance(0, i) / meters_per_minute);
+            AddRoute(bus_id, stop_ids, offsets, departures);
+
+            if (tc.GetBusType(bus_id) == BusType::BUSTYPE_ORDINAR)
+            { // Обратное направление некольцевого маршрута отправляется с последней остановки по тому же расписанию.
+                reverse(stop_ids.begin(), stop_ids.end());
+                for (size_t i = 0; i < stop_count; ++i)
+                    offsets[i] = dist_table.BackwardRoadDistance(stop_count - 1, stop_count - 1 - i) / meters_per_minute;
+                AddRoute(bus_id, stop_ids, offsets, departures);
+            }
+        }
+        BuildStopRoutes(metric.stops_count);
+    }
+
+    void TimetableRouter::AddRoute(uint32_t bus_id, const vector<uint32_t>& stop_ids, const vector<double>& offsets,
+                                   TransportCatalogue::DeparturesRange departures)
+    {
+        routes_.push_back({bus_id, static_cast<uint32_t>(route_stops_.size()), static_cast<uint32_t>(stop_ids.size()),
+                           static_cast<uint32_t>(trip_departures_.size()),
+                           static_cast<uint32_t>(departures.end() - departures.begin())});
+        route_stops_.insert(route_stops_.end(), stop_ids.begin(), stop_ids.end());
+        stop_offsets_.insert(stop_offsets_.end(), offsets.begin(), offsets.end());
+        trip_departures_.insert(trip_departures_.end(), departures.begin(), departures.end());
+    }
+
+    void TimetableRouter::BuildStopRoutes(size_t stop_count)
+    {
+        stop_routes_offsets_.assign(stop_count + 1, 0);
+        for (const uint32_t stop_id : route_stops_)
+            ++stop_routes_offsets_[stop_id + 1];
+        for (size_t i = 1; i < stop_routes_offsets_.size(); ++i)
+            stop_routes_offsets_[i] += stop_routes_offsets_[i - 1];
+        stop_routes_.resize(route_stops_.size());
+        vector<uint32_t> stop_routes_pos(stop_routes_offsets_.begin(), stop_routes_offsets_.end() - 1);
+        for (uint32_t route_id = 0; route_id < routes_.size(); ++route_id)
+            for (uint32_t position = 0; position < routes_[route_id].stop_count; ++position)
+            {
+                const uint32_t stop_id = route_stops_[routes_[route_id].stops_begin + position];
+                stop_routes_[stop_routes_pos[stop_id]++] = {route_id, position};
+            }
+    }
+
+    optional<TimetableRouter::Journey> TimetableRouter::FindEarliestArrival(uint32_t from_stop_id, uint32_t to_stop_id,
+                                                                           double departure_time) const
+    {
+        const size_t stop_count = stop_routes_offsets_.size() - 1;
+        if (from_stop_id >= stop_count || to_stop_id >= stop_count)
+            throw out_of_range("Invalid route stop");
+        thread_local SearchState state;
+        state.Prepare(stop_count, routes_.size());
+        state.PrepareRound(0);
+        state.SetLabel(0, from_stop_id, {departure_time});
+
+        size_t last_round = 0;
+        for (size_t round = 1; !state.marked_stops.empty(); ++round)
+        {
+            // Направления, проходящие через улучшенные в прошлом раунде остановки, просматриваются
+            // от самой ранней из таких остановок.
+            for (const uint32_t stop_id : state.marked_stops)
+            {
+                state.is_marked[stop_id] = false;
+                for (uint32_t i = stop_routes_offsets_[stop_id]; i < stop_routes_offsets_[stop_id + 1]; ++i)
+                {
+                    const StopRoute& stop_route = stop_routes_[i];
+                    uint32_t& route_position = state.route_positions[stop_route.route_id];
+                    if (route_position == NO_POSITION)
+                        state.queued_routes.push_back(stop_route.route_id);
+                    route_position = min(route_position, stop_route.position);
+                }
+            }
+            state.marked_stops.clear();
+            state.PrepareRound(round);
+
+            for (const uint32_t route_id : state.queued_routes)
+            {
+                const Route& route = routes_[route_id];
+                const double* departures = trip_departures_.data() + route.trips_begin;
+                uint32_t trip = NO_POSITION, board_position = NO_POSITION;
+                for (uint32_t position = state.route_positions[route_id]; position < route.stop_count; ++position)
+                {
+                    const uint32_t stop_id = route_stops_[route.stops_begin + position];
+                    const double offset = stop_offsets_[route.stops_begin + position];
+                    const double trip_time = trip != NO_POSITION ? departures[trip] + offset : NO_TIME;
+                    // Прибытие текущим рейсом засчитывается, только если оно раньше уже известного прибытия
+                    // на эту остановку и на конечную.
+                    if (trip_time < state.best_arrivals[stop_id] && trip_time < state.best_arrivals[to_stop_id])
+                        state.SetLabel(round, stop_id, {trip_time, route_id, trip, board_position, position});
+                    // Если на остановку удалось попасть в прошлом раунде не позже текущего рейса, можно пересесть
+                    // на более ранний рейс.
+                    const double prev_arrival = state.GetLabel(round - 1, stop_id).arrival_time;
+                    if (prev_arrival != NO_TIME && prev_arrival <= trip_time)
+                    {
+                        uint32_t earliest_trip = static_cast<uint32_t>(
+                            lower_bound(departures, departures + route.trip_count, prev_arrival - offset) - departures);
+                        while (earliest_trip < route.trip_count && departures[earliest_trip] + offset < prev_arrival)
+                            ++earliest_trip;
+                        if (earliest_trip < route.trip_count && earliest_trip < trip)
+                        {
+                            trip = earliest_trip;
+                            board_position = position;
+                        }
+                    }
+                }
+                state.route_positions[route_id] = NO_POSITION;
+            }
+            state.queued_routes.clear();
+            if (state.GetLabel(round, to_stop_id).arrival_time != NO_TIME)
+                last_round = round;
+        }
+
+        optional<Journey> result;
+        if (state.best_arrivals[to_stop_id] != NO_TIME)
+        {
+            // Раунд, в котором последний раз улучшено прибытие на конечную остановку, даёт наиболее раннее
+            // прибытие. Маршрут восстанавливается от конца, по одной поездке на раунд.
+            result = Journey{departure_time, state.best_arrivals[to_stop_id], {}};
+            uint32_t stop_id = to_stop_id;
+            for (size_t round = last_round; round > 0; --round)
+            {
+                const Label& label = state.GetLabel(round, stop_id);
+                const Route& route = routes_[label.route_id];
+                const uint32_t board_stop_id = route_stops_[route.stops_begin + label.board_position];
+                result->legs.push_back({route.bus_id, board_stop_id, stop_id, label.alight_position - label.board_position,
+                                        trip_departures_[route.trips_begin + label.trip] +
+                                        stop_offsets_[route.stops_begin + label.board_position],
+                                        label.arrival_time});
+                stop_id = board_stop_id;
+            }
+            reverse(result->legs.begin(), result->legs.end());
+        }
+        state.Reset();
+        return result;
+    }
+} // namespace router
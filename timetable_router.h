@@ -0,0 +1,103 @@
+#pragma once
+
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include <limits>
+
+#include "transport_catalogue.h"
+
+namespace router
+{
+    // Маршрутизатор по расписаниям автобусов. В отличие от маршрутизирующего графа BusRouter, где каждая посадка
+    // стоит фиксированного времени ожидания, ожидание здесь определяется временами отправления рейсов, а ищется
+    // маршрут с наиболее ранним прибытием при отправлении в заданный момент. Поиск ведётся алгоритмом RAPTOR:
+    // в раунде k находятся времена прибытия на остановки не более чем с k поездками, и каждый маршрут
+    // просматривается за раунд один раз, от самой ранней остановки, на которую удалось попасть в прошлом раунде.
+    // Маршруты без расписания в поиске не участвуют. Все данные хранятся в плоских массивах.
+    class TimetableRouter
+    {
+    public:
+        // Поездка на одном рейсе от остановки посадки до остановки высадки
+        struct Leg
+        {
+            uint32_t bus_id;
+            uint32_t board_stop_id;
+            uint32_t alight_stop_id;
+            uint32_t span_count;
+            double departure_time;
+            double arrival_time;
+        };
+
+        struct Journey
+        {
+            double departure_time; // Момент отправления, заданный при поиске
+            double arrival_time;
+            std::vector<Leg> legs;
+        };
+
+        // bus_velocities - скорости автобусов в км/ч, индексированные номерами маршрутов справочника: по ним
+        // рассчитывается время в пути от первой остановки рейса.
+        TimetableRouter(const transport::TransportCatalogue& tc, const std::vector<double>& bus_velocities);
+
+        // Маршрут с наиболее ранним прибытием из остановки from в остановку to при отправлении в момент
+        // departure_time (в минутах от начала суток), а из равных по времени прибытия - с наименьшим числом
+        // поездок. nullopt - до to не добраться.
+        std::optional<Journey> FindEarliestArrival(uint32_t from_stop_id, uint32_t to_stop_id,
+                                                   double departure_time) const;
+
+        size_t GetTripCount() const
+        {
+            return trip_departures_.size();
+        }
+
+    private:
+        static constexpr uint32_t NO_POSITION = std::numeric_limits<uint32_t>::max();
+        static constexpr double NO_TIME = std::numeric_limits<double>::infinity();
+
+        // Одно направление маршрута автобуса. Скорость автобусов маршрута постоянна, поэтому рейсы направления друг
+        // друга не обгоняют, а время рейса на остановке - это время его отправления плюс общее для всех рейсов
+        // время в пути до остановки.
+        struct Route
+        {
+            uint32_t bus_id;
+            uint32_t stops_begin; // Остановки - route_stops_[stops_begin..stops_begin + stop_count), время в пути
+            uint32_t stop_count;  // до них - stop_offsets_ с теми же индексами
+            uint32_t trips_begin; // Отправления рейсов по возрастанию - trip_departures_[trips_begin..trips_begin + trip_count)
+            uint32_t trip_count;
+        };
+
+        // Позиция остановки в последовательности остановок направления
+        struct StopRoute
+        {
+            uint32_t route_id;
+            uint32_t position;
+        };
+
+        // Метка остановки в раунде: наиболее раннее время прибытия и последняя поездка маршрута, по которому оно достигнуто.
+        struct Label
+        {
+            double arrival_time = NO_TIME;
+            uint32_t route_id = NO_POSITION;
+            uint32_t trip = NO_POSITION;
+            uint32_t board_position = NO_POSITION;
+            uint32_t alight_position = NO_POSITION;
+        };
+
+        // Состояние поиска, выделяемое один раз на поток
+        struct SearchState;
+
+        std::vector<Route> routes_;
+        std::vector<uint32_t> route_stops_;
+        std::vector<double> stop_offsets_;
+        std::vector<double> trip_departures_;
+        // Направления, проходящие через остановку, в формате CSR: для остановки i -
+        // stop_routes_[stop_routes_offsets_[i]..stop_routes_offsets_[i + 1])
+        std::vector<uint32_t> stop_routes_offsets_;
+        std::vector<StopRoute> stop_routes_;
+
+        void AddRoute(uint32_t bus_id, const std::vector<uint32_t>& stop_ids, const std::vector<double>& offsets,
+                      transport::TransportCatalogue::DeparturesRange departures);
+        void BuildStopRoutes(size_t stop_count);
+    };
+} // namespace router
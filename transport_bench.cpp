@@ -0,0 +1,497 @@
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <set>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+
+#include "json.h"
+#include "json_reader.h"
+#include "base_snapshot.h"
+#include "transport_catalogue.h"
+#include "transport_router.h"
+
+using namespace std;
+using namespace std::literals;
+
+// Стенд для замера производительности справочника. Строит детерминированную синтетическую
+// транспортную сеть с заданными параметрами, проводит её через все стадии работы справочника
+// и выводит время каждой стадии в виде JSON-документа, пригодного для отслеживания регрессий.
+
+namespace bench
+{
+    struct BenchParams
+    {
+        int stops = 1000;
+        int buses = 100;
+        int stops_per_bus = 20;
+        double distance_density = 0.7; // Доля участков маршрутов с явно заданным расстоянием по дорогам
+        uint64_t seed = 1;
+        int routes = 1000;
+        int lookups = 1000;   // Количество запросов "Bus" и, отдельно, "Stop"
+        int maps = 1;
+        int matrix_size = 100; // Число начальных и, отдельно, конечных остановок запроса "Matrix"
+        string base_file = "transport_bench.db"s;
+        string compression = "none"s;
+        string routing_algorithm = "matrix"s;
+        string dump_input;    // Файл для сохранения сгенерированного документа запросов
+        string output;        // Файл для вывода результатов (по умолчанию - стандартный вывод)
+        bool keep_base = false;
+    };
+
+    // Генератор псевдослучайных чисел splitmix64. Собственная реализация, в отличие от
+    // распределений стандартной библиотеки, даёт одинаковую последовательность на любой платформе.
+    class Random
+    {
+    public:
+        explicit Random(uint64_t seed) : state_(seed)
+        {}
+
+        uint64_t Next()
+        {
+            uint64_t z = (state_ += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        double Uniform(double lo, double hi)
+        {
+            return lo + (hi - lo) * static_cast<double>(Next() >> 11) * 0x1.0p-53;
+        }
+
+        size_t Index(size_t count)
+        {
+            return static_cast<size_t>(Next() % count);
+        }
+
+    private:
+        uint64_t state_;
+    };
+
+    string StopName(size_t stop_num)
+    {
+        return "Stop "s + to_string(stop_num);
+    }
+
+    string BusName(size_t bus_num)
+    {
+        return "Bus "s + to_string(bus_num);
+    }
+
+    // Синтетический город: остановки равномерно разбросаны по прямоугольнику, а маршрут
+    // строится как случайное блуждание по соседним ячейкам сетки, наложенной на город,
+    // так что соседние остановки маршрута оказываются недалеко друг от друга.
+    json::Node GenerateCity(const BenchParams& params)
+    {
+        constexpr double LAT_MIN = 55.55, LAT_MAX = 55.95, LNG_MIN = 37.35, LNG_MAX = 37.85;
+        Random random(params.seed);
+        const size_t stop_count = params.stops;
+
+        vector<pair<double, double>> coords(stop_count);
+        const size_t grid_size = max<size_t>(1, static_cast<size_t>(sqrt(stop_count / 4.0)));
+        vector<vector<size_t>> grid(grid_size * grid_size);
+        auto cell_of = [&](size_t stop_num)
+        {
+            const size_t row = min(grid_size - 1, static_cast<size_t>((coords[stop_num].first - LAT_MIN) /
+                                                                      (LAT_MAX - LAT_MIN) * grid_size));
+            const size_t col = min(grid_size - 1, static_cast<size_t>((coords[stop_num].second - LNG_MIN) /
+                                                                      (LNG_MAX - LNG_MIN) * grid_size));
+            return make_pair(row, col);
+        };
+        for (size_t stop_num = 0; stop_num < stop_count; ++stop_num)
+        {
+            coords[stop_num] = {random.Uniform(LAT_MIN, LAT_MAX), random.Uniform(LNG_MIN, LNG_MAX)};
+            auto [row, col] = cell_of(stop_num);
+            grid[row * grid_size + col].push_back(stop_num);
+        }
+
+        auto next_stop = [&](size_t stop_num)
+        {
+            auto [row, col] = cell_of(stop_num);
+            vector<size_t> candidates;
+            for (size_t r = row ? row - 1 : 0; r <= min(grid_size - 1, row + 1); ++r)
+                for (size_t c = col ? col - 1 : 0; c <= min(grid_size - 1, col + 1); ++c)
+                    for (size_t candidate : grid[r * grid_size + c])
+                        if (candidate != stop_num)
+                            candidates.push_back(candidate);
+            return candidates.empty() ? random.Index(stop_count) : candidates[random.Index(candidates.size())];
+        };
+
+        auto geo_distance = [&](size_t from, size_t to)
+        {
+            return detail::ComputeDistance(detail::Coordinates{coords[from].first, coords[from].second},
+                                           detail::Coordinates{coords[to].first, coords[to].second});
+        };
+
+        json::Array base_requests;
+        map<size_t, map<size_t, int>> road_distances;
+        for (int bus_num = 0; bus_num < params.buses; ++bus_num)
+        {
+            // Каждый третий маршрут - кольцевой.
+            const bool is_roundtrip = bus_num % 3 == 0;
+            vector<size_t> route{random.Index(stop_count)};
+            while (route.size() < static_cast<size_t>(max(2, params.stops_per_bus)) - (is_roundtrip ? 1 : 0))
+                route.push_back(next_stop(route.back()));
+            if (is_roundtrip)
+                route.push_back(route.front());
+
+            json::Array stops;
+            for (size_t i = 0; i < route.size(); ++i)
+            {
+                stops.push_back(StopName(route[i]));
+                if (i && route[i - 1] != route[i] && random.Uniform(0, 1) < params.distance_density)
+                {
+                    const double geo = geo_distance(route[i - 1], route[i]);
+                    road_distances[route[i - 1]][route[i]] = static_cast<int>(geo * random.Uniform(1.1, 1.5)) + 1;
+                    if (random.Uniform(0, 1) < 0.5)
+                        road_distances[route[i]][route[i - 1]] = static_cast<int>(geo * random.Uniform(1.1, 1.5)) + 1;
+                }
+            }
+            // Рейсы ходят с 5 до 23 часов с интервалом от 5 до 20 минут.
+            base_requests.push_back(json::Dict{{"type"s, "Bus"s}, {"name"s, BusName(bus_num)},
+                                               {"is_roundtrip"s, is_roundtrip}, {"stops"s, move(stops)},
+                                               {"first_departure"s, 300 + bus_num % 15}, {"last_departure"s, 1380},
+                                               {"interval"s, 5 + bus_num % 16}});
+        }
+
+        for (size_t stop_num = 0; stop_num < stop_count; ++stop_num)
+        {
+            json::Dict distances;
+            for (const auto& [to_stop, distance] : road_distances[stop_num])
+                distances[StopName(to_stop)] = distance;
+            base_requests.push_back(json::Dict{{"type"s, "Stop"s}, {"name"s, StopName(stop_num)},
+                                               {"latitude"s, coords[stop_num].first},
+                                               {"longitude"s, coords[stop_num].second},
+                                               {"road_distances"s, move(distances)}});
+        }
+
+        json::Dict render_settings{
+            {"width"s, 1500}, {"height"s, 950}, {"padding"s, 50}, {"stop_radius"s, 3}, {"line_width"s, 10},
+            {"bus_label_font_size"s, 18}, {"bus_label_offset"s, json::Array{7, 15}},
+            {"stop_label_font_size"s, 13}, {"stop_label_offset"s, json::Array{7, -3}},
+            {"underlayer_color"s, json::Array{255, 255, 255, 0.85}}, {"underlayer_width"s, 3},
+            {"color_palette"s, json::Array{"red"s, "green"s, "blue"s, "brown"s, "orange"s}}};
+
+        return json::Dict{
+            {"serialization_settings"s, json::Dict{{"file"s, params.base_file}, {"compression"s, params.compression}}},
+            {"routing_settings"s, json::Dict{{"bus_wait_time"s, 6}, {"bus_velocity"s, 40},
+                                             {"routing_algorithm"s, params.routing_algorithm}}},
+            {"render_settings"s, move(render_settings)},
+            {"base_requests"s, move(base_requests)}};
+    }
+
+    // Запросы на получение информации, сгруппированные по типам.
+    map<string, json::Array> GenerateStatRequests(const BenchParams& params)
+    {
+        Random random(params.seed ^ 0x5747A7ull);
+        map<string, json::Array> result;
+        int request_id = 0;
+        for (int i = 0; i < params.lookups; ++i)
+            result["Bus"s].push_back(json::Dict{{"id"s, request_id++}, {"type"s, "Bus"s},
+                                                {"name"s, BusName(random.Index(params.buses))}});
+        for (int i = 0; i < params.lookups; ++i)
+            result["Stop"s].push_back(json::Dict{{"id"s, request_id++}, {"type"s, "Stop"s},
+                                                 {"name"s, StopName(random.Index(params.stops))}});
+        for (int i = 0; i < params.routes; ++i)
+            result["Route"s].push_back(json::Dict{{"id"s, request_id++}, {"type"s, "Route"s},
+                                                  {"from"s, StopName(random.Index(params.stops))},
+                                                  {"to"s, StopName(random.Index(params.stops))}});
+        for (int i = 0; i < params.maps; ++i)
+            result["Map"s].push_back(json::Dict{{"id"s, request_id++}, {"type"s, "Map"s}});
+        if (params.matrix_size > 0)
+        {
+            json::Array sources, targets;
+            for (int i = 0; i < params.matrix_size; ++i)
+            {
+                sources.push_back(StopName(random.Index(params.stops)));
+                targets.push_back(StopName(random.Index(params.stops)));
+            }
+            result["Matrix"s].push_back(json::Dict{{"id"s, request_id++}, {"type"s, "Matrix"s},
+                                                   {"sources"s, move(sources)}, {"targets"s, move(targets)}});
+        }
+        // Запросы "Route" с моментом отправления исполняются по расписаниям и замеряются отдельно.
+        for (int i = 0; i < params.routes; ++i)
+            result["TimetableRoute"s].push_back(json::Dict{{"id"s, request_id++}, {"type"s, "Route"s},
+                                                           {"from"s, StopName(random.Index(params.stops))},
+                                                           {"to"s, StopName(random.Index(params.stops))},
+                                                           {"departure_time"s, random.Uniform(300, 1380)}});
+        // Запросы "Route" всего из нескольких начальных остановок: справочник строит их пакетами, одним поиском
+        // на начальную остановку.
+        const size_t origin_count = min(params.stops, 100);
+        for (int i = 0; i < params.routes; ++i)
+            result["RouteFewOrigins"s].push_back(json::Dict{{"id"s, request_id++}, {"type"s, "Route"s},
+                                                            {"from"s, StopName(random.Index(origin_count))},
+                                                            {"to"s, StopName(random.Index(params.stops))}});
+        return result;
+    }
+
+    string ToString(const json::Node& node)
+    {
+        ostringstream out;
+        json::Print(json::Document(node), out);
+        return out.str();
+    }
+
+    // Время выполнения func в миллисекундах
+    double Measure(const function<void()>& func)
+    {
+        const auto start = chrono::steady_clock::now();
+        func();
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    }
+
+    // Сравнение способов поиска маршрута по запросу с алгоритмом Дейкстры на одних и тех же парах остановок:
+    // время поиска, среднее число вершин, до которых найден окончательный маршрут, и количество
+    // расхождений найденного времени поездки с алгоритмом Дейкстры.
+    json::Dict CompareRouteSearch(const BenchParams& params, const transport::BaseSnapshot& snapshot)
+    {
+        Random random(params.seed ^ 0x5EA2C4ull);
+        vector<pair<string, string>> stop_pairs;
+        for (int i = 0; i < params.routes; ++i)
+        {
+            string from = StopName(random.Index(params.stops));
+            stop_pairs.emplace_back(move(from), StopName(random.Index(params.stops)));
+        }
+
+        const pair<string, graph::RouteSearch> route_searches[] = {{"dijkstra"s, graph::RouteSearch::DIJKSTRA},
+                                                                   {"bidirectional"s, graph::RouteSearch::BIDIRECTIONAL},
+                                                                   {"astar"s, graph::RouteSearch::ASTAR},
+                                                                   {"contraction_hierarchy"s,
+                                                                    graph::RouteSearch::CONTRACTION_HIERARCHY},
+                                                                   {"hub_labels"s, graph::RouteSearch::HUB_LABELS}};
+        json::Dict result;
+        vector<optional<double>> reference_times;
+        for (const auto& [search_name, route_search] : route_searches)
+        {
+            router::RouterContext router_context = snapshot.router_context;
+            router_context.route_search = route_search;
+            unique_ptr<router::BusRouter> bus_router_ptr;
+            const double build_ms = Measure([&]()
+            {
+                bus_router_ptr = make_unique<router::BusRouter>(router_context, snapshot.catalogue);
+            });
+            const router::BusRouter& bus_router = *bus_router_ptr;
+            vector<optional<double>> route_times;
+            route_times.reserve(stop_pairs.size());
+            size_t settled_vertexes = 0;
+            const double total_ms = Measure([&]()
+            {
+                for (const auto& [from, to] : stop_pairs)
+                {
+                    graph::Router<double>::SearchStats search_stats;
+                    const auto route = bus_router.DoRoute(from, to, &search_stats);
+                    settled_vertexes += search_stats.settled_vertexes;
+                    route_times.push_back(route ? optional<double>(route->total_time) : nullopt);
+                }
+            });
+            if (reference_times.empty())
+                reference_times = route_times;
+            int mismatches = 0;
+            for (size_t i = 0; i < route_times.size(); ++i)
+                if (route_times[i].has_value() != reference_times[i].has_value() ||
+                    (route_times[i] && abs(*route_times[i] - *reference_times[i]) > 1e-6 * max(1.0, *reference_times[i])))
+                    ++mismatches;
+            const double count = static_cast<double>(stop_pairs.size());
+            json::Dict search_result{{"build_ms"s, build_ms},
+                                     {"count"s, static_cast<int>(stop_pairs.size())}, {"total_ms"s, total_ms},
+                                     {"mean_us"s, count ? total_ms * 1000.0 / count : 0.0},
+                                     {"mean_settled_vertexes"s, count ? settled_vertexes / count : 0.0},
+                                     {"mismatches"s, mismatches}};
+
+            // Сценарий "что если": другие скорости половины маршрутов и время ожидания трети остановок.
+            // Веса рёбер пересчитываются на месте, а возврат к исходным параметрам должен дать прежние маршруты.
+            const router::BusRouter::WeightSettings original_settings = bus_router.GetWeightSettings();
+            router::BusRouter::WeightSettings what_if_settings = original_settings;
+            for (size_t i = 0; i < what_if_settings.bus_velocities.size(); ++i)
+                what_if_settings.bus_velocities[i] *= i % 2 ? 1.25 : 1.0;
+            for (size_t i = 0; i < what_if_settings.stop_wait_times.size(); ++i)
+                what_if_settings.stop_wait_times[i] += i % 3 ? 0.0 : 2.0;
+            search_result["reweight_ms"s] = Measure([&]() {bus_router_ptr->Reweight(move(what_if_settings));});
+            bus_router_ptr->Reweight(original_settings);
+            int reweight_mismatches = 0;
+            for (size_t i = 0; i < stop_pairs.size(); ++i)
+            {
+                const auto route = bus_router.DoRoute(stop_pairs[i].first, stop_pairs[i].second);
+                if (route.has_value() != route_times[i].has_value() ||
+                    (route && abs(route->total_time - *route_times[i]) > 1e-6 * max(1.0, *route_times[i])))
+                    ++reweight_mismatches;
+            }
+            search_result["reweight_mismatches"s] = reweight_mismatches;
+            if (route_search == graph::RouteSearch::HUB_LABELS)
+            { // Объём меток хабов в сравнении с маршрутной матрицей, хранящей по ячейке на каждую пару вершин
+                const double vertex_count = static_cast<double>(bus_router.GetGraph().GetVertexCount());
+                const double label_count = static_cast<double>(bus_router.GetRouter().GetHubLabelCount());
+                search_result["label_count"s] = label_count;
+                search_result["labels_per_vertex"s] = vertex_count ? label_count / vertex_count : 0.0;
+                search_result["matrix_cells"s] = vertex_count * vertex_count;
+                search_result["labels_to_matrix_ratio"s] = vertex_count ? label_count / (vertex_count * vertex_count) : 0.0;
+            }
+            result[search_name] = move(search_result);
+        }
+        return result;
+    }
+
+    json::Node Run(const BenchParams& params)
+    {
+        json::Dict phases;
+        string input_text;
+        phases["generate_ms"s] = Measure([&]() {input_text = ToString(GenerateCity(params));});
+        if (!params.dump_input.empty())
+            ofstream(params.dump_input) << input_text;
+
+        transport::TransportCatalogue catalogue;
+        {
+            istringstream input(input_text);
+            unique_ptr<transport::reader::JSONReader> jsr;
+            phases["json_parse_ms"s] = Measure([&]() {jsr = make_unique<transport::reader::JSONReader>(input, catalogue);});
+            phases["add_info_ms"s] = Measure([&]() {jsr->ProcessAddInfoRequests();});
+            phases["build_router_ms"s] = Measure([&]() {jsr->BuildBusRouter();});
+            phases["serialize_ms"s] = Measure([&]() {jsr->ProcessSerialize();});
+        }
+
+        serial::SerializationContext serial_context;
+        serial_context.input_file = params.base_file;
+        serial_context.output_file = params.base_file;
+        // Загрузка только справочника (разделы маршрутизатора и картографии загружаются лениво)
+        // и загрузка полного снимка состояния.
+        phases["deserialize_catalogue_ms"s] = Measure([&]()
+        {
+            transport::TransportCatalogue loaded_catalogue;
+            transport::reader::JSONReader loader(serial_context, loaded_catalogue);
+            loader.ProcessDeserialize();
+        });
+        shared_ptr<const transport::BaseSnapshot> snapshot;
+        phases["deserialize_ms"s] = Measure([&]() {snapshot = transport::LoadBaseSnapshot(serial_context);});
+
+        // Запросы каждого типа исполняются отдельным пакетом по полностью загруженному снимку.
+        // Разбор JSON-документа пакета в замер не входит.
+        json::Dict requests;
+        for (auto& [request_type, request_list] : GenerateStatRequests(params))
+        {
+            const int count = static_cast<int>(request_list.size());
+            istringstream input(ToString(json::Dict{{"stat_requests"s, move(request_list)}}));
+            transport::TransportCatalogue unused;
+            transport::reader::JSONReader jsr(input, unused);
+            const double total_ms = Measure([&]() {jsr.ProcessGetInfoRequests(*snapshot);});
+            requests[request_type] = json::Dict{{"count"s, count}, {"total_ms"s, total_ms},
+                                                {"mean_us"s, count ? total_ms * 1000.0 / count : 0.0}};
+        }
+
+        json::Dict route_search = CompareRouteSearch(params, *snapshot);
+
+        const transport::TCCommonMetric metric = snapshot->catalogue.GetCommonMetric();
+        json::Dict network{{"stops"s, static_cast<int>(metric.stops_count)}, {"buses"s, static_cast<int>(metric.buses_count)},
+                           {"graph_vertexes"s, static_cast<int>(snapshot->bus_router->GetGraph().GetVertexCount())},
+                           {"graph_edges"s, static_cast<int>(snapshot->bus_router->GetGraph().GetEdgeCount())},
+                           {"input_kb"s, static_cast<int>(input_text.size() / 1024)},
+                           {"base_kb"s, static_cast<int>(filesystem::file_size(params.base_file) / 1024)}};
+        if (!params.keep_base)
+            filesystem::remove(params.base_file);
+
+        json::Dict bench_params{{"stops"s, params.stops}, {"buses"s, params.buses},
+                                {"stops_per_bus"s, params.stops_per_bus},
+                                {"distance_density"s, params.distance_density},
+                                {"seed"s, static_cast<int>(params.seed)}, {"routes"s, params.routes},
+                                {"lookups"s, params.lookups}, {"maps"s, params.maps}, {"matrix_size"s, params.matrix_size},
+                                {"compression"s, params.compression}, {"routing_algorithm"s, params.routing_algorithm}};
+        return json::Dict{{"format_version"s, 1}, {"params"s, move(bench_params)}, {"network"s, move(network)},
+                          {"phases"s, move(phases)}, {"requests"s, move(requests)}, {"route_search"s, move(route_search)}};
+    }
+
+    void PrintUsage(ostream& stream = cerr)
+    {
+        stream << "Формат команды: transport_bench [--stops N] [--buses N] [--stops-per-bus N]\n"
+                  "    [--distance-density D] [--seed N] [--routes N] [--lookups N] [--maps N]\n"
+                  "    [--matrix-size N] [--compression none|lz]\n"
+                  "    [--routing-algorithm matrix|dijkstra|bidirectional|astar|contraction_hierarchy|hub_labels]\n"
+                  "    [--base FILE] [--keep-base] [--dump-input FILE] [--output FILE]\n"sv;
+    }
+
+    BenchParams ParseCommandLine(int argc, char* argv[])
+    {
+        BenchParams params;
+        for (int i = 1; i < argc; ++i)
+        {
+            const string_view option(argv[i]);
+            if (option == "--keep-base"sv)
+            {
+                params.keep_base = true;
+                continue;
+            }
+            if (i + 1 >= argc)
+                throw invalid_argument("Missing value for option "s + string(option));
+            const string value(argv[++i]);
+            if (option == "--stops"sv)
+                params.stops = stoi(value);
+            else if (option == "--buses"sv)
+                params.buses = stoi(value);
+            else if (option == "--stops-per-bus"sv)
+                params.stops_per_bus = stoi(value);
+            else if (option == "--distance-density"sv)
+                params.distance_density = stod(value);
+            else if (option == "--seed"sv)
+                params.seed = stoull(value);
+            else if (option == "--routes"sv)
+                params.routes = stoi(value);
+            else if (option == "--lookups"sv)
+                params.lookups = stoi(value);
+            else if (option == "--maps"sv)
+                params.maps = stoi(value);
+            else if (option == "--matrix-size"sv)
+                params.matrix_size = stoi(value);
+            else if (option == "--compression"sv)
+                params.compression = value;
+            else if (option == "--routing-algorithm"sv)
+                params.routing_algorithm = value;
+            else if (option == "--base"sv)
+                params.base_file = value;
+            else if (option == "--dump-input"sv)
+                params.dump_input = value;
+            else if (option == "--output"sv)
+                params.output = value;
+            else
+                throw invalid_argument("Unknown option "s + string(option));
+        }
+        if (params.stops < 2 || params.buses < 1 || params.stops_per_bus < 2)
+            throw invalid_argument("Network must have at least 2 stops, 1 bus and 2 stops per bus"s);
+        return params;
+    }
+} // namespace bench
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        const bench::BenchParams params = bench::ParseCommandLine(argc, argv);
+        const json::Document result(bench::Run(params));
+        if (params.output.empty())
+        {
+            json::Print(result, cout);
+            cout << endl;
+        }
+        else
+        {
+            ofstream output(params.output);
+            json::Print(result, output);
+        }
+    }
+    catch (const exception& exc)
+    {
+        cerr << exc.what() << endl;
+        bench::PrintUsage();
+        return 1;
+    }
+    return 0;
+}
@@ -1,5 +1,8 @@
 
 #include <limits>
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
 
 #include "transport_catalogue.h"
 #include "geo.h"
@@ -11,15 +14,17 @@ using namespace detail;
 StopDescriptor TransportCatalogue::ConvertStopToExternalFormat(const Stop& stopi) const
 {
     StopDescriptor result;
+    const uint32_t stop_id = static_cast<uint32_t>(&stopi - stops_.data());
 
     result.stop_name = stopi.stop_name;
     result.stop_type = stopi.stop_type;
     result.stop_coords = stopi.stop_coords;
-    for (const Bus* current_bus: stopi.buses_at_stop)
-        result.buses_at_stop.insert(current_bus->bus_name);
+    result.wait_time = stopi.wait_time;
+    for (uint32_t i = stop_buses_offsets_[stop_id]; i < stop_buses_offsets_[stop_id + 1]; ++i)
+        result.buses_at_stop.insert(result.buses_at_stop.end(), buses_[stop_buses_[i]].bus_name);
 
-    for (auto current_stop_pair : stopi.distance_to_stop)
-        result.distance_to_stop[current_stop_pair.first->stop_name] = current_stop_pair.second;
+    for (uint32_t i = distance_offsets_[stop_id]; i < distance_offsets_[stop_id + 1]; ++i)
+        result.distance_to_stop[stops_[distances_[i].stop_id].stop_name] = distances_[i].distance;
 
     return result;
 }
@@ -30,29 +35,69 @@ BusDescriptor TransportCatalogue::ConvertBusToExternalFormat(const Bus& busi) co
 
     result.bus_name = busi.bus_name;
     result.bus_type = busi.bus_type;
-    for (const Stop* current_stop: busi.bus_stops)
-        result.bus_stops.push_back(current_stop->stop_name);
+    result.bus_stops.reserve(busi.stops_end - busi.stops_begin);
+    for (uint32_t i = busi.stops_begin; i < busi.stops_end; ++i)
+        result.bus_stops.push_back(stops_[bus_stops_[i]].stop_name);
+    result.departures.assign(bus_departures_.begin() + busi.departures_begin,
+                             bus_departures_.begin() + busi.departures_end);
+    result.velocity = busi.velocity;
 
     return result;
 }
 
+uint32_t TransportCatalogue::FindStopId(string_view stop_name) const
+{
+    auto stop_it = lower_bound(stops_.begin(), stops_.end(), stop_name,
+                               [](const Stop& lhs, string_view name) {return lhs.stop_name < name;});
+    if (stop_it == stops_.end() || stop_it->stop_name != stop_name)
+        return NO_ID;
+    return static_cast<uint32_t>(stop_it - stops_.begin());
+}
+
+uint32_t TransportCatalogue::FindBusId(string_view bus_name) const
+{
+    auto bus_it = lower_bound(buses_.begin(), buses_.end(), bus_name,
+                              [](const Bus& lhs, string_view name) {return lhs.bus_name < name;});
+    if (bus_it == buses_.end() || bus_it->bus_name != bus_name)
+        return NO_ID;
+    return static_cast<uint32_t>(bus_it - buses_.begin());
+}
+
 Coordinates TransportCatalogue::GetStopCoordinates(const string& stop_name) const
 {
-    Stop stopi;
-    stopi.stop_name = stop_name;
-    auto stop_it = stops_.find(stopi);
-    if (stop_it == stops_.end())
+    uint32_t stop_id = FindStopId(stop_name);
+    if (stop_id == NO_ID)
         return {numeric_limits<double>::min(), numeric_limits<double>::min()};
     else
-        return stop_it->stop_coords;
+        return stops_[stop_id].stop_coords;
+}
+
+const TransportCatalogue::DistanceToStop* TransportCatalogue::FindDistance(uint32_t from_stop_id,
+                                                                           uint32_t to_stop_id) const
+{
+    // Расстояний от одной остановки обычно немного, для коротких списков линейный поиск быстрее двоичного.
+    static constexpr uint32_t LINEAR_SEARCH_LIMIT = 8;
+    const DistanceToStop* first = distances_.data() + distance_offsets_[from_stop_id];
+    const DistanceToStop* last = distances_.data() + distance_offsets_[from_stop_id + 1];
+    if (last - first <= LINEAR_SEARCH_LIMIT)
+    {
+        for (; first != last; ++first)
+            if (first->stop_id == to_stop_id)
+                return first;
+        return nullptr;
+    }
+    first = lower_bound(first, last, to_stop_id,
+                        [](const DistanceToStop& lhs, uint32_t stop_id) {return lhs.stop_id < stop_id;});
+    return first != last && first->stop_id == to_stop_id ? first : nullptr;
 }
 
-decltype(TransportCatalogue::stops_)::iterator TransportCatalogue::MakeDumbStop(Stop& dumb_stop)
+double TransportCatalogue::GetRoadDistance(uint32_t from_stop_id, uint32_t to_stop_id, double geo_distance) const
 {
-    dumb_stop.stop_type = StopType::STOPTYPE_UNDEFINED;
-    dumb_stop.stop_coords.lat = numeric_limits<double>::min();
-    dumb_stop.stop_coords.lng = numeric_limits<double>::min();
-    return stops_.insert(dumb_stop).first;
+    if (const DistanceToStop* dist = FindDistance(from_stop_id, to_stop_id))
+        return dist->distance;
+    if (const DistanceToStop* dist = FindDistance(to_stop_id, from_stop_id))
+        return dist->distance;
+    return geo_distance;
 }
 
 // В возвращаемой паре первый член - расстояние по дорогам,
@@ -60,103 +105,88 @@ decltype(TransportCatalogue::stops_)::iterator TransportCatalogue::MakeDumbStop(
 pair<double, double> TransportCatalogue::CountNeighborsDistance(const string& from_stop_name,
                                                                 const string& to_stop_name) const
 {
-    double road_distance = 0, geo_distance = 0;
+    double geo_distance = 0;
 
-    Stop from_stop, to_stop;
-    from_stop.stop_name = from_stop_name;
-    auto from_stop_it = stops_.find(from_stop);
-    to_stop.stop_name = to_stop_name;
-    auto to_stop_it = stops_.find(to_stop);
-    if (from_stop_it == stops_.end() || to_stop_it == stops_.end())
+    uint32_t from_stop_id = FindStopId(from_stop_name);
+    uint32_t to_stop_id = FindStopId(to_stop_name);
+    if (from_stop_id == NO_ID || to_stop_id == NO_ID)
         return {0, 0};
 
-    if (from_stop_name != to_stop_name)
-        geo_distance = ComputeDistance(from_stop_it->stop_coords, to_stop_it->stop_coords);
+    if (from_stop_id != to_stop_id)
+        geo_distance = ComputeDistance(stops_[from_stop_id].stop_trig, stops_[to_stop_id].stop_trig);
 
-    if (from_stop_it->distance_to_stop.count(&(*to_stop_it)))
-        road_distance = from_stop_it->distance_to_stop.at(&(*to_stop_it));
-    else if (to_stop_it->distance_to_stop.count(&(*from_stop_it)))
-        road_distance = to_stop_it->distance_to_stop.at(&(*from_stop_it));
-    else
-        road_distance = geo_distance;
-
-    return {road_distance, geo_distance};
+    return {GetRoadDistance(from_stop_id, to_stop_id, geo_distance), geo_distance};
 }
 
-void TransportCatalogue::AddStop(const StopDescriptor& stop)
+void TransportCatalogue::BuildDistanceTables()
 {
-    Stop stopi;
-
-    stopi.stop_type = stop.stop_type;
-    stopi.stop_name = stop.stop_name;
-    stopi.stop_coords = stop.stop_coords;
-    //Заполняем массив distance_to_stop - список актуальных расстояний до других остановок по дорогам
-    for (auto to_stop_pair : stop.distance_to_stop)
+    CoordinatesBatch stops_batch;
+    for (Bus& bus : buses_)
     {
-        Stop to_stop;
-        to_stop.stop_name = to_stop_pair.first;
-        auto to_stop_it = stops_.find(to_stop);
-        if (to_stop_it == stops_.end())
-            to_stop_it = MakeDumbStop(to_stop); //Такой остановки ещё нет, добавим вместо неё болванку
-        stopi.distance_to_stop[&(*to_stop_it)] = to_stop_pair.second;
-    }
+        BusDistanceTable& table = bus.distance_table;
+        const size_t stops_count = bus.stops_end - bus.stops_begin;
+        const size_t segments_count = stops_count ? stops_count - 1 : 0;
+        const uint32_t* bus_stops = bus_stops_.data() + bus.stops_begin;
+        // Географические расстояния по всем участкам маршрута считаем одним пакетом.
+        stops_batch = CoordinatesBatch();
+        stops_batch.reserve(stops_count);
+        for (size_t i = 0; i < stops_count; ++i)
+            stops_batch.push_back(stops_[bus_stops[i]].stop_trig);
+        table.geo.resize(segments_count);
+        ComputeChainDistances(stops_batch, table.geo.data());
 
-    auto [stop_it, is_added] = stops_.insert(stopi);
-    if (!is_added)
-    {
-        if (stop_it->stop_coords.lat == numeric_limits<double>::min() &&
-            stop_it->stop_coords.lng == numeric_limits<double>::min() &&
-            stop_it->stop_type == StopType::STOPTYPE_UNDEFINED)
+        table.forward_road.resize(segments_count);
+        table.backward_road.resize(segments_count);
+        for (size_t i = 0; i < segments_count; ++i)
         {
-            auto node_ex = stops_.extract(stop_it);
-            Stop& old_stop = node_ex.value();
-            old_stop.stop_type = stopi.stop_type;
-            old_stop.stop_coords = stopi.stop_coords;
-            old_stop.distance_to_stop.merge(stopi.distance_to_stop);
-            stops_.insert(move(node_ex));
+            if (bus_stops[i] == bus_stops[i + 1])
+                table.geo[i] = 0;
+            table.forward_road[i] = GetRoadDistance(bus_stops[i], bus_stops[i + 1], table.geo[i]);
+            table.backward_road[i] = GetRoadDistance(bus_stops[i + 1], bus_stops[i], table.geo[i]);
+        }
+
+        table.forward_road_prefix.assign(stops_count, 0);
+        table.backward_road_prefix.assign(stops_count, 0);
+        table.geo_prefix.assign(stops_count, 0);
+        for (size_t i = 0; i < segments_count; ++i)
+        {
+            table.forward_road_prefix[i + 1] = table.forward_road_prefix[i] + table.forward_road[i];
+            table.backward_road_prefix[i + 1] = table.backward_road_prefix[i] + table.backward_road[i];
+            table.geo_prefix[i + 1] = table.geo_prefix[i] + table.geo[i];
         }
     }
 }
 
-void TransportCatalogue::AddBus(const BusDescriptor& bus)
+const BusDistanceTable* TransportCatalogue::GetBusDistanceTable(const string& bus_name) const
 {
-    Bus busi;
-    busi.bus_type = bus.bus_type;
-    busi.bus_name = bus.bus_name;
-    if (buses_.count(busi))
-        return;
-    for (const string& current_stop_name : bus.bus_stops)
-    {
-        Stop current_stop;
-        current_stop.stop_name = current_stop_name;
-        auto current_stop_it = stops_.find(current_stop);
-        if (current_stop_it == stops_.end())
-            current_stop_it = MakeDumbStop(current_stop); //Такой остановки ещё нет, добавим вместо неё болванку
-        busi.bus_stops.push_back(&(*current_stop_it));
-    }
-
-    const Bus* bus_ptr = &(*buses_.insert(busi).first);
+    uint32_t bus_id = FindBusId(bus_name);
+    if (bus_id == NO_ID)
+        return nullptr;
+    return &buses_[bus_id].distance_table;
+}
 
-    //Добавляем создаваемый маршрут в список останавливающихся автобусов для каждой его остановки
-    for (const Stop* stop_ptr : busi.bus_stops)
-        const_cast<Stop*>(stop_ptr)->buses_at_stop.push_back(bus_ptr);
+optional<TransportCatalogue::BusNamesRange> TransportCatalogue::GetBusesAtStop(string_view stop_name) const
+{
+    uint32_t stop_id = FindStopId(stop_name);
+    if (stop_id == NO_ID || stops_[stop_id].stop_type == StopType::STOPTYPE_UNDEFINED)
+        return nullopt;
+    return BusNamesRange(bus_name_iterator(*this, stop_buses_.data() + stop_buses_offsets_[stop_id]),
+                         bus_name_iterator(*this, stop_buses_.data() + stop_buses_offsets_[stop_id + 1]));
 }
 
 BusDescriptor TransportCatalogue::GetBus(const string& bus_name) const
 {
     BusDescriptor result;
-    Bus busi;
 
-    busi.bus_name = bus_name;
-    auto bus_it = buses_.find(busi);
-    if (bus_it == buses_.end())
+    uint32_t bus_id = FindBusId(bus_name);
+    if (bus_id == NO_ID)
     {
         result.bus_type = BusType::BUSTYPE_UNDEFINED;
         result.bus_name = bus_name;
     }
     else
     {
-        result = ConvertBusToExternalFormat(*bus_it);
+        result = ConvertBusToExternalFormat(buses_[bus_id]);
     }
 
     return result;
@@ -165,11 +195,9 @@ BusDescriptor TransportCatalogue::GetBus(const string& bus_name) const
 StopDescriptor TransportCatalogue::GetStop(const string& stop_name) const
 {
     StopDescriptor result;
-    Stop stopi;
 
-    stopi.stop_name = stop_name;
-    auto stop_it = stops_.find(stopi);
-    if (stop_it == stops_.end())
+    uint32_t stop_id = FindStopId(stop_name);
+    if (stop_id == NO_ID)
     {
         result.stop_type = StopType::STOPTYPE_UNDEFINED;
         result.stop_name = stop_name;
@@ -177,7 +205,7 @@ StopDescriptor TransportCatalogue::GetStop(const string& stop_name) const
     }
     else
     {
-        result = ConvertStopToExternalFormat(*stop_it);
+        result = ConvertStopToExternalFormat(stops_[stop_id]);
     }
 
     return result;
@@ -187,3 +215,227 @@ TCCommonMetric TransportCatalogue::GetCommonMetric() const
 {
     return {stops_.size(), buses_.size()};
 }
+
+TransportCatalogue::Builder::Builder(const TransportCatalogue& tc)
+{
+    for (uint32_t stop_id = 0; stop_id < tc.stops_.size(); ++stop_id)
+    {
+        const Stop& stop = tc.stops_[stop_id];
+        uint32_t new_stop_id = GetStopId(stop.stop_name);
+        stops_[new_stop_id].stop_type = stop.stop_type;
+        stops_[new_stop_id].stop_coords = stop.stop_coords;
+        stops_[new_stop_id].wait_time = stop.wait_time;
+        for (uint32_t i = tc.distance_offsets_[stop_id]; i < tc.distance_offsets_[stop_id + 1]; ++i)
+            distances_.push_back({new_stop_id, GetStopId(tc.stops_[tc.distances_[i].stop_id].stop_name),
+                                  tc.distances_[i].distance, false});
+    }
+
+    for (const Bus& bus : tc.buses_)
+        AddBus(tc.ConvertBusToExternalFormat(bus));
+}
+
+uint32_t TransportCatalogue::Builder::GetStopId(const string& stop_name)
+{
+    auto [name_it, is_added] = stop_name_to_id_.emplace(stop_name, static_cast<uint32_t>(stops_.size()));
+    if (is_added) //Такой остановки ещё нет, добавим вместо неё болванку
+        stops_.push_back({StopType::STOPTYPE_UNDEFINED, stop_name,
+                         {numeric_limits<double>::min(), numeric_limits<double>::min()}, nullopt, false});
+    return name_it->second;
+}
+
+void TransportCatalogue::Builder::AddStop(const StopDescriptor& stop)
+{
+    uint32_t stop_id = GetStopId(stop.stop_name);
+    if (stops_[stop_id].is_removed)
+        stops_[stop_id].is_removed = false;
+    if (stop.stop_type == StopType::STOPTYPE_UNDEFINED || stops_[stop_id].stop_type != StopType::STOPTYPE_UNDEFINED)
+        return; // Повторное описание уже существующей остановки игнорируется
+
+    stops_[stop_id].stop_type = stop.stop_type;
+    stops_[stop_id].stop_coords = stop.stop_coords;
+    stops_[stop_id].wait_time = stop.wait_time;
+    //Заполняем список актуальных расстояний до других остановок по дорогам
+    for (const auto& to_stop_pair : stop.distance_to_stop)
+        distances_.push_back({stop_id, GetStopId(to_stop_pair.first), to_stop_pair.second, false});
+}
+
+void TransportCatalogue::Builder::AddBus(const BusDescriptor& bus)
+{
+    if (!bus_name_to_id_.emplace(bus.bus_name, static_cast<uint32_t>(buses_.size())).second)
+        return;
+
+    BusRecord busi;
+    busi.bus_type = bus.bus_type;
+    busi.bus_name = bus.bus_name;
+    busi.stops_begin = static_cast<uint32_t>(bus_stops_.size());
+    for (const string& current_stop_name : bus.bus_stops)
+        bus_stops_.push_back(GetStopId(current_stop_name));
+    busi.stops_end = static_cast<uint32_t>(bus_stops_.size());
+    busi.departures = bus.departures;
+    sort(busi.departures.begin(), busi.departures.end());
+    busi.velocity = bus.velocity;
+    buses_.push_back(move(busi));
+}
+
+void TransportCatalogue::Builder::UpdateStop(const StopDescriptor& stop)
+{
+    uint32_t stop_id = GetStopId(stop.stop_name);
+    stops_[stop_id].is_removed = false;
+    stops_[stop_id].stop_type = stop.stop_type;
+    stops_[stop_id].stop_coords = stop.stop_coords;
+    stops_[stop_id].wait_time = stop.wait_time;
+    // Из нескольких расстояний для одной пары остановок Finalize() оставляет последнее добавленное.
+    for (const auto& to_stop_pair : stop.distance_to_stop)
+        distances_.push_back({stop_id, GetStopId(to_stop_pair.first), to_stop_pair.second, false});
+}
+
+void TransportCatalogue::Builder::RemoveStop(const string& stop_name)
+{
+    auto stop_it = stop_name_to_id_.find(stop_name);
+    if (stop_it == stop_name_to_id_.end())
+        return;
+    const uint32_t stop_id = stop_it->second;
+    stops_[stop_id].is_removed = true;
+    stops_[stop_id].stop_type = StopType::STOPTYPE_UNDEFINED;
+    distances_.erase(remove_if(distances_.begin(), distances_.end(),
+                               [stop_id](const DistanceRecord& dist)
+                               {
+                                   return dist.from_stop_id == stop_id || dist.to_stop_id == stop_id;
+                               }),
+                     distances_.end());
+}
+
+void TransportCatalogue::Builder::RemoveDistance(const string& from_stop_name, const string& to_stop_name)
+{
+    distances_.push_back({GetStopId(from_stop_name), GetStopId(to_stop_name), 0.0, true});
+}
+
+bool TransportCatalogue::Builder::RemoveBus(const string& bus_name)
+{
+    auto bus_it = bus_name_to_id_.find(bus_name);
+    if (bus_it == bus_name_to_id_.end())
+        return false;
+    // Порядок маршрутов в построителе не важен (Finalize() упорядочивает их по именам), поэтому на место
+    // удаляемого маршрута переносится последний. Остановки удалённого маршрута остаются в bus_stops_
+    // неиспользуемым участком.
+    const uint32_t bus_id = bus_it->second;
+    bus_name_to_id_.erase(bus_it);
+    if (bus_id + 1 != buses_.size())
+    {
+        buses_[bus_id] = move(buses_.back());
+        bus_name_to_id_[buses_[bus_id].bus_name] = bus_id;
+    }
+    buses_.pop_back();
+    return true;
+}
+
+TransportCatalogue TransportCatalogue::Builder::Finalize()
+{
+    TransportCatalogue result;
+
+    // Упорядочиваем остановки по именам, их позиции в упорядоченном массиве становятся
+    // окончательными номерами. new_stop_id - отображение временных номеров в окончательные.
+    // Удалённые остановки в справочник не попадают, их окончательные номера - NO_ID.
+    vector<uint32_t> stop_order;
+    stop_order.reserve(stops_.size());
+    for (uint32_t stop_id = 0; stop_id < stops_.size(); ++stop_id)
+        if (!stops_[stop_id].is_removed)
+            stop_order.push_back(stop_id);
+    sort(stop_order.begin(), stop_order.end(),
+         [this](uint32_t lhs, uint32_t rhs) {return stops_[lhs].stop_name < stops_[rhs].stop_name;});
+    vector<uint32_t> new_stop_id(stops_.size(), NO_ID);
+    result.stops_.reserve(stop_order.size());
+    for (uint32_t stop_id : stop_order)
+    {
+        new_stop_id[stop_id] = static_cast<uint32_t>(result.stops_.size());
+        StopRecord& stop = stops_[stop_id];
+        result.stops_.push_back({stop.stop_type, move(stop.stop_name), stop.stop_coords,
+                                 ComputeCoordinatesTrig(stop.stop_coords), stop.wait_time});
+    }
+
+    // Аналогично упорядочиваем маршруты, записывая их списки остановок подряд в общий массив.
+    sort(buses_.begin(), buses_.end(),
+         [](const BusRecord& lhs, const BusRecord& rhs) {return lhs.bus_name < rhs.bus_name;});
+    result.buses_.reserve(buses_.size());
+    result.bus_stops_.reserve(bus_stops_.size());
+    result.stop_buses_offsets_.assign(result.stops_.size() + 1, 0);
+    for (BusRecord& bus : buses_)
+    {
+        uint32_t stops_begin = static_cast<uint32_t>(result.bus_stops_.size());
+        for (uint32_t i = bus.stops_begin; i < bus.stops_end; ++i)
+        {
+            if (new_stop_id[bus_stops_[i]] == NO_ID)
+                throw invalid_argument("Removed stop "s + stops_[bus_stops_[i]].stop_name +
+                                       " is used by bus "s + bus.bus_name);
+            result.bus_stops_.push_back(new_stop_id[bus_stops_[i]]);
+        }
+        const uint32_t departures_begin = static_cast<uint32_t>(result.bus_departures_.size());
+        result.bus_departures_.insert(result.bus_departures_.end(), bus.departures.begin(), bus.departures.end());
+        result.buses_.push_back({bus.bus_type, move(bus.bus_name), stops_begin,
+                                 static_cast<uint32_t>(result.bus_stops_.size()), departures_begin,
+                                 static_cast<uint32_t>(result.bus_departures_.size()), bus.velocity, {}});
+    }
+
+    // Списки маршрутов, проходящих через каждую остановку. Маршрут, несколько раз проходящий
+    // через остановку, учитывается в её списке только один раз. Маршруты перебираются по
+    // возрастанию номеров, поэтому списки сразу получаются упорядоченными по именам.
+    vector<uint32_t> last_bus_at_stop(result.stops_.size(), NO_ID);
+    for (uint32_t bus_id = 0; bus_id < result.buses_.size(); ++bus_id)
+        for (uint32_t i = result.buses_[bus_id].stops_begin; i < result.buses_[bus_id].stops_end; ++i)
+            if (last_bus_at_stop[result.bus_stops_[i]] != bus_id)
+            {
+                last_bus_at_stop[result.bus_stops_[i]] = bus_id;
+                ++result.stop_buses_offsets_[result.bus_stops_[i] + 1];
+            }
+    for (size_t i = 1; i < result.stop_buses_offsets_.size(); ++i)
+        result.stop_buses_offsets_[i] += result.stop_buses_offsets_[i - 1];
+    result.stop_buses_.resize(result.stop_buses_offsets_.back());
+    vector<uint32_t> stop_buses_pos(result.stop_buses_offsets_.begin(), result.stop_buses_offsets_.end() - 1);
+    last_bus_at_stop.assign(result.stops_.size(), NO_ID);
+    for (uint32_t bus_id = 0; bus_id < result.buses_.size(); ++bus_id)
+        for (uint32_t i = result.buses_[bus_id].stops_begin; i < result.buses_[bus_id].stops_end; ++i)
+            if (last_bus_at_stop[result.bus_stops_[i]] != bus_id)
+            {
+                last_bus_at_stop[result.bus_stops_[i]] = bus_id;
+                result.stop_buses_[stop_buses_pos[result.bus_stops_[i]]++] = bus_id;
+            }
+
+    // Таблица дорожных расстояний. Из нескольких значений для одной пары остановок оставляем последнее.
+    for (DistanceRecord& dist : distances_)
+    {
+        dist.from_stop_id = new_stop_id[dist.from_stop_id];
+        dist.to_stop_id = new_stop_id[dist.to_stop_id];
+    }
+    distances_.erase(remove_if(distances_.begin(), distances_.end(),
+                               [](const DistanceRecord& dist)
+                               {
+                                   return dist.from_stop_id == NO_ID || dist.to_stop_id == NO_ID;
+                               }),
+                     distances_.end());
+    stable_sort(distances_.begin(), distances_.end(),
+                [](const DistanceRecord& lhs, const DistanceRecord& rhs)
+                {
+                    return lhs.from_stop_id < rhs.from_stop_id ||
+                           (lhs.from_stop_id == rhs.from_stop_id && lhs.to_stop_id < rhs.to_stop_id);
+                });
+    result.distances_.reserve(distances_.size());
+    result.distance_offsets_.assign(result.stops_.size() + 1, 0);
+    for (size_t i = 0; i < distances_.size(); ++i)
+    {
+        if (i + 1 < distances_.size() && distances_[i + 1].from_stop_id == distances_[i].from_stop_id &&
+            distances_[i + 1].to_stop_id == distances_[i].to_stop_id)
+            continue;
+        if (distances_[i].is_removed)
+            continue;
+        result.distances_.push_back({distances_[i].to_stop_id, distances_[i].distance});
+        ++result.distance_offsets_[distances_[i].from_stop_id + 1];
+    }
+    for (size_t i = 1; i < result.distance_offsets_.size(); ++i)
+        result.distance_offsets_[i] += result.distance_offsets_[i - 1];
+    result.distances_.shrink_to_fit();
+
+    result.BuildDistanceTables();
+
+    *this = Builder();
+    return result;
+}
@@ -1,14 +1,19 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <set>
 #include <unordered_set>
 #include <unordered_map>
 #include <iterator>
+#include <cstdint>
+#include <limits>
+#include <optional>
 
 #include "domain.h"
 #include "geo.h"
+#include "ranges.h"
 
 namespace serial
 {
@@ -18,12 +23,22 @@ namespace serial
 namespace transport
 {
 
+    // Транспортный справочник. Объект справочника неизменяем: он создаётся построителем
+    // TransportCatalogue::Builder, который накапливает описания остановок, маршрутов и
+    // расстояний, а затем одним вызовом Finalize() переводит их в компактное представление,
+    // оптимизированное для чтения. Все методы справочника константны и не изменяют его
+    // внутреннего состояния, поэтому один объект может без блокировок использоваться
+    // одновременно несколькими потоками.
     class TransportCatalogue
     {
     public:
 
-        void AddStop(const StopDescriptor& stop);
-        void AddBus(const BusDescriptor& bus);
+        class Builder;
+        class bus_name_iterator;
+        using BusNamesRange = ranges::Range<bus_name_iterator>;
+        using StopIdsRange = ranges::Range<const uint32_t*>;
+        using DeparturesRange = ranges::Range<const double*>;
+
         BusDescriptor GetBus(const std::string& bus_name) const;
         StopDescriptor GetStop(const std::string& stop_name) const;
         TCCommonMetric GetCommonMetric() const;
@@ -32,65 +47,118 @@ namespace transport
         // второй член - географическое расстояние по кратчайшей.
         std::pair<double, double> CountNeighborsDistance(const std::string& from_stop_name,
                                                          const std::string& to_stop_name) const;
+        // Таблица расстояний между соседними остановками маршрута с префиксными суммами.
+        // Возвращает nullptr, если маршрут не найден.
+        const BusDistanceTable* GetBusDistanceTable(const std::string& bus_name) const;
+        // Имена маршрутов, проходящих через остановку, без повторов и упорядоченные по алфавиту.
+        // Диапазон ссылается на данные справочника и не требует никаких выделений памяти.
+        // Возвращает nullopt, если остановка не найдена или не описана (является болванкой).
+        std::optional<BusNamesRange> GetBusesAtStop(std::string_view stop_name) const;
+
+        // Доступ к остановкам и маршрутам по их плотным номерам. Номера - это позиции в алфавитном
+        // порядке имён, они непрерывны (от 0 до количества остановок/маршрутов) и не меняются
+        // в течение жизни объекта справочника. Поиск номера по имени возвращает NO_ID, если имя не найдено.
+        static constexpr uint32_t NO_ID = std::numeric_limits<uint32_t>::max();
+        uint32_t FindStopId(std::string_view stop_name) const;
+        uint32_t FindBusId(std::string_view bus_name) const;
+        const std::string& GetStopName(uint32_t stop_id) const
+        {
+            return stops_[stop_id].stop_name;
+        }
+        const std::string& GetBusName(uint32_t bus_id) const
+        {
+            return buses_[bus_id].bus_name;
+        }
+        const BusDistanceTable& GetBusDistanceTable(uint32_t bus_id) const
+        {
+            return buses_[bus_id].distance_table;
+        }
+        BusType GetBusType(uint32_t bus_id) const
+        {
+            return buses_[bus_id].bus_type;
+        }
+        // Номера остановок маршрута в порядке их следования. Диапазон ссылается на данные справочника.
+        StopIdsRange GetBusStopIds(uint32_t bus_id) const
+        {
+            return StopIdsRange(bus_stops_.data() + buses_[bus_id].stops_begin, bus_stops_.data() + buses_[bus_id].stops_end);
+        }
+        // Времена отправления рейсов маршрута (пустой диапазон - расписания нет)
+        DeparturesRange GetBusDepartures(uint32_t bus_id) const
+        {
+            return DeparturesRange(bus_departures_.data() + buses_[bus_id].departures_begin,
+                                   bus_departures_.data() + buses_[bus_id].departures_end);
+        }
+        // Время ожидания на остановке и скорость автобусов маршрута, заданные в справочнике. nullopt - не заданы.
+        std::optional<double> GetStopWaitTime(uint32_t stop_id) const
+        {
+            return stops_[stop_id].wait_time;
+        }
+        std::optional<double> GetBusVelocity(uint32_t bus_id) const
+        {
+            return buses_[bus_id].velocity;
+        }
+        // Количество различных маршрутов, проходящих через остановку
+        size_t GetStopBusCount(uint32_t stop_id) const
+        {
+            return stop_buses_offsets_[stop_id + 1] - stop_buses_offsets_[stop_id];
+        }
 
     private:
 
         friend class serial::Serializer;
-        struct Bus;
+
+        // Остановки и маршруты хранятся в векторах, упорядоченных по именам. Позиция элемента
+        // в векторе служит его плотным номером (идентификатором), а поиск по имени выполняется
+        // двоичным поиском.
         struct Stop
         {
             StopType stop_type;
             std::string stop_name;
             detail::Coordinates stop_coords;
-            std::vector<const Bus*> buses_at_stop;
-            std::unordered_map<const Stop*, double> distance_to_stop;
-            bool operator==(const Stop& second_stop) const
-            {
-                return stop_name == second_stop.stop_name;
-            }
+            detail::CoordinatesTrig stop_trig; // Предвычисленные тригонометрические функции координат stop_coords
+            std::optional<double> wait_time;
         };
 
         struct Bus
         {
             BusType bus_type;
             std::string bus_name;
-            std::vector<const Stop*> bus_stops;
-            bool operator==(const Bus& second_bus) const
-            {
-                return bus_name == second_bus.bus_name;
-            }
+            uint32_t stops_begin; // Список остановок маршрута - bus_stops_[stops_begin..stops_end)
+            uint32_t stops_end;
+            uint32_t departures_begin; // Расписание маршрута - bus_departures_[departures_begin..departures_end)
+            uint32_t departures_end;
+            std::optional<double> velocity;
+            BusDistanceTable distance_table;
         };
 
-        class StopHasher
+        // Элемент таблицы дорожных расстояний: номер остановки назначения и расстояние до неё
+        struct DistanceToStop
         {
-        public:
-
-            size_t operator()(const Stop& stop) const
-            {
-                return std::hash<std::string>()(stop.stop_name);
-            }
-        };
-
-        class BusHasher
-        {
-        public:
-
-            size_t operator()(const Bus& bus) const
-            {
-                return std::hash<std::string>()(bus.bus_name);
-            }
+            uint32_t stop_id;
+            double distance;
         };
 
-        using StopsListType = std::unordered_set<Stop, StopHasher>;
-        using BusesListType = std::unordered_set<Bus, BusHasher>;
-
-        StopsListType stops_; //Массив зарегистрированных остановок
-        BusesListType buses_;  //Массив зарегистрированных маршрутов автобусов
+        std::vector<Stop> stops_; //Массив зарегистрированных остановок
+        std::vector<Bus> buses_;  //Массив зарегистрированных маршрутов автобусов
+        std::vector<uint32_t> bus_stops_; //Списки остановок всех маршрутов, записанные подряд
+        std::vector<double> bus_departures_; //Расписания всех маршрутов, записанные подряд
+        // Списки маршрутов, проходящих через остановку, в формате CSR: номера маршрутов для
+        // остановки i хранятся в stop_buses_[stop_buses_offsets_[i]..stop_buses_offsets_[i + 1]),
+        // без повторов и по возрастанию номеров (то есть в алфавитном порядке имён маршрутов).
+        std::vector<uint32_t> stop_buses_offsets_;
+        std::vector<uint32_t> stop_buses_;
+        // Таблица дорожных расстояний в формате CSR: расстояния от остановки с номером i хранятся
+        // в distances_[distance_offsets_[i]..distance_offsets_[i + 1]), упорядоченные по номеру
+        // остановки назначения.
+        std::vector<uint32_t> distance_offsets_;
+        std::vector<DistanceToStop> distances_;
 
         //Приватные методы класса
         StopDescriptor ConvertStopToExternalFormat(const Stop& stopi) const;
         BusDescriptor ConvertBusToExternalFormat(const Bus& busi) const;
-        decltype(stops_)::iterator MakeDumbStop(Stop& dumb_stop);
+        const DistanceToStop* FindDistance(uint32_t from_stop_id, uint32_t to_stop_id) const;
+        double GetRoadDistance(uint32_t from_stop_id, uint32_t to_stop_id, double geo_distance) const;
+        void BuildDistanceTables();
 
     public:
 
@@ -178,8 +246,50 @@ namespace transport
             mutable StopDescriptor temp_stop_desc_;
         };
 
+        // Итератор по номерам маршрутов, при разыменовании возвращающий имя маршрута.
+        class bus_name_iterator : public std::iterator<std::forward_iterator_tag, std::string>
+        {
+        public:
+            explicit bus_name_iterator(const TransportCatalogue& tc, const uint32_t* bus_id_ptr) :
+                                       tc_(&tc), bus_id_ptr_(bus_id_ptr)
+            {}
+
+            bus_name_iterator& operator++()
+            {
+                ++bus_id_ptr_;
+                return *this;
+            }
+
+            bus_name_iterator operator++(int)
+            {
+                bus_name_iterator retval = *this;
+                ++(*this);
+                return retval;
+            }
+
+            bool operator==(bus_name_iterator other) const
+            {
+                return bus_id_ptr_ == other.bus_id_ptr_;
+            }
+
+            bool operator!=(bus_name_iterator other) const
+            {
+                return !(*this == other);
+            }
+
+            const std::string& operator*() const
+            {
+                return tc_->buses_[*bus_id_ptr_].bus_name;
+            }
+
+        private:
+            const TransportCatalogue* tc_;
+            const uint32_t* bus_id_ptr_;
+        };
+
         friend class iterator;
         friend class stop_iterator;
+        friend class bus_name_iterator;
         iterator begin() const
         {
             return iterator(*this, false);
@@ -201,4 +311,72 @@ namespace transport
         }
     };
 
+    // Построитель транспортного справочника. Описания остановок, маршрутов и расстояний
+    // только дописываются в его внутренние массивы, никаких перестроений структур данных
+    // при этом не происходит. Остановки, упомянутые в маршрутах или расстояниях, но так
+    // и не описанные, попадают в справочник как "болванки" с типом STOPTYPE_UNDEFINED.
+    // Повторные описания уже описанных остановки или маршрута игнорируются.
+    class TransportCatalogue::Builder
+    {
+    public:
+
+        Builder() = default;
+        // Создаёт построитель, уже содержащий все данные справочника tc, для его дополнения.
+        explicit Builder(const TransportCatalogue& tc);
+
+        // Остановка с типом STOPTYPE_UNDEFINED лишь регистрирует своё имя.
+        void AddStop(const StopDescriptor& stop);
+        void AddBus(const BusDescriptor& bus);
+        // Методы правки данных, используемые при дополнении уже построенного справочника.
+        // UpdateStop заменяет координаты и время ожидания остановки и добавляет или заменяет расстояния от неё.
+        void UpdateStop(const StopDescriptor& stop);
+        // Удаляет остановку вместе с расстояниями от неё и до неё. Если удалённая остановка всё ещё
+        // входит в какой-либо маршрут, Finalize() выбрасывает исключение std::invalid_argument.
+        void RemoveStop(const std::string& stop_name);
+        void RemoveDistance(const std::string& from_stop_name, const std::string& to_stop_name);
+        // Возвращает false, если маршрута с таким именем нет.
+        bool RemoveBus(const std::string& bus_name);
+        // Переводит накопленные данные в неизменяемый справочник, построитель при этом опустошается.
+        TransportCatalogue Finalize();
+
+    private:
+
+        struct StopRecord
+        {
+            StopType stop_type;
+            std::string stop_name;
+            detail::Coordinates stop_coords;
+            std::optional<double> wait_time;
+            bool is_removed = false;
+        };
+
+        struct BusRecord
+        {
+            BusType bus_type;
+            std::string bus_name;
+            uint32_t stops_begin;
+            uint32_t stops_end;
+            std::vector<double> departures;
+            std::optional<double> velocity;
+        };
+
+        struct DistanceRecord
+        {
+            uint32_t from_stop_id;
+            uint32_t to_stop_id;
+            double distance;
+            bool is_removed; // Запись отменяет ранее заданное расстояние, значение distance не используется
+        };
+
+        // Номера остановок в построителе - временные, в порядке первого упоминания остановки.
+        std::vector<StopRecord> stops_;
+        std::vector<BusRecord> buses_;
+        std::vector<uint32_t> bus_stops_;
+        std::vector<DistanceRecord> distances_;
+        std::unordered_map<std::string, uint32_t> stop_name_to_id_;
+        std::unordered_map<std::string, uint32_t> bus_name_to_id_; // Позиции маршрутов в buses_
+
+        uint32_t GetStopId(const std::string& stop_name);
+    };
+
 } //namespace transport
@@ -16,185 +16,239 @@
 #include <google/protobuf/port_def.inc>
 
 PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
 namespace TransCatSerial {
-constexpr StopNameToVertex::StopNameToVertex(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : stop_name_num_(0u)
-  , vertex_id_(0u){}
+PROTOBUF_CONSTEXPR StopNameToVertex::StopNameToVertex(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stop_name_num_)*/0u
+  , /*decltype(_impl_.vertex_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct StopNameToVertexDefaultTypeInternal {
-  constexpr StopNameToVertexDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR StopNameToVertexDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~StopNameToVertexDefaultTypeInternal() {}
   union {
     StopNameToVertex _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT StopNameToVertexDefaultTypeInternal _StopNameToVertex_default_instance_;
-constexpr StopNameToVertexList::StopNameToVertexList(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : stop_name_to_vertex_(){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StopNameToVertexDefaultTypeInternal _StopNameToVertex_default_instance_;
+PROTOBUF_CONSTEXPR StopNameToVertexList::StopNameToVertexList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stop_name_to_vertex_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct StopNameToVertexListDefaultTypeInternal {
-  constexpr StopNameToVertexListDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR StopNameToVertexListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~StopNameToVertexListDefaultTypeInternal() {}
   union {
     StopNameToVertexList _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT StopNameToVertexListDefaultTypeInternal _StopNameToVertexList_default_instance_;
-constexpr EdgeDescriptor::EdgeDescriptor(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : edge_type_(0)
-
-  , from_stop_num_(0u)
-  , to_stop_num_(0u)
-  , bus_name_num_(0u)
-  , time_length_(0)
-  , span_count_(0u){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StopNameToVertexListDefaultTypeInternal _StopNameToVertexList_default_instance_;
+PROTOBUF_CONSTEXPR EdgeDescriptor::EdgeDescriptor(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.edge_type_)*/0
+  , /*decltype(_impl_.from_stop_num_)*/0u
+  , /*decltype(_impl_.to_stop_num_)*/0u
+  , /*decltype(_impl_.bus_name_num_)*/0u
+  , /*decltype(_impl_.time_length_)*/0
+  , /*decltype(_impl_.span_count_)*/0u
+  , /*decltype(_impl_.from_position_)*/0u
+  , /*decltype(_impl_.is_backward_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct EdgeDescriptorDefaultTypeInternal {
-  constexpr EdgeDescriptorDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR EdgeDescriptorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~EdgeDescriptorDefaultTypeInternal() {}
   union {
     EdgeDescriptor _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT EdgeDescriptorDefaultTypeInternal _EdgeDescriptor_default_instance_;
-constexpr EdgeToDesc::EdgeToDesc(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : edge_descriptor_(nullptr)
-  , edge_id_(0u){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EdgeDescriptorDefaultTypeInternal _EdgeDescriptor_default_instance_;
+PROTOBUF_CONSTEXPR EdgeToDesc::EdgeToDesc(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.edge_descriptor_)*/nullptr
+  , /*decltype(_impl_.edge_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct EdgeToDescDefaultTypeInternal {
-  constexpr EdgeToDescDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR EdgeToDescDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~EdgeToDescDefaultTypeInternal() {}
   union {
     EdgeToDesc _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT EdgeToDescDefaultTypeInternal _EdgeToDesc_default_instance_;
-constexpr EdgeToDescList::EdgeToDescList(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : edge_to_desc_(){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EdgeToDescDefaultTypeInternal _EdgeToDesc_default_instance_;
+PROTOBUF_CONSTEXPR EdgeToDescList::EdgeToDescList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.edge_to_desc_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct EdgeToDescListDefaultTypeInternal {
-  constexpr EdgeToDescListDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR EdgeToDescListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~EdgeToDescListDefaultTypeInternal() {}
   union {
     EdgeToDescList _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT EdgeToDescListDefaultTypeInternal _EdgeToDescList_default_instance_;
-constexpr Coordinates::Coordinates(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : lat_(0)
-  , lng_(0){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EdgeToDescListDefaultTypeInternal _EdgeToDescList_default_instance_;
+PROTOBUF_CONSTEXPR Coordinates::Coordinates(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.lat_)*/0
+  , /*decltype(_impl_.lng_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct CoordinatesDefaultTypeInternal {
-  constexpr CoordinatesDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR CoordinatesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~CoordinatesDefaultTypeInternal() {}
   union {
     Coordinates _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT CoordinatesDefaultTypeInternal _Coordinates_default_instance_;
-constexpr DistanceToStop::DistanceToStop(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : distance_(0)
-  , stop_num_(0u){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CoordinatesDefaultTypeInternal _Coordinates_default_instance_;
+PROTOBUF_CONSTEXPR DistanceToStop::DistanceToStop(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.distance_)*/0
+  , /*decltype(_impl_.stop_num_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct DistanceToStopDefaultTypeInternal {
-  constexpr DistanceToStopDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR DistanceToStopDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~DistanceToStopDefaultTypeInternal() {}
   union {
     DistanceToStop _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT DistanceToStopDefaultTypeInternal _DistanceToStop_default_instance_;
-constexpr Stop::Stop(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : buses_at_stop_()
-  , _buses_at_stop_cached_byte_size_(0)
-  , distance_to_stop_()
-  , stop_name_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , stop_coords_(nullptr)
-  , stop_type_(0)
-{}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DistanceToStopDefaultTypeInternal _DistanceToStop_default_instance_;
+PROTOBUF_CONSTEXPR Stop::Stop(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.buses_at_stop_)*/{}
+  , /*decltype(_impl_._buses_at_stop_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.distance_to_stop_)*/{}
+  , /*decltype(_impl_.stop_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.stop_coords_)*/nullptr
+  , /*decltype(_impl_.wait_time_)*/0
+  , /*decltype(_impl_.stop_type_)*/0} {}
 struct StopDefaultTypeInternal {
-  constexpr StopDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR StopDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~StopDefaultTypeInternal() {}
   union {
     Stop _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT StopDefaultTypeInternal _Stop_default_instance_;
-constexpr Bus::Bus(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : bus_stops_()
-  , _bus_stops_cached_byte_size_(0)
-  , bus_name_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , bus_type_(0)
-{}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StopDefaultTypeInternal _Stop_default_instance_;
+PROTOBUF_CONSTEXPR Bus::Bus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.bus_stops_)*/{}
+  , /*decltype(_impl_._bus_stops_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.departures_)*/{}
+  , /*decltype(_impl_.bus_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.velocity_)*/0
+  , /*decltype(_impl_.bus_type_)*/0} {}
 struct BusDefaultTypeInternal {
-  constexpr BusDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR BusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~BusDefaultTypeInternal() {}
   union {
     Bus _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT BusDefaultTypeInternal _Bus_default_instance_;
-constexpr StopList::StopList(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : stops_(){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BusDefaultTypeInternal _Bus_default_instance_;
+PROTOBUF_CONSTEXPR StopList::StopList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stops_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct StopListDefaultTypeInternal {
-  constexpr StopListDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR StopListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~StopListDefaultTypeInternal() {}
   union {
     StopList _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT StopListDefaultTypeInternal _StopList_default_instance_;
-constexpr BusList::BusList(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : buses_(){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StopListDefaultTypeInternal _StopList_default_instance_;
+PROTOBUF_CONSTEXPR BusList::BusList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.buses_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct BusListDefaultTypeInternal {
-  constexpr BusListDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR BusListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~BusListDefaultTypeInternal() {}
   union {
     BusList _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT BusListDefaultTypeInternal _BusList_default_instance_;
-constexpr TransportCatalogue::TransportCatalogue(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : stops_(nullptr)
-  , buses_(nullptr)
-  , router_context_(nullptr)
-  , render_context_(nullptr)
-  , stop_name_to_enter_vertex_(nullptr)
-  , stop_name_to_exit_vertex_(nullptr)
-  , edge_to_desc_(nullptr)
-  , edges_(nullptr)
-  , incidence_lists_(nullptr)
-  , routes_data_(nullptr)
-  , is_routes_data_(false){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BusListDefaultTypeInternal _BusList_default_instance_;
+PROTOBUF_CONSTEXPR TransportCatalogue::TransportCatalogue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stops_)*/nullptr
+  , /*decltype(_impl_.buses_)*/nullptr
+  , /*decltype(_impl_.router_context_)*/nullptr
+  , /*decltype(_impl_.render_context_)*/nullptr
+  , /*decltype(_impl_.stop_name_to_enter_vertex_)*/nullptr
+  , /*decltype(_impl_.stop_name_to_exit_vertex_)*/nullptr
+  , /*decltype(_impl_.edge_to_desc_)*/nullptr
+  , /*decltype(_impl_.edges_)*/nullptr
+  , /*decltype(_impl_.incidence_lists_)*/nullptr
+  , /*decltype(_impl_.routes_data_)*/nullptr
+  , /*decltype(_impl_.packed_routes_data_)*/nullptr
+  , /*decltype(_impl_.contraction_hierarchy_)*/nullptr
+  , /*decltype(_impl_.hub_labels_)*/nullptr
+  , /*decltype(_impl_.is_routes_data_)*/false
+  , /*decltype(_impl_.format_version_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct TransportCatalogueDefaultTypeInternal {
-  constexpr TransportCatalogueDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR TransportCatalogueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~TransportCatalogueDefaultTypeInternal() {}
   union {
     TransportCatalogue _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT TransportCatalogueDefaultTypeInternal _TransportCatalogue_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransportCatalogueDefaultTypeInternal _TransportCatalogue_default_instance_;
+PROTOBUF_CONSTEXPR BaseSection::BaseSection(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.offset_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.compressed_)*/false
+  , /*decltype(_impl_.size_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BaseSectionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BaseSectionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BaseSectionDefaultTypeInternal() {}
+  union {
+    BaseSection _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BaseSectionDefaultTypeInternal _BaseSection_default_instance_;
+PROTOBUF_CONSTEXPR BaseIndex::BaseIndex(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sections_)*/{}
+  , /*decltype(_impl_.format_version_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BaseIndexDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BaseIndexDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BaseIndexDefaultTypeInternal() {}
+  union {
+    BaseIndex _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BaseIndexDefaultTypeInternal _BaseIndex_default_instance_;
 }  // namespace TransCatSerial
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_transport_5fcatalogue_2eproto[12];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_transport_5fcatalogue_2eproto[3];
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_transport_5fcatalogue_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_transport_5fcatalogue_2eproto[14];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_transport_5fcatalogue_2eproto[4];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_transport_5fcatalogue_2eproto = nullptr;
 
 const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
@@ -203,138 +257,180 @@ const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SEC
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::StopNameToVertex, stop_name_num_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::StopNameToVertex, vertex_id_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::StopNameToVertex, _impl_.stop_name_num_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::StopNameToVertex, _impl_.vertex_id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::StopNameToVertexList, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::StopNameToVertexList, stop_name_to_vertex_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::StopNameToVertexList, _impl_.stop_name_to_vertex_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeDescriptor, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeDescriptor, edge_type_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeDescriptor, from_stop_num_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeDescriptor, to_stop_num_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeDescriptor, bus_name_num_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeDescriptor, span_count_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeDescriptor, time_length_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeDescriptor, _impl_.edge_type_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeDescriptor, _impl_.from_stop_num_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeDescriptor, _impl_.to_stop_num_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeDescriptor, _impl_.bus_name_num_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeDescriptor, _impl_.span_count_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeDescriptor, _impl_.time_length_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeDescriptor, _impl_.from_position_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeDescriptor, _impl_.is_backward_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeToDesc, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeToDesc, edge_id_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeToDesc, edge_descriptor_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeToDesc, _impl_.edge_id_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeToDesc, _impl_.edge_descriptor_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeToDescList, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeToDescList, edge_to_desc_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::EdgeToDescList, _impl_.edge_to_desc_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::Coordinates, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Coordinates, lat_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Coordinates, lng_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Coordinates, _impl_.lat_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Coordinates, _impl_.lng_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::DistanceToStop, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::DistanceToStop, stop_num_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::DistanceToStop, distance_),
-  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::DistanceToStop, _impl_.stop_num_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::DistanceToStop, _impl_.distance_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Stop, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::Stop, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Stop, stop_type_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Stop, stop_name_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Stop, stop_coords_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Stop, buses_at_stop_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Stop, distance_to_stop_),
-  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Stop, _impl_.stop_type_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Stop, _impl_.stop_name_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Stop, _impl_.stop_coords_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Stop, _impl_.buses_at_stop_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Stop, _impl_.distance_to_stop_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Stop, _impl_.wait_time_),
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Bus, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::Bus, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Bus, bus_type_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Bus, bus_name_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Bus, bus_stops_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Bus, _impl_.bus_type_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Bus, _impl_.bus_name_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Bus, _impl_.bus_stops_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Bus, _impl_.departures_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::Bus, _impl_.velocity_),
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::StopList, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::StopList, stops_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::StopList, _impl_.stops_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::BusList, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::BusList, buses_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::BusList, _impl_.buses_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, stops_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, buses_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, router_context_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, render_context_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, is_routes_data_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, stop_name_to_enter_vertex_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, stop_name_to_exit_vertex_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, edge_to_desc_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, edges_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, incidence_lists_),
-  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, routes_data_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _impl_.stops_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _impl_.buses_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _impl_.router_context_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _impl_.render_context_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _impl_.is_routes_data_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _impl_.stop_name_to_enter_vertex_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _impl_.stop_name_to_exit_vertex_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _impl_.edge_to_desc_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _impl_.edges_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _impl_.incidence_lists_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _impl_.routes_data_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _impl_.format_version_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _impl_.packed_routes_data_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _impl_.contraction_hierarchy_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::TransportCatalogue, _impl_.hub_labels_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::BaseSection, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::BaseSection, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::BaseSection, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::BaseSection, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::BaseSection, _impl_.compressed_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::BaseIndex, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::BaseIndex, _impl_.format_version_),
+  PROTOBUF_FIELD_OFFSET(::TransCatSerial::BaseIndex, _impl_.sections_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::TransCatSerial::StopNameToVertex)},
   { 8, -1, -1, sizeof(::TransCatSerial::StopNameToVertexList)},
   { 15, -1, -1, sizeof(::TransCatSerial::EdgeDescriptor)},
-  { 27, -1, -1, sizeof(::TransCatSerial::EdgeToDesc)},
-  { 35, -1, -1, sizeof(::TransCatSerial::EdgeToDescList)},
-  { 42, -1, -1, sizeof(::TransCatSerial::Coordinates)},
-  { 50, -1, -1, sizeof(::TransCatSerial::DistanceToStop)},
-  { 58, -1, -1, sizeof(::TransCatSerial::Stop)},
-  { 69, -1, -1, sizeof(::TransCatSerial::Bus)},
-  { 78, -1, -1, sizeof(::TransCatSerial::StopList)},
-  { 85, -1, -1, sizeof(::TransCatSerial::BusList)},
-  { 92, -1, -1, sizeof(::TransCatSerial::TransportCatalogue)},
+  { 29, -1, -1, sizeof(::TransCatSerial::EdgeToDesc)},
+  { 37, -1, -1, sizeof(::TransCatSerial::EdgeToDescList)},
+  { 44, -1, -1, sizeof(::TransCatSerial::Coordinates)},
+  { 52, -1, -1, sizeof(::TransCatSerial::DistanceToStop)},
+  { 60, 72, -1, sizeof(::TransCatSerial::Stop)},
+  { 78, 89, -1, sizeof(::TransCatSerial::Bus)},
+  { 94, -1, -1, sizeof(::TransCatSerial::StopList)},
+  { 101, -1, -1, sizeof(::TransCatSerial::BusList)},
+  { 108, -1, -1, sizeof(::TransCatSerial::TransportCatalogue)},
+  { 129, -1, -1, sizeof(::TransCatSerial::BaseSection)},
+  { 139, -1, -1, sizeof(::TransCatSerial::BaseIndex)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_StopNameToVertex_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_StopNameToVertexList_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_EdgeDescriptor_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_EdgeToDesc_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_EdgeToDescList_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_Coordinates_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_DistanceToStop_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_Stop_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_Bus_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_StopList_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_BusList_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TransCatSerial::_TransportCatalogue_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::TransCatSerial::_StopNameToVertex_default_instance_._instance,
+  &::TransCatSerial::_StopNameToVertexList_default_instance_._instance,
+  &::TransCatSerial::_EdgeDescriptor_default_instance_._instance,
+  &::TransCatSerial::_EdgeToDesc_default_instance_._instance,
+  &::TransCatSerial::_EdgeToDescList_default_instance_._instance,
+  &::TransCatSerial::_Coordinates_default_instance_._instance,
+  &::TransCatSerial::_DistanceToStop_default_instance_._instance,
+  &::TransCatSerial::_Stop_default_instance_._instance,
+  &::TransCatSerial::_Bus_default_instance_._instance,
+  &::TransCatSerial::_StopList_default_instance_._instance,
+  &::TransCatSerial::_BusList_default_instance_._instance,
+  &::TransCatSerial::_TransportCatalogue_default_instance_._instance,
+  &::TransCatSerial::_BaseSection_default_instance_._instance,
+  &::TransCatSerial::_BaseIndex_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_transport_5fcatalogue_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -343,66 +439,85 @@ const char descriptor_table_protodef_transport_5fcatalogue_2eproto[] PROTOBUF_SE
   "StopNameToVertex\022\025\n\rstop_name_num\030\001 \001(\r\022"
   "\021\n\tvertex_id\030\002 \001(\r\"U\n\024StopNameToVertexLi"
   "st\022=\n\023stop_name_to_vertex\030\001 \003(\0132 .TransC"
-  "atSerial.StopNameToVertex\"\370\001\n\016EdgeDescri"
+  "atSerial.StopNameToVertex\"\244\002\n\016EdgeDescri"
   "ptor\022:\n\tedge_type\030\001 \001(\0162\'.TransCatSerial"
   ".EdgeDescriptor.EdgeType\022\025\n\rfrom_stop_nu"
   "m\030\002 \001(\r\022\023\n\013to_stop_num\030\003 \001(\r\022\024\n\014bus_name"
   "_num\030\004 \001(\r\022\022\n\nspan_count\030\005 \001(\r\022\023\n\013time_l"
-  "ength\030\006 \001(\001\"\?\n\010EdgeType\022\020\n\014EDGE_UNKNOWN\020"
-  "\000\022\016\n\nEDGE_STAGE\020\001\022\021\n\rEDGE_TRANSFER\020\002\"V\n\n"
-  "EdgeToDesc\022\017\n\007edge_id\030\001 \001(\r\0227\n\017edge_desc"
-  "riptor\030\002 \001(\0132\036.TransCatSerial.EdgeDescri"
-  "ptor\"B\n\016EdgeToDescList\0220\n\014edge_to_desc\030\001"
-  " \003(\0132\032.TransCatSerial.EdgeToDesc\"\'\n\013Coor"
-  "dinates\022\013\n\003lat\030\001 \001(\001\022\013\n\003lng\030\002 \001(\001\"4\n\016Dis"
-  "tanceToStop\022\020\n\010stop_num\030\001 \001(\r\022\020\n\010distanc"
-  "e\030\002 \001(\001\"\210\002\n\004Stop\0220\n\tstop_type\030\001 \001(\0162\035.Tr"
-  "ansCatSerial.Stop.StopType\022\021\n\tstop_name\030"
-  "\002 \001(\014\0220\n\013stop_coords\030\003 \001(\0132\033.TransCatSer"
-  "ial.Coordinates\022\025\n\rbuses_at_stop\030\004 \003(\r\0228"
-  "\n\020distance_to_stop\030\005 \003(\0132\036.TransCatSeria"
-  "l.DistanceToStop\"8\n\010StopType\022\026\n\022STOPTYPE"
-  "_UNDEFINED\020\000\022\024\n\020STOPTYPE_ORDINAR\020\001\"\246\001\n\003B"
-  "us\022-\n\010bus_type\030\001 \001(\0162\033.TransCatSerial.Bu"
-  "s.BusType\022\020\n\010bus_name\030\002 \001(\014\022\021\n\tbus_stops"
-  "\030\003 \003(\r\"K\n\007BusType\022\025\n\021BUSTYPE_UNDEFINED\020\000"
-  "\022\023\n\017BUSTYPE_ORDINAR\020\001\022\024\n\020BUSTYPE_CIRCULA"
-  "R\020\002\"/\n\010StopList\022#\n\005stops\030\001 \003(\0132\024.TransCa"
-  "tSerial.Stop\"-\n\007BusList\022\"\n\005buses\030\002 \003(\0132\023"
-  ".TransCatSerial.Bus\"\307\004\n\022TransportCatalog"
-  "ue\022\'\n\005stops\030\001 \001(\0132\030.TransCatSerial.StopL"
-  "ist\022&\n\005buses\030\002 \001(\0132\027.TransCatSerial.BusL"
-  "ist\0225\n\016router_context\030\003 \001(\0132\035.TransCatSe"
-  "rial.RouterContext\022:\n\016render_context\030\004 \001"
-  "(\0132\".TransCatSerial.MapRendererContext\022\026"
-  "\n\016is_routes_data\030\005 \001(\010\022G\n\031stop_name_to_e"
-  "nter_vertex\030\006 \001(\0132$.TransCatSerial.StopN"
-  "ameToVertexList\022F\n\030stop_name_to_exit_ver"
-  "tex\030\007 \001(\0132$.TransCatSerial.StopNameToVer"
-  "texList\0224\n\014edge_to_desc\030\010 \001(\0132\036.TransCat"
-  "Serial.EdgeToDescList\022$\n\005edges\030\t \001(\0132\025.T"
-  "ransCatSerial.Edges\0227\n\017incidence_lists\030\n"
-  " \001(\0132\036.TransCatSerial.IncidenceLists\022/\n\013"
-  "routes_data\030\013 \001(\0132\032.TransCatSerial.Route"
-  "sDatab\006proto3"
+  "ength\030\006 \001(\001\022\025\n\rfrom_position\030\007 \001(\r\022\023\n\013is"
+  "_backward\030\010 \001(\010\"\?\n\010EdgeType\022\020\n\014EDGE_UNKN"
+  "OWN\020\000\022\016\n\nEDGE_STAGE\020\001\022\021\n\rEDGE_TRANSFER\020\002"
+  "\"V\n\nEdgeToDesc\022\017\n\007edge_id\030\001 \001(\r\0227\n\017edge_"
+  "descriptor\030\002 \001(\0132\036.TransCatSerial.EdgeDe"
+  "scriptor\"B\n\016EdgeToDescList\0220\n\014edge_to_de"
+  "sc\030\001 \003(\0132\032.TransCatSerial.EdgeToDesc\"\'\n\013"
+  "Coordinates\022\013\n\003lat\030\001 \001(\001\022\013\n\003lng\030\002 \001(\001\"4\n"
+  "\016DistanceToStop\022\020\n\010stop_num\030\001 \001(\r\022\020\n\010dis"
+  "tance\030\002 \001(\001\"\256\002\n\004Stop\0220\n\tstop_type\030\001 \001(\0162"
+  "\035.TransCatSerial.Stop.StopType\022\021\n\tstop_n"
+  "ame\030\002 \001(\014\0220\n\013stop_coords\030\003 \001(\0132\033.TransCa"
+  "tSerial.Coordinates\022\025\n\rbuses_at_stop\030\004 \003"
+  "(\r\0228\n\020distance_to_stop\030\005 \003(\0132\036.TransCatS"
+  "erial.DistanceToStop\022\026\n\twait_time\030\006 \001(\001H"
+  "\000\210\001\001\"8\n\010StopType\022\026\n\022STOPTYPE_UNDEFINED\020\000"
+  "\022\024\n\020STOPTYPE_ORDINAR\020\001B\014\n\n_wait_time\"\336\001\n"
+  "\003Bus\022-\n\010bus_type\030\001 \001(\0162\033.TransCatSerial."
+  "Bus.BusType\022\020\n\010bus_name\030\002 \001(\014\022\021\n\tbus_sto"
+  "ps\030\003 \003(\r\022\022\n\ndepartures\030\004 \003(\001\022\025\n\010velocity"
+  "\030\005 \001(\001H\000\210\001\001\"K\n\007BusType\022\025\n\021BUSTYPE_UNDEFI"
+  "NED\020\000\022\023\n\017BUSTYPE_ORDINAR\020\001\022\024\n\020BUSTYPE_CI"
+  "RCULAR\020\002B\013\n\t_velocity\"/\n\010StopList\022#\n\005sto"
+  "ps\030\001 \003(\0132\024.TransCatSerial.Stop\"-\n\007BusLis"
+  "t\022\"\n\005buses\030\002 \003(\0132\023.TransCatSerial.Bus\"\221\006"
+  "\n\022TransportCatalogue\022\'\n\005stops\030\001 \001(\0132\030.Tr"
+  "ansCatSerial.StopList\022&\n\005buses\030\002 \001(\0132\027.T"
+  "ransCatSerial.BusList\0225\n\016router_context\030"
+  "\003 \001(\0132\035.TransCatSerial.RouterContext\022:\n\016"
+  "render_context\030\004 \001(\0132\".TransCatSerial.Ma"
+  "pRendererContext\022\026\n\016is_routes_data\030\005 \001(\010"
+  "\022G\n\031stop_name_to_enter_vertex\030\006 \001(\0132$.Tr"
+  "ansCatSerial.StopNameToVertexList\022F\n\030sto"
+  "p_name_to_exit_vertex\030\007 \001(\0132$.TransCatSe"
+  "rial.StopNameToVertexList\0224\n\014edge_to_des"
+  "c\030\010 \001(\0132\036.TransCatSerial.EdgeToDescList\022"
+  "$\n\005edges\030\t \001(\0132\025.TransCatSerial.Edges\0227\n"
+  "\017incidence_lists\030\n \001(\0132\036.TransCatSerial."
+  "IncidenceLists\022/\n\013routes_data\030\013 \001(\0132\032.Tr"
+  "ansCatSerial.RoutesData\022\026\n\016format_versio"
+  "n\030\014 \001(\r\022<\n\022packed_routes_data\030\r \001(\0132 .Tr"
+  "ansCatSerial.PackedRoutesData\022C\n\025contrac"
+  "tion_hierarchy\030\016 \001(\0132$.TransCatSerial.Co"
+  "ntractionHierarchy\022-\n\nhub_labels\030\017 \001(\0132\031"
+  ".TransCatSerial.HubLabels\"\376\001\n\013BaseSectio"
+  "n\0225\n\004type\030\001 \001(\0162\'.TransCatSerial.BaseSec"
+  "tion.SectionType\022\016\n\006offset\030\002 \001(\004\022\014\n\004size"
+  "\030\003 \001(\004\022\022\n\ncompressed\030\004 \001(\010\"\205\001\n\013SectionTy"
+  "pe\022\023\n\017SECTION_UNKNOWN\020\000\022\025\n\021SECTION_CATAL"
+  "OGUE\020\001\022\032\n\026SECTION_ROUTER_CONTEXT\020\002\022\032\n\026SE"
+  "CTION_RENDER_CONTEXT\020\003\022\022\n\016SECTION_ROUTER"
+  "\020\004\"R\n\tBaseIndex\022\026\n\016format_version\030\001 \001(\r\022"
+  "-\n\010sections\030\002 \003(\0132\033.TransCatSerial.BaseS"
+  "ectionb\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_transport_5fcatalogue_2eproto_deps[2] = {
+static const ::_pbi::DescriptorTable* const descriptor_table_transport_5fcatalogue_2eproto_deps[2] = {
   &::descriptor_table_graph_2eproto,
   &::descriptor_table_map_5frenderer_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_transport_5fcatalogue_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transport_5fcatalogue_2eproto = {
-  false, false, 1853, descriptor_table_protodef_transport_5fcatalogue_2eproto, "transport_catalogue.proto", 
-  &descriptor_table_transport_5fcatalogue_2eproto_once, descriptor_table_transport_5fcatalogue_2eproto_deps, 2, 12,
-  schemas, file_default_instances, TableStruct_transport_5fcatalogue_2eproto::offsets,
-  file_level_metadata_transport_5fcatalogue_2eproto, file_level_enum_descriptors_transport_5fcatalogue_2eproto, file_level_service_descriptors_transport_5fcatalogue_2eproto,
+static ::_pbi::once_flag descriptor_table_transport_5fcatalogue_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_transport_5fcatalogue_2eproto = {
+    false, false, 2534, descriptor_table_protodef_transport_5fcatalogue_2eproto,
+    "transport_catalogue.proto",
+    &descriptor_table_transport_5fcatalogue_2eproto_once, descriptor_table_transport_5fcatalogue_2eproto_deps, 2, 14,
+    schemas, file_default_instances, TableStruct_transport_5fcatalogue_2eproto::offsets,
+    file_level_metadata_transport_5fcatalogue_2eproto, file_level_enum_descriptors_transport_5fcatalogue_2eproto,
+    file_level_service_descriptors_transport_5fcatalogue_2eproto,
 };
-PROTOBUF_ATTRIBUTE_WEAK const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable* descriptor_table_transport_5fcatalogue_2eproto_getter() {
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_transport_5fcatalogue_2eproto_getter() {
   return &descriptor_table_transport_5fcatalogue_2eproto;
 }
 
 // Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY static ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptorsRunner dynamic_init_dummy_transport_5fcatalogue_2eproto(&descriptor_table_transport_5fcatalogue_2eproto);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_transport_5fcatalogue_2eproto(&descriptor_table_transport_5fcatalogue_2eproto);
 namespace TransCatSerial {
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EdgeDescriptor_EdgeType_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transport_5fcatalogue_2eproto);
@@ -471,6 +586,33 @@ constexpr Bus_BusType Bus::BusType_MIN;
 constexpr Bus_BusType Bus::BusType_MAX;
 constexpr int Bus::BusType_ARRAYSIZE;
 #endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* BaseSection_SectionType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transport_5fcatalogue_2eproto);
+  return file_level_enum_descriptors_transport_5fcatalogue_2eproto[3];
+}
+bool BaseSection_SectionType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr BaseSection_SectionType BaseSection::SECTION_UNKNOWN;
+constexpr BaseSection_SectionType BaseSection::SECTION_CATALOGUE;
+constexpr BaseSection_SectionType BaseSection::SECTION_ROUTER_CONTEXT;
+constexpr BaseSection_SectionType BaseSection::SECTION_RENDER_CONTEXT;
+constexpr BaseSection_SectionType BaseSection::SECTION_ROUTER;
+constexpr BaseSection_SectionType BaseSection::SectionType_MIN;
+constexpr BaseSection_SectionType BaseSection::SectionType_MAX;
+constexpr int BaseSection::SectionType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
@@ -481,47 +623,50 @@ class StopNameToVertex::_Internal {
 StopNameToVertex::StopNameToVertex(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.StopNameToVertex)
 }
 StopNameToVertex::StopNameToVertex(const StopNameToVertex& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StopNameToVertex* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stop_name_num_){}
+    , decltype(_impl_.vertex_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&stop_name_num_, &from.stop_name_num_,
-    static_cast<size_t>(reinterpret_cast<char*>(&vertex_id_) -
-    reinterpret_cast<char*>(&stop_name_num_)) + sizeof(vertex_id_));
+  ::memcpy(&_impl_.stop_name_num_, &from._impl_.stop_name_num_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.vertex_id_) -
+    reinterpret_cast<char*>(&_impl_.stop_name_num_)) + sizeof(_impl_.vertex_id_));
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.StopNameToVertex)
 }
 
-inline void StopNameToVertex::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&stop_name_num_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&vertex_id_) -
-    reinterpret_cast<char*>(&stop_name_num_)) + sizeof(vertex_id_));
+inline void StopNameToVertex::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stop_name_num_){0u}
+    , decltype(_impl_.vertex_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 StopNameToVertex::~StopNameToVertex() {
   // @@protoc_insertion_point(destructor:TransCatSerial.StopNameToVertex)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void StopNameToVertex::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void StopNameToVertex::ArenaDtor(void* object) {
-  StopNameToVertex* _this = reinterpret_cast< StopNameToVertex* >(object);
-  (void)_this;
-}
-void StopNameToVertex::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void StopNameToVertex::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void StopNameToVertex::Clear() {
@@ -530,22 +675,22 @@ void StopNameToVertex::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&stop_name_num_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&vertex_id_) -
-      reinterpret_cast<char*>(&stop_name_num_)) + sizeof(vertex_id_));
+  ::memset(&_impl_.stop_name_num_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.vertex_id_) -
+      reinterpret_cast<char*>(&_impl_.stop_name_num_)) + sizeof(_impl_.vertex_id_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* StopNameToVertex::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* StopNameToVertex::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // uint32 stop_name_num = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          stop_name_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.stop_name_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -553,7 +698,7 @@ const char* StopNameToVertex::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPA
       // uint32 vertex_id = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          vertex_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.vertex_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -590,17 +735,17 @@ uint8_t* StopNameToVertex::_InternalSerialize(
   // uint32 stop_name_num = 1;
   if (this->_internal_stop_name_num() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_stop_name_num(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_stop_name_num(), target);
   }
 
   // uint32 vertex_id = 2;
   if (this->_internal_vertex_id() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_vertex_id(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_vertex_id(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.StopNameToVertex)
@@ -617,43 +762,39 @@ size_t StopNameToVertex::ByteSizeLong() const {
 
   // uint32 stop_name_num = 1;
   if (this->_internal_stop_name_num() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32SizePlusOne(this->_internal_stop_name_num());
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stop_name_num());
   }
 
   // uint32 vertex_id = 2;
   if (this->_internal_vertex_id() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32SizePlusOne(this->_internal_vertex_id());
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_vertex_id());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StopNameToVertex::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     StopNameToVertex::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StopNameToVertex::GetClassData() const { return &_class_data_; }
 
-void StopNameToVertex::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<StopNameToVertex *>(to)->MergeFrom(
-      static_cast<const StopNameToVertex &>(from));
-}
-
 
-void StopNameToVertex::MergeFrom(const StopNameToVertex& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.StopNameToVertex)
-  GOOGLE_DCHECK_NE(&from, this);
+void StopNameToVertex::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StopNameToVertex*>(&to_msg);
+  auto& from = static_cast<const StopNameToVertex&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.StopNameToVertex)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (from._internal_stop_name_num() != 0) {
-    _internal_set_stop_name_num(from._internal_stop_name_num());
+    _this->_internal_set_stop_name_num(from._internal_stop_name_num());
   }
   if (from._internal_vertex_id() != 0) {
-    _internal_set_vertex_id(from._internal_vertex_id());
+    _this->_internal_set_vertex_id(from._internal_vertex_id());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void StopNameToVertex::CopyFrom(const StopNameToVertex& from) {
@@ -671,15 +812,15 @@ void StopNameToVertex::InternalSwap(StopNameToVertex* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(StopNameToVertex, vertex_id_)
-      + sizeof(StopNameToVertex::vertex_id_)
-      - PROTOBUF_FIELD_OFFSET(StopNameToVertex, stop_name_num_)>(
-          reinterpret_cast<char*>(&stop_name_num_),
-          reinterpret_cast<char*>(&other->stop_name_num_));
+      PROTOBUF_FIELD_OFFSET(StopNameToVertex, _impl_.vertex_id_)
+      + sizeof(StopNameToVertex::_impl_.vertex_id_)
+      - PROTOBUF_FIELD_OFFSET(StopNameToVertex, _impl_.stop_name_num_)>(
+          reinterpret_cast<char*>(&_impl_.stop_name_num_),
+          reinterpret_cast<char*>(&other->_impl_.stop_name_num_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata StopNameToVertex::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
       file_level_metadata_transport_5fcatalogue_2eproto[0]);
 }
@@ -692,43 +833,47 @@ class StopNameToVertexList::_Internal {
 
 StopNameToVertexList::StopNameToVertexList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  stop_name_to_vertex_(arena) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.StopNameToVertexList)
 }
 StopNameToVertexList::StopNameToVertexList(const StopNameToVertexList& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      stop_name_to_vertex_(from.stop_name_to_vertex_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StopNameToVertexList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stop_name_to_vertex_){from._impl_.stop_name_to_vertex_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.StopNameToVertexList)
 }
 
-inline void StopNameToVertexList::SharedCtor() {
+inline void StopNameToVertexList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stop_name_to_vertex_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 StopNameToVertexList::~StopNameToVertexList() {
   // @@protoc_insertion_point(destructor:TransCatSerial.StopNameToVertexList)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void StopNameToVertexList::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stop_name_to_vertex_.~RepeatedPtrField();
 }
 
-void StopNameToVertexList::ArenaDtor(void* object) {
-  StopNameToVertexList* _this = reinterpret_cast< StopNameToVertexList* >(object);
-  (void)_this;
-}
-void StopNameToVertexList::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void StopNameToVertexList::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void StopNameToVertexList::Clear() {
@@ -737,15 +882,15 @@ void StopNameToVertexList::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  stop_name_to_vertex_.Clear();
+  _impl_.stop_name_to_vertex_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* StopNameToVertexList::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* StopNameToVertexList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .TransCatSerial.StopNameToVertex stop_name_to_vertex = 1;
       case 1:
@@ -790,15 +935,15 @@ uint8_t* StopNameToVertexList::_InternalSerialize(
   (void) cached_has_bits;
 
   // repeated .TransCatSerial.StopNameToVertex stop_name_to_vertex = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_stop_name_to_vertex_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_stop_name_to_vertex_size()); i < n; i++) {
+    const auto& repfield = this->_internal_stop_name_to_vertex(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_stop_name_to_vertex(i), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.StopNameToVertexList)
@@ -815,35 +960,31 @@ size_t StopNameToVertexList::ByteSizeLong() const {
 
   // repeated .TransCatSerial.StopNameToVertex stop_name_to_vertex = 1;
   total_size += 1UL * this->_internal_stop_name_to_vertex_size();
-  for (const auto& msg : this->stop_name_to_vertex_) {
+  for (const auto& msg : this->_impl_.stop_name_to_vertex_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StopNameToVertexList::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     StopNameToVertexList::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StopNameToVertexList::GetClassData() const { return &_class_data_; }
 
-void StopNameToVertexList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<StopNameToVertexList *>(to)->MergeFrom(
-      static_cast<const StopNameToVertexList &>(from));
-}
-
 
-void StopNameToVertexList::MergeFrom(const StopNameToVertexList& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.StopNameToVertexList)
-  GOOGLE_DCHECK_NE(&from, this);
+void StopNameToVertexList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StopNameToVertexList*>(&to_msg);
+  auto& from = static_cast<const StopNameToVertexList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.StopNameToVertexList)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  stop_name_to_vertex_.MergeFrom(from.stop_name_to_vertex_);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.stop_name_to_vertex_.MergeFrom(from._impl_.stop_name_to_vertex_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void StopNameToVertexList::CopyFrom(const StopNameToVertexList& from) {
@@ -860,11 +1001,11 @@ bool StopNameToVertexList::IsInitialized() const {
 void StopNameToVertexList::InternalSwap(StopNameToVertexList* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  stop_name_to_vertex_.InternalSwap(&other->stop_name_to_vertex_);
+  _impl_.stop_name_to_vertex_.InternalSwap(&other->_impl_.stop_name_to_vertex_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata StopNameToVertexList::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
       file_level_metadata_transport_5fcatalogue_2eproto[1]);
 }
@@ -878,47 +1019,62 @@ class EdgeDescriptor::_Internal {
 EdgeDescriptor::EdgeDescriptor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.EdgeDescriptor)
 }
 EdgeDescriptor::EdgeDescriptor(const EdgeDescriptor& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EdgeDescriptor* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edge_type_){}
+    , decltype(_impl_.from_stop_num_){}
+    , decltype(_impl_.to_stop_num_){}
+    , decltype(_impl_.bus_name_num_){}
+    , decltype(_impl_.time_length_){}
+    , decltype(_impl_.span_count_){}
+    , decltype(_impl_.from_position_){}
+    , decltype(_impl_.is_backward_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&edge_type_, &from.edge_type_,
-    static_cast<size_t>(reinterpret_cast<char*>(&span_count_) -
-    reinterpret_cast<char*>(&edge_type_)) + sizeof(span_count_));
+  ::memcpy(&_impl_.edge_type_, &from._impl_.edge_type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.is_backward_) -
+    reinterpret_cast<char*>(&_impl_.edge_type_)) + sizeof(_impl_.is_backward_));
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.EdgeDescriptor)
 }
 
-inline void EdgeDescriptor::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&edge_type_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&span_count_) -
-    reinterpret_cast<char*>(&edge_type_)) + sizeof(span_count_));
+inline void EdgeDescriptor::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edge_type_){0}
+    , decltype(_impl_.from_stop_num_){0u}
+    , decltype(_impl_.to_stop_num_){0u}
+    , decltype(_impl_.bus_name_num_){0u}
+    , decltype(_impl_.time_length_){0}
+    , decltype(_impl_.span_count_){0u}
+    , decltype(_impl_.from_position_){0u}
+    , decltype(_impl_.is_backward_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 EdgeDescriptor::~EdgeDescriptor() {
   // @@protoc_insertion_point(destructor:TransCatSerial.EdgeDescriptor)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void EdgeDescriptor::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void EdgeDescriptor::ArenaDtor(void* object) {
-  EdgeDescriptor* _this = reinterpret_cast< EdgeDescriptor* >(object);
-  (void)_this;
-}
-void EdgeDescriptor::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void EdgeDescriptor::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void EdgeDescriptor::Clear() {
@@ -927,17 +1083,17 @@ void EdgeDescriptor::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&edge_type_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&span_count_) -
-      reinterpret_cast<char*>(&edge_type_)) + sizeof(span_count_));
+  ::memset(&_impl_.edge_type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.is_backward_) -
+      reinterpret_cast<char*>(&_impl_.edge_type_)) + sizeof(_impl_.is_backward_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* EdgeDescriptor::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* EdgeDescriptor::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .TransCatSerial.EdgeDescriptor.EdgeType edge_type = 1;
       case 1:
@@ -951,7 +1107,7 @@ const char* EdgeDescriptor::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE
       // uint32 from_stop_num = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          from_stop_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.from_stop_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -959,7 +1115,7 @@ const char* EdgeDescriptor::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE
       // uint32 to_stop_num = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          to_stop_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.to_stop_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -967,7 +1123,7 @@ const char* EdgeDescriptor::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE
       // uint32 bus_name_num = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          bus_name_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.bus_name_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -975,7 +1131,7 @@ const char* EdgeDescriptor::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE
       // uint32 span_count = 5;
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          span_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.span_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -983,11 +1139,27 @@ const char* EdgeDescriptor::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE
       // double time_length = 6;
       case 6:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
-          time_length_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.time_length_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
         continue;
+      // uint32 from_position = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.from_position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool is_backward = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.is_backward_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1020,32 +1192,32 @@ uint8_t* EdgeDescriptor::_InternalSerialize(
   // .TransCatSerial.EdgeDescriptor.EdgeType edge_type = 1;
   if (this->_internal_edge_type() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       1, this->_internal_edge_type(), target);
   }
 
   // uint32 from_stop_num = 2;
   if (this->_internal_from_stop_num() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_from_stop_num(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_from_stop_num(), target);
   }
 
   // uint32 to_stop_num = 3;
   if (this->_internal_to_stop_num() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_to_stop_num(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_to_stop_num(), target);
   }
 
   // uint32 bus_name_num = 4;
   if (this->_internal_bus_name_num() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_bus_name_num(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_bus_name_num(), target);
   }
 
   // uint32 span_count = 5;
   if (this->_internal_span_count() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(5, this->_internal_span_count(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_span_count(), target);
   }
 
   // double time_length = 6;
@@ -1055,11 +1227,23 @@ uint8_t* EdgeDescriptor::_InternalSerialize(
   memcpy(&raw_time_length, &tmp_time_length, sizeof(tmp_time_length));
   if (raw_time_length != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(6, this->_internal_time_length(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_time_length(), target);
+  }
+
+  // uint32 from_position = 7;
+  if (this->_internal_from_position() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_from_position(), target);
+  }
+
+  // bool is_backward = 8;
+  if (this->_internal_is_backward() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_is_backward(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.EdgeDescriptor)
@@ -1077,22 +1261,22 @@ size_t EdgeDescriptor::ByteSizeLong() const {
   // .TransCatSerial.EdgeDescriptor.EdgeType edge_type = 1;
   if (this->_internal_edge_type() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_edge_type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_edge_type());
   }
 
   // uint32 from_stop_num = 2;
   if (this->_internal_from_stop_num() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32SizePlusOne(this->_internal_from_stop_num());
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_from_stop_num());
   }
 
   // uint32 to_stop_num = 3;
   if (this->_internal_to_stop_num() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32SizePlusOne(this->_internal_to_stop_num());
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_to_stop_num());
   }
 
   // uint32 bus_name_num = 4;
   if (this->_internal_bus_name_num() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32SizePlusOne(this->_internal_bus_name_num());
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bus_name_num());
   }
 
   // double time_length = 6;
@@ -1106,54 +1290,66 @@ size_t EdgeDescriptor::ByteSizeLong() const {
 
   // uint32 span_count = 5;
   if (this->_internal_span_count() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32SizePlusOne(this->_internal_span_count());
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_span_count());
+  }
+
+  // uint32 from_position = 7;
+  if (this->_internal_from_position() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_from_position());
+  }
+
+  // bool is_backward = 8;
+  if (this->_internal_is_backward() != 0) {
+    total_size += 1 + 1;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EdgeDescriptor::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     EdgeDescriptor::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EdgeDescriptor::GetClassData() const { return &_class_data_; }
 
-void EdgeDescriptor::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<EdgeDescriptor *>(to)->MergeFrom(
-      static_cast<const EdgeDescriptor &>(from));
-}
-
 
-void EdgeDescriptor::MergeFrom(const EdgeDescriptor& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.EdgeDescriptor)
-  GOOGLE_DCHECK_NE(&from, this);
+void EdgeDescriptor::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EdgeDescriptor*>(&to_msg);
+  auto& from = static_cast<const EdgeDescriptor&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.EdgeDescriptor)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (from._internal_edge_type() != 0) {
-    _internal_set_edge_type(from._internal_edge_type());
+    _this->_internal_set_edge_type(from._internal_edge_type());
   }
   if (from._internal_from_stop_num() != 0) {
-    _internal_set_from_stop_num(from._internal_from_stop_num());
+    _this->_internal_set_from_stop_num(from._internal_from_stop_num());
   }
   if (from._internal_to_stop_num() != 0) {
-    _internal_set_to_stop_num(from._internal_to_stop_num());
+    _this->_internal_set_to_stop_num(from._internal_to_stop_num());
   }
   if (from._internal_bus_name_num() != 0) {
-    _internal_set_bus_name_num(from._internal_bus_name_num());
+    _this->_internal_set_bus_name_num(from._internal_bus_name_num());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_time_length = from._internal_time_length();
   uint64_t raw_time_length;
   memcpy(&raw_time_length, &tmp_time_length, sizeof(tmp_time_length));
   if (raw_time_length != 0) {
-    _internal_set_time_length(from._internal_time_length());
+    _this->_internal_set_time_length(from._internal_time_length());
   }
   if (from._internal_span_count() != 0) {
-    _internal_set_span_count(from._internal_span_count());
+    _this->_internal_set_span_count(from._internal_span_count());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_from_position() != 0) {
+    _this->_internal_set_from_position(from._internal_from_position());
+  }
+  if (from._internal_is_backward() != 0) {
+    _this->_internal_set_is_backward(from._internal_is_backward());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void EdgeDescriptor::CopyFrom(const EdgeDescriptor& from) {
@@ -1171,15 +1367,15 @@ void EdgeDescriptor::InternalSwap(EdgeDescriptor* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(EdgeDescriptor, span_count_)
-      + sizeof(EdgeDescriptor::span_count_)
-      - PROTOBUF_FIELD_OFFSET(EdgeDescriptor, edge_type_)>(
-          reinterpret_cast<char*>(&edge_type_),
-          reinterpret_cast<char*>(&other->edge_type_));
+      PROTOBUF_FIELD_OFFSET(EdgeDescriptor, _impl_.is_backward_)
+      + sizeof(EdgeDescriptor::_impl_.is_backward_)
+      - PROTOBUF_FIELD_OFFSET(EdgeDescriptor, _impl_.edge_type_)>(
+          reinterpret_cast<char*>(&_impl_.edge_type_),
+          reinterpret_cast<char*>(&other->_impl_.edge_type_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata EdgeDescriptor::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
       file_level_metadata_transport_5fcatalogue_2eproto[2]);
 }
@@ -1193,56 +1389,57 @@ class EdgeToDesc::_Internal {
 
 const ::TransCatSerial::EdgeDescriptor&
 EdgeToDesc::_Internal::edge_descriptor(const EdgeToDesc* msg) {
-  return *msg->edge_descriptor_;
+  return *msg->_impl_.edge_descriptor_;
 }
 EdgeToDesc::EdgeToDesc(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.EdgeToDesc)
 }
 EdgeToDesc::EdgeToDesc(const EdgeToDesc& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EdgeToDesc* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edge_descriptor_){nullptr}
+    , decltype(_impl_.edge_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_edge_descriptor()) {
-    edge_descriptor_ = new ::TransCatSerial::EdgeDescriptor(*from.edge_descriptor_);
-  } else {
-    edge_descriptor_ = nullptr;
+    _this->_impl_.edge_descriptor_ = new ::TransCatSerial::EdgeDescriptor(*from._impl_.edge_descriptor_);
   }
-  edge_id_ = from.edge_id_;
+  _this->_impl_.edge_id_ = from._impl_.edge_id_;
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.EdgeToDesc)
 }
 
-inline void EdgeToDesc::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&edge_descriptor_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&edge_id_) -
-    reinterpret_cast<char*>(&edge_descriptor_)) + sizeof(edge_id_));
+inline void EdgeToDesc::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edge_descriptor_){nullptr}
+    , decltype(_impl_.edge_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 EdgeToDesc::~EdgeToDesc() {
   // @@protoc_insertion_point(destructor:TransCatSerial.EdgeToDesc)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void EdgeToDesc::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete edge_descriptor_;
+  if (this != internal_default_instance()) delete _impl_.edge_descriptor_;
 }
 
-void EdgeToDesc::ArenaDtor(void* object) {
-  EdgeToDesc* _this = reinterpret_cast< EdgeToDesc* >(object);
-  (void)_this;
-}
-void EdgeToDesc::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void EdgeToDesc::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void EdgeToDesc::Clear() {
@@ -1251,24 +1448,24 @@ void EdgeToDesc::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && edge_descriptor_ != nullptr) {
-    delete edge_descriptor_;
+  if (GetArenaForAllocation() == nullptr && _impl_.edge_descriptor_ != nullptr) {
+    delete _impl_.edge_descriptor_;
   }
-  edge_descriptor_ = nullptr;
-  edge_id_ = 0u;
+  _impl_.edge_descriptor_ = nullptr;
+  _impl_.edge_id_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* EdgeToDesc::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* EdgeToDesc::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // uint32 edge_id = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          edge_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.edge_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1313,19 +1510,18 @@ uint8_t* EdgeToDesc::_InternalSerialize(
   // uint32 edge_id = 1;
   if (this->_internal_edge_id() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_edge_id(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_edge_id(), target);
   }
 
   // .TransCatSerial.EdgeDescriptor edge_descriptor = 2;
   if (this->_internal_has_edge_descriptor()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::edge_descriptor(this), target, stream);
+      InternalWriteMessage(2, _Internal::edge_descriptor(this),
+        _Internal::edge_descriptor(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.EdgeToDesc)
@@ -1344,43 +1540,40 @@ size_t EdgeToDesc::ByteSizeLong() const {
   if (this->_internal_has_edge_descriptor()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *edge_descriptor_);
+        *_impl_.edge_descriptor_);
   }
 
   // uint32 edge_id = 1;
   if (this->_internal_edge_id() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32SizePlusOne(this->_internal_edge_id());
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_edge_id());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EdgeToDesc::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     EdgeToDesc::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EdgeToDesc::GetClassData() const { return &_class_data_; }
 
-void EdgeToDesc::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<EdgeToDesc *>(to)->MergeFrom(
-      static_cast<const EdgeToDesc &>(from));
-}
-
 
-void EdgeToDesc::MergeFrom(const EdgeToDesc& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.EdgeToDesc)
-  GOOGLE_DCHECK_NE(&from, this);
+void EdgeToDesc::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EdgeToDesc*>(&to_msg);
+  auto& from = static_cast<const EdgeToDesc&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.EdgeToDesc)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (from._internal_has_edge_descriptor()) {
-    _internal_mutable_edge_descriptor()->::TransCatSerial::EdgeDescriptor::MergeFrom(from._internal_edge_descriptor());
+    _this->_internal_mutable_edge_descriptor()->::TransCatSerial::EdgeDescriptor::MergeFrom(
+        from._internal_edge_descriptor());
   }
   if (from._internal_edge_id() != 0) {
-    _internal_set_edge_id(from._internal_edge_id());
+    _this->_internal_set_edge_id(from._internal_edge_id());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void EdgeToDesc::CopyFrom(const EdgeToDesc& from) {
@@ -1398,15 +1591,15 @@ void EdgeToDesc::InternalSwap(EdgeToDesc* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(EdgeToDesc, edge_id_)
-      + sizeof(EdgeToDesc::edge_id_)
-      - PROTOBUF_FIELD_OFFSET(EdgeToDesc, edge_descriptor_)>(
-          reinterpret_cast<char*>(&edge_descriptor_),
-          reinterpret_cast<char*>(&other->edge_descriptor_));
+      PROTOBUF_FIELD_OFFSET(EdgeToDesc, _impl_.edge_id_)
+      + sizeof(EdgeToDesc::_impl_.edge_id_)
+      - PROTOBUF_FIELD_OFFSET(EdgeToDesc, _impl_.edge_descriptor_)>(
+          reinterpret_cast<char*>(&_impl_.edge_descriptor_),
+          reinterpret_cast<char*>(&other->_impl_.edge_descriptor_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata EdgeToDesc::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
       file_level_metadata_transport_5fcatalogue_2eproto[3]);
 }
@@ -1419,43 +1612,47 @@ class EdgeToDescList::_Internal {
 
 EdgeToDescList::EdgeToDescList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  edge_to_desc_(arena) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.EdgeToDescList)
 }
 EdgeToDescList::EdgeToDescList(const EdgeToDescList& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      edge_to_desc_(from.edge_to_desc_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EdgeToDescList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edge_to_desc_){from._impl_.edge_to_desc_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.EdgeToDescList)
 }
 
-inline void EdgeToDescList::SharedCtor() {
+inline void EdgeToDescList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edge_to_desc_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 EdgeToDescList::~EdgeToDescList() {
   // @@protoc_insertion_point(destructor:TransCatSerial.EdgeToDescList)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void EdgeToDescList::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.edge_to_desc_.~RepeatedPtrField();
 }
 
-void EdgeToDescList::ArenaDtor(void* object) {
-  EdgeToDescList* _this = reinterpret_cast< EdgeToDescList* >(object);
-  (void)_this;
-}
-void EdgeToDescList::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void EdgeToDescList::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void EdgeToDescList::Clear() {
@@ -1464,15 +1661,15 @@ void EdgeToDescList::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  edge_to_desc_.Clear();
+  _impl_.edge_to_desc_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* EdgeToDescList::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* EdgeToDescList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .TransCatSerial.EdgeToDesc edge_to_desc = 1;
       case 1:
@@ -1517,15 +1714,15 @@ uint8_t* EdgeToDescList::_InternalSerialize(
   (void) cached_has_bits;
 
   // repeated .TransCatSerial.EdgeToDesc edge_to_desc = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_edge_to_desc_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_edge_to_desc_size()); i < n; i++) {
+    const auto& repfield = this->_internal_edge_to_desc(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_edge_to_desc(i), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.EdgeToDescList)
@@ -1542,35 +1739,31 @@ size_t EdgeToDescList::ByteSizeLong() const {
 
   // repeated .TransCatSerial.EdgeToDesc edge_to_desc = 1;
   total_size += 1UL * this->_internal_edge_to_desc_size();
-  for (const auto& msg : this->edge_to_desc_) {
+  for (const auto& msg : this->_impl_.edge_to_desc_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EdgeToDescList::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     EdgeToDescList::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EdgeToDescList::GetClassData() const { return &_class_data_; }
 
-void EdgeToDescList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<EdgeToDescList *>(to)->MergeFrom(
-      static_cast<const EdgeToDescList &>(from));
-}
-
 
-void EdgeToDescList::MergeFrom(const EdgeToDescList& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.EdgeToDescList)
-  GOOGLE_DCHECK_NE(&from, this);
+void EdgeToDescList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EdgeToDescList*>(&to_msg);
+  auto& from = static_cast<const EdgeToDescList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.EdgeToDescList)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  edge_to_desc_.MergeFrom(from.edge_to_desc_);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.edge_to_desc_.MergeFrom(from._impl_.edge_to_desc_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void EdgeToDescList::CopyFrom(const EdgeToDescList& from) {
@@ -1587,11 +1780,11 @@ bool EdgeToDescList::IsInitialized() const {
 void EdgeToDescList::InternalSwap(EdgeToDescList* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  edge_to_desc_.InternalSwap(&other->edge_to_desc_);
+  _impl_.edge_to_desc_.InternalSwap(&other->_impl_.edge_to_desc_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata EdgeToDescList::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
       file_level_metadata_transport_5fcatalogue_2eproto[4]);
 }
@@ -1605,47 +1798,50 @@ class Coordinates::_Internal {
 Coordinates::Coordinates(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.Coordinates)
 }
 Coordinates::Coordinates(const Coordinates& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Coordinates* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lat_){}
+    , decltype(_impl_.lng_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&lat_, &from.lat_,
-    static_cast<size_t>(reinterpret_cast<char*>(&lng_) -
-    reinterpret_cast<char*>(&lat_)) + sizeof(lng_));
+  ::memcpy(&_impl_.lat_, &from._impl_.lat_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lng_) -
+    reinterpret_cast<char*>(&_impl_.lat_)) + sizeof(_impl_.lng_));
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.Coordinates)
 }
 
-inline void Coordinates::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&lat_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&lng_) -
-    reinterpret_cast<char*>(&lat_)) + sizeof(lng_));
+inline void Coordinates::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lat_){0}
+    , decltype(_impl_.lng_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Coordinates::~Coordinates() {
   // @@protoc_insertion_point(destructor:TransCatSerial.Coordinates)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void Coordinates::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void Coordinates::ArenaDtor(void* object) {
-  Coordinates* _this = reinterpret_cast< Coordinates* >(object);
-  (void)_this;
-}
-void Coordinates::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Coordinates::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void Coordinates::Clear() {
@@ -1654,22 +1850,22 @@ void Coordinates::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&lat_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lng_) -
-      reinterpret_cast<char*>(&lat_)) + sizeof(lng_));
+  ::memset(&_impl_.lat_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.lng_) -
+      reinterpret_cast<char*>(&_impl_.lat_)) + sizeof(_impl_.lng_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Coordinates::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Coordinates::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // double lat = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
-          lat_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.lat_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -1677,7 +1873,7 @@ const char* Coordinates::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
       // double lng = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
-          lng_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.lng_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -1718,7 +1914,7 @@ uint8_t* Coordinates::_InternalSerialize(
   memcpy(&raw_lat, &tmp_lat, sizeof(tmp_lat));
   if (raw_lat != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(1, this->_internal_lat(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_lat(), target);
   }
 
   // double lng = 2;
@@ -1728,11 +1924,11 @@ uint8_t* Coordinates::_InternalSerialize(
   memcpy(&raw_lng, &tmp_lng, sizeof(tmp_lng));
   if (raw_lng != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_lng(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_lng(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.Coordinates)
@@ -1765,25 +1961,21 @@ size_t Coordinates::ByteSizeLong() const {
     total_size += 1 + 8;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Coordinates::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     Coordinates::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Coordinates::GetClassData() const { return &_class_data_; }
 
-void Coordinates::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Coordinates *>(to)->MergeFrom(
-      static_cast<const Coordinates &>(from));
-}
-
 
-void Coordinates::MergeFrom(const Coordinates& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.Coordinates)
-  GOOGLE_DCHECK_NE(&from, this);
+void Coordinates::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Coordinates*>(&to_msg);
+  auto& from = static_cast<const Coordinates&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.Coordinates)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -1792,16 +1984,16 @@ void Coordinates::MergeFrom(const Coordinates& from) {
   uint64_t raw_lat;
   memcpy(&raw_lat, &tmp_lat, sizeof(tmp_lat));
   if (raw_lat != 0) {
-    _internal_set_lat(from._internal_lat());
+    _this->_internal_set_lat(from._internal_lat());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
   double tmp_lng = from._internal_lng();
   uint64_t raw_lng;
   memcpy(&raw_lng, &tmp_lng, sizeof(tmp_lng));
   if (raw_lng != 0) {
-    _internal_set_lng(from._internal_lng());
+    _this->_internal_set_lng(from._internal_lng());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Coordinates::CopyFrom(const Coordinates& from) {
@@ -1819,15 +2011,15 @@ void Coordinates::InternalSwap(Coordinates* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Coordinates, lng_)
-      + sizeof(Coordinates::lng_)
-      - PROTOBUF_FIELD_OFFSET(Coordinates, lat_)>(
-          reinterpret_cast<char*>(&lat_),
-          reinterpret_cast<char*>(&other->lat_));
+      PROTOBUF_FIELD_OFFSET(Coordinates, _impl_.lng_)
+      + sizeof(Coordinates::_impl_.lng_)
+      - PROTOBUF_FIELD_OFFSET(Coordinates, _impl_.lat_)>(
+          reinterpret_cast<char*>(&_impl_.lat_),
+          reinterpret_cast<char*>(&other->_impl_.lat_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Coordinates::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
       file_level_metadata_transport_5fcatalogue_2eproto[5]);
 }
@@ -1841,47 +2033,50 @@ class DistanceToStop::_Internal {
 DistanceToStop::DistanceToStop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.DistanceToStop)
 }
 DistanceToStop::DistanceToStop(const DistanceToStop& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DistanceToStop* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.distance_){}
+    , decltype(_impl_.stop_num_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&distance_, &from.distance_,
-    static_cast<size_t>(reinterpret_cast<char*>(&stop_num_) -
-    reinterpret_cast<char*>(&distance_)) + sizeof(stop_num_));
+  ::memcpy(&_impl_.distance_, &from._impl_.distance_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.stop_num_) -
+    reinterpret_cast<char*>(&_impl_.distance_)) + sizeof(_impl_.stop_num_));
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.DistanceToStop)
 }
 
-inline void DistanceToStop::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&distance_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&stop_num_) -
-    reinterpret_cast<char*>(&distance_)) + sizeof(stop_num_));
+inline void DistanceToStop::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.distance_){0}
+    , decltype(_impl_.stop_num_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 DistanceToStop::~DistanceToStop() {
   // @@protoc_insertion_point(destructor:TransCatSerial.DistanceToStop)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void DistanceToStop::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void DistanceToStop::ArenaDtor(void* object) {
-  DistanceToStop* _this = reinterpret_cast< DistanceToStop* >(object);
-  (void)_this;
-}
-void DistanceToStop::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void DistanceToStop::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void DistanceToStop::Clear() {
@@ -1890,22 +2085,22 @@ void DistanceToStop::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&distance_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&stop_num_) -
-      reinterpret_cast<char*>(&distance_)) + sizeof(stop_num_));
+  ::memset(&_impl_.distance_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.stop_num_) -
+      reinterpret_cast<char*>(&_impl_.distance_)) + sizeof(_impl_.stop_num_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* DistanceToStop::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* DistanceToStop::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // uint32 stop_num = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          stop_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.stop_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1913,7 +2108,7 @@ const char* DistanceToStop::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE
       // double distance = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
-          distance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.distance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
@@ -1950,7 +2145,7 @@ uint8_t* DistanceToStop::_InternalSerialize(
   // uint32 stop_num = 1;
   if (this->_internal_stop_num() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_stop_num(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_stop_num(), target);
   }
 
   // double distance = 2;
@@ -1960,11 +2155,11 @@ uint8_t* DistanceToStop::_InternalSerialize(
   memcpy(&raw_distance, &tmp_distance, sizeof(tmp_distance));
   if (raw_distance != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_distance(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_distance(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.DistanceToStop)
@@ -1990,28 +2185,24 @@ size_t DistanceToStop::ByteSizeLong() const {
 
   // uint32 stop_num = 1;
   if (this->_internal_stop_num() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32SizePlusOne(this->_internal_stop_num());
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stop_num());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DistanceToStop::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     DistanceToStop::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DistanceToStop::GetClassData() const { return &_class_data_; }
 
-void DistanceToStop::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<DistanceToStop *>(to)->MergeFrom(
-      static_cast<const DistanceToStop &>(from));
-}
-
 
-void DistanceToStop::MergeFrom(const DistanceToStop& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.DistanceToStop)
-  GOOGLE_DCHECK_NE(&from, this);
+void DistanceToStop::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DistanceToStop*>(&to_msg);
+  auto& from = static_cast<const DistanceToStop&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.DistanceToStop)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -2020,12 +2211,12 @@ void DistanceToStop::MergeFrom(const DistanceToStop& from) {
   uint64_t raw_distance;
   memcpy(&raw_distance, &tmp_distance, sizeof(tmp_distance));
   if (raw_distance != 0) {
-    _internal_set_distance(from._internal_distance());
+    _this->_internal_set_distance(from._internal_distance());
   }
   if (from._internal_stop_num() != 0) {
-    _internal_set_stop_num(from._internal_stop_num());
+    _this->_internal_set_stop_num(from._internal_stop_num());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DistanceToStop::CopyFrom(const DistanceToStop& from) {
@@ -2043,15 +2234,15 @@ void DistanceToStop::InternalSwap(DistanceToStop* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(DistanceToStop, stop_num_)
-      + sizeof(DistanceToStop::stop_num_)
-      - PROTOBUF_FIELD_OFFSET(DistanceToStop, distance_)>(
-          reinterpret_cast<char*>(&distance_),
-          reinterpret_cast<char*>(&other->distance_));
+      PROTOBUF_FIELD_OFFSET(DistanceToStop, _impl_.stop_num_)
+      + sizeof(DistanceToStop::_impl_.stop_num_)
+      - PROTOBUF_FIELD_OFFSET(DistanceToStop, _impl_.distance_)>(
+          reinterpret_cast<char*>(&_impl_.distance_),
+          reinterpret_cast<char*>(&other->_impl_.distance_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata DistanceToStop::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
       file_level_metadata_transport_5fcatalogue_2eproto[6]);
 }
@@ -2060,78 +2251,95 @@ void DistanceToStop::InternalSwap(DistanceToStop* other) {
 
 class Stop::_Internal {
  public:
+  using HasBits = decltype(std::declval<Stop>()._impl_._has_bits_);
   static const ::TransCatSerial::Coordinates& stop_coords(const Stop* msg);
+  static void set_has_wait_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
 };
 
 const ::TransCatSerial::Coordinates&
 Stop::_Internal::stop_coords(const Stop* msg) {
-  return *msg->stop_coords_;
+  return *msg->_impl_.stop_coords_;
 }
 Stop::Stop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  buses_at_stop_(arena),
-  distance_to_stop_(arena) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.Stop)
 }
 Stop::Stop(const Stop& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      buses_at_stop_(from.buses_at_stop_),
-      distance_to_stop_(from.distance_to_stop_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Stop* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.buses_at_stop_){from._impl_.buses_at_stop_}
+    , /*decltype(_impl_._buses_at_stop_cached_byte_size_)*/{0}
+    , decltype(_impl_.distance_to_stop_){from._impl_.distance_to_stop_}
+    , decltype(_impl_.stop_name_){}
+    , decltype(_impl_.stop_coords_){nullptr}
+    , decltype(_impl_.wait_time_){}
+    , decltype(_impl_.stop_type_){}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  stop_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.stop_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    stop_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.stop_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_stop_name().empty()) {
-    stop_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_stop_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.stop_name_.Set(from._internal_stop_name(), 
+      _this->GetArenaForAllocation());
   }
   if (from._internal_has_stop_coords()) {
-    stop_coords_ = new ::TransCatSerial::Coordinates(*from.stop_coords_);
-  } else {
-    stop_coords_ = nullptr;
+    _this->_impl_.stop_coords_ = new ::TransCatSerial::Coordinates(*from._impl_.stop_coords_);
   }
-  stop_type_ = from.stop_type_;
+  ::memcpy(&_impl_.wait_time_, &from._impl_.wait_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.stop_type_) -
+    reinterpret_cast<char*>(&_impl_.wait_time_)) + sizeof(_impl_.stop_type_));
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.Stop)
 }
 
-inline void Stop::SharedCtor() {
-stop_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  stop_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&stop_coords_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&stop_type_) -
-    reinterpret_cast<char*>(&stop_coords_)) + sizeof(stop_type_));
+inline void Stop::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.buses_at_stop_){arena}
+    , /*decltype(_impl_._buses_at_stop_cached_byte_size_)*/{0}
+    , decltype(_impl_.distance_to_stop_){arena}
+    , decltype(_impl_.stop_name_){}
+    , decltype(_impl_.stop_coords_){nullptr}
+    , decltype(_impl_.wait_time_){0}
+    , decltype(_impl_.stop_type_){0}
+  };
+  _impl_.stop_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stop_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Stop::~Stop() {
   // @@protoc_insertion_point(destructor:TransCatSerial.Stop)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void Stop::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  stop_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete stop_coords_;
+  _impl_.buses_at_stop_.~RepeatedField();
+  _impl_.distance_to_stop_.~RepeatedPtrField();
+  _impl_.stop_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.stop_coords_;
 }
 
-void Stop::ArenaDtor(void* object) {
-  Stop* _this = reinterpret_cast< Stop* >(object);
-  (void)_this;
-}
-void Stop::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Stop::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void Stop::Clear() {
@@ -2140,22 +2348,25 @@ void Stop::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  buses_at_stop_.Clear();
-  distance_to_stop_.Clear();
-  stop_name_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && stop_coords_ != nullptr) {
-    delete stop_coords_;
+  _impl_.buses_at_stop_.Clear();
+  _impl_.distance_to_stop_.Clear();
+  _impl_.stop_name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.stop_coords_ != nullptr) {
+    delete _impl_.stop_coords_;
   }
-  stop_coords_ = nullptr;
-  stop_type_ = 0;
+  _impl_.stop_coords_ = nullptr;
+  _impl_.wait_time_ = 0;
+  _impl_.stop_type_ = 0;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Stop::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Stop::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .TransCatSerial.Stop.StopType stop_type = 1;
       case 1:
@@ -2170,7 +2381,7 @@ const char* Stop::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inter
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_stop_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -2207,6 +2418,15 @@ const char* Stop::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inter
         } else
           goto handle_unusual;
         continue;
+      // optional double wait_time = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_wait_time(&has_bits);
+          _impl_.wait_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2223,6 +2443,7 @@ const char* Stop::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inter
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -2239,7 +2460,7 @@ uint8_t* Stop::_InternalSerialize(
   // .TransCatSerial.Stop.StopType stop_type = 1;
   if (this->_internal_stop_type() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       1, this->_internal_stop_type(), target);
   }
 
@@ -2251,15 +2472,14 @@ uint8_t* Stop::_InternalSerialize(
 
   // .TransCatSerial.Coordinates stop_coords = 3;
   if (this->_internal_has_stop_coords()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::stop_coords(this), target, stream);
+      InternalWriteMessage(3, _Internal::stop_coords(this),
+        _Internal::stop_coords(this).GetCachedSize(), target, stream);
   }
 
   // repeated uint32 buses_at_stop = 4;
   {
-    int byte_size = _buses_at_stop_cached_byte_size_.load(std::memory_order_relaxed);
+    int byte_size = _impl_._buses_at_stop_cached_byte_size_.load(std::memory_order_relaxed);
     if (byte_size > 0) {
       target = stream->WriteUInt32Packed(
           4, _internal_buses_at_stop(), byte_size, target);
@@ -2267,15 +2487,21 @@ uint8_t* Stop::_InternalSerialize(
   }
 
   // repeated .TransCatSerial.DistanceToStop distance_to_stop = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_distance_to_stop_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_distance_to_stop_size()); i < n; i++) {
+    const auto& repfield = this->_internal_distance_to_stop(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, this->_internal_distance_to_stop(i), target, stream);
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional double wait_time = 6;
+  if (_internal_has_wait_time()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_wait_time(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.Stop)
@@ -2292,22 +2518,21 @@ size_t Stop::ByteSizeLong() const {
 
   // repeated uint32 buses_at_stop = 4;
   {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      UInt32Size(this->buses_at_stop_);
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.buses_at_stop_);
     if (data_size > 0) {
       total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-            static_cast<int32_t>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
-    _buses_at_stop_cached_byte_size_.store(cached_size,
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._buses_at_stop_cached_byte_size_.store(cached_size,
                                     std::memory_order_relaxed);
     total_size += data_size;
   }
 
   // repeated .TransCatSerial.DistanceToStop distance_to_stop = 5;
   total_size += 1UL * this->_internal_distance_to_stop_size();
-  for (const auto& msg : this->distance_to_stop_) {
+  for (const auto& msg : this->_impl_.distance_to_stop_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
@@ -2323,49 +2548,55 @@ size_t Stop::ByteSizeLong() const {
   if (this->_internal_has_stop_coords()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *stop_coords_);
+        *_impl_.stop_coords_);
+  }
+
+  // optional double wait_time = 6;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 8;
   }
 
   // .TransCatSerial.Stop.StopType stop_type = 1;
   if (this->_internal_stop_type() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_stop_type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_stop_type());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Stop::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     Stop::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Stop::GetClassData() const { return &_class_data_; }
 
-void Stop::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Stop *>(to)->MergeFrom(
-      static_cast<const Stop &>(from));
-}
-
 
-void Stop::MergeFrom(const Stop& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.Stop)
-  GOOGLE_DCHECK_NE(&from, this);
+void Stop::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Stop*>(&to_msg);
+  auto& from = static_cast<const Stop&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.Stop)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  buses_at_stop_.MergeFrom(from.buses_at_stop_);
-  distance_to_stop_.MergeFrom(from.distance_to_stop_);
+  _this->_impl_.buses_at_stop_.MergeFrom(from._impl_.buses_at_stop_);
+  _this->_impl_.distance_to_stop_.MergeFrom(from._impl_.distance_to_stop_);
   if (!from._internal_stop_name().empty()) {
-    _internal_set_stop_name(from._internal_stop_name());
+    _this->_internal_set_stop_name(from._internal_stop_name());
   }
   if (from._internal_has_stop_coords()) {
-    _internal_mutable_stop_coords()->::TransCatSerial::Coordinates::MergeFrom(from._internal_stop_coords());
+    _this->_internal_mutable_stop_coords()->::TransCatSerial::Coordinates::MergeFrom(
+        from._internal_stop_coords());
+  }
+  if (from._internal_has_wait_time()) {
+    _this->_internal_set_wait_time(from._internal_wait_time());
   }
   if (from._internal_stop_type() != 0) {
-    _internal_set_stop_type(from._internal_stop_type());
+    _this->_internal_set_stop_type(from._internal_stop_type());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Stop::CopyFrom(const Stop& from) {
@@ -2384,23 +2615,23 @@ void Stop::InternalSwap(Stop* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  buses_at_stop_.InternalSwap(&other->buses_at_stop_);
-  distance_to_stop_.InternalSwap(&other->distance_to_stop_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.buses_at_stop_.InternalSwap(&other->_impl_.buses_at_stop_);
+  _impl_.distance_to_stop_.InternalSwap(&other->_impl_.distance_to_stop_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &stop_name_, lhs_arena,
-      &other->stop_name_, rhs_arena
+      &_impl_.stop_name_, lhs_arena,
+      &other->_impl_.stop_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Stop, stop_type_)
-      + sizeof(Stop::stop_type_)
-      - PROTOBUF_FIELD_OFFSET(Stop, stop_coords_)>(
-          reinterpret_cast<char*>(&stop_coords_),
-          reinterpret_cast<char*>(&other->stop_coords_));
+      PROTOBUF_FIELD_OFFSET(Stop, _impl_.stop_type_)
+      + sizeof(Stop::_impl_.stop_type_)
+      - PROTOBUF_FIELD_OFFSET(Stop, _impl_.stop_coords_)>(
+          reinterpret_cast<char*>(&_impl_.stop_coords_),
+          reinterpret_cast<char*>(&other->_impl_.stop_coords_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Stop::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
       file_level_metadata_transport_5fcatalogue_2eproto[7]);
 }
@@ -2409,62 +2640,84 @@ void Stop::InternalSwap(Stop* other) {
 
 class Bus::_Internal {
  public:
+  using HasBits = decltype(std::declval<Bus>()._impl_._has_bits_);
+  static void set_has_velocity(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
 };
 
 Bus::Bus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  bus_stops_(arena) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.Bus)
 }
 Bus::Bus(const Bus& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      bus_stops_(from.bus_stops_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Bus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bus_stops_){from._impl_.bus_stops_}
+    , /*decltype(_impl_._bus_stops_cached_byte_size_)*/{0}
+    , decltype(_impl_.departures_){from._impl_.departures_}
+    , decltype(_impl_.bus_name_){}
+    , decltype(_impl_.velocity_){}
+    , decltype(_impl_.bus_type_){}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  bus_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.bus_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    bus_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.bus_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_bus_name().empty()) {
-    bus_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_bus_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.bus_name_.Set(from._internal_bus_name(), 
+      _this->GetArenaForAllocation());
   }
-  bus_type_ = from.bus_type_;
+  ::memcpy(&_impl_.velocity_, &from._impl_.velocity_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bus_type_) -
+    reinterpret_cast<char*>(&_impl_.velocity_)) + sizeof(_impl_.bus_type_));
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.Bus)
 }
 
-inline void Bus::SharedCtor() {
-bus_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  bus_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-bus_type_ = 0;
+inline void Bus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bus_stops_){arena}
+    , /*decltype(_impl_._bus_stops_cached_byte_size_)*/{0}
+    , decltype(_impl_.departures_){arena}
+    , decltype(_impl_.bus_name_){}
+    , decltype(_impl_.velocity_){0}
+    , decltype(_impl_.bus_type_){0}
+  };
+  _impl_.bus_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bus_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Bus::~Bus() {
   // @@protoc_insertion_point(destructor:TransCatSerial.Bus)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void Bus::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  bus_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.bus_stops_.~RepeatedField();
+  _impl_.departures_.~RepeatedField();
+  _impl_.bus_name_.Destroy();
 }
 
-void Bus::ArenaDtor(void* object) {
-  Bus* _this = reinterpret_cast< Bus* >(object);
-  (void)_this;
-}
-void Bus::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Bus::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void Bus::Clear() {
@@ -2473,17 +2726,21 @@ void Bus::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  bus_stops_.Clear();
-  bus_name_.ClearToEmpty();
-  bus_type_ = 0;
+  _impl_.bus_stops_.Clear();
+  _impl_.departures_.Clear();
+  _impl_.bus_name_.ClearToEmpty();
+  _impl_.velocity_ = 0;
+  _impl_.bus_type_ = 0;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Bus::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Bus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .TransCatSerial.Bus.BusType bus_type = 1;
       case 1:
@@ -2498,7 +2755,7 @@ const char* Bus::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::intern
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_bus_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -2514,6 +2771,26 @@ const char* Bus::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::intern
         } else
           goto handle_unusual;
         continue;
+      // repeated double departures = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_departures(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 33) {
+          _internal_add_departures(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double velocity = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_velocity(&has_bits);
+          _impl_.velocity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2530,6 +2807,7 @@ const char* Bus::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::intern
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -2546,7 +2824,7 @@ uint8_t* Bus::_InternalSerialize(
   // .TransCatSerial.Bus.BusType bus_type = 1;
   if (this->_internal_bus_type() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       1, this->_internal_bus_type(), target);
   }
 
@@ -2558,15 +2836,26 @@ uint8_t* Bus::_InternalSerialize(
 
   // repeated uint32 bus_stops = 3;
   {
-    int byte_size = _bus_stops_cached_byte_size_.load(std::memory_order_relaxed);
+    int byte_size = _impl_._bus_stops_cached_byte_size_.load(std::memory_order_relaxed);
     if (byte_size > 0) {
       target = stream->WriteUInt32Packed(
           3, _internal_bus_stops(), byte_size, target);
     }
   }
 
+  // repeated double departures = 4;
+  if (this->_internal_departures_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_departures(), target);
+  }
+
+  // optional double velocity = 5;
+  if (_internal_has_velocity()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_velocity(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.Bus)
@@ -2583,19 +2872,29 @@ size_t Bus::ByteSizeLong() const {
 
   // repeated uint32 bus_stops = 3;
   {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      UInt32Size(this->bus_stops_);
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.bus_stops_);
     if (data_size > 0) {
       total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-            static_cast<int32_t>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
-    _bus_stops_cached_byte_size_.store(cached_size,
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._bus_stops_cached_byte_size_.store(cached_size,
                                     std::memory_order_relaxed);
     total_size += data_size;
   }
 
+  // repeated double departures = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_departures_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
   // bytes bus_name = 2;
   if (!this->_internal_bus_name().empty()) {
     total_size += 1 +
@@ -2603,42 +2902,48 @@ size_t Bus::ByteSizeLong() const {
         this->_internal_bus_name());
   }
 
+  // optional double velocity = 5;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 8;
+  }
+
   // .TransCatSerial.Bus.BusType bus_type = 1;
   if (this->_internal_bus_type() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_bus_type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_bus_type());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Bus::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     Bus::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Bus::GetClassData() const { return &_class_data_; }
 
-void Bus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Bus *>(to)->MergeFrom(
-      static_cast<const Bus &>(from));
-}
-
 
-void Bus::MergeFrom(const Bus& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.Bus)
-  GOOGLE_DCHECK_NE(&from, this);
+void Bus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Bus*>(&to_msg);
+  auto& from = static_cast<const Bus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.Bus)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  bus_stops_.MergeFrom(from.bus_stops_);
+  _this->_impl_.bus_stops_.MergeFrom(from._impl_.bus_stops_);
+  _this->_impl_.departures_.MergeFrom(from._impl_.departures_);
   if (!from._internal_bus_name().empty()) {
-    _internal_set_bus_name(from._internal_bus_name());
+    _this->_internal_set_bus_name(from._internal_bus_name());
+  }
+  if (from._internal_has_velocity()) {
+    _this->_internal_set_velocity(from._internal_velocity());
   }
   if (from._internal_bus_type() != 0) {
-    _internal_set_bus_type(from._internal_bus_type());
+    _this->_internal_set_bus_type(from._internal_bus_type());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Bus::CopyFrom(const Bus& from) {
@@ -2657,17 +2962,23 @@ void Bus::InternalSwap(Bus* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  bus_stops_.InternalSwap(&other->bus_stops_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.bus_stops_.InternalSwap(&other->_impl_.bus_stops_);
+  _impl_.departures_.InternalSwap(&other->_impl_.departures_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &bus_name_, lhs_arena,
-      &other->bus_name_, rhs_arena
+      &_impl_.bus_name_, lhs_arena,
+      &other->_impl_.bus_name_, rhs_arena
   );
-  swap(bus_type_, other->bus_type_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Bus, _impl_.bus_type_)
+      + sizeof(Bus::_impl_.bus_type_)
+      - PROTOBUF_FIELD_OFFSET(Bus, _impl_.velocity_)>(
+          reinterpret_cast<char*>(&_impl_.velocity_),
+          reinterpret_cast<char*>(&other->_impl_.velocity_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Bus::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
       file_level_metadata_transport_5fcatalogue_2eproto[8]);
 }
@@ -2680,43 +2991,47 @@ class StopList::_Internal {
 
 StopList::StopList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  stops_(arena) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.StopList)
 }
 StopList::StopList(const StopList& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      stops_(from.stops_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StopList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_){from._impl_.stops_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.StopList)
 }
 
-inline void StopList::SharedCtor() {
+inline void StopList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 StopList::~StopList() {
   // @@protoc_insertion_point(destructor:TransCatSerial.StopList)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void StopList::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stops_.~RepeatedPtrField();
 }
 
-void StopList::ArenaDtor(void* object) {
-  StopList* _this = reinterpret_cast< StopList* >(object);
-  (void)_this;
-}
-void StopList::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void StopList::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void StopList::Clear() {
@@ -2725,15 +3040,15 @@ void StopList::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  stops_.Clear();
+  _impl_.stops_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* StopList::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* StopList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .TransCatSerial.Stop stops = 1;
       case 1:
@@ -2778,15 +3093,15 @@ uint8_t* StopList::_InternalSerialize(
   (void) cached_has_bits;
 
   // repeated .TransCatSerial.Stop stops = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_stops_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_stops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_stops(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_stops(i), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.StopList)
@@ -2803,35 +3118,31 @@ size_t StopList::ByteSizeLong() const {
 
   // repeated .TransCatSerial.Stop stops = 1;
   total_size += 1UL * this->_internal_stops_size();
-  for (const auto& msg : this->stops_) {
+  for (const auto& msg : this->_impl_.stops_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StopList::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     StopList::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StopList::GetClassData() const { return &_class_data_; }
 
-void StopList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<StopList *>(to)->MergeFrom(
-      static_cast<const StopList &>(from));
-}
-
 
-void StopList::MergeFrom(const StopList& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.StopList)
-  GOOGLE_DCHECK_NE(&from, this);
+void StopList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StopList*>(&to_msg);
+  auto& from = static_cast<const StopList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.StopList)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  stops_.MergeFrom(from.stops_);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.stops_.MergeFrom(from._impl_.stops_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void StopList::CopyFrom(const StopList& from) {
@@ -2848,11 +3159,11 @@ bool StopList::IsInitialized() const {
 void StopList::InternalSwap(StopList* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  stops_.InternalSwap(&other->stops_);
+  _impl_.stops_.InternalSwap(&other->_impl_.stops_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata StopList::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
       file_level_metadata_transport_5fcatalogue_2eproto[9]);
 }
@@ -2865,43 +3176,47 @@ class BusList::_Internal {
 
 BusList::BusList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  buses_(arena) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.BusList)
 }
 BusList::BusList(const BusList& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      buses_(from.buses_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BusList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.buses_){from._impl_.buses_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.BusList)
 }
 
-inline void BusList::SharedCtor() {
+inline void BusList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.buses_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 BusList::~BusList() {
   // @@protoc_insertion_point(destructor:TransCatSerial.BusList)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void BusList::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.buses_.~RepeatedPtrField();
 }
 
-void BusList::ArenaDtor(void* object) {
-  BusList* _this = reinterpret_cast< BusList* >(object);
-  (void)_this;
-}
-void BusList::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void BusList::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void BusList::Clear() {
@@ -2910,15 +3225,15 @@ void BusList::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  buses_.Clear();
+  _impl_.buses_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* BusList::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* BusList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .TransCatSerial.Bus buses = 2;
       case 2:
@@ -2963,15 +3278,15 @@ uint8_t* BusList::_InternalSerialize(
   (void) cached_has_bits;
 
   // repeated .TransCatSerial.Bus buses = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_buses_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_buses_size()); i < n; i++) {
+    const auto& repfield = this->_internal_buses(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_buses(i), target, stream);
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.BusList)
@@ -2988,35 +3303,31 @@ size_t BusList::ByteSizeLong() const {
 
   // repeated .TransCatSerial.Bus buses = 2;
   total_size += 1UL * this->_internal_buses_size();
-  for (const auto& msg : this->buses_) {
+  for (const auto& msg : this->_impl_.buses_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BusList::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     BusList::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BusList::GetClassData() const { return &_class_data_; }
 
-void BusList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<BusList *>(to)->MergeFrom(
-      static_cast<const BusList &>(from));
-}
-
 
-void BusList::MergeFrom(const BusList& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.BusList)
-  GOOGLE_DCHECK_NE(&from, this);
+void BusList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BusList*>(&to_msg);
+  auto& from = static_cast<const BusList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.BusList)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  buses_.MergeFrom(from.buses_);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.buses_.MergeFrom(from._impl_.buses_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void BusList::CopyFrom(const BusList& from) {
@@ -3033,11 +3344,11 @@ bool BusList::IsInitialized() const {
 void BusList::InternalSwap(BusList* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  buses_.InternalSwap(&other->buses_);
+  _impl_.buses_.InternalSwap(&other->_impl_.buses_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata BusList::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
       file_level_metadata_transport_5fcatalogue_2eproto[10]);
 }
@@ -3056,180 +3367,236 @@ class TransportCatalogue::_Internal {
   static const ::TransCatSerial::Edges& edges(const TransportCatalogue* msg);
   static const ::TransCatSerial::IncidenceLists& incidence_lists(const TransportCatalogue* msg);
   static const ::TransCatSerial::RoutesData& routes_data(const TransportCatalogue* msg);
+  static const ::TransCatSerial::PackedRoutesData& packed_routes_data(const TransportCatalogue* msg);
+  static const ::TransCatSerial::ContractionHierarchy& contraction_hierarchy(const TransportCatalogue* msg);
+  static const ::TransCatSerial::HubLabels& hub_labels(const TransportCatalogue* msg);
 };
 
 const ::TransCatSerial::StopList&
 TransportCatalogue::_Internal::stops(const TransportCatalogue* msg) {
-  return *msg->stops_;
+  return *msg->_impl_.stops_;
 }
 const ::TransCatSerial::BusList&
 TransportCatalogue::_Internal::buses(const TransportCatalogue* msg) {
-  return *msg->buses_;
+  return *msg->_impl_.buses_;
 }
 const ::TransCatSerial::RouterContext&
 TransportCatalogue::_Internal::router_context(const TransportCatalogue* msg) {
-  return *msg->router_context_;
+  return *msg->_impl_.router_context_;
 }
 const ::TransCatSerial::MapRendererContext&
 TransportCatalogue::_Internal::render_context(const TransportCatalogue* msg) {
-  return *msg->render_context_;
+  return *msg->_impl_.render_context_;
 }
 const ::TransCatSerial::StopNameToVertexList&
 TransportCatalogue::_Internal::stop_name_to_enter_vertex(const TransportCatalogue* msg) {
-  return *msg->stop_name_to_enter_vertex_;
+  return *msg->_impl_.stop_name_to_enter_vertex_;
 }
 const ::TransCatSerial::StopNameToVertexList&
 TransportCatalogue::_Internal::stop_name_to_exit_vertex(const TransportCatalogue* msg) {
-  return *msg->stop_name_to_exit_vertex_;
+  return *msg->_impl_.stop_name_to_exit_vertex_;
 }
 const ::TransCatSerial::EdgeToDescList&
 TransportCatalogue::_Internal::edge_to_desc(const TransportCatalogue* msg) {
-  return *msg->edge_to_desc_;
+  return *msg->_impl_.edge_to_desc_;
 }
 const ::TransCatSerial::Edges&
 TransportCatalogue::_Internal::edges(const TransportCatalogue* msg) {
-  return *msg->edges_;
+  return *msg->_impl_.edges_;
 }
 const ::TransCatSerial::IncidenceLists&
 TransportCatalogue::_Internal::incidence_lists(const TransportCatalogue* msg) {
-  return *msg->incidence_lists_;
+  return *msg->_impl_.incidence_lists_;
 }
 const ::TransCatSerial::RoutesData&
 TransportCatalogue::_Internal::routes_data(const TransportCatalogue* msg) {
-  return *msg->routes_data_;
+  return *msg->_impl_.routes_data_;
+}
+const ::TransCatSerial::PackedRoutesData&
+TransportCatalogue::_Internal::packed_routes_data(const TransportCatalogue* msg) {
+  return *msg->_impl_.packed_routes_data_;
+}
+const ::TransCatSerial::ContractionHierarchy&
+TransportCatalogue::_Internal::contraction_hierarchy(const TransportCatalogue* msg) {
+  return *msg->_impl_.contraction_hierarchy_;
+}
+const ::TransCatSerial::HubLabels&
+TransportCatalogue::_Internal::hub_labels(const TransportCatalogue* msg) {
+  return *msg->_impl_.hub_labels_;
 }
 void TransportCatalogue::clear_router_context() {
-  if (GetArenaForAllocation() == nullptr && router_context_ != nullptr) {
-    delete router_context_;
+  if (GetArenaForAllocation() == nullptr && _impl_.router_context_ != nullptr) {
+    delete _impl_.router_context_;
   }
-  router_context_ = nullptr;
+  _impl_.router_context_ = nullptr;
 }
 void TransportCatalogue::clear_render_context() {
-  if (GetArenaForAllocation() == nullptr && render_context_ != nullptr) {
-    delete render_context_;
+  if (GetArenaForAllocation() == nullptr && _impl_.render_context_ != nullptr) {
+    delete _impl_.render_context_;
   }
-  render_context_ = nullptr;
+  _impl_.render_context_ = nullptr;
 }
 void TransportCatalogue::clear_edges() {
-  if (GetArenaForAllocation() == nullptr && edges_ != nullptr) {
-    delete edges_;
+  if (GetArenaForAllocation() == nullptr && _impl_.edges_ != nullptr) {
+    delete _impl_.edges_;
   }
-  edges_ = nullptr;
+  _impl_.edges_ = nullptr;
 }
 void TransportCatalogue::clear_incidence_lists() {
-  if (GetArenaForAllocation() == nullptr && incidence_lists_ != nullptr) {
-    delete incidence_lists_;
+  if (GetArenaForAllocation() == nullptr && _impl_.incidence_lists_ != nullptr) {
+    delete _impl_.incidence_lists_;
   }
-  incidence_lists_ = nullptr;
+  _impl_.incidence_lists_ = nullptr;
 }
 void TransportCatalogue::clear_routes_data() {
-  if (GetArenaForAllocation() == nullptr && routes_data_ != nullptr) {
-    delete routes_data_;
+  if (GetArenaForAllocation() == nullptr && _impl_.routes_data_ != nullptr) {
+    delete _impl_.routes_data_;
+  }
+  _impl_.routes_data_ = nullptr;
+}
+void TransportCatalogue::clear_packed_routes_data() {
+  if (GetArenaForAllocation() == nullptr && _impl_.packed_routes_data_ != nullptr) {
+    delete _impl_.packed_routes_data_;
+  }
+  _impl_.packed_routes_data_ = nullptr;
+}
+void TransportCatalogue::clear_contraction_hierarchy() {
+  if (GetArenaForAllocation() == nullptr && _impl_.contraction_hierarchy_ != nullptr) {
+    delete _impl_.contraction_hierarchy_;
+  }
+  _impl_.contraction_hierarchy_ = nullptr;
+}
+void TransportCatalogue::clear_hub_labels() {
+  if (GetArenaForAllocation() == nullptr && _impl_.hub_labels_ != nullptr) {
+    delete _impl_.hub_labels_;
   }
-  routes_data_ = nullptr;
+  _impl_.hub_labels_ = nullptr;
 }
 TransportCatalogue::TransportCatalogue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TransCatSerial.TransportCatalogue)
 }
 TransportCatalogue::TransportCatalogue(const TransportCatalogue& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TransportCatalogue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_){nullptr}
+    , decltype(_impl_.buses_){nullptr}
+    , decltype(_impl_.router_context_){nullptr}
+    , decltype(_impl_.render_context_){nullptr}
+    , decltype(_impl_.stop_name_to_enter_vertex_){nullptr}
+    , decltype(_impl_.stop_name_to_exit_vertex_){nullptr}
+    , decltype(_impl_.edge_to_desc_){nullptr}
+    , decltype(_impl_.edges_){nullptr}
+    , decltype(_impl_.incidence_lists_){nullptr}
+    , decltype(_impl_.routes_data_){nullptr}
+    , decltype(_impl_.packed_routes_data_){nullptr}
+    , decltype(_impl_.contraction_hierarchy_){nullptr}
+    , decltype(_impl_.hub_labels_){nullptr}
+    , decltype(_impl_.is_routes_data_){}
+    , decltype(_impl_.format_version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_stops()) {
-    stops_ = new ::TransCatSerial::StopList(*from.stops_);
-  } else {
-    stops_ = nullptr;
+    _this->_impl_.stops_ = new ::TransCatSerial::StopList(*from._impl_.stops_);
   }
   if (from._internal_has_buses()) {
-    buses_ = new ::TransCatSerial::BusList(*from.buses_);
-  } else {
-    buses_ = nullptr;
+    _this->_impl_.buses_ = new ::TransCatSerial::BusList(*from._impl_.buses_);
   }
   if (from._internal_has_router_context()) {
-    router_context_ = new ::TransCatSerial::RouterContext(*from.router_context_);
-  } else {
-    router_context_ = nullptr;
+    _this->_impl_.router_context_ = new ::TransCatSerial::RouterContext(*from._impl_.router_context_);
   }
   if (from._internal_has_render_context()) {
-    render_context_ = new ::TransCatSerial::MapRendererContext(*from.render_context_);
-  } else {
-    render_context_ = nullptr;
+    _this->_impl_.render_context_ = new ::TransCatSerial::MapRendererContext(*from._impl_.render_context_);
   }
   if (from._internal_has_stop_name_to_enter_vertex()) {
-    stop_name_to_enter_vertex_ = new ::TransCatSerial::StopNameToVertexList(*from.stop_name_to_enter_vertex_);
-  } else {
-    stop_name_to_enter_vertex_ = nullptr;
+    _this->_impl_.stop_name_to_enter_vertex_ = new ::TransCatSerial::StopNameToVertexList(*from._impl_.stop_name_to_enter_vertex_);
   }
   if (from._internal_has_stop_name_to_exit_vertex()) {
-    stop_name_to_exit_vertex_ = new ::TransCatSerial::StopNameToVertexList(*from.stop_name_to_exit_vertex_);
-  } else {
-    stop_name_to_exit_vertex_ = nullptr;
+    _this->_impl_.stop_name_to_exit_vertex_ = new ::TransCatSerial::StopNameToVertexList(*from._impl_.stop_name_to_exit_vertex_);
   }
   if (from._internal_has_edge_to_desc()) {
-    edge_to_desc_ = new ::TransCatSerial::EdgeToDescList(*from.edge_to_desc_);
-  } else {
-    edge_to_desc_ = nullptr;
+    _this->_impl_.edge_to_desc_ = new ::TransCatSerial::EdgeToDescList(*from._impl_.edge_to_desc_);
   }
   if (from._internal_has_edges()) {
-    edges_ = new ::TransCatSerial::Edges(*from.edges_);
-  } else {
-    edges_ = nullptr;
+    _this->_impl_.edges_ = new ::TransCatSerial::Edges(*from._impl_.edges_);
   }
   if (from._internal_has_incidence_lists()) {
-    incidence_lists_ = new ::TransCatSerial::IncidenceLists(*from.incidence_lists_);
-  } else {
-    incidence_lists_ = nullptr;
+    _this->_impl_.incidence_lists_ = new ::TransCatSerial::IncidenceLists(*from._impl_.incidence_lists_);
   }
   if (from._internal_has_routes_data()) {
-    routes_data_ = new ::TransCatSerial::RoutesData(*from.routes_data_);
-  } else {
-    routes_data_ = nullptr;
+    _this->_impl_.routes_data_ = new ::TransCatSerial::RoutesData(*from._impl_.routes_data_);
+  }
+  if (from._internal_has_packed_routes_data()) {
+    _this->_impl_.packed_routes_data_ = new ::TransCatSerial::PackedRoutesData(*from._impl_.packed_routes_data_);
+  }
+  if (from._internal_has_contraction_hierarchy()) {
+    _this->_impl_.contraction_hierarchy_ = new ::TransCatSerial::ContractionHierarchy(*from._impl_.contraction_hierarchy_);
   }
-  is_routes_data_ = from.is_routes_data_;
+  if (from._internal_has_hub_labels()) {
+    _this->_impl_.hub_labels_ = new ::TransCatSerial::HubLabels(*from._impl_.hub_labels_);
+  }
+  ::memcpy(&_impl_.is_routes_data_, &from._impl_.is_routes_data_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.format_version_) -
+    reinterpret_cast<char*>(&_impl_.is_routes_data_)) + sizeof(_impl_.format_version_));
   // @@protoc_insertion_point(copy_constructor:TransCatSerial.TransportCatalogue)
 }
 
-inline void TransportCatalogue::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&stops_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&is_routes_data_) -
-    reinterpret_cast<char*>(&stops_)) + sizeof(is_routes_data_));
+inline void TransportCatalogue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_){nullptr}
+    , decltype(_impl_.buses_){nullptr}
+    , decltype(_impl_.router_context_){nullptr}
+    , decltype(_impl_.render_context_){nullptr}
+    , decltype(_impl_.stop_name_to_enter_vertex_){nullptr}
+    , decltype(_impl_.stop_name_to_exit_vertex_){nullptr}
+    , decltype(_impl_.edge_to_desc_){nullptr}
+    , decltype(_impl_.edges_){nullptr}
+    , decltype(_impl_.incidence_lists_){nullptr}
+    , decltype(_impl_.routes_data_){nullptr}
+    , decltype(_impl_.packed_routes_data_){nullptr}
+    , decltype(_impl_.contraction_hierarchy_){nullptr}
+    , decltype(_impl_.hub_labels_){nullptr}
+    , decltype(_impl_.is_routes_data_){false}
+    , decltype(_impl_.format_version_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 TransportCatalogue::~TransportCatalogue() {
   // @@protoc_insertion_point(destructor:TransCatSerial.TransportCatalogue)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void TransportCatalogue::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete stops_;
-  if (this != internal_default_instance()) delete buses_;
-  if (this != internal_default_instance()) delete router_context_;
-  if (this != internal_default_instance()) delete render_context_;
-  if (this != internal_default_instance()) delete stop_name_to_enter_vertex_;
-  if (this != internal_default_instance()) delete stop_name_to_exit_vertex_;
-  if (this != internal_default_instance()) delete edge_to_desc_;
-  if (this != internal_default_instance()) delete edges_;
-  if (this != internal_default_instance()) delete incidence_lists_;
-  if (this != internal_default_instance()) delete routes_data_;
+  if (this != internal_default_instance()) delete _impl_.stops_;
+  if (this != internal_default_instance()) delete _impl_.buses_;
+  if (this != internal_default_instance()) delete _impl_.router_context_;
+  if (this != internal_default_instance()) delete _impl_.render_context_;
+  if (this != internal_default_instance()) delete _impl_.stop_name_to_enter_vertex_;
+  if (this != internal_default_instance()) delete _impl_.stop_name_to_exit_vertex_;
+  if (this != internal_default_instance()) delete _impl_.edge_to_desc_;
+  if (this != internal_default_instance()) delete _impl_.edges_;
+  if (this != internal_default_instance()) delete _impl_.incidence_lists_;
+  if (this != internal_default_instance()) delete _impl_.routes_data_;
+  if (this != internal_default_instance()) delete _impl_.packed_routes_data_;
+  if (this != internal_default_instance()) delete _impl_.contraction_hierarchy_;
+  if (this != internal_default_instance()) delete _impl_.hub_labels_;
 }
 
-void TransportCatalogue::ArenaDtor(void* object) {
-  TransportCatalogue* _this = reinterpret_cast< TransportCatalogue* >(object);
-  (void)_this;
-}
-void TransportCatalogue::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void TransportCatalogue::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void TransportCatalogue::Clear() {
@@ -3238,55 +3605,69 @@ void TransportCatalogue::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && stops_ != nullptr) {
-    delete stops_;
+  if (GetArenaForAllocation() == nullptr && _impl_.stops_ != nullptr) {
+    delete _impl_.stops_;
+  }
+  _impl_.stops_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.buses_ != nullptr) {
+    delete _impl_.buses_;
+  }
+  _impl_.buses_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.router_context_ != nullptr) {
+    delete _impl_.router_context_;
+  }
+  _impl_.router_context_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.render_context_ != nullptr) {
+    delete _impl_.render_context_;
   }
-  stops_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && buses_ != nullptr) {
-    delete buses_;
+  _impl_.render_context_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.stop_name_to_enter_vertex_ != nullptr) {
+    delete _impl_.stop_name_to_enter_vertex_;
   }
-  buses_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && router_context_ != nullptr) {
-    delete router_context_;
+  _impl_.stop_name_to_enter_vertex_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.stop_name_to_exit_vertex_ != nullptr) {
+    delete _impl_.stop_name_to_exit_vertex_;
   }
-  router_context_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && render_context_ != nullptr) {
-    delete render_context_;
+  _impl_.stop_name_to_exit_vertex_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.edge_to_desc_ != nullptr) {
+    delete _impl_.edge_to_desc_;
   }
-  render_context_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && stop_name_to_enter_vertex_ != nullptr) {
-    delete stop_name_to_enter_vertex_;
+  _impl_.edge_to_desc_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.edges_ != nullptr) {
+    delete _impl_.edges_;
   }
-  stop_name_to_enter_vertex_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && stop_name_to_exit_vertex_ != nullptr) {
-    delete stop_name_to_exit_vertex_;
+  _impl_.edges_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.incidence_lists_ != nullptr) {
+    delete _impl_.incidence_lists_;
   }
-  stop_name_to_exit_vertex_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && edge_to_desc_ != nullptr) {
-    delete edge_to_desc_;
+  _impl_.incidence_lists_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.routes_data_ != nullptr) {
+    delete _impl_.routes_data_;
   }
-  edge_to_desc_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && edges_ != nullptr) {
-    delete edges_;
+  _impl_.routes_data_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.packed_routes_data_ != nullptr) {
+    delete _impl_.packed_routes_data_;
   }
-  edges_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && incidence_lists_ != nullptr) {
-    delete incidence_lists_;
+  _impl_.packed_routes_data_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.contraction_hierarchy_ != nullptr) {
+    delete _impl_.contraction_hierarchy_;
   }
-  incidence_lists_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && routes_data_ != nullptr) {
-    delete routes_data_;
+  _impl_.contraction_hierarchy_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.hub_labels_ != nullptr) {
+    delete _impl_.hub_labels_;
   }
-  routes_data_ = nullptr;
-  is_routes_data_ = false;
+  _impl_.hub_labels_ = nullptr;
+  ::memset(&_impl_.is_routes_data_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.format_version_) -
+      reinterpret_cast<char*>(&_impl_.is_routes_data_)) + sizeof(_impl_.format_version_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TransportCatalogue::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TransportCatalogue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .TransCatSerial.StopList stops = 1;
       case 1:
@@ -3323,7 +3704,7 @@ const char* TransportCatalogue::_InternalParse(const char* ptr, ::PROTOBUF_NAMES
       // bool is_routes_data = 5;
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          is_routes_data_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.is_routes_data_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -3376,18 +3757,50 @@ const char* TransportCatalogue::_InternalParse(const char* ptr, ::PROTOBUF_NAMES
         } else
           goto handle_unusual;
         continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+      // uint32 format_version = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.format_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .TransCatSerial.PackedRoutesData packed_routes_data = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_packed_routes_data(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .TransCatSerial.ContractionHierarchy contraction_hierarchy = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_contraction_hierarchy(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .TransCatSerial.HubLabels hub_labels = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hub_labels(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
         ptr, ctx);
     CHK_(ptr != nullptr);
   }  // while
@@ -3407,92 +3820,109 @@ uint8_t* TransportCatalogue::_InternalSerialize(
 
   // .TransCatSerial.StopList stops = 1;
   if (this->_internal_has_stops()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::stops(this), target, stream);
+      InternalWriteMessage(1, _Internal::stops(this),
+        _Internal::stops(this).GetCachedSize(), target, stream);
   }
 
   // .TransCatSerial.BusList buses = 2;
   if (this->_internal_has_buses()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::buses(this), target, stream);
+      InternalWriteMessage(2, _Internal::buses(this),
+        _Internal::buses(this).GetCachedSize(), target, stream);
   }
 
   // .TransCatSerial.RouterContext router_context = 3;
   if (this->_internal_has_router_context()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::router_context(this), target, stream);
+      InternalWriteMessage(3, _Internal::router_context(this),
+        _Internal::router_context(this).GetCachedSize(), target, stream);
   }
 
   // .TransCatSerial.MapRendererContext render_context = 4;
   if (this->_internal_has_render_context()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::render_context(this), target, stream);
+      InternalWriteMessage(4, _Internal::render_context(this),
+        _Internal::render_context(this).GetCachedSize(), target, stream);
   }
 
   // bool is_routes_data = 5;
   if (this->_internal_is_routes_data() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(5, this->_internal_is_routes_data(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_is_routes_data(), target);
   }
 
   // .TransCatSerial.StopNameToVertexList stop_name_to_enter_vertex = 6;
   if (this->_internal_has_stop_name_to_enter_vertex()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        6, _Internal::stop_name_to_enter_vertex(this), target, stream);
+      InternalWriteMessage(6, _Internal::stop_name_to_enter_vertex(this),
+        _Internal::stop_name_to_enter_vertex(this).GetCachedSize(), target, stream);
   }
 
   // .TransCatSerial.StopNameToVertexList stop_name_to_exit_vertex = 7;
   if (this->_internal_has_stop_name_to_exit_vertex()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        7, _Internal::stop_name_to_exit_vertex(this), target, stream);
+      InternalWriteMessage(7, _Internal::stop_name_to_exit_vertex(this),
+        _Internal::stop_name_to_exit_vertex(this).GetCachedSize(), target, stream);
   }
 
   // .TransCatSerial.EdgeToDescList edge_to_desc = 8;
   if (this->_internal_has_edge_to_desc()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        8, _Internal::edge_to_desc(this), target, stream);
+      InternalWriteMessage(8, _Internal::edge_to_desc(this),
+        _Internal::edge_to_desc(this).GetCachedSize(), target, stream);
   }
 
   // .TransCatSerial.Edges edges = 9;
   if (this->_internal_has_edges()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        9, _Internal::edges(this), target, stream);
+      InternalWriteMessage(9, _Internal::edges(this),
+        _Internal::edges(this).GetCachedSize(), target, stream);
   }
 
   // .TransCatSerial.IncidenceLists incidence_lists = 10;
   if (this->_internal_has_incidence_lists()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        10, _Internal::incidence_lists(this), target, stream);
+      InternalWriteMessage(10, _Internal::incidence_lists(this),
+        _Internal::incidence_lists(this).GetCachedSize(), target, stream);
   }
 
   // .TransCatSerial.RoutesData routes_data = 11;
   if (this->_internal_has_routes_data()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::routes_data(this),
+        _Internal::routes_data(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 format_version = 12;
+  if (this->_internal_format_version() != 0) {
     target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(12, this->_internal_format_version(), target);
+  }
+
+  // .TransCatSerial.PackedRoutesData packed_routes_data = 13;
+  if (this->_internal_has_packed_routes_data()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(13, _Internal::packed_routes_data(this),
+        _Internal::packed_routes_data(this).GetCachedSize(), target, stream);
+  }
+
+  // .TransCatSerial.ContractionHierarchy contraction_hierarchy = 14;
+  if (this->_internal_has_contraction_hierarchy()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(14, _Internal::contraction_hierarchy(this),
+        _Internal::contraction_hierarchy(this).GetCachedSize(), target, stream);
+  }
+
+  // .TransCatSerial.HubLabels hub_labels = 15;
+  if (this->_internal_has_hub_labels()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        11, _Internal::routes_data(this), target, stream);
+      InternalWriteMessage(15, _Internal::hub_labels(this),
+        _Internal::hub_labels(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.TransportCatalogue)
@@ -3511,70 +3941,91 @@ size_t TransportCatalogue::ByteSizeLong() const {
   if (this->_internal_has_stops()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *stops_);
+        *_impl_.stops_);
   }
 
   // .TransCatSerial.BusList buses = 2;
   if (this->_internal_has_buses()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *buses_);
+        *_impl_.buses_);
   }
 
   // .TransCatSerial.RouterContext router_context = 3;
   if (this->_internal_has_router_context()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *router_context_);
+        *_impl_.router_context_);
   }
 
   // .TransCatSerial.MapRendererContext render_context = 4;
   if (this->_internal_has_render_context()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *render_context_);
+        *_impl_.render_context_);
   }
 
   // .TransCatSerial.StopNameToVertexList stop_name_to_enter_vertex = 6;
   if (this->_internal_has_stop_name_to_enter_vertex()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *stop_name_to_enter_vertex_);
+        *_impl_.stop_name_to_enter_vertex_);
   }
 
   // .TransCatSerial.StopNameToVertexList stop_name_to_exit_vertex = 7;
   if (this->_internal_has_stop_name_to_exit_vertex()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *stop_name_to_exit_vertex_);
+        *_impl_.stop_name_to_exit_vertex_);
   }
 
   // .TransCatSerial.EdgeToDescList edge_to_desc = 8;
   if (this->_internal_has_edge_to_desc()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *edge_to_desc_);
+        *_impl_.edge_to_desc_);
   }
 
   // .TransCatSerial.Edges edges = 9;
   if (this->_internal_has_edges()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *edges_);
+        *_impl_.edges_);
   }
 
   // .TransCatSerial.IncidenceLists incidence_lists = 10;
   if (this->_internal_has_incidence_lists()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *incidence_lists_);
+        *_impl_.incidence_lists_);
   }
 
   // .TransCatSerial.RoutesData routes_data = 11;
   if (this->_internal_has_routes_data()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *routes_data_);
+        *_impl_.routes_data_);
+  }
+
+  // .TransCatSerial.PackedRoutesData packed_routes_data = 13;
+  if (this->_internal_has_packed_routes_data()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.packed_routes_data_);
+  }
+
+  // .TransCatSerial.ContractionHierarchy contraction_hierarchy = 14;
+  if (this->_internal_has_contraction_hierarchy()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.contraction_hierarchy_);
+  }
+
+  // .TransCatSerial.HubLabels hub_labels = 15;
+  if (this->_internal_has_hub_labels()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.hub_labels_);
   }
 
   // bool is_routes_data = 5;
@@ -3582,62 +4033,88 @@ size_t TransportCatalogue::ByteSizeLong() const {
     total_size += 1 + 1;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  // uint32 format_version = 12;
+  if (this->_internal_format_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_format_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TransportCatalogue::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     TransportCatalogue::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TransportCatalogue::GetClassData() const { return &_class_data_; }
 
-void TransportCatalogue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<TransportCatalogue *>(to)->MergeFrom(
-      static_cast<const TransportCatalogue &>(from));
-}
-
 
-void TransportCatalogue::MergeFrom(const TransportCatalogue& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.TransportCatalogue)
-  GOOGLE_DCHECK_NE(&from, this);
+void TransportCatalogue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TransportCatalogue*>(&to_msg);
+  auto& from = static_cast<const TransportCatalogue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.TransportCatalogue)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (from._internal_has_stops()) {
-    _internal_mutable_stops()->::TransCatSerial::StopList::MergeFrom(from._internal_stops());
+    _this->_internal_mutable_stops()->::TransCatSerial::StopList::MergeFrom(
+        from._internal_stops());
   }
   if (from._internal_has_buses()) {
-    _internal_mutable_buses()->::TransCatSerial::BusList::MergeFrom(from._internal_buses());
+    _this->_internal_mutable_buses()->::TransCatSerial::BusList::MergeFrom(
+        from._internal_buses());
   }
   if (from._internal_has_router_context()) {
-    _internal_mutable_router_context()->::TransCatSerial::RouterContext::MergeFrom(from._internal_router_context());
+    _this->_internal_mutable_router_context()->::TransCatSerial::RouterContext::MergeFrom(
+        from._internal_router_context());
   }
   if (from._internal_has_render_context()) {
-    _internal_mutable_render_context()->::TransCatSerial::MapRendererContext::MergeFrom(from._internal_render_context());
+    _this->_internal_mutable_render_context()->::TransCatSerial::MapRendererContext::MergeFrom(
+        from._internal_render_context());
   }
   if (from._internal_has_stop_name_to_enter_vertex()) {
-    _internal_mutable_stop_name_to_enter_vertex()->::TransCatSerial::StopNameToVertexList::MergeFrom(from._internal_stop_name_to_enter_vertex());
+    _this->_internal_mutable_stop_name_to_enter_vertex()->::TransCatSerial::StopNameToVertexList::MergeFrom(
+        from._internal_stop_name_to_enter_vertex());
   }
   if (from._internal_has_stop_name_to_exit_vertex()) {
-    _internal_mutable_stop_name_to_exit_vertex()->::TransCatSerial::StopNameToVertexList::MergeFrom(from._internal_stop_name_to_exit_vertex());
+    _this->_internal_mutable_stop_name_to_exit_vertex()->::TransCatSerial::StopNameToVertexList::MergeFrom(
+        from._internal_stop_name_to_exit_vertex());
   }
   if (from._internal_has_edge_to_desc()) {
-    _internal_mutable_edge_to_desc()->::TransCatSerial::EdgeToDescList::MergeFrom(from._internal_edge_to_desc());
+    _this->_internal_mutable_edge_to_desc()->::TransCatSerial::EdgeToDescList::MergeFrom(
+        from._internal_edge_to_desc());
   }
   if (from._internal_has_edges()) {
-    _internal_mutable_edges()->::TransCatSerial::Edges::MergeFrom(from._internal_edges());
+    _this->_internal_mutable_edges()->::TransCatSerial::Edges::MergeFrom(
+        from._internal_edges());
   }
   if (from._internal_has_incidence_lists()) {
-    _internal_mutable_incidence_lists()->::TransCatSerial::IncidenceLists::MergeFrom(from._internal_incidence_lists());
+    _this->_internal_mutable_incidence_lists()->::TransCatSerial::IncidenceLists::MergeFrom(
+        from._internal_incidence_lists());
   }
   if (from._internal_has_routes_data()) {
-    _internal_mutable_routes_data()->::TransCatSerial::RoutesData::MergeFrom(from._internal_routes_data());
+    _this->_internal_mutable_routes_data()->::TransCatSerial::RoutesData::MergeFrom(
+        from._internal_routes_data());
+  }
+  if (from._internal_has_packed_routes_data()) {
+    _this->_internal_mutable_packed_routes_data()->::TransCatSerial::PackedRoutesData::MergeFrom(
+        from._internal_packed_routes_data());
+  }
+  if (from._internal_has_contraction_hierarchy()) {
+    _this->_internal_mutable_contraction_hierarchy()->::TransCatSerial::ContractionHierarchy::MergeFrom(
+        from._internal_contraction_hierarchy());
+  }
+  if (from._internal_has_hub_labels()) {
+    _this->_internal_mutable_hub_labels()->::TransCatSerial::HubLabels::MergeFrom(
+        from._internal_hub_labels());
   }
   if (from._internal_is_routes_data() != 0) {
-    _internal_set_is_routes_data(from._internal_is_routes_data());
+    _this->_internal_set_is_routes_data(from._internal_is_routes_data());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_format_version() != 0) {
+    _this->_internal_set_format_version(from._internal_format_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void TransportCatalogue::CopyFrom(const TransportCatalogue& from) {
@@ -3655,58 +4132,552 @@ void TransportCatalogue::InternalSwap(TransportCatalogue* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TransportCatalogue, is_routes_data_)
-      + sizeof(TransportCatalogue::is_routes_data_)
-      - PROTOBUF_FIELD_OFFSET(TransportCatalogue, stops_)>(
-          reinterpret_cast<char*>(&stops_),
-          reinterpret_cast<char*>(&other->stops_));
+      PROTOBUF_FIELD_OFFSET(TransportCatalogue, _impl_.format_version_)
+      + sizeof(TransportCatalogue::_impl_.format_version_)
+      - PROTOBUF_FIELD_OFFSET(TransportCatalogue, _impl_.stops_)>(
+          reinterpret_cast<char*>(&_impl_.stops_),
+          reinterpret_cast<char*>(&other->_impl_.stops_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata TransportCatalogue::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
       file_level_metadata_transport_5fcatalogue_2eproto[11]);
 }
 
+// ===================================================================
+
+class BaseSection::_Internal {
+ public:
+};
+
+BaseSection::BaseSection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TransCatSerial.BaseSection)
+}
+BaseSection::BaseSection(const BaseSection& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BaseSection* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.offset_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.compressed_){}
+    , decltype(_impl_.size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.offset_, &from._impl_.offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.size_) -
+    reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.size_));
+  // @@protoc_insertion_point(copy_constructor:TransCatSerial.BaseSection)
+}
+
+inline void BaseSection::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.offset_){uint64_t{0u}}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.compressed_){false}
+    , decltype(_impl_.size_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BaseSection::~BaseSection() {
+  // @@protoc_insertion_point(destructor:TransCatSerial.BaseSection)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BaseSection::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void BaseSection::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BaseSection::Clear() {
+// @@protoc_insertion_point(message_clear_start:TransCatSerial.BaseSection)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.offset_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.size_) -
+      reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.size_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BaseSection::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .TransCatSerial.BaseSection.SectionType type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::TransCatSerial::BaseSection_SectionType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 offset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool compressed = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.compressed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BaseSection::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TransCatSerial.BaseSection)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .TransCatSerial.BaseSection.SectionType type = 1;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // uint64 offset = 2;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_offset(), target);
+  }
+
+  // uint64 size = 3;
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_size(), target);
+  }
+
+  // bool compressed = 4;
+  if (this->_internal_compressed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_compressed(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.BaseSection)
+  return target;
+}
+
+size_t BaseSection::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TransCatSerial.BaseSection)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 offset = 2;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_offset());
+  }
+
+  // .TransCatSerial.BaseSection.SectionType type = 1;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  // bool compressed = 4;
+  if (this->_internal_compressed() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 size = 3;
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BaseSection::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BaseSection::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BaseSection::GetClassData() const { return &_class_data_; }
+
+
+void BaseSection::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BaseSection*>(&to_msg);
+  auto& from = static_cast<const BaseSection&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.BaseSection)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_compressed() != 0) {
+    _this->_internal_set_compressed(from._internal_compressed());
+  }
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BaseSection::CopyFrom(const BaseSection& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TransCatSerial.BaseSection)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BaseSection::IsInitialized() const {
+  return true;
+}
+
+void BaseSection::InternalSwap(BaseSection* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BaseSection, _impl_.size_)
+      + sizeof(BaseSection::_impl_.size_)
+      - PROTOBUF_FIELD_OFFSET(BaseSection, _impl_.offset_)>(
+          reinterpret_cast<char*>(&_impl_.offset_),
+          reinterpret_cast<char*>(&other->_impl_.offset_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BaseSection::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[12]);
+}
+
+// ===================================================================
+
+class BaseIndex::_Internal {
+ public:
+};
+
+BaseIndex::BaseIndex(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TransCatSerial.BaseIndex)
+}
+BaseIndex::BaseIndex(const BaseIndex& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BaseIndex* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sections_){from._impl_.sections_}
+    , decltype(_impl_.format_version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.format_version_ = from._impl_.format_version_;
+  // @@protoc_insertion_point(copy_constructor:TransCatSerial.BaseIndex)
+}
+
+inline void BaseIndex::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sections_){arena}
+    , decltype(_impl_.format_version_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BaseIndex::~BaseIndex() {
+  // @@protoc_insertion_point(destructor:TransCatSerial.BaseIndex)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BaseIndex::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sections_.~RepeatedPtrField();
+}
+
+void BaseIndex::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BaseIndex::Clear() {
+// @@protoc_insertion_point(message_clear_start:TransCatSerial.BaseIndex)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sections_.Clear();
+  _impl_.format_version_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BaseIndex::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 format_version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.format_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .TransCatSerial.BaseSection sections = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_sections(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BaseIndex::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TransCatSerial.BaseIndex)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 format_version = 1;
+  if (this->_internal_format_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_format_version(), target);
+  }
+
+  // repeated .TransCatSerial.BaseSection sections = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sections_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sections(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TransCatSerial.BaseIndex)
+  return target;
+}
+
+size_t BaseIndex::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TransCatSerial.BaseIndex)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .TransCatSerial.BaseSection sections = 2;
+  total_size += 1UL * this->_internal_sections_size();
+  for (const auto& msg : this->_impl_.sections_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint32 format_version = 1;
+  if (this->_internal_format_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_format_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BaseIndex::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BaseIndex::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BaseIndex::GetClassData() const { return &_class_data_; }
+
+
+void BaseIndex::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BaseIndex*>(&to_msg);
+  auto& from = static_cast<const BaseIndex&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TransCatSerial.BaseIndex)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.sections_.MergeFrom(from._impl_.sections_);
+  if (from._internal_format_version() != 0) {
+    _this->_internal_set_format_version(from._internal_format_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BaseIndex::CopyFrom(const BaseIndex& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TransCatSerial.BaseIndex)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BaseIndex::IsInitialized() const {
+  return true;
+}
+
+void BaseIndex::InternalSwap(BaseIndex* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.sections_.InternalSwap(&other->_impl_.sections_);
+  swap(_impl_.format_version_, other->_impl_.format_version_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BaseIndex::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[13]);
+}
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace TransCatSerial
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::TransCatSerial::StopNameToVertex* Arena::CreateMaybeMessage< ::TransCatSerial::StopNameToVertex >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::StopNameToVertex*
+Arena::CreateMaybeMessage< ::TransCatSerial::StopNameToVertex >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::StopNameToVertex >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::StopNameToVertexList* Arena::CreateMaybeMessage< ::TransCatSerial::StopNameToVertexList >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::StopNameToVertexList*
+Arena::CreateMaybeMessage< ::TransCatSerial::StopNameToVertexList >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::StopNameToVertexList >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::EdgeDescriptor* Arena::CreateMaybeMessage< ::TransCatSerial::EdgeDescriptor >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::EdgeDescriptor*
+Arena::CreateMaybeMessage< ::TransCatSerial::EdgeDescriptor >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::EdgeDescriptor >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::EdgeToDesc* Arena::CreateMaybeMessage< ::TransCatSerial::EdgeToDesc >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::EdgeToDesc*
+Arena::CreateMaybeMessage< ::TransCatSerial::EdgeToDesc >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::EdgeToDesc >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::EdgeToDescList* Arena::CreateMaybeMessage< ::TransCatSerial::EdgeToDescList >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::EdgeToDescList*
+Arena::CreateMaybeMessage< ::TransCatSerial::EdgeToDescList >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::EdgeToDescList >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::Coordinates* Arena::CreateMaybeMessage< ::TransCatSerial::Coordinates >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::Coordinates*
+Arena::CreateMaybeMessage< ::TransCatSerial::Coordinates >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::Coordinates >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::DistanceToStop* Arena::CreateMaybeMessage< ::TransCatSerial::DistanceToStop >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::DistanceToStop*
+Arena::CreateMaybeMessage< ::TransCatSerial::DistanceToStop >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::DistanceToStop >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::Stop* Arena::CreateMaybeMessage< ::TransCatSerial::Stop >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::Stop*
+Arena::CreateMaybeMessage< ::TransCatSerial::Stop >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::Stop >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::Bus* Arena::CreateMaybeMessage< ::TransCatSerial::Bus >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::Bus*
+Arena::CreateMaybeMessage< ::TransCatSerial::Bus >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::Bus >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::StopList* Arena::CreateMaybeMessage< ::TransCatSerial::StopList >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::StopList*
+Arena::CreateMaybeMessage< ::TransCatSerial::StopList >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::StopList >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::BusList* Arena::CreateMaybeMessage< ::TransCatSerial::BusList >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::BusList*
+Arena::CreateMaybeMessage< ::TransCatSerial::BusList >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::BusList >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TransCatSerial::TransportCatalogue* Arena::CreateMaybeMessage< ::TransCatSerial::TransportCatalogue >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TransCatSerial::TransportCatalogue*
+Arena::CreateMaybeMessage< ::TransCatSerial::TransportCatalogue >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TransCatSerial::TransportCatalogue >(arena);
 }
+template<> PROTOBUF_NOINLINE ::TransCatSerial::BaseSection*
+Arena::CreateMaybeMessage< ::TransCatSerial::BaseSection >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TransCatSerial::BaseSection >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TransCatSerial::BaseIndex*
+Arena::CreateMaybeMessage< ::TransCatSerial::BaseIndex >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TransCatSerial::BaseIndex >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3019000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3019003 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -45,18 +44,16 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_transport_5fcatalogue_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[12]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
   static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transport_5fcatalogue_2eproto;
 namespace TransCatSerial {
+class BaseIndex;
+struct BaseIndexDefaultTypeInternal;
+extern BaseIndexDefaultTypeInternal _BaseIndex_default_instance_;
+class BaseSection;
+struct BaseSectionDefaultTypeInternal;
+extern BaseSectionDefaultTypeInternal _BaseSection_default_instance_;
 class Bus;
 struct BusDefaultTypeInternal;
 extern BusDefaultTypeInternal _Bus_default_instance_;
@@ -95,6 +92,8 @@ struct TransportCatalogueDefaultTypeInternal;
 extern TransportCatalogueDefaultTypeInternal _TransportCatalogue_default_instance_;
 }  // namespace TransCatSerial
 PROTOBUF_NAMESPACE_OPEN
+template<> ::TransCatSerial::BaseIndex* Arena::CreateMaybeMessage<::TransCatSerial::BaseIndex>(Arena*);
+template<> ::TransCatSerial::BaseSection* Arena::CreateMaybeMessage<::TransCatSerial::BaseSection>(Arena*);
 template<> ::TransCatSerial::Bus* Arena::CreateMaybeMessage<::TransCatSerial::Bus>(Arena*);
 template<> ::TransCatSerial::BusList* Arena::CreateMaybeMessage<::TransCatSerial::BusList>(Arena*);
 template<> ::TransCatSerial::Coordinates* Arena::CreateMaybeMessage<::TransCatSerial::Coordinates>(Arena*);
@@ -187,6 +186,34 @@ inline bool Bus_BusType_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Bus_BusType>(
     Bus_BusType_descriptor(), name, value);
 }
+enum BaseSection_SectionType : int {
+  BaseSection_SectionType_SECTION_UNKNOWN = 0,
+  BaseSection_SectionType_SECTION_CATALOGUE = 1,
+  BaseSection_SectionType_SECTION_ROUTER_CONTEXT = 2,
+  BaseSection_SectionType_SECTION_RENDER_CONTEXT = 3,
+  BaseSection_SectionType_SECTION_ROUTER = 4,
+  BaseSection_SectionType_BaseSection_SectionType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  BaseSection_SectionType_BaseSection_SectionType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool BaseSection_SectionType_IsValid(int value);
+constexpr BaseSection_SectionType BaseSection_SectionType_SectionType_MIN = BaseSection_SectionType_SECTION_UNKNOWN;
+constexpr BaseSection_SectionType BaseSection_SectionType_SectionType_MAX = BaseSection_SectionType_SECTION_ROUTER;
+constexpr int BaseSection_SectionType_SectionType_ARRAYSIZE = BaseSection_SectionType_SectionType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* BaseSection_SectionType_descriptor();
+template<typename T>
+inline const std::string& BaseSection_SectionType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, BaseSection_SectionType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function BaseSection_SectionType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    BaseSection_SectionType_descriptor(), enum_t_value);
+}
+inline bool BaseSection_SectionType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, BaseSection_SectionType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<BaseSection_SectionType>(
+    BaseSection_SectionType_descriptor(), name, value);
+}
 // ===================================================================
 
 class StopNameToVertex final :
@@ -194,7 +221,7 @@ class StopNameToVertex final :
  public:
   inline StopNameToVertex() : StopNameToVertex(nullptr) {}
   ~StopNameToVertex() override;
-  explicit constexpr StopNameToVertex(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR StopNameToVertex(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   StopNameToVertex(const StopNameToVertex& from);
   StopNameToVertex(StopNameToVertex&& from) noexcept
@@ -269,9 +296,11 @@ class StopNameToVertex final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const StopNameToVertex& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const StopNameToVertex& from);
+  void MergeFrom( const StopNameToVertex& from) {
+    StopNameToVertex::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -280,10 +309,10 @@ class StopNameToVertex final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(StopNameToVertex* other);
@@ -296,9 +325,6 @@ class StopNameToVertex final :
   protected:
   explicit StopNameToVertex(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -339,9 +365,12 @@ class StopNameToVertex final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  uint32_t stop_name_num_;
-  uint32_t vertex_id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint32_t stop_name_num_;
+    uint32_t vertex_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5fcatalogue_2eproto;
 };
 // -------------------------------------------------------------------
@@ -351,7 +380,7 @@ class StopNameToVertexList final :
  public:
   inline StopNameToVertexList() : StopNameToVertexList(nullptr) {}
   ~StopNameToVertexList() override;
-  explicit constexpr StopNameToVertexList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR StopNameToVertexList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   StopNameToVertexList(const StopNameToVertexList& from);
   StopNameToVertexList(StopNameToVertexList&& from) noexcept
@@ -426,9 +455,11 @@ class StopNameToVertexList final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const StopNameToVertexList& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const StopNameToVertexList& from);
+  void MergeFrom( const StopNameToVertexList& from) {
+    StopNameToVertexList::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -437,10 +468,10 @@ class StopNameToVertexList final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(StopNameToVertexList* other);
@@ -453,9 +484,6 @@ class StopNameToVertexList final :
   protected:
   explicit StopNameToVertexList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -495,8 +523,11 @@ class StopNameToVertexList final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::StopNameToVertex > stop_name_to_vertex_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::StopNameToVertex > stop_name_to_vertex_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5fcatalogue_2eproto;
 };
 // -------------------------------------------------------------------
@@ -506,7 +537,7 @@ class EdgeDescriptor final :
  public:
   inline EdgeDescriptor() : EdgeDescriptor(nullptr) {}
   ~EdgeDescriptor() override;
-  explicit constexpr EdgeDescriptor(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR EdgeDescriptor(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   EdgeDescriptor(const EdgeDescriptor& from);
   EdgeDescriptor(EdgeDescriptor&& from) noexcept
@@ -581,9 +612,11 @@ class EdgeDescriptor final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const EdgeDescriptor& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const EdgeDescriptor& from);
+  void MergeFrom( const EdgeDescriptor& from) {
+    EdgeDescriptor::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -592,10 +625,10 @@ class EdgeDescriptor final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(EdgeDescriptor* other);
@@ -608,9 +641,6 @@ class EdgeDescriptor final :
   protected:
   explicit EdgeDescriptor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -661,6 +691,8 @@ class EdgeDescriptor final :
     kBusNameNumFieldNumber = 4,
     kTimeLengthFieldNumber = 6,
     kSpanCountFieldNumber = 5,
+    kFromPositionFieldNumber = 7,
+    kIsBackwardFieldNumber = 8,
   };
   // .TransCatSerial.EdgeDescriptor.EdgeType edge_type = 1;
   void clear_edge_type();
@@ -716,6 +748,24 @@ class EdgeDescriptor final :
   void _internal_set_span_count(uint32_t value);
   public:
 
+  // uint32 from_position = 7;
+  void clear_from_position();
+  uint32_t from_position() const;
+  void set_from_position(uint32_t value);
+  private:
+  uint32_t _internal_from_position() const;
+  void _internal_set_from_position(uint32_t value);
+  public:
+
+  // bool is_backward = 8;
+  void clear_is_backward();
+  bool is_backward() const;
+  void set_is_backward(bool value);
+  private:
+  bool _internal_is_backward() const;
+  void _internal_set_is_backward(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:TransCatSerial.EdgeDescriptor)
  private:
   class _Internal;
@@ -723,13 +773,18 @@ class EdgeDescriptor final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  int edge_type_;
-  uint32_t from_stop_num_;
-  uint32_t to_stop_num_;
-  uint32_t bus_name_num_;
-  double time_length_;
-  uint32_t span_count_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int edge_type_;
+    uint32_t from_stop_num_;
+    uint32_t to_stop_num_;
+    uint32_t bus_name_num_;
+    double time_length_;
+    uint32_t span_count_;
+    uint32_t from_position_;
+    bool is_backward_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5fcatalogue_2eproto;
 };
 // -------------------------------------------------------------------
@@ -739,7 +794,7 @@ class EdgeToDesc final :
  public:
   inline EdgeToDesc() : EdgeToDesc(nullptr) {}
   ~EdgeToDesc() override;
-  explicit constexpr EdgeToDesc(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR EdgeToDesc(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   EdgeToDesc(const EdgeToDesc& from);
   EdgeToDesc(EdgeToDesc&& from) noexcept
@@ -814,9 +869,11 @@ class EdgeToDesc final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const EdgeToDesc& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const EdgeToDesc& from);
+  void MergeFrom( const EdgeToDesc& from) {
+    EdgeToDesc::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -825,10 +882,10 @@ class EdgeToDesc final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(EdgeToDesc* other);
@@ -841,9 +898,6 @@ class EdgeToDesc final :
   protected:
   explicit EdgeToDesc(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -893,9 +947,12 @@ class EdgeToDesc final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::TransCatSerial::EdgeDescriptor* edge_descriptor_;
-  uint32_t edge_id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::TransCatSerial::EdgeDescriptor* edge_descriptor_;
+    uint32_t edge_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5fcatalogue_2eproto;
 };
 // -------------------------------------------------------------------
@@ -905,7 +962,7 @@ class EdgeToDescList final :
  public:
   inline EdgeToDescList() : EdgeToDescList(nullptr) {}
   ~EdgeToDescList() override;
-  explicit constexpr EdgeToDescList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR EdgeToDescList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   EdgeToDescList(const EdgeToDescList& from);
   EdgeToDescList(EdgeToDescList&& from) noexcept
@@ -980,9 +1037,11 @@ class EdgeToDescList final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const EdgeToDescList& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const EdgeToDescList& from);
+  void MergeFrom( const EdgeToDescList& from) {
+    EdgeToDescList::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -991,10 +1050,10 @@ class EdgeToDescList final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(EdgeToDescList* other);
@@ -1007,9 +1066,6 @@ class EdgeToDescList final :
   protected:
   explicit EdgeToDescList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -1049,8 +1105,11 @@ class EdgeToDescList final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::EdgeToDesc > edge_to_desc_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::EdgeToDesc > edge_to_desc_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5fcatalogue_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1060,7 +1119,7 @@ class Coordinates final :
  public:
   inline Coordinates() : Coordinates(nullptr) {}
   ~Coordinates() override;
-  explicit constexpr Coordinates(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR Coordinates(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Coordinates(const Coordinates& from);
   Coordinates(Coordinates&& from) noexcept
@@ -1135,9 +1194,11 @@ class Coordinates final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Coordinates& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Coordinates& from);
+  void MergeFrom( const Coordinates& from) {
+    Coordinates::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1146,10 +1207,10 @@ class Coordinates final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Coordinates* other);
@@ -1162,9 +1223,6 @@ class Coordinates final :
   protected:
   explicit Coordinates(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -1205,9 +1263,12 @@ class Coordinates final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  double lat_;
-  double lng_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    double lat_;
+    double lng_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5fcatalogue_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1217,7 +1278,7 @@ class DistanceToStop final :
  public:
   inline DistanceToStop() : DistanceToStop(nullptr) {}
   ~DistanceToStop() override;
-  explicit constexpr DistanceToStop(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR DistanceToStop(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DistanceToStop(const DistanceToStop& from);
   DistanceToStop(DistanceToStop&& from) noexcept
@@ -1292,9 +1353,11 @@ class DistanceToStop final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DistanceToStop& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const DistanceToStop& from);
+  void MergeFrom( const DistanceToStop& from) {
+    DistanceToStop::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1303,10 +1366,10 @@ class DistanceToStop final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(DistanceToStop* other);
@@ -1319,9 +1382,6 @@ class DistanceToStop final :
   protected:
   explicit DistanceToStop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -1362,9 +1422,12 @@ class DistanceToStop final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  double distance_;
-  uint32_t stop_num_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    double distance_;
+    uint32_t stop_num_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5fcatalogue_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1374,7 +1437,7 @@ class Stop final :
  public:
   inline Stop() : Stop(nullptr) {}
   ~Stop() override;
-  explicit constexpr Stop(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR Stop(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Stop(const Stop& from);
   Stop(Stop&& from) noexcept
@@ -1449,9 +1512,11 @@ class Stop final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Stop& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Stop& from);
+  void MergeFrom( const Stop& from) {
+    Stop::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1460,10 +1525,10 @@ class Stop final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Stop* other);
@@ -1476,9 +1541,6 @@ class Stop final :
   protected:
   explicit Stop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -1525,6 +1587,7 @@ class Stop final :
     kDistanceToStopFieldNumber = 5,
     kStopNameFieldNumber = 2,
     kStopCoordsFieldNumber = 3,
+    kWaitTimeFieldNumber = 6,
     kStopTypeFieldNumber = 1,
   };
   // repeated uint32 buses_at_stop = 4;
@@ -1599,6 +1662,19 @@ class Stop final :
       ::TransCatSerial::Coordinates* stop_coords);
   ::TransCatSerial::Coordinates* unsafe_arena_release_stop_coords();
 
+  // optional double wait_time = 6;
+  bool has_wait_time() const;
+  private:
+  bool _internal_has_wait_time() const;
+  public:
+  void clear_wait_time();
+  double wait_time() const;
+  void set_wait_time(double value);
+  private:
+  double _internal_wait_time() const;
+  void _internal_set_wait_time(double value);
+  public:
+
   // .TransCatSerial.Stop.StopType stop_type = 1;
   void clear_stop_type();
   ::TransCatSerial::Stop_StopType stop_type() const;
@@ -1615,13 +1691,18 @@ class Stop final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > buses_at_stop_;
-  mutable std::atomic<int> _buses_at_stop_cached_byte_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::DistanceToStop > distance_to_stop_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr stop_name_;
-  ::TransCatSerial::Coordinates* stop_coords_;
-  int stop_type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > buses_at_stop_;
+    mutable std::atomic<int> _buses_at_stop_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::DistanceToStop > distance_to_stop_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr stop_name_;
+    ::TransCatSerial::Coordinates* stop_coords_;
+    double wait_time_;
+    int stop_type_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5fcatalogue_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1631,7 +1712,7 @@ class Bus final :
  public:
   inline Bus() : Bus(nullptr) {}
   ~Bus() override;
-  explicit constexpr Bus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR Bus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Bus(const Bus& from);
   Bus(Bus&& from) noexcept
@@ -1706,9 +1787,11 @@ class Bus final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Bus& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Bus& from);
+  void MergeFrom( const Bus& from) {
+    Bus::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1717,10 +1800,10 @@ class Bus final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Bus* other);
@@ -1733,9 +1816,6 @@ class Bus final :
   protected:
   explicit Bus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -1781,7 +1861,9 @@ class Bus final :
 
   enum : int {
     kBusStopsFieldNumber = 3,
+    kDeparturesFieldNumber = 4,
     kBusNameFieldNumber = 2,
+    kVelocityFieldNumber = 5,
     kBusTypeFieldNumber = 1,
   };
   // repeated uint32 bus_stops = 3;
@@ -1806,6 +1888,28 @@ class Bus final :
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_bus_stops();
 
+  // repeated double departures = 4;
+  int departures_size() const;
+  private:
+  int _internal_departures_size() const;
+  public:
+  void clear_departures();
+  private:
+  double _internal_departures(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_departures() const;
+  void _internal_add_departures(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_departures();
+  public:
+  double departures(int index) const;
+  void set_departures(int index, double value);
+  void add_departures(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      departures() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_departures();
+
   // bytes bus_name = 2;
   void clear_bus_name();
   const std::string& bus_name() const;
@@ -1820,6 +1924,19 @@ class Bus final :
   std::string* _internal_mutable_bus_name();
   public:
 
+  // optional double velocity = 5;
+  bool has_velocity() const;
+  private:
+  bool _internal_has_velocity() const;
+  public:
+  void clear_velocity();
+  double velocity() const;
+  void set_velocity(double value);
+  private:
+  double _internal_velocity() const;
+  void _internal_set_velocity(double value);
+  public:
+
   // .TransCatSerial.Bus.BusType bus_type = 1;
   void clear_bus_type();
   ::TransCatSerial::Bus_BusType bus_type() const;
@@ -1836,11 +1953,17 @@ class Bus final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > bus_stops_;
-  mutable std::atomic<int> _bus_stops_cached_byte_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bus_name_;
-  int bus_type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > bus_stops_;
+    mutable std::atomic<int> _bus_stops_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > departures_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bus_name_;
+    double velocity_;
+    int bus_type_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5fcatalogue_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1850,7 +1973,7 @@ class StopList final :
  public:
   inline StopList() : StopList(nullptr) {}
   ~StopList() override;
-  explicit constexpr StopList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR StopList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   StopList(const StopList& from);
   StopList(StopList&& from) noexcept
@@ -1925,9 +2048,11 @@ class StopList final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const StopList& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const StopList& from);
+  void MergeFrom( const StopList& from) {
+    StopList::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1936,10 +2061,10 @@ class StopList final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(StopList* other);
@@ -1952,9 +2077,6 @@ class StopList final :
   protected:
   explicit StopList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -1994,8 +2116,11 @@ class StopList final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Stop > stops_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Stop > stops_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5fcatalogue_2eproto;
 };
 // -------------------------------------------------------------------
@@ -2005,7 +2130,7 @@ class BusList final :
  public:
   inline BusList() : BusList(nullptr) {}
   ~BusList() override;
-  explicit constexpr BusList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR BusList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BusList(const BusList& from);
   BusList(BusList&& from) noexcept
@@ -2080,9 +2205,11 @@ class BusList final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BusList& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const BusList& from);
+  void MergeFrom( const BusList& from) {
+    BusList::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -2091,10 +2218,10 @@ class BusList final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(BusList* other);
@@ -2107,9 +2234,6 @@ class BusList final :
   protected:
   explicit BusList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -2149,8 +2273,11 @@ class BusList final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Bus > buses_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Bus > buses_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5fcatalogue_2eproto;
 };
 // -------------------------------------------------------------------
@@ -2160,7 +2287,7 @@ class TransportCatalogue final :
  public:
   inline TransportCatalogue() : TransportCatalogue(nullptr) {}
   ~TransportCatalogue() override;
-  explicit constexpr TransportCatalogue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR TransportCatalogue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TransportCatalogue(const TransportCatalogue& from);
   TransportCatalogue(TransportCatalogue&& from) noexcept
@@ -2235,9 +2362,11 @@ class TransportCatalogue final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TransportCatalogue& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const TransportCatalogue& from);
+  void MergeFrom( const TransportCatalogue& from) {
+    TransportCatalogue::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -2246,10 +2375,10 @@ class TransportCatalogue final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TransportCatalogue* other);
@@ -2262,9 +2391,6 @@ class TransportCatalogue final :
   protected:
   explicit TransportCatalogue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -2287,7 +2413,11 @@ class TransportCatalogue final :
     kEdgesFieldNumber = 9,
     kIncidenceListsFieldNumber = 10,
     kRoutesDataFieldNumber = 11,
+    kPackedRoutesDataFieldNumber = 13,
+    kContractionHierarchyFieldNumber = 14,
+    kHubLabelsFieldNumber = 15,
     kIsRoutesDataFieldNumber = 5,
+    kFormatVersionFieldNumber = 12,
   };
   // .TransCatSerial.StopList stops = 1;
   bool has_stops() const;
@@ -2469,6 +2599,60 @@ class TransportCatalogue final :
       ::TransCatSerial::RoutesData* routes_data);
   ::TransCatSerial::RoutesData* unsafe_arena_release_routes_data();
 
+  // .TransCatSerial.PackedRoutesData packed_routes_data = 13;
+  bool has_packed_routes_data() const;
+  private:
+  bool _internal_has_packed_routes_data() const;
+  public:
+  void clear_packed_routes_data();
+  const ::TransCatSerial::PackedRoutesData& packed_routes_data() const;
+  PROTOBUF_NODISCARD ::TransCatSerial::PackedRoutesData* release_packed_routes_data();
+  ::TransCatSerial::PackedRoutesData* mutable_packed_routes_data();
+  void set_allocated_packed_routes_data(::TransCatSerial::PackedRoutesData* packed_routes_data);
+  private:
+  const ::TransCatSerial::PackedRoutesData& _internal_packed_routes_data() const;
+  ::TransCatSerial::PackedRoutesData* _internal_mutable_packed_routes_data();
+  public:
+  void unsafe_arena_set_allocated_packed_routes_data(
+      ::TransCatSerial::PackedRoutesData* packed_routes_data);
+  ::TransCatSerial::PackedRoutesData* unsafe_arena_release_packed_routes_data();
+
+  // .TransCatSerial.ContractionHierarchy contraction_hierarchy = 14;
+  bool has_contraction_hierarchy() const;
+  private:
+  bool _internal_has_contraction_hierarchy() const;
+  public:
+  void clear_contraction_hierarchy();
+  const ::TransCatSerial::ContractionHierarchy& contraction_hierarchy() const;
+  PROTOBUF_NODISCARD ::TransCatSerial::ContractionHierarchy* release_contraction_hierarchy();
+  ::TransCatSerial::ContractionHierarchy* mutable_contraction_hierarchy();
+  void set_allocated_contraction_hierarchy(::TransCatSerial::ContractionHierarchy* contraction_hierarchy);
+  private:
+  const ::TransCatSerial::ContractionHierarchy& _internal_contraction_hierarchy() const;
+  ::TransCatSerial::ContractionHierarchy* _internal_mutable_contraction_hierarchy();
+  public:
+  void unsafe_arena_set_allocated_contraction_hierarchy(
+      ::TransCatSerial::ContractionHierarchy* contraction_hierarchy);
+  ::TransCatSerial::ContractionHierarchy* unsafe_arena_release_contraction_hierarchy();
+
+  // .TransCatSerial.HubLabels hub_labels = 15;
+  bool has_hub_labels() const;
+  private:
+  bool _internal_has_hub_labels() const;
+  public:
+  void clear_hub_labels();
+  const ::TransCatSerial::HubLabels& hub_labels() const;
+  PROTOBUF_NODISCARD ::TransCatSerial::HubLabels* release_hub_labels();
+  ::TransCatSerial::HubLabels* mutable_hub_labels();
+  void set_allocated_hub_labels(::TransCatSerial::HubLabels* hub_labels);
+  private:
+  const ::TransCatSerial::HubLabels& _internal_hub_labels() const;
+  ::TransCatSerial::HubLabels* _internal_mutable_hub_labels();
+  public:
+  void unsafe_arena_set_allocated_hub_labels(
+      ::TransCatSerial::HubLabels* hub_labels);
+  ::TransCatSerial::HubLabels* unsafe_arena_release_hub_labels();
+
   // bool is_routes_data = 5;
   void clear_is_routes_data();
   bool is_routes_data() const;
@@ -2478,6 +2662,15 @@ class TransportCatalogue final :
   void _internal_set_is_routes_data(bool value);
   public:
 
+  // uint32 format_version = 12;
+  void clear_format_version();
+  uint32_t format_version() const;
+  void set_format_version(uint32_t value);
+  private:
+  uint32_t _internal_format_version() const;
+  void _internal_set_format_version(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:TransCatSerial.TransportCatalogue)
  private:
   class _Internal;
@@ -2485,153 +2678,545 @@ class TransportCatalogue final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::TransCatSerial::StopList* stops_;
-  ::TransCatSerial::BusList* buses_;
-  ::TransCatSerial::RouterContext* router_context_;
-  ::TransCatSerial::MapRendererContext* render_context_;
-  ::TransCatSerial::StopNameToVertexList* stop_name_to_enter_vertex_;
-  ::TransCatSerial::StopNameToVertexList* stop_name_to_exit_vertex_;
-  ::TransCatSerial::EdgeToDescList* edge_to_desc_;
-  ::TransCatSerial::Edges* edges_;
-  ::TransCatSerial::IncidenceLists* incidence_lists_;
-  ::TransCatSerial::RoutesData* routes_data_;
-  bool is_routes_data_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::TransCatSerial::StopList* stops_;
+    ::TransCatSerial::BusList* buses_;
+    ::TransCatSerial::RouterContext* router_context_;
+    ::TransCatSerial::MapRendererContext* render_context_;
+    ::TransCatSerial::StopNameToVertexList* stop_name_to_enter_vertex_;
+    ::TransCatSerial::StopNameToVertexList* stop_name_to_exit_vertex_;
+    ::TransCatSerial::EdgeToDescList* edge_to_desc_;
+    ::TransCatSerial::Edges* edges_;
+    ::TransCatSerial::IncidenceLists* incidence_lists_;
+    ::TransCatSerial::RoutesData* routes_data_;
+    ::TransCatSerial::PackedRoutesData* packed_routes_data_;
+    ::TransCatSerial::ContractionHierarchy* contraction_hierarchy_;
+    ::TransCatSerial::HubLabels* hub_labels_;
+    bool is_routes_data_;
+    uint32_t format_version_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5fcatalogue_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class BaseSection final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TransCatSerial.BaseSection) */ {
+ public:
+  inline BaseSection() : BaseSection(nullptr) {}
+  ~BaseSection() override;
+  explicit PROTOBUF_CONSTEXPR BaseSection(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  BaseSection(const BaseSection& from);
+  BaseSection(BaseSection&& from) noexcept
+    : BaseSection() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// StopNameToVertex
+  inline BaseSection& operator=(const BaseSection& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BaseSection& operator=(BaseSection&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// uint32 stop_name_num = 1;
-inline void StopNameToVertex::clear_stop_name_num() {
-  stop_name_num_ = 0u;
-}
-inline uint32_t StopNameToVertex::_internal_stop_name_num() const {
-  return stop_name_num_;
-}
-inline uint32_t StopNameToVertex::stop_name_num() const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.StopNameToVertex.stop_name_num)
-  return _internal_stop_name_num();
-}
-inline void StopNameToVertex::_internal_set_stop_name_num(uint32_t value) {
-  
-  stop_name_num_ = value;
-}
-inline void StopNameToVertex::set_stop_name_num(uint32_t value) {
-  _internal_set_stop_name_num(value);
-  // @@protoc_insertion_point(field_set:TransCatSerial.StopNameToVertex.stop_name_num)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BaseSection& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BaseSection* internal_default_instance() {
+    return reinterpret_cast<const BaseSection*>(
+               &_BaseSection_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
 
-// uint32 vertex_id = 2;
-inline void StopNameToVertex::clear_vertex_id() {
-  vertex_id_ = 0u;
-}
-inline uint32_t StopNameToVertex::_internal_vertex_id() const {
-  return vertex_id_;
-}
-inline uint32_t StopNameToVertex::vertex_id() const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.StopNameToVertex.vertex_id)
-  return _internal_vertex_id();
-}
-inline void StopNameToVertex::_internal_set_vertex_id(uint32_t value) {
-  
-  vertex_id_ = value;
-}
-inline void StopNameToVertex::set_vertex_id(uint32_t value) {
-  _internal_set_vertex_id(value);
-  // @@protoc_insertion_point(field_set:TransCatSerial.StopNameToVertex.vertex_id)
-}
+  friend void swap(BaseSection& a, BaseSection& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BaseSection* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BaseSection* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// -------------------------------------------------------------------
+  // implements Message ----------------------------------------------
 
-// StopNameToVertexList
+  BaseSection* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BaseSection>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BaseSection& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BaseSection& from) {
+    BaseSection::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// repeated .TransCatSerial.StopNameToVertex stop_name_to_vertex = 1;
-inline int StopNameToVertexList::_internal_stop_name_to_vertex_size() const {
-  return stop_name_to_vertex_.size();
-}
-inline int StopNameToVertexList::stop_name_to_vertex_size() const {
-  return _internal_stop_name_to_vertex_size();
-}
-inline void StopNameToVertexList::clear_stop_name_to_vertex() {
-  stop_name_to_vertex_.Clear();
-}
-inline ::TransCatSerial::StopNameToVertex* StopNameToVertexList::mutable_stop_name_to_vertex(int index) {
-  // @@protoc_insertion_point(field_mutable:TransCatSerial.StopNameToVertexList.stop_name_to_vertex)
-  return stop_name_to_vertex_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::StopNameToVertex >*
-StopNameToVertexList::mutable_stop_name_to_vertex() {
-  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.StopNameToVertexList.stop_name_to_vertex)
-  return &stop_name_to_vertex_;
-}
-inline const ::TransCatSerial::StopNameToVertex& StopNameToVertexList::_internal_stop_name_to_vertex(int index) const {
-  return stop_name_to_vertex_.Get(index);
-}
-inline const ::TransCatSerial::StopNameToVertex& StopNameToVertexList::stop_name_to_vertex(int index) const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.StopNameToVertexList.stop_name_to_vertex)
-  return _internal_stop_name_to_vertex(index);
-}
-inline ::TransCatSerial::StopNameToVertex* StopNameToVertexList::_internal_add_stop_name_to_vertex() {
-  return stop_name_to_vertex_.Add();
-}
-inline ::TransCatSerial::StopNameToVertex* StopNameToVertexList::add_stop_name_to_vertex() {
-  ::TransCatSerial::StopNameToVertex* _add = _internal_add_stop_name_to_vertex();
-  // @@protoc_insertion_point(field_add:TransCatSerial.StopNameToVertexList.stop_name_to_vertex)
-  return _add;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::StopNameToVertex >&
-StopNameToVertexList::stop_name_to_vertex() const {
-  // @@protoc_insertion_point(field_list:TransCatSerial.StopNameToVertexList.stop_name_to_vertex)
-  return stop_name_to_vertex_;
-}
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// -------------------------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BaseSection* other);
 
-// EdgeDescriptor
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TransCatSerial.BaseSection";
+  }
+  protected:
+  explicit BaseSection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-// .TransCatSerial.EdgeDescriptor.EdgeType edge_type = 1;
-inline void EdgeDescriptor::clear_edge_type() {
-  edge_type_ = 0;
-}
-inline ::TransCatSerial::EdgeDescriptor_EdgeType EdgeDescriptor::_internal_edge_type() const {
-  return static_cast< ::TransCatSerial::EdgeDescriptor_EdgeType >(edge_type_);
-}
-inline ::TransCatSerial::EdgeDescriptor_EdgeType EdgeDescriptor::edge_type() const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.EdgeDescriptor.edge_type)
-  return _internal_edge_type();
-}
-inline void EdgeDescriptor::_internal_set_edge_type(::TransCatSerial::EdgeDescriptor_EdgeType value) {
-  
-  edge_type_ = value;
-}
-inline void EdgeDescriptor::set_edge_type(::TransCatSerial::EdgeDescriptor_EdgeType value) {
-  _internal_set_edge_type(value);
-  // @@protoc_insertion_point(field_set:TransCatSerial.EdgeDescriptor.edge_type)
-}
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-// uint32 from_stop_num = 2;
-inline void EdgeDescriptor::clear_from_stop_num() {
-  from_stop_num_ = 0u;
-}
-inline uint32_t EdgeDescriptor::_internal_from_stop_num() const {
-  return from_stop_num_;
-}
-inline uint32_t EdgeDescriptor::from_stop_num() const {
-  // @@protoc_insertion_point(field_get:TransCatSerial.EdgeDescriptor.from_stop_num)
-  return _internal_from_stop_num();
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef BaseSection_SectionType SectionType;
+  static constexpr SectionType SECTION_UNKNOWN =
+    BaseSection_SectionType_SECTION_UNKNOWN;
+  static constexpr SectionType SECTION_CATALOGUE =
+    BaseSection_SectionType_SECTION_CATALOGUE;
+  static constexpr SectionType SECTION_ROUTER_CONTEXT =
+    BaseSection_SectionType_SECTION_ROUTER_CONTEXT;
+  static constexpr SectionType SECTION_RENDER_CONTEXT =
+    BaseSection_SectionType_SECTION_RENDER_CONTEXT;
+  static constexpr SectionType SECTION_ROUTER =
+    BaseSection_SectionType_SECTION_ROUTER;
+  static inline bool SectionType_IsValid(int value) {
+    return BaseSection_SectionType_IsValid(value);
+  }
+  static constexpr SectionType SectionType_MIN =
+    BaseSection_SectionType_SectionType_MIN;
+  static constexpr SectionType SectionType_MAX =
+    BaseSection_SectionType_SectionType_MAX;
+  static constexpr int SectionType_ARRAYSIZE =
+    BaseSection_SectionType_SectionType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  SectionType_descriptor() {
+    return BaseSection_SectionType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& SectionType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, SectionType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function SectionType_Name.");
+    return BaseSection_SectionType_Name(enum_t_value);
+  }
+  static inline bool SectionType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      SectionType* value) {
+    return BaseSection_SectionType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOffsetFieldNumber = 2,
+    kTypeFieldNumber = 1,
+    kCompressedFieldNumber = 4,
+    kSizeFieldNumber = 3,
+  };
+  // uint64 offset = 2;
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
+
+  // .TransCatSerial.BaseSection.SectionType type = 1;
+  void clear_type();
+  ::TransCatSerial::BaseSection_SectionType type() const;
+  void set_type(::TransCatSerial::BaseSection_SectionType value);
+  private:
+  ::TransCatSerial::BaseSection_SectionType _internal_type() const;
+  void _internal_set_type(::TransCatSerial::BaseSection_SectionType value);
+  public:
+
+  // bool compressed = 4;
+  void clear_compressed();
+  bool compressed() const;
+  void set_compressed(bool value);
+  private:
+  bool _internal_compressed() const;
+  void _internal_set_compressed(bool value);
+  public:
+
+  // uint64 size = 3;
+  void clear_size();
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TransCatSerial.BaseSection)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t offset_;
+    int type_;
+    bool compressed_;
+    uint64_t size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BaseIndex final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TransCatSerial.BaseIndex) */ {
+ public:
+  inline BaseIndex() : BaseIndex(nullptr) {}
+  ~BaseIndex() override;
+  explicit PROTOBUF_CONSTEXPR BaseIndex(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BaseIndex(const BaseIndex& from);
+  BaseIndex(BaseIndex&& from) noexcept
+    : BaseIndex() {
+    *this = ::std::move(from);
+  }
+
+  inline BaseIndex& operator=(const BaseIndex& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BaseIndex& operator=(BaseIndex&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BaseIndex& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BaseIndex* internal_default_instance() {
+    return reinterpret_cast<const BaseIndex*>(
+               &_BaseIndex_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(BaseIndex& a, BaseIndex& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BaseIndex* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BaseIndex* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BaseIndex* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BaseIndex>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BaseIndex& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BaseIndex& from) {
+    BaseIndex::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BaseIndex* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TransCatSerial.BaseIndex";
+  }
+  protected:
+  explicit BaseIndex(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSectionsFieldNumber = 2,
+    kFormatVersionFieldNumber = 1,
+  };
+  // repeated .TransCatSerial.BaseSection sections = 2;
+  int sections_size() const;
+  private:
+  int _internal_sections_size() const;
+  public:
+  void clear_sections();
+  ::TransCatSerial::BaseSection* mutable_sections(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::BaseSection >*
+      mutable_sections();
+  private:
+  const ::TransCatSerial::BaseSection& _internal_sections(int index) const;
+  ::TransCatSerial::BaseSection* _internal_add_sections();
+  public:
+  const ::TransCatSerial::BaseSection& sections(int index) const;
+  ::TransCatSerial::BaseSection* add_sections();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::BaseSection >&
+      sections() const;
+
+  // uint32 format_version = 1;
+  void clear_format_version();
+  uint32_t format_version() const;
+  void set_format_version(uint32_t value);
+  private:
+  uint32_t _internal_format_version() const;
+  void _internal_set_format_version(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TransCatSerial.BaseIndex)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::BaseSection > sections_;
+    uint32_t format_version_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// StopNameToVertex
+
+// uint32 stop_name_num = 1;
+inline void StopNameToVertex::clear_stop_name_num() {
+  _impl_.stop_name_num_ = 0u;
+}
+inline uint32_t StopNameToVertex::_internal_stop_name_num() const {
+  return _impl_.stop_name_num_;
+}
+inline uint32_t StopNameToVertex::stop_name_num() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.StopNameToVertex.stop_name_num)
+  return _internal_stop_name_num();
+}
+inline void StopNameToVertex::_internal_set_stop_name_num(uint32_t value) {
+  
+  _impl_.stop_name_num_ = value;
+}
+inline void StopNameToVertex::set_stop_name_num(uint32_t value) {
+  _internal_set_stop_name_num(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.StopNameToVertex.stop_name_num)
+}
+
+// uint32 vertex_id = 2;
+inline void StopNameToVertex::clear_vertex_id() {
+  _impl_.vertex_id_ = 0u;
+}
+inline uint32_t StopNameToVertex::_internal_vertex_id() const {
+  return _impl_.vertex_id_;
+}
+inline uint32_t StopNameToVertex::vertex_id() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.StopNameToVertex.vertex_id)
+  return _internal_vertex_id();
+}
+inline void StopNameToVertex::_internal_set_vertex_id(uint32_t value) {
+  
+  _impl_.vertex_id_ = value;
+}
+inline void StopNameToVertex::set_vertex_id(uint32_t value) {
+  _internal_set_vertex_id(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.StopNameToVertex.vertex_id)
+}
+
+// -------------------------------------------------------------------
+
+// StopNameToVertexList
+
+// repeated .TransCatSerial.StopNameToVertex stop_name_to_vertex = 1;
+inline int StopNameToVertexList::_internal_stop_name_to_vertex_size() const {
+  return _impl_.stop_name_to_vertex_.size();
+}
+inline int StopNameToVertexList::stop_name_to_vertex_size() const {
+  return _internal_stop_name_to_vertex_size();
+}
+inline void StopNameToVertexList::clear_stop_name_to_vertex() {
+  _impl_.stop_name_to_vertex_.Clear();
+}
+inline ::TransCatSerial::StopNameToVertex* StopNameToVertexList::mutable_stop_name_to_vertex(int index) {
+  // @@protoc_insertion_point(field_mutable:TransCatSerial.StopNameToVertexList.stop_name_to_vertex)
+  return _impl_.stop_name_to_vertex_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::StopNameToVertex >*
+StopNameToVertexList::mutable_stop_name_to_vertex() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.StopNameToVertexList.stop_name_to_vertex)
+  return &_impl_.stop_name_to_vertex_;
+}
+inline const ::TransCatSerial::StopNameToVertex& StopNameToVertexList::_internal_stop_name_to_vertex(int index) const {
+  return _impl_.stop_name_to_vertex_.Get(index);
+}
+inline const ::TransCatSerial::StopNameToVertex& StopNameToVertexList::stop_name_to_vertex(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.StopNameToVertexList.stop_name_to_vertex)
+  return _internal_stop_name_to_vertex(index);
+}
+inline ::TransCatSerial::StopNameToVertex* StopNameToVertexList::_internal_add_stop_name_to_vertex() {
+  return _impl_.stop_name_to_vertex_.Add();
+}
+inline ::TransCatSerial::StopNameToVertex* StopNameToVertexList::add_stop_name_to_vertex() {
+  ::TransCatSerial::StopNameToVertex* _add = _internal_add_stop_name_to_vertex();
+  // @@protoc_insertion_point(field_add:TransCatSerial.StopNameToVertexList.stop_name_to_vertex)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::StopNameToVertex >&
+StopNameToVertexList::stop_name_to_vertex() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.StopNameToVertexList.stop_name_to_vertex)
+  return _impl_.stop_name_to_vertex_;
+}
+
+// -------------------------------------------------------------------
+
+// EdgeDescriptor
+
+// .TransCatSerial.EdgeDescriptor.EdgeType edge_type = 1;
+inline void EdgeDescriptor::clear_edge_type() {
+  _impl_.edge_type_ = 0;
+}
+inline ::TransCatSerial::EdgeDescriptor_EdgeType EdgeDescriptor::_internal_edge_type() const {
+  return static_cast< ::TransCatSerial::EdgeDescriptor_EdgeType >(_impl_.edge_type_);
+}
+inline ::TransCatSerial::EdgeDescriptor_EdgeType EdgeDescriptor::edge_type() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.EdgeDescriptor.edge_type)
+  return _internal_edge_type();
+}
+inline void EdgeDescriptor::_internal_set_edge_type(::TransCatSerial::EdgeDescriptor_EdgeType value) {
+  
+  _impl_.edge_type_ = value;
+}
+inline void EdgeDescriptor::set_edge_type(::TransCatSerial::EdgeDescriptor_EdgeType value) {
+  _internal_set_edge_type(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.EdgeDescriptor.edge_type)
+}
+
+// uint32 from_stop_num = 2;
+inline void EdgeDescriptor::clear_from_stop_num() {
+  _impl_.from_stop_num_ = 0u;
+}
+inline uint32_t EdgeDescriptor::_internal_from_stop_num() const {
+  return _impl_.from_stop_num_;
+}
+inline uint32_t EdgeDescriptor::from_stop_num() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.EdgeDescriptor.from_stop_num)
+  return _internal_from_stop_num();
 }
 inline void EdgeDescriptor::_internal_set_from_stop_num(uint32_t value) {
   
-  from_stop_num_ = value;
+  _impl_.from_stop_num_ = value;
 }
 inline void EdgeDescriptor::set_from_stop_num(uint32_t value) {
   _internal_set_from_stop_num(value);
@@ -2640,10 +3225,10 @@ inline void EdgeDescriptor::set_from_stop_num(uint32_t value) {
 
 // uint32 to_stop_num = 3;
 inline void EdgeDescriptor::clear_to_stop_num() {
-  to_stop_num_ = 0u;
+  _impl_.to_stop_num_ = 0u;
 }
 inline uint32_t EdgeDescriptor::_internal_to_stop_num() const {
-  return to_stop_num_;
+  return _impl_.to_stop_num_;
 }
 inline uint32_t EdgeDescriptor::to_stop_num() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.EdgeDescriptor.to_stop_num)
@@ -2651,7 +3236,7 @@ inline uint32_t EdgeDescriptor::to_stop_num() const {
 }
 inline void EdgeDescriptor::_internal_set_to_stop_num(uint32_t value) {
   
-  to_stop_num_ = value;
+  _impl_.to_stop_num_ = value;
 }
 inline void EdgeDescriptor::set_to_stop_num(uint32_t value) {
   _internal_set_to_stop_num(value);
@@ -2660,10 +3245,10 @@ inline void EdgeDescriptor::set_to_stop_num(uint32_t value) {
 
 // uint32 bus_name_num = 4;
 inline void EdgeDescriptor::clear_bus_name_num() {
-  bus_name_num_ = 0u;
+  _impl_.bus_name_num_ = 0u;
 }
 inline uint32_t EdgeDescriptor::_internal_bus_name_num() const {
-  return bus_name_num_;
+  return _impl_.bus_name_num_;
 }
 inline uint32_t EdgeDescriptor::bus_name_num() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.EdgeDescriptor.bus_name_num)
@@ -2671,7 +3256,7 @@ inline uint32_t EdgeDescriptor::bus_name_num() const {
 }
 inline void EdgeDescriptor::_internal_set_bus_name_num(uint32_t value) {
   
-  bus_name_num_ = value;
+  _impl_.bus_name_num_ = value;
 }
 inline void EdgeDescriptor::set_bus_name_num(uint32_t value) {
   _internal_set_bus_name_num(value);
@@ -2680,10 +3265,10 @@ inline void EdgeDescriptor::set_bus_name_num(uint32_t value) {
 
 // uint32 span_count = 5;
 inline void EdgeDescriptor::clear_span_count() {
-  span_count_ = 0u;
+  _impl_.span_count_ = 0u;
 }
 inline uint32_t EdgeDescriptor::_internal_span_count() const {
-  return span_count_;
+  return _impl_.span_count_;
 }
 inline uint32_t EdgeDescriptor::span_count() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.EdgeDescriptor.span_count)
@@ -2691,7 +3276,7 @@ inline uint32_t EdgeDescriptor::span_count() const {
 }
 inline void EdgeDescriptor::_internal_set_span_count(uint32_t value) {
   
-  span_count_ = value;
+  _impl_.span_count_ = value;
 }
 inline void EdgeDescriptor::set_span_count(uint32_t value) {
   _internal_set_span_count(value);
@@ -2700,10 +3285,10 @@ inline void EdgeDescriptor::set_span_count(uint32_t value) {
 
 // double time_length = 6;
 inline void EdgeDescriptor::clear_time_length() {
-  time_length_ = 0;
+  _impl_.time_length_ = 0;
 }
 inline double EdgeDescriptor::_internal_time_length() const {
-  return time_length_;
+  return _impl_.time_length_;
 }
 inline double EdgeDescriptor::time_length() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.EdgeDescriptor.time_length)
@@ -2711,23 +3296,63 @@ inline double EdgeDescriptor::time_length() const {
 }
 inline void EdgeDescriptor::_internal_set_time_length(double value) {
   
-  time_length_ = value;
+  _impl_.time_length_ = value;
 }
 inline void EdgeDescriptor::set_time_length(double value) {
   _internal_set_time_length(value);
   // @@protoc_insertion_point(field_set:TransCatSerial.EdgeDescriptor.time_length)
 }
 
+// uint32 from_position = 7;
+inline void EdgeDescriptor::clear_from_position() {
+  _impl_.from_position_ = 0u;
+}
+inline uint32_t EdgeDescriptor::_internal_from_position() const {
+  return _impl_.from_position_;
+}
+inline uint32_t EdgeDescriptor::from_position() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.EdgeDescriptor.from_position)
+  return _internal_from_position();
+}
+inline void EdgeDescriptor::_internal_set_from_position(uint32_t value) {
+  
+  _impl_.from_position_ = value;
+}
+inline void EdgeDescriptor::set_from_position(uint32_t value) {
+  _internal_set_from_position(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.EdgeDescriptor.from_position)
+}
+
+// bool is_backward = 8;
+inline void EdgeDescriptor::clear_is_backward() {
+  _impl_.is_backward_ = false;
+}
+inline bool EdgeDescriptor::_internal_is_backward() const {
+  return _impl_.is_backward_;
+}
+inline bool EdgeDescriptor::is_backward() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.EdgeDescriptor.is_backward)
+  return _internal_is_backward();
+}
+inline void EdgeDescriptor::_internal_set_is_backward(bool value) {
+  
+  _impl_.is_backward_ = value;
+}
+inline void EdgeDescriptor::set_is_backward(bool value) {
+  _internal_set_is_backward(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.EdgeDescriptor.is_backward)
+}
+
 // -------------------------------------------------------------------
 
 // EdgeToDesc
 
 // uint32 edge_id = 1;
 inline void EdgeToDesc::clear_edge_id() {
-  edge_id_ = 0u;
+  _impl_.edge_id_ = 0u;
 }
 inline uint32_t EdgeToDesc::_internal_edge_id() const {
-  return edge_id_;
+  return _impl_.edge_id_;
 }
 inline uint32_t EdgeToDesc::edge_id() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.EdgeToDesc.edge_id)
@@ -2735,7 +3360,7 @@ inline uint32_t EdgeToDesc::edge_id() const {
 }
 inline void EdgeToDesc::_internal_set_edge_id(uint32_t value) {
   
-  edge_id_ = value;
+  _impl_.edge_id_ = value;
 }
 inline void EdgeToDesc::set_edge_id(uint32_t value) {
   _internal_set_edge_id(value);
@@ -2744,19 +3369,19 @@ inline void EdgeToDesc::set_edge_id(uint32_t value) {
 
 // .TransCatSerial.EdgeDescriptor edge_descriptor = 2;
 inline bool EdgeToDesc::_internal_has_edge_descriptor() const {
-  return this != internal_default_instance() && edge_descriptor_ != nullptr;
+  return this != internal_default_instance() && _impl_.edge_descriptor_ != nullptr;
 }
 inline bool EdgeToDesc::has_edge_descriptor() const {
   return _internal_has_edge_descriptor();
 }
 inline void EdgeToDesc::clear_edge_descriptor() {
-  if (GetArenaForAllocation() == nullptr && edge_descriptor_ != nullptr) {
-    delete edge_descriptor_;
+  if (GetArenaForAllocation() == nullptr && _impl_.edge_descriptor_ != nullptr) {
+    delete _impl_.edge_descriptor_;
   }
-  edge_descriptor_ = nullptr;
+  _impl_.edge_descriptor_ = nullptr;
 }
 inline const ::TransCatSerial::EdgeDescriptor& EdgeToDesc::_internal_edge_descriptor() const {
-  const ::TransCatSerial::EdgeDescriptor* p = edge_descriptor_;
+  const ::TransCatSerial::EdgeDescriptor* p = _impl_.edge_descriptor_;
   return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::EdgeDescriptor&>(
       ::TransCatSerial::_EdgeDescriptor_default_instance_);
 }
@@ -2767,9 +3392,9 @@ inline const ::TransCatSerial::EdgeDescriptor& EdgeToDesc::edge_descriptor() con
 inline void EdgeToDesc::unsafe_arena_set_allocated_edge_descriptor(
     ::TransCatSerial::EdgeDescriptor* edge_descriptor) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(edge_descriptor_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.edge_descriptor_);
   }
-  edge_descriptor_ = edge_descriptor;
+  _impl_.edge_descriptor_ = edge_descriptor;
   if (edge_descriptor) {
     
   } else {
@@ -2779,8 +3404,8 @@ inline void EdgeToDesc::unsafe_arena_set_allocated_edge_descriptor(
 }
 inline ::TransCatSerial::EdgeDescriptor* EdgeToDesc::release_edge_descriptor() {
   
-  ::TransCatSerial::EdgeDescriptor* temp = edge_descriptor_;
-  edge_descriptor_ = nullptr;
+  ::TransCatSerial::EdgeDescriptor* temp = _impl_.edge_descriptor_;
+  _impl_.edge_descriptor_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -2795,17 +3420,17 @@ inline ::TransCatSerial::EdgeDescriptor* EdgeToDesc::release_edge_descriptor() {
 inline ::TransCatSerial::EdgeDescriptor* EdgeToDesc::unsafe_arena_release_edge_descriptor() {
   // @@protoc_insertion_point(field_release:TransCatSerial.EdgeToDesc.edge_descriptor)
   
-  ::TransCatSerial::EdgeDescriptor* temp = edge_descriptor_;
-  edge_descriptor_ = nullptr;
+  ::TransCatSerial::EdgeDescriptor* temp = _impl_.edge_descriptor_;
+  _impl_.edge_descriptor_ = nullptr;
   return temp;
 }
 inline ::TransCatSerial::EdgeDescriptor* EdgeToDesc::_internal_mutable_edge_descriptor() {
   
-  if (edge_descriptor_ == nullptr) {
+  if (_impl_.edge_descriptor_ == nullptr) {
     auto* p = CreateMaybeMessage<::TransCatSerial::EdgeDescriptor>(GetArenaForAllocation());
-    edge_descriptor_ = p;
+    _impl_.edge_descriptor_ = p;
   }
-  return edge_descriptor_;
+  return _impl_.edge_descriptor_;
 }
 inline ::TransCatSerial::EdgeDescriptor* EdgeToDesc::mutable_edge_descriptor() {
   ::TransCatSerial::EdgeDescriptor* _msg = _internal_mutable_edge_descriptor();
@@ -2815,11 +3440,11 @@ inline ::TransCatSerial::EdgeDescriptor* EdgeToDesc::mutable_edge_descriptor() {
 inline void EdgeToDesc::set_allocated_edge_descriptor(::TransCatSerial::EdgeDescriptor* edge_descriptor) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete edge_descriptor_;
+    delete _impl_.edge_descriptor_;
   }
   if (edge_descriptor) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::TransCatSerial::EdgeDescriptor>::GetOwningArena(edge_descriptor);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(edge_descriptor);
     if (message_arena != submessage_arena) {
       edge_descriptor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, edge_descriptor, submessage_arena);
@@ -2828,7 +3453,7 @@ inline void EdgeToDesc::set_allocated_edge_descriptor(::TransCatSerial::EdgeDesc
   } else {
     
   }
-  edge_descriptor_ = edge_descriptor;
+  _impl_.edge_descriptor_ = edge_descriptor;
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.EdgeToDesc.edge_descriptor)
 }
 
@@ -2838,32 +3463,32 @@ inline void EdgeToDesc::set_allocated_edge_descriptor(::TransCatSerial::EdgeDesc
 
 // repeated .TransCatSerial.EdgeToDesc edge_to_desc = 1;
 inline int EdgeToDescList::_internal_edge_to_desc_size() const {
-  return edge_to_desc_.size();
+  return _impl_.edge_to_desc_.size();
 }
 inline int EdgeToDescList::edge_to_desc_size() const {
   return _internal_edge_to_desc_size();
 }
 inline void EdgeToDescList::clear_edge_to_desc() {
-  edge_to_desc_.Clear();
+  _impl_.edge_to_desc_.Clear();
 }
 inline ::TransCatSerial::EdgeToDesc* EdgeToDescList::mutable_edge_to_desc(int index) {
   // @@protoc_insertion_point(field_mutable:TransCatSerial.EdgeToDescList.edge_to_desc)
-  return edge_to_desc_.Mutable(index);
+  return _impl_.edge_to_desc_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::EdgeToDesc >*
 EdgeToDescList::mutable_edge_to_desc() {
   // @@protoc_insertion_point(field_mutable_list:TransCatSerial.EdgeToDescList.edge_to_desc)
-  return &edge_to_desc_;
+  return &_impl_.edge_to_desc_;
 }
 inline const ::TransCatSerial::EdgeToDesc& EdgeToDescList::_internal_edge_to_desc(int index) const {
-  return edge_to_desc_.Get(index);
+  return _impl_.edge_to_desc_.Get(index);
 }
 inline const ::TransCatSerial::EdgeToDesc& EdgeToDescList::edge_to_desc(int index) const {
   // @@protoc_insertion_point(field_get:TransCatSerial.EdgeToDescList.edge_to_desc)
   return _internal_edge_to_desc(index);
 }
 inline ::TransCatSerial::EdgeToDesc* EdgeToDescList::_internal_add_edge_to_desc() {
-  return edge_to_desc_.Add();
+  return _impl_.edge_to_desc_.Add();
 }
 inline ::TransCatSerial::EdgeToDesc* EdgeToDescList::add_edge_to_desc() {
   ::TransCatSerial::EdgeToDesc* _add = _internal_add_edge_to_desc();
@@ -2873,7 +3498,7 @@ inline ::TransCatSerial::EdgeToDesc* EdgeToDescList::add_edge_to_desc() {
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::EdgeToDesc >&
 EdgeToDescList::edge_to_desc() const {
   // @@protoc_insertion_point(field_list:TransCatSerial.EdgeToDescList.edge_to_desc)
-  return edge_to_desc_;
+  return _impl_.edge_to_desc_;
 }
 
 // -------------------------------------------------------------------
@@ -2882,10 +3507,10 @@ EdgeToDescList::edge_to_desc() const {
 
 // double lat = 1;
 inline void Coordinates::clear_lat() {
-  lat_ = 0;
+  _impl_.lat_ = 0;
 }
 inline double Coordinates::_internal_lat() const {
-  return lat_;
+  return _impl_.lat_;
 }
 inline double Coordinates::lat() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Coordinates.lat)
@@ -2893,7 +3518,7 @@ inline double Coordinates::lat() const {
 }
 inline void Coordinates::_internal_set_lat(double value) {
   
-  lat_ = value;
+  _impl_.lat_ = value;
 }
 inline void Coordinates::set_lat(double value) {
   _internal_set_lat(value);
@@ -2902,10 +3527,10 @@ inline void Coordinates::set_lat(double value) {
 
 // double lng = 2;
 inline void Coordinates::clear_lng() {
-  lng_ = 0;
+  _impl_.lng_ = 0;
 }
 inline double Coordinates::_internal_lng() const {
-  return lng_;
+  return _impl_.lng_;
 }
 inline double Coordinates::lng() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Coordinates.lng)
@@ -2913,7 +3538,7 @@ inline double Coordinates::lng() const {
 }
 inline void Coordinates::_internal_set_lng(double value) {
   
-  lng_ = value;
+  _impl_.lng_ = value;
 }
 inline void Coordinates::set_lng(double value) {
   _internal_set_lng(value);
@@ -2926,10 +3551,10 @@ inline void Coordinates::set_lng(double value) {
 
 // uint32 stop_num = 1;
 inline void DistanceToStop::clear_stop_num() {
-  stop_num_ = 0u;
+  _impl_.stop_num_ = 0u;
 }
 inline uint32_t DistanceToStop::_internal_stop_num() const {
-  return stop_num_;
+  return _impl_.stop_num_;
 }
 inline uint32_t DistanceToStop::stop_num() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.DistanceToStop.stop_num)
@@ -2937,7 +3562,7 @@ inline uint32_t DistanceToStop::stop_num() const {
 }
 inline void DistanceToStop::_internal_set_stop_num(uint32_t value) {
   
-  stop_num_ = value;
+  _impl_.stop_num_ = value;
 }
 inline void DistanceToStop::set_stop_num(uint32_t value) {
   _internal_set_stop_num(value);
@@ -2946,10 +3571,10 @@ inline void DistanceToStop::set_stop_num(uint32_t value) {
 
 // double distance = 2;
 inline void DistanceToStop::clear_distance() {
-  distance_ = 0;
+  _impl_.distance_ = 0;
 }
 inline double DistanceToStop::_internal_distance() const {
-  return distance_;
+  return _impl_.distance_;
 }
 inline double DistanceToStop::distance() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.DistanceToStop.distance)
@@ -2957,7 +3582,7 @@ inline double DistanceToStop::distance() const {
 }
 inline void DistanceToStop::_internal_set_distance(double value) {
   
-  distance_ = value;
+  _impl_.distance_ = value;
 }
 inline void DistanceToStop::set_distance(double value) {
   _internal_set_distance(value);
@@ -2970,10 +3595,10 @@ inline void DistanceToStop::set_distance(double value) {
 
 // .TransCatSerial.Stop.StopType stop_type = 1;
 inline void Stop::clear_stop_type() {
-  stop_type_ = 0;
+  _impl_.stop_type_ = 0;
 }
 inline ::TransCatSerial::Stop_StopType Stop::_internal_stop_type() const {
-  return static_cast< ::TransCatSerial::Stop_StopType >(stop_type_);
+  return static_cast< ::TransCatSerial::Stop_StopType >(_impl_.stop_type_);
 }
 inline ::TransCatSerial::Stop_StopType Stop::stop_type() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Stop.stop_type)
@@ -2981,7 +3606,7 @@ inline ::TransCatSerial::Stop_StopType Stop::stop_type() const {
 }
 inline void Stop::_internal_set_stop_type(::TransCatSerial::Stop_StopType value) {
   
-  stop_type_ = value;
+  _impl_.stop_type_ = value;
 }
 inline void Stop::set_stop_type(::TransCatSerial::Stop_StopType value) {
   _internal_set_stop_type(value);
@@ -2990,7 +3615,7 @@ inline void Stop::set_stop_type(::TransCatSerial::Stop_StopType value) {
 
 // bytes stop_name = 2;
 inline void Stop::clear_stop_name() {
-  stop_name_.ClearToEmpty();
+  _impl_.stop_name_.ClearToEmpty();
 }
 inline const std::string& Stop::stop_name() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Stop.stop_name)
@@ -3000,7 +3625,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Stop::set_stop_name(ArgT0&& arg0, ArgT... args) {
  
- stop_name_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.stop_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:TransCatSerial.Stop.stop_name)
 }
 inline std::string* Stop::mutable_stop_name() {
@@ -3009,19 +3634,19 @@ inline std::string* Stop::mutable_stop_name() {
   return _s;
 }
 inline const std::string& Stop::_internal_stop_name() const {
-  return stop_name_.Get();
+  return _impl_.stop_name_.Get();
 }
 inline void Stop::_internal_set_stop_name(const std::string& value) {
   
-  stop_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.stop_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Stop::_internal_mutable_stop_name() {
   
-  return stop_name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.stop_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Stop::release_stop_name() {
   // @@protoc_insertion_point(field_release:TransCatSerial.Stop.stop_name)
-  return stop_name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.stop_name_.Release();
 }
 inline void Stop::set_allocated_stop_name(std::string* stop_name) {
   if (stop_name != nullptr) {
@@ -3029,11 +3654,10 @@ inline void Stop::set_allocated_stop_name(std::string* stop_name) {
   } else {
     
   }
-  stop_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), stop_name,
-      GetArenaForAllocation());
+  _impl_.stop_name_.SetAllocated(stop_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (stop_name_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    stop_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.stop_name_.IsDefault()) {
+    _impl_.stop_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.Stop.stop_name)
@@ -3041,19 +3665,19 @@ inline void Stop::set_allocated_stop_name(std::string* stop_name) {
 
 // .TransCatSerial.Coordinates stop_coords = 3;
 inline bool Stop::_internal_has_stop_coords() const {
-  return this != internal_default_instance() && stop_coords_ != nullptr;
+  return this != internal_default_instance() && _impl_.stop_coords_ != nullptr;
 }
 inline bool Stop::has_stop_coords() const {
   return _internal_has_stop_coords();
 }
 inline void Stop::clear_stop_coords() {
-  if (GetArenaForAllocation() == nullptr && stop_coords_ != nullptr) {
-    delete stop_coords_;
+  if (GetArenaForAllocation() == nullptr && _impl_.stop_coords_ != nullptr) {
+    delete _impl_.stop_coords_;
   }
-  stop_coords_ = nullptr;
+  _impl_.stop_coords_ = nullptr;
 }
 inline const ::TransCatSerial::Coordinates& Stop::_internal_stop_coords() const {
-  const ::TransCatSerial::Coordinates* p = stop_coords_;
+  const ::TransCatSerial::Coordinates* p = _impl_.stop_coords_;
   return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::Coordinates&>(
       ::TransCatSerial::_Coordinates_default_instance_);
 }
@@ -3064,9 +3688,9 @@ inline const ::TransCatSerial::Coordinates& Stop::stop_coords() const {
 inline void Stop::unsafe_arena_set_allocated_stop_coords(
     ::TransCatSerial::Coordinates* stop_coords) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(stop_coords_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stop_coords_);
   }
-  stop_coords_ = stop_coords;
+  _impl_.stop_coords_ = stop_coords;
   if (stop_coords) {
     
   } else {
@@ -3076,8 +3700,8 @@ inline void Stop::unsafe_arena_set_allocated_stop_coords(
 }
 inline ::TransCatSerial::Coordinates* Stop::release_stop_coords() {
   
-  ::TransCatSerial::Coordinates* temp = stop_coords_;
-  stop_coords_ = nullptr;
+  ::TransCatSerial::Coordinates* temp = _impl_.stop_coords_;
+  _impl_.stop_coords_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -3092,17 +3716,17 @@ inline ::TransCatSerial::Coordinates* Stop::release_stop_coords() {
 inline ::TransCatSerial::Coordinates* Stop::unsafe_arena_release_stop_coords() {
   // @@protoc_insertion_point(field_release:TransCatSerial.Stop.stop_coords)
   
-  ::TransCatSerial::Coordinates* temp = stop_coords_;
-  stop_coords_ = nullptr;
+  ::TransCatSerial::Coordinates* temp = _impl_.stop_coords_;
+  _impl_.stop_coords_ = nullptr;
   return temp;
 }
 inline ::TransCatSerial::Coordinates* Stop::_internal_mutable_stop_coords() {
   
-  if (stop_coords_ == nullptr) {
+  if (_impl_.stop_coords_ == nullptr) {
     auto* p = CreateMaybeMessage<::TransCatSerial::Coordinates>(GetArenaForAllocation());
-    stop_coords_ = p;
+    _impl_.stop_coords_ = p;
   }
-  return stop_coords_;
+  return _impl_.stop_coords_;
 }
 inline ::TransCatSerial::Coordinates* Stop::mutable_stop_coords() {
   ::TransCatSerial::Coordinates* _msg = _internal_mutable_stop_coords();
@@ -3112,11 +3736,11 @@ inline ::TransCatSerial::Coordinates* Stop::mutable_stop_coords() {
 inline void Stop::set_allocated_stop_coords(::TransCatSerial::Coordinates* stop_coords) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete stop_coords_;
+    delete _impl_.stop_coords_;
   }
   if (stop_coords) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::TransCatSerial::Coordinates>::GetOwningArena(stop_coords);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stop_coords);
     if (message_arena != submessage_arena) {
       stop_coords = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, stop_coords, submessage_arena);
@@ -3125,33 +3749,33 @@ inline void Stop::set_allocated_stop_coords(::TransCatSerial::Coordinates* stop_
   } else {
     
   }
-  stop_coords_ = stop_coords;
+  _impl_.stop_coords_ = stop_coords;
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.Stop.stop_coords)
 }
 
 // repeated uint32 buses_at_stop = 4;
 inline int Stop::_internal_buses_at_stop_size() const {
-  return buses_at_stop_.size();
+  return _impl_.buses_at_stop_.size();
 }
 inline int Stop::buses_at_stop_size() const {
   return _internal_buses_at_stop_size();
 }
 inline void Stop::clear_buses_at_stop() {
-  buses_at_stop_.Clear();
+  _impl_.buses_at_stop_.Clear();
 }
 inline uint32_t Stop::_internal_buses_at_stop(int index) const {
-  return buses_at_stop_.Get(index);
+  return _impl_.buses_at_stop_.Get(index);
 }
 inline uint32_t Stop::buses_at_stop(int index) const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Stop.buses_at_stop)
   return _internal_buses_at_stop(index);
 }
 inline void Stop::set_buses_at_stop(int index, uint32_t value) {
-  buses_at_stop_.Set(index, value);
+  _impl_.buses_at_stop_.Set(index, value);
   // @@protoc_insertion_point(field_set:TransCatSerial.Stop.buses_at_stop)
 }
 inline void Stop::_internal_add_buses_at_stop(uint32_t value) {
-  buses_at_stop_.Add(value);
+  _impl_.buses_at_stop_.Add(value);
 }
 inline void Stop::add_buses_at_stop(uint32_t value) {
   _internal_add_buses_at_stop(value);
@@ -3159,7 +3783,7 @@ inline void Stop::add_buses_at_stop(uint32_t value) {
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 Stop::_internal_buses_at_stop() const {
-  return buses_at_stop_;
+  return _impl_.buses_at_stop_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 Stop::buses_at_stop() const {
@@ -3168,7 +3792,7 @@ Stop::buses_at_stop() const {
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 Stop::_internal_mutable_buses_at_stop() {
-  return &buses_at_stop_;
+  return &_impl_.buses_at_stop_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 Stop::mutable_buses_at_stop() {
@@ -3178,32 +3802,32 @@ Stop::mutable_buses_at_stop() {
 
 // repeated .TransCatSerial.DistanceToStop distance_to_stop = 5;
 inline int Stop::_internal_distance_to_stop_size() const {
-  return distance_to_stop_.size();
+  return _impl_.distance_to_stop_.size();
 }
 inline int Stop::distance_to_stop_size() const {
   return _internal_distance_to_stop_size();
 }
 inline void Stop::clear_distance_to_stop() {
-  distance_to_stop_.Clear();
+  _impl_.distance_to_stop_.Clear();
 }
 inline ::TransCatSerial::DistanceToStop* Stop::mutable_distance_to_stop(int index) {
   // @@protoc_insertion_point(field_mutable:TransCatSerial.Stop.distance_to_stop)
-  return distance_to_stop_.Mutable(index);
+  return _impl_.distance_to_stop_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::DistanceToStop >*
 Stop::mutable_distance_to_stop() {
   // @@protoc_insertion_point(field_mutable_list:TransCatSerial.Stop.distance_to_stop)
-  return &distance_to_stop_;
+  return &_impl_.distance_to_stop_;
 }
 inline const ::TransCatSerial::DistanceToStop& Stop::_internal_distance_to_stop(int index) const {
-  return distance_to_stop_.Get(index);
+  return _impl_.distance_to_stop_.Get(index);
 }
 inline const ::TransCatSerial::DistanceToStop& Stop::distance_to_stop(int index) const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Stop.distance_to_stop)
   return _internal_distance_to_stop(index);
 }
 inline ::TransCatSerial::DistanceToStop* Stop::_internal_add_distance_to_stop() {
-  return distance_to_stop_.Add();
+  return _impl_.distance_to_stop_.Add();
 }
 inline ::TransCatSerial::DistanceToStop* Stop::add_distance_to_stop() {
   ::TransCatSerial::DistanceToStop* _add = _internal_add_distance_to_stop();
@@ -3213,7 +3837,35 @@ inline ::TransCatSerial::DistanceToStop* Stop::add_distance_to_stop() {
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::DistanceToStop >&
 Stop::distance_to_stop() const {
   // @@protoc_insertion_point(field_list:TransCatSerial.Stop.distance_to_stop)
-  return distance_to_stop_;
+  return _impl_.distance_to_stop_;
+}
+
+// optional double wait_time = 6;
+inline bool Stop::_internal_has_wait_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Stop::has_wait_time() const {
+  return _internal_has_wait_time();
+}
+inline void Stop::clear_wait_time() {
+  _impl_.wait_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double Stop::_internal_wait_time() const {
+  return _impl_.wait_time_;
+}
+inline double Stop::wait_time() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.Stop.wait_time)
+  return _internal_wait_time();
+}
+inline void Stop::_internal_set_wait_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.wait_time_ = value;
+}
+inline void Stop::set_wait_time(double value) {
+  _internal_set_wait_time(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.Stop.wait_time)
 }
 
 // -------------------------------------------------------------------
@@ -3222,10 +3874,10 @@ Stop::distance_to_stop() const {
 
 // .TransCatSerial.Bus.BusType bus_type = 1;
 inline void Bus::clear_bus_type() {
-  bus_type_ = 0;
+  _impl_.bus_type_ = 0;
 }
 inline ::TransCatSerial::Bus_BusType Bus::_internal_bus_type() const {
-  return static_cast< ::TransCatSerial::Bus_BusType >(bus_type_);
+  return static_cast< ::TransCatSerial::Bus_BusType >(_impl_.bus_type_);
 }
 inline ::TransCatSerial::Bus_BusType Bus::bus_type() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Bus.bus_type)
@@ -3233,7 +3885,7 @@ inline ::TransCatSerial::Bus_BusType Bus::bus_type() const {
 }
 inline void Bus::_internal_set_bus_type(::TransCatSerial::Bus_BusType value) {
   
-  bus_type_ = value;
+  _impl_.bus_type_ = value;
 }
 inline void Bus::set_bus_type(::TransCatSerial::Bus_BusType value) {
   _internal_set_bus_type(value);
@@ -3242,7 +3894,7 @@ inline void Bus::set_bus_type(::TransCatSerial::Bus_BusType value) {
 
 // bytes bus_name = 2;
 inline void Bus::clear_bus_name() {
-  bus_name_.ClearToEmpty();
+  _impl_.bus_name_.ClearToEmpty();
 }
 inline const std::string& Bus::bus_name() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Bus.bus_name)
@@ -3252,7 +3904,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Bus::set_bus_name(ArgT0&& arg0, ArgT... args) {
  
- bus_name_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.bus_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:TransCatSerial.Bus.bus_name)
 }
 inline std::string* Bus::mutable_bus_name() {
@@ -3261,19 +3913,19 @@ inline std::string* Bus::mutable_bus_name() {
   return _s;
 }
 inline const std::string& Bus::_internal_bus_name() const {
-  return bus_name_.Get();
+  return _impl_.bus_name_.Get();
 }
 inline void Bus::_internal_set_bus_name(const std::string& value) {
   
-  bus_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.bus_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Bus::_internal_mutable_bus_name() {
   
-  return bus_name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.bus_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Bus::release_bus_name() {
   // @@protoc_insertion_point(field_release:TransCatSerial.Bus.bus_name)
-  return bus_name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.bus_name_.Release();
 }
 inline void Bus::set_allocated_bus_name(std::string* bus_name) {
   if (bus_name != nullptr) {
@@ -3281,11 +3933,10 @@ inline void Bus::set_allocated_bus_name(std::string* bus_name) {
   } else {
     
   }
-  bus_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), bus_name,
-      GetArenaForAllocation());
+  _impl_.bus_name_.SetAllocated(bus_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (bus_name_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    bus_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.bus_name_.IsDefault()) {
+    _impl_.bus_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.Bus.bus_name)
@@ -3293,27 +3944,27 @@ inline void Bus::set_allocated_bus_name(std::string* bus_name) {
 
 // repeated uint32 bus_stops = 3;
 inline int Bus::_internal_bus_stops_size() const {
-  return bus_stops_.size();
+  return _impl_.bus_stops_.size();
 }
 inline int Bus::bus_stops_size() const {
   return _internal_bus_stops_size();
 }
 inline void Bus::clear_bus_stops() {
-  bus_stops_.Clear();
+  _impl_.bus_stops_.Clear();
 }
 inline uint32_t Bus::_internal_bus_stops(int index) const {
-  return bus_stops_.Get(index);
+  return _impl_.bus_stops_.Get(index);
 }
 inline uint32_t Bus::bus_stops(int index) const {
   // @@protoc_insertion_point(field_get:TransCatSerial.Bus.bus_stops)
   return _internal_bus_stops(index);
 }
 inline void Bus::set_bus_stops(int index, uint32_t value) {
-  bus_stops_.Set(index, value);
+  _impl_.bus_stops_.Set(index, value);
   // @@protoc_insertion_point(field_set:TransCatSerial.Bus.bus_stops)
 }
 inline void Bus::_internal_add_bus_stops(uint32_t value) {
-  bus_stops_.Add(value);
+  _impl_.bus_stops_.Add(value);
 }
 inline void Bus::add_bus_stops(uint32_t value) {
   _internal_add_bus_stops(value);
@@ -3321,7 +3972,7 @@ inline void Bus::add_bus_stops(uint32_t value) {
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 Bus::_internal_bus_stops() const {
-  return bus_stops_;
+  return _impl_.bus_stops_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 Bus::bus_stops() const {
@@ -3330,7 +3981,7 @@ Bus::bus_stops() const {
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 Bus::_internal_mutable_bus_stops() {
-  return &bus_stops_;
+  return &_impl_.bus_stops_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 Bus::mutable_bus_stops() {
@@ -3338,38 +3989,113 @@ Bus::mutable_bus_stops() {
   return _internal_mutable_bus_stops();
 }
 
+// repeated double departures = 4;
+inline int Bus::_internal_departures_size() const {
+  return _impl_.departures_.size();
+}
+inline int Bus::departures_size() const {
+  return _internal_departures_size();
+}
+inline void Bus::clear_departures() {
+  _impl_.departures_.Clear();
+}
+inline double Bus::_internal_departures(int index) const {
+  return _impl_.departures_.Get(index);
+}
+inline double Bus::departures(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.Bus.departures)
+  return _internal_departures(index);
+}
+inline void Bus::set_departures(int index, double value) {
+  _impl_.departures_.Set(index, value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.Bus.departures)
+}
+inline void Bus::_internal_add_departures(double value) {
+  _impl_.departures_.Add(value);
+}
+inline void Bus::add_departures(double value) {
+  _internal_add_departures(value);
+  // @@protoc_insertion_point(field_add:TransCatSerial.Bus.departures)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+Bus::_internal_departures() const {
+  return _impl_.departures_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+Bus::departures() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.Bus.departures)
+  return _internal_departures();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+Bus::_internal_mutable_departures() {
+  return &_impl_.departures_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+Bus::mutable_departures() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.Bus.departures)
+  return _internal_mutable_departures();
+}
+
+// optional double velocity = 5;
+inline bool Bus::_internal_has_velocity() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Bus::has_velocity() const {
+  return _internal_has_velocity();
+}
+inline void Bus::clear_velocity() {
+  _impl_.velocity_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double Bus::_internal_velocity() const {
+  return _impl_.velocity_;
+}
+inline double Bus::velocity() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.Bus.velocity)
+  return _internal_velocity();
+}
+inline void Bus::_internal_set_velocity(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.velocity_ = value;
+}
+inline void Bus::set_velocity(double value) {
+  _internal_set_velocity(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.Bus.velocity)
+}
+
 // -------------------------------------------------------------------
 
 // StopList
 
 // repeated .TransCatSerial.Stop stops = 1;
 inline int StopList::_internal_stops_size() const {
-  return stops_.size();
+  return _impl_.stops_.size();
 }
 inline int StopList::stops_size() const {
   return _internal_stops_size();
 }
 inline void StopList::clear_stops() {
-  stops_.Clear();
+  _impl_.stops_.Clear();
 }
 inline ::TransCatSerial::Stop* StopList::mutable_stops(int index) {
   // @@protoc_insertion_point(field_mutable:TransCatSerial.StopList.stops)
-  return stops_.Mutable(index);
+  return _impl_.stops_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Stop >*
 StopList::mutable_stops() {
   // @@protoc_insertion_point(field_mutable_list:TransCatSerial.StopList.stops)
-  return &stops_;
+  return &_impl_.stops_;
 }
 inline const ::TransCatSerial::Stop& StopList::_internal_stops(int index) const {
-  return stops_.Get(index);
+  return _impl_.stops_.Get(index);
 }
 inline const ::TransCatSerial::Stop& StopList::stops(int index) const {
   // @@protoc_insertion_point(field_get:TransCatSerial.StopList.stops)
   return _internal_stops(index);
 }
 inline ::TransCatSerial::Stop* StopList::_internal_add_stops() {
-  return stops_.Add();
+  return _impl_.stops_.Add();
 }
 inline ::TransCatSerial::Stop* StopList::add_stops() {
   ::TransCatSerial::Stop* _add = _internal_add_stops();
@@ -3379,7 +4105,7 @@ inline ::TransCatSerial::Stop* StopList::add_stops() {
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Stop >&
 StopList::stops() const {
   // @@protoc_insertion_point(field_list:TransCatSerial.StopList.stops)
-  return stops_;
+  return _impl_.stops_;
 }
 
 // -------------------------------------------------------------------
@@ -3388,32 +4114,32 @@ StopList::stops() const {
 
 // repeated .TransCatSerial.Bus buses = 2;
 inline int BusList::_internal_buses_size() const {
-  return buses_.size();
+  return _impl_.buses_.size();
 }
 inline int BusList::buses_size() const {
   return _internal_buses_size();
 }
 inline void BusList::clear_buses() {
-  buses_.Clear();
+  _impl_.buses_.Clear();
 }
 inline ::TransCatSerial::Bus* BusList::mutable_buses(int index) {
   // @@protoc_insertion_point(field_mutable:TransCatSerial.BusList.buses)
-  return buses_.Mutable(index);
+  return _impl_.buses_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Bus >*
 BusList::mutable_buses() {
   // @@protoc_insertion_point(field_mutable_list:TransCatSerial.BusList.buses)
-  return &buses_;
+  return &_impl_.buses_;
 }
 inline const ::TransCatSerial::Bus& BusList::_internal_buses(int index) const {
-  return buses_.Get(index);
+  return _impl_.buses_.Get(index);
 }
 inline const ::TransCatSerial::Bus& BusList::buses(int index) const {
   // @@protoc_insertion_point(field_get:TransCatSerial.BusList.buses)
   return _internal_buses(index);
 }
 inline ::TransCatSerial::Bus* BusList::_internal_add_buses() {
-  return buses_.Add();
+  return _impl_.buses_.Add();
 }
 inline ::TransCatSerial::Bus* BusList::add_buses() {
   ::TransCatSerial::Bus* _add = _internal_add_buses();
@@ -3423,7 +4149,7 @@ inline ::TransCatSerial::Bus* BusList::add_buses() {
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::Bus >&
 BusList::buses() const {
   // @@protoc_insertion_point(field_list:TransCatSerial.BusList.buses)
-  return buses_;
+  return _impl_.buses_;
 }
 
 // -------------------------------------------------------------------
@@ -3432,19 +4158,19 @@ BusList::buses() const {
 
 // .TransCatSerial.StopList stops = 1;
 inline bool TransportCatalogue::_internal_has_stops() const {
-  return this != internal_default_instance() && stops_ != nullptr;
+  return this != internal_default_instance() && _impl_.stops_ != nullptr;
 }
 inline bool TransportCatalogue::has_stops() const {
   return _internal_has_stops();
 }
 inline void TransportCatalogue::clear_stops() {
-  if (GetArenaForAllocation() == nullptr && stops_ != nullptr) {
-    delete stops_;
+  if (GetArenaForAllocation() == nullptr && _impl_.stops_ != nullptr) {
+    delete _impl_.stops_;
   }
-  stops_ = nullptr;
+  _impl_.stops_ = nullptr;
 }
 inline const ::TransCatSerial::StopList& TransportCatalogue::_internal_stops() const {
-  const ::TransCatSerial::StopList* p = stops_;
+  const ::TransCatSerial::StopList* p = _impl_.stops_;
   return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::StopList&>(
       ::TransCatSerial::_StopList_default_instance_);
 }
@@ -3455,9 +4181,9 @@ inline const ::TransCatSerial::StopList& TransportCatalogue::stops() const {
 inline void TransportCatalogue::unsafe_arena_set_allocated_stops(
     ::TransCatSerial::StopList* stops) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(stops_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stops_);
   }
-  stops_ = stops;
+  _impl_.stops_ = stops;
   if (stops) {
     
   } else {
@@ -3467,8 +4193,8 @@ inline void TransportCatalogue::unsafe_arena_set_allocated_stops(
 }
 inline ::TransCatSerial::StopList* TransportCatalogue::release_stops() {
   
-  ::TransCatSerial::StopList* temp = stops_;
-  stops_ = nullptr;
+  ::TransCatSerial::StopList* temp = _impl_.stops_;
+  _impl_.stops_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -3483,17 +4209,17 @@ inline ::TransCatSerial::StopList* TransportCatalogue::release_stops() {
 inline ::TransCatSerial::StopList* TransportCatalogue::unsafe_arena_release_stops() {
   // @@protoc_insertion_point(field_release:TransCatSerial.TransportCatalogue.stops)
   
-  ::TransCatSerial::StopList* temp = stops_;
-  stops_ = nullptr;
+  ::TransCatSerial::StopList* temp = _impl_.stops_;
+  _impl_.stops_ = nullptr;
   return temp;
 }
 inline ::TransCatSerial::StopList* TransportCatalogue::_internal_mutable_stops() {
   
-  if (stops_ == nullptr) {
+  if (_impl_.stops_ == nullptr) {
     auto* p = CreateMaybeMessage<::TransCatSerial::StopList>(GetArenaForAllocation());
-    stops_ = p;
+    _impl_.stops_ = p;
   }
-  return stops_;
+  return _impl_.stops_;
 }
 inline ::TransCatSerial::StopList* TransportCatalogue::mutable_stops() {
   ::TransCatSerial::StopList* _msg = _internal_mutable_stops();
@@ -3503,11 +4229,11 @@ inline ::TransCatSerial::StopList* TransportCatalogue::mutable_stops() {
 inline void TransportCatalogue::set_allocated_stops(::TransCatSerial::StopList* stops) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete stops_;
+    delete _impl_.stops_;
   }
   if (stops) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::TransCatSerial::StopList>::GetOwningArena(stops);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stops);
     if (message_arena != submessage_arena) {
       stops = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, stops, submessage_arena);
@@ -3516,25 +4242,25 @@ inline void TransportCatalogue::set_allocated_stops(::TransCatSerial::StopList*
   } else {
     
   }
-  stops_ = stops;
+  _impl_.stops_ = stops;
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.TransportCatalogue.stops)
 }
 
 // .TransCatSerial.BusList buses = 2;
 inline bool TransportCatalogue::_internal_has_buses() const {
-  return this != internal_default_instance() && buses_ != nullptr;
+  return this != internal_default_instance() && _impl_.buses_ != nullptr;
 }
 inline bool TransportCatalogue::has_buses() const {
   return _internal_has_buses();
 }
 inline void TransportCatalogue::clear_buses() {
-  if (GetArenaForAllocation() == nullptr && buses_ != nullptr) {
-    delete buses_;
+  if (GetArenaForAllocation() == nullptr && _impl_.buses_ != nullptr) {
+    delete _impl_.buses_;
   }
-  buses_ = nullptr;
+  _impl_.buses_ = nullptr;
 }
 inline const ::TransCatSerial::BusList& TransportCatalogue::_internal_buses() const {
-  const ::TransCatSerial::BusList* p = buses_;
+  const ::TransCatSerial::BusList* p = _impl_.buses_;
   return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::BusList&>(
       ::TransCatSerial::_BusList_default_instance_);
 }
@@ -3545,9 +4271,9 @@ inline const ::TransCatSerial::BusList& TransportCatalogue::buses() const {
 inline void TransportCatalogue::unsafe_arena_set_allocated_buses(
     ::TransCatSerial::BusList* buses) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(buses_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.buses_);
   }
-  buses_ = buses;
+  _impl_.buses_ = buses;
   if (buses) {
     
   } else {
@@ -3557,8 +4283,8 @@ inline void TransportCatalogue::unsafe_arena_set_allocated_buses(
 }
 inline ::TransCatSerial::BusList* TransportCatalogue::release_buses() {
   
-  ::TransCatSerial::BusList* temp = buses_;
-  buses_ = nullptr;
+  ::TransCatSerial::BusList* temp = _impl_.buses_;
+  _impl_.buses_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -3573,17 +4299,17 @@ inline ::TransCatSerial::BusList* TransportCatalogue::release_buses() {
 inline ::TransCatSerial::BusList* TransportCatalogue::unsafe_arena_release_buses() {
   // @@protoc_insertion_point(field_release:TransCatSerial.TransportCatalogue.buses)
   
-  ::TransCatSerial::BusList* temp = buses_;
-  buses_ = nullptr;
+  ::TransCatSerial::BusList* temp = _impl_.buses_;
+  _impl_.buses_ = nullptr;
   return temp;
 }
 inline ::TransCatSerial::BusList* TransportCatalogue::_internal_mutable_buses() {
   
-  if (buses_ == nullptr) {
+  if (_impl_.buses_ == nullptr) {
     auto* p = CreateMaybeMessage<::TransCatSerial::BusList>(GetArenaForAllocation());
-    buses_ = p;
+    _impl_.buses_ = p;
   }
-  return buses_;
+  return _impl_.buses_;
 }
 inline ::TransCatSerial::BusList* TransportCatalogue::mutable_buses() {
   ::TransCatSerial::BusList* _msg = _internal_mutable_buses();
@@ -3593,11 +4319,11 @@ inline ::TransCatSerial::BusList* TransportCatalogue::mutable_buses() {
 inline void TransportCatalogue::set_allocated_buses(::TransCatSerial::BusList* buses) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete buses_;
+    delete _impl_.buses_;
   }
   if (buses) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::TransCatSerial::BusList>::GetOwningArena(buses);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(buses);
     if (message_arena != submessage_arena) {
       buses = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, buses, submessage_arena);
@@ -3606,19 +4332,19 @@ inline void TransportCatalogue::set_allocated_buses(::TransCatSerial::BusList* b
   } else {
     
   }
-  buses_ = buses;
+  _impl_.buses_ = buses;
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.TransportCatalogue.buses)
 }
 
 // .TransCatSerial.RouterContext router_context = 3;
 inline bool TransportCatalogue::_internal_has_router_context() const {
-  return this != internal_default_instance() && router_context_ != nullptr;
+  return this != internal_default_instance() && _impl_.router_context_ != nullptr;
 }
 inline bool TransportCatalogue::has_router_context() const {
   return _internal_has_router_context();
 }
 inline const ::TransCatSerial::RouterContext& TransportCatalogue::_internal_router_context() const {
-  const ::TransCatSerial::RouterContext* p = router_context_;
+  const ::TransCatSerial::RouterContext* p = _impl_.router_context_;
   return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::RouterContext&>(
       ::TransCatSerial::_RouterContext_default_instance_);
 }
@@ -3629,9 +4355,9 @@ inline const ::TransCatSerial::RouterContext& TransportCatalogue::router_context
 inline void TransportCatalogue::unsafe_arena_set_allocated_router_context(
     ::TransCatSerial::RouterContext* router_context) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(router_context_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.router_context_);
   }
-  router_context_ = router_context;
+  _impl_.router_context_ = router_context;
   if (router_context) {
     
   } else {
@@ -3641,8 +4367,8 @@ inline void TransportCatalogue::unsafe_arena_set_allocated_router_context(
 }
 inline ::TransCatSerial::RouterContext* TransportCatalogue::release_router_context() {
   
-  ::TransCatSerial::RouterContext* temp = router_context_;
-  router_context_ = nullptr;
+  ::TransCatSerial::RouterContext* temp = _impl_.router_context_;
+  _impl_.router_context_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -3657,17 +4383,17 @@ inline ::TransCatSerial::RouterContext* TransportCatalogue::release_router_conte
 inline ::TransCatSerial::RouterContext* TransportCatalogue::unsafe_arena_release_router_context() {
   // @@protoc_insertion_point(field_release:TransCatSerial.TransportCatalogue.router_context)
   
-  ::TransCatSerial::RouterContext* temp = router_context_;
-  router_context_ = nullptr;
+  ::TransCatSerial::RouterContext* temp = _impl_.router_context_;
+  _impl_.router_context_ = nullptr;
   return temp;
 }
 inline ::TransCatSerial::RouterContext* TransportCatalogue::_internal_mutable_router_context() {
   
-  if (router_context_ == nullptr) {
+  if (_impl_.router_context_ == nullptr) {
     auto* p = CreateMaybeMessage<::TransCatSerial::RouterContext>(GetArenaForAllocation());
-    router_context_ = p;
+    _impl_.router_context_ = p;
   }
-  return router_context_;
+  return _impl_.router_context_;
 }
 inline ::TransCatSerial::RouterContext* TransportCatalogue::mutable_router_context() {
   ::TransCatSerial::RouterContext* _msg = _internal_mutable_router_context();
@@ -3677,12 +4403,11 @@ inline ::TransCatSerial::RouterContext* TransportCatalogue::mutable_router_conte
 inline void TransportCatalogue::set_allocated_router_context(::TransCatSerial::RouterContext* router_context) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(router_context_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.router_context_);
   }
   if (router_context) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<
-            ::PROTOBUF_NAMESPACE_ID::MessageLite>::GetOwningArena(
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
                 reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(router_context));
     if (message_arena != submessage_arena) {
       router_context = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
@@ -3692,19 +4417,19 @@ inline void TransportCatalogue::set_allocated_router_context(::TransCatSerial::R
   } else {
     
   }
-  router_context_ = router_context;
+  _impl_.router_context_ = router_context;
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.TransportCatalogue.router_context)
 }
 
 // .TransCatSerial.MapRendererContext render_context = 4;
 inline bool TransportCatalogue::_internal_has_render_context() const {
-  return this != internal_default_instance() && render_context_ != nullptr;
+  return this != internal_default_instance() && _impl_.render_context_ != nullptr;
 }
 inline bool TransportCatalogue::has_render_context() const {
   return _internal_has_render_context();
 }
 inline const ::TransCatSerial::MapRendererContext& TransportCatalogue::_internal_render_context() const {
-  const ::TransCatSerial::MapRendererContext* p = render_context_;
+  const ::TransCatSerial::MapRendererContext* p = _impl_.render_context_;
   return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::MapRendererContext&>(
       ::TransCatSerial::_MapRendererContext_default_instance_);
 }
@@ -3715,9 +4440,9 @@ inline const ::TransCatSerial::MapRendererContext& TransportCatalogue::render_co
 inline void TransportCatalogue::unsafe_arena_set_allocated_render_context(
     ::TransCatSerial::MapRendererContext* render_context) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(render_context_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.render_context_);
   }
-  render_context_ = render_context;
+  _impl_.render_context_ = render_context;
   if (render_context) {
     
   } else {
@@ -3727,8 +4452,8 @@ inline void TransportCatalogue::unsafe_arena_set_allocated_render_context(
 }
 inline ::TransCatSerial::MapRendererContext* TransportCatalogue::release_render_context() {
   
-  ::TransCatSerial::MapRendererContext* temp = render_context_;
-  render_context_ = nullptr;
+  ::TransCatSerial::MapRendererContext* temp = _impl_.render_context_;
+  _impl_.render_context_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -3743,17 +4468,17 @@ inline ::TransCatSerial::MapRendererContext* TransportCatalogue::release_render_
 inline ::TransCatSerial::MapRendererContext* TransportCatalogue::unsafe_arena_release_render_context() {
   // @@protoc_insertion_point(field_release:TransCatSerial.TransportCatalogue.render_context)
   
-  ::TransCatSerial::MapRendererContext* temp = render_context_;
-  render_context_ = nullptr;
+  ::TransCatSerial::MapRendererContext* temp = _impl_.render_context_;
+  _impl_.render_context_ = nullptr;
   return temp;
 }
 inline ::TransCatSerial::MapRendererContext* TransportCatalogue::_internal_mutable_render_context() {
   
-  if (render_context_ == nullptr) {
+  if (_impl_.render_context_ == nullptr) {
     auto* p = CreateMaybeMessage<::TransCatSerial::MapRendererContext>(GetArenaForAllocation());
-    render_context_ = p;
+    _impl_.render_context_ = p;
   }
-  return render_context_;
+  return _impl_.render_context_;
 }
 inline ::TransCatSerial::MapRendererContext* TransportCatalogue::mutable_render_context() {
   ::TransCatSerial::MapRendererContext* _msg = _internal_mutable_render_context();
@@ -3763,12 +4488,11 @@ inline ::TransCatSerial::MapRendererContext* TransportCatalogue::mutable_render_
 inline void TransportCatalogue::set_allocated_render_context(::TransCatSerial::MapRendererContext* render_context) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(render_context_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.render_context_);
   }
   if (render_context) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<
-            ::PROTOBUF_NAMESPACE_ID::MessageLite>::GetOwningArena(
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
                 reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(render_context));
     if (message_arena != submessage_arena) {
       render_context = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
@@ -3778,16 +4502,16 @@ inline void TransportCatalogue::set_allocated_render_context(::TransCatSerial::M
   } else {
     
   }
-  render_context_ = render_context;
+  _impl_.render_context_ = render_context;
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.TransportCatalogue.render_context)
 }
 
 // bool is_routes_data = 5;
 inline void TransportCatalogue::clear_is_routes_data() {
-  is_routes_data_ = false;
+  _impl_.is_routes_data_ = false;
 }
 inline bool TransportCatalogue::_internal_is_routes_data() const {
-  return is_routes_data_;
+  return _impl_.is_routes_data_;
 }
 inline bool TransportCatalogue::is_routes_data() const {
   // @@protoc_insertion_point(field_get:TransCatSerial.TransportCatalogue.is_routes_data)
@@ -3795,7 +4519,7 @@ inline bool TransportCatalogue::is_routes_data() const {
 }
 inline void TransportCatalogue::_internal_set_is_routes_data(bool value) {
   
-  is_routes_data_ = value;
+  _impl_.is_routes_data_ = value;
 }
 inline void TransportCatalogue::set_is_routes_data(bool value) {
   _internal_set_is_routes_data(value);
@@ -3804,19 +4528,19 @@ inline void TransportCatalogue::set_is_routes_data(bool value) {
 
 // .TransCatSerial.StopNameToVertexList stop_name_to_enter_vertex = 6;
 inline bool TransportCatalogue::_internal_has_stop_name_to_enter_vertex() const {
-  return this != internal_default_instance() && stop_name_to_enter_vertex_ != nullptr;
+  return this != internal_default_instance() && _impl_.stop_name_to_enter_vertex_ != nullptr;
 }
 inline bool TransportCatalogue::has_stop_name_to_enter_vertex() const {
   return _internal_has_stop_name_to_enter_vertex();
 }
 inline void TransportCatalogue::clear_stop_name_to_enter_vertex() {
-  if (GetArenaForAllocation() == nullptr && stop_name_to_enter_vertex_ != nullptr) {
-    delete stop_name_to_enter_vertex_;
+  if (GetArenaForAllocation() == nullptr && _impl_.stop_name_to_enter_vertex_ != nullptr) {
+    delete _impl_.stop_name_to_enter_vertex_;
   }
-  stop_name_to_enter_vertex_ = nullptr;
+  _impl_.stop_name_to_enter_vertex_ = nullptr;
 }
 inline const ::TransCatSerial::StopNameToVertexList& TransportCatalogue::_internal_stop_name_to_enter_vertex() const {
-  const ::TransCatSerial::StopNameToVertexList* p = stop_name_to_enter_vertex_;
+  const ::TransCatSerial::StopNameToVertexList* p = _impl_.stop_name_to_enter_vertex_;
   return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::StopNameToVertexList&>(
       ::TransCatSerial::_StopNameToVertexList_default_instance_);
 }
@@ -3827,9 +4551,9 @@ inline const ::TransCatSerial::StopNameToVertexList& TransportCatalogue::stop_na
 inline void TransportCatalogue::unsafe_arena_set_allocated_stop_name_to_enter_vertex(
     ::TransCatSerial::StopNameToVertexList* stop_name_to_enter_vertex) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(stop_name_to_enter_vertex_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stop_name_to_enter_vertex_);
   }
-  stop_name_to_enter_vertex_ = stop_name_to_enter_vertex;
+  _impl_.stop_name_to_enter_vertex_ = stop_name_to_enter_vertex;
   if (stop_name_to_enter_vertex) {
     
   } else {
@@ -3839,8 +4563,8 @@ inline void TransportCatalogue::unsafe_arena_set_allocated_stop_name_to_enter_ve
 }
 inline ::TransCatSerial::StopNameToVertexList* TransportCatalogue::release_stop_name_to_enter_vertex() {
   
-  ::TransCatSerial::StopNameToVertexList* temp = stop_name_to_enter_vertex_;
-  stop_name_to_enter_vertex_ = nullptr;
+  ::TransCatSerial::StopNameToVertexList* temp = _impl_.stop_name_to_enter_vertex_;
+  _impl_.stop_name_to_enter_vertex_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -3855,17 +4579,17 @@ inline ::TransCatSerial::StopNameToVertexList* TransportCatalogue::release_stop_
 inline ::TransCatSerial::StopNameToVertexList* TransportCatalogue::unsafe_arena_release_stop_name_to_enter_vertex() {
   // @@protoc_insertion_point(field_release:TransCatSerial.TransportCatalogue.stop_name_to_enter_vertex)
   
-  ::TransCatSerial::StopNameToVertexList* temp = stop_name_to_enter_vertex_;
-  stop_name_to_enter_vertex_ = nullptr;
+  ::TransCatSerial::StopNameToVertexList* temp = _impl_.stop_name_to_enter_vertex_;
+  _impl_.stop_name_to_enter_vertex_ = nullptr;
   return temp;
 }
 inline ::TransCatSerial::StopNameToVertexList* TransportCatalogue::_internal_mutable_stop_name_to_enter_vertex() {
   
-  if (stop_name_to_enter_vertex_ == nullptr) {
+  if (_impl_.stop_name_to_enter_vertex_ == nullptr) {
     auto* p = CreateMaybeMessage<::TransCatSerial::StopNameToVertexList>(GetArenaForAllocation());
-    stop_name_to_enter_vertex_ = p;
+    _impl_.stop_name_to_enter_vertex_ = p;
   }
-  return stop_name_to_enter_vertex_;
+  return _impl_.stop_name_to_enter_vertex_;
 }
 inline ::TransCatSerial::StopNameToVertexList* TransportCatalogue::mutable_stop_name_to_enter_vertex() {
   ::TransCatSerial::StopNameToVertexList* _msg = _internal_mutable_stop_name_to_enter_vertex();
@@ -3875,11 +4599,11 @@ inline ::TransCatSerial::StopNameToVertexList* TransportCatalogue::mutable_stop_
 inline void TransportCatalogue::set_allocated_stop_name_to_enter_vertex(::TransCatSerial::StopNameToVertexList* stop_name_to_enter_vertex) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete stop_name_to_enter_vertex_;
+    delete _impl_.stop_name_to_enter_vertex_;
   }
   if (stop_name_to_enter_vertex) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::TransCatSerial::StopNameToVertexList>::GetOwningArena(stop_name_to_enter_vertex);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stop_name_to_enter_vertex);
     if (message_arena != submessage_arena) {
       stop_name_to_enter_vertex = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, stop_name_to_enter_vertex, submessage_arena);
@@ -3888,25 +4612,25 @@ inline void TransportCatalogue::set_allocated_stop_name_to_enter_vertex(::TransC
   } else {
     
   }
-  stop_name_to_enter_vertex_ = stop_name_to_enter_vertex;
+  _impl_.stop_name_to_enter_vertex_ = stop_name_to_enter_vertex;
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.TransportCatalogue.stop_name_to_enter_vertex)
 }
 
 // .TransCatSerial.StopNameToVertexList stop_name_to_exit_vertex = 7;
 inline bool TransportCatalogue::_internal_has_stop_name_to_exit_vertex() const {
-  return this != internal_default_instance() && stop_name_to_exit_vertex_ != nullptr;
+  return this != internal_default_instance() && _impl_.stop_name_to_exit_vertex_ != nullptr;
 }
 inline bool TransportCatalogue::has_stop_name_to_exit_vertex() const {
   return _internal_has_stop_name_to_exit_vertex();
 }
 inline void TransportCatalogue::clear_stop_name_to_exit_vertex() {
-  if (GetArenaForAllocation() == nullptr && stop_name_to_exit_vertex_ != nullptr) {
-    delete stop_name_to_exit_vertex_;
+  if (GetArenaForAllocation() == nullptr && _impl_.stop_name_to_exit_vertex_ != nullptr) {
+    delete _impl_.stop_name_to_exit_vertex_;
   }
-  stop_name_to_exit_vertex_ = nullptr;
+  _impl_.stop_name_to_exit_vertex_ = nullptr;
 }
 inline const ::TransCatSerial::StopNameToVertexList& TransportCatalogue::_internal_stop_name_to_exit_vertex() const {
-  const ::TransCatSerial::StopNameToVertexList* p = stop_name_to_exit_vertex_;
+  const ::TransCatSerial::StopNameToVertexList* p = _impl_.stop_name_to_exit_vertex_;
   return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::StopNameToVertexList&>(
       ::TransCatSerial::_StopNameToVertexList_default_instance_);
 }
@@ -3917,9 +4641,9 @@ inline const ::TransCatSerial::StopNameToVertexList& TransportCatalogue::stop_na
 inline void TransportCatalogue::unsafe_arena_set_allocated_stop_name_to_exit_vertex(
     ::TransCatSerial::StopNameToVertexList* stop_name_to_exit_vertex) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(stop_name_to_exit_vertex_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stop_name_to_exit_vertex_);
   }
-  stop_name_to_exit_vertex_ = stop_name_to_exit_vertex;
+  _impl_.stop_name_to_exit_vertex_ = stop_name_to_exit_vertex;
   if (stop_name_to_exit_vertex) {
     
   } else {
@@ -3929,8 +4653,8 @@ inline void TransportCatalogue::unsafe_arena_set_allocated_stop_name_to_exit_ver
 }
 inline ::TransCatSerial::StopNameToVertexList* TransportCatalogue::release_stop_name_to_exit_vertex() {
   
-  ::TransCatSerial::StopNameToVertexList* temp = stop_name_to_exit_vertex_;
-  stop_name_to_exit_vertex_ = nullptr;
+  ::TransCatSerial::StopNameToVertexList* temp = _impl_.stop_name_to_exit_vertex_;
+  _impl_.stop_name_to_exit_vertex_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -3945,17 +4669,17 @@ inline ::TransCatSerial::StopNameToVertexList* TransportCatalogue::release_stop_
 inline ::TransCatSerial::StopNameToVertexList* TransportCatalogue::unsafe_arena_release_stop_name_to_exit_vertex() {
   // @@protoc_insertion_point(field_release:TransCatSerial.TransportCatalogue.stop_name_to_exit_vertex)
   
-  ::TransCatSerial::StopNameToVertexList* temp = stop_name_to_exit_vertex_;
-  stop_name_to_exit_vertex_ = nullptr;
+  ::TransCatSerial::StopNameToVertexList* temp = _impl_.stop_name_to_exit_vertex_;
+  _impl_.stop_name_to_exit_vertex_ = nullptr;
   return temp;
 }
 inline ::TransCatSerial::StopNameToVertexList* TransportCatalogue::_internal_mutable_stop_name_to_exit_vertex() {
   
-  if (stop_name_to_exit_vertex_ == nullptr) {
+  if (_impl_.stop_name_to_exit_vertex_ == nullptr) {
     auto* p = CreateMaybeMessage<::TransCatSerial::StopNameToVertexList>(GetArenaForAllocation());
-    stop_name_to_exit_vertex_ = p;
+    _impl_.stop_name_to_exit_vertex_ = p;
   }
-  return stop_name_to_exit_vertex_;
+  return _impl_.stop_name_to_exit_vertex_;
 }
 inline ::TransCatSerial::StopNameToVertexList* TransportCatalogue::mutable_stop_name_to_exit_vertex() {
   ::TransCatSerial::StopNameToVertexList* _msg = _internal_mutable_stop_name_to_exit_vertex();
@@ -3965,11 +4689,11 @@ inline ::TransCatSerial::StopNameToVertexList* TransportCatalogue::mutable_stop_
 inline void TransportCatalogue::set_allocated_stop_name_to_exit_vertex(::TransCatSerial::StopNameToVertexList* stop_name_to_exit_vertex) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete stop_name_to_exit_vertex_;
+    delete _impl_.stop_name_to_exit_vertex_;
   }
   if (stop_name_to_exit_vertex) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::TransCatSerial::StopNameToVertexList>::GetOwningArena(stop_name_to_exit_vertex);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stop_name_to_exit_vertex);
     if (message_arena != submessage_arena) {
       stop_name_to_exit_vertex = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, stop_name_to_exit_vertex, submessage_arena);
@@ -3978,25 +4702,25 @@ inline void TransportCatalogue::set_allocated_stop_name_to_exit_vertex(::TransCa
   } else {
     
   }
-  stop_name_to_exit_vertex_ = stop_name_to_exit_vertex;
+  _impl_.stop_name_to_exit_vertex_ = stop_name_to_exit_vertex;
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.TransportCatalogue.stop_name_to_exit_vertex)
 }
 
 // .TransCatSerial.EdgeToDescList edge_to_desc = 8;
 inline bool TransportCatalogue::_internal_has_edge_to_desc() const {
-  return this != internal_default_instance() && edge_to_desc_ != nullptr;
+  return this != internal_default_instance() && _impl_.edge_to_desc_ != nullptr;
 }
 inline bool TransportCatalogue::has_edge_to_desc() const {
   return _internal_has_edge_to_desc();
 }
 inline void TransportCatalogue::clear_edge_to_desc() {
-  if (GetArenaForAllocation() == nullptr && edge_to_desc_ != nullptr) {
-    delete edge_to_desc_;
+  if (GetArenaForAllocation() == nullptr && _impl_.edge_to_desc_ != nullptr) {
+    delete _impl_.edge_to_desc_;
   }
-  edge_to_desc_ = nullptr;
+  _impl_.edge_to_desc_ = nullptr;
 }
 inline const ::TransCatSerial::EdgeToDescList& TransportCatalogue::_internal_edge_to_desc() const {
-  const ::TransCatSerial::EdgeToDescList* p = edge_to_desc_;
+  const ::TransCatSerial::EdgeToDescList* p = _impl_.edge_to_desc_;
   return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::EdgeToDescList&>(
       ::TransCatSerial::_EdgeToDescList_default_instance_);
 }
@@ -4007,9 +4731,9 @@ inline const ::TransCatSerial::EdgeToDescList& TransportCatalogue::edge_to_desc(
 inline void TransportCatalogue::unsafe_arena_set_allocated_edge_to_desc(
     ::TransCatSerial::EdgeToDescList* edge_to_desc) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(edge_to_desc_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.edge_to_desc_);
   }
-  edge_to_desc_ = edge_to_desc;
+  _impl_.edge_to_desc_ = edge_to_desc;
   if (edge_to_desc) {
     
   } else {
@@ -4019,8 +4743,8 @@ inline void TransportCatalogue::unsafe_arena_set_allocated_edge_to_desc(
 }
 inline ::TransCatSerial::EdgeToDescList* TransportCatalogue::release_edge_to_desc() {
   
-  ::TransCatSerial::EdgeToDescList* temp = edge_to_desc_;
-  edge_to_desc_ = nullptr;
+  ::TransCatSerial::EdgeToDescList* temp = _impl_.edge_to_desc_;
+  _impl_.edge_to_desc_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -4035,17 +4759,17 @@ inline ::TransCatSerial::EdgeToDescList* TransportCatalogue::release_edge_to_des
 inline ::TransCatSerial::EdgeToDescList* TransportCatalogue::unsafe_arena_release_edge_to_desc() {
   // @@protoc_insertion_point(field_release:TransCatSerial.TransportCatalogue.edge_to_desc)
   
-  ::TransCatSerial::EdgeToDescList* temp = edge_to_desc_;
-  edge_to_desc_ = nullptr;
+  ::TransCatSerial::EdgeToDescList* temp = _impl_.edge_to_desc_;
+  _impl_.edge_to_desc_ = nullptr;
   return temp;
 }
 inline ::TransCatSerial::EdgeToDescList* TransportCatalogue::_internal_mutable_edge_to_desc() {
   
-  if (edge_to_desc_ == nullptr) {
+  if (_impl_.edge_to_desc_ == nullptr) {
     auto* p = CreateMaybeMessage<::TransCatSerial::EdgeToDescList>(GetArenaForAllocation());
-    edge_to_desc_ = p;
+    _impl_.edge_to_desc_ = p;
   }
-  return edge_to_desc_;
+  return _impl_.edge_to_desc_;
 }
 inline ::TransCatSerial::EdgeToDescList* TransportCatalogue::mutable_edge_to_desc() {
   ::TransCatSerial::EdgeToDescList* _msg = _internal_mutable_edge_to_desc();
@@ -4055,11 +4779,11 @@ inline ::TransCatSerial::EdgeToDescList* TransportCatalogue::mutable_edge_to_des
 inline void TransportCatalogue::set_allocated_edge_to_desc(::TransCatSerial::EdgeToDescList* edge_to_desc) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete edge_to_desc_;
+    delete _impl_.edge_to_desc_;
   }
   if (edge_to_desc) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::TransCatSerial::EdgeToDescList>::GetOwningArena(edge_to_desc);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(edge_to_desc);
     if (message_arena != submessage_arena) {
       edge_to_desc = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, edge_to_desc, submessage_arena);
@@ -4068,19 +4792,19 @@ inline void TransportCatalogue::set_allocated_edge_to_desc(::TransCatSerial::Edg
   } else {
     
   }
-  edge_to_desc_ = edge_to_desc;
+  _impl_.edge_to_desc_ = edge_to_desc;
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.TransportCatalogue.edge_to_desc)
 }
 
 // .TransCatSerial.Edges edges = 9;
 inline bool TransportCatalogue::_internal_has_edges() const {
-  return this != internal_default_instance() && edges_ != nullptr;
+  return this != internal_default_instance() && _impl_.edges_ != nullptr;
 }
 inline bool TransportCatalogue::has_edges() const {
   return _internal_has_edges();
 }
 inline const ::TransCatSerial::Edges& TransportCatalogue::_internal_edges() const {
-  const ::TransCatSerial::Edges* p = edges_;
+  const ::TransCatSerial::Edges* p = _impl_.edges_;
   return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::Edges&>(
       ::TransCatSerial::_Edges_default_instance_);
 }
@@ -4091,9 +4815,9 @@ inline const ::TransCatSerial::Edges& TransportCatalogue::edges() const {
 inline void TransportCatalogue::unsafe_arena_set_allocated_edges(
     ::TransCatSerial::Edges* edges) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(edges_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.edges_);
   }
-  edges_ = edges;
+  _impl_.edges_ = edges;
   if (edges) {
     
   } else {
@@ -4103,8 +4827,8 @@ inline void TransportCatalogue::unsafe_arena_set_allocated_edges(
 }
 inline ::TransCatSerial::Edges* TransportCatalogue::release_edges() {
   
-  ::TransCatSerial::Edges* temp = edges_;
-  edges_ = nullptr;
+  ::TransCatSerial::Edges* temp = _impl_.edges_;
+  _impl_.edges_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -4119,17 +4843,17 @@ inline ::TransCatSerial::Edges* TransportCatalogue::release_edges() {
 inline ::TransCatSerial::Edges* TransportCatalogue::unsafe_arena_release_edges() {
   // @@protoc_insertion_point(field_release:TransCatSerial.TransportCatalogue.edges)
   
-  ::TransCatSerial::Edges* temp = edges_;
-  edges_ = nullptr;
+  ::TransCatSerial::Edges* temp = _impl_.edges_;
+  _impl_.edges_ = nullptr;
   return temp;
 }
 inline ::TransCatSerial::Edges* TransportCatalogue::_internal_mutable_edges() {
   
-  if (edges_ == nullptr) {
+  if (_impl_.edges_ == nullptr) {
     auto* p = CreateMaybeMessage<::TransCatSerial::Edges>(GetArenaForAllocation());
-    edges_ = p;
+    _impl_.edges_ = p;
   }
-  return edges_;
+  return _impl_.edges_;
 }
 inline ::TransCatSerial::Edges* TransportCatalogue::mutable_edges() {
   ::TransCatSerial::Edges* _msg = _internal_mutable_edges();
@@ -4139,12 +4863,11 @@ inline ::TransCatSerial::Edges* TransportCatalogue::mutable_edges() {
 inline void TransportCatalogue::set_allocated_edges(::TransCatSerial::Edges* edges) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(edges_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.edges_);
   }
   if (edges) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<
-            ::PROTOBUF_NAMESPACE_ID::MessageLite>::GetOwningArena(
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
                 reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(edges));
     if (message_arena != submessage_arena) {
       edges = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
@@ -4154,19 +4877,19 @@ inline void TransportCatalogue::set_allocated_edges(::TransCatSerial::Edges* edg
   } else {
     
   }
-  edges_ = edges;
+  _impl_.edges_ = edges;
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.TransportCatalogue.edges)
 }
 
 // .TransCatSerial.IncidenceLists incidence_lists = 10;
 inline bool TransportCatalogue::_internal_has_incidence_lists() const {
-  return this != internal_default_instance() && incidence_lists_ != nullptr;
+  return this != internal_default_instance() && _impl_.incidence_lists_ != nullptr;
 }
 inline bool TransportCatalogue::has_incidence_lists() const {
   return _internal_has_incidence_lists();
 }
 inline const ::TransCatSerial::IncidenceLists& TransportCatalogue::_internal_incidence_lists() const {
-  const ::TransCatSerial::IncidenceLists* p = incidence_lists_;
+  const ::TransCatSerial::IncidenceLists* p = _impl_.incidence_lists_;
   return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::IncidenceLists&>(
       ::TransCatSerial::_IncidenceLists_default_instance_);
 }
@@ -4177,9 +4900,9 @@ inline const ::TransCatSerial::IncidenceLists& TransportCatalogue::incidence_lis
 inline void TransportCatalogue::unsafe_arena_set_allocated_incidence_lists(
     ::TransCatSerial::IncidenceLists* incidence_lists) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(incidence_lists_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.incidence_lists_);
   }
-  incidence_lists_ = incidence_lists;
+  _impl_.incidence_lists_ = incidence_lists;
   if (incidence_lists) {
     
   } else {
@@ -4189,8 +4912,8 @@ inline void TransportCatalogue::unsafe_arena_set_allocated_incidence_lists(
 }
 inline ::TransCatSerial::IncidenceLists* TransportCatalogue::release_incidence_lists() {
   
-  ::TransCatSerial::IncidenceLists* temp = incidence_lists_;
-  incidence_lists_ = nullptr;
+  ::TransCatSerial::IncidenceLists* temp = _impl_.incidence_lists_;
+  _impl_.incidence_lists_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -4205,17 +4928,17 @@ inline ::TransCatSerial::IncidenceLists* TransportCatalogue::release_incidence_l
 inline ::TransCatSerial::IncidenceLists* TransportCatalogue::unsafe_arena_release_incidence_lists() {
   // @@protoc_insertion_point(field_release:TransCatSerial.TransportCatalogue.incidence_lists)
   
-  ::TransCatSerial::IncidenceLists* temp = incidence_lists_;
-  incidence_lists_ = nullptr;
+  ::TransCatSerial::IncidenceLists* temp = _impl_.incidence_lists_;
+  _impl_.incidence_lists_ = nullptr;
   return temp;
 }
 inline ::TransCatSerial::IncidenceLists* TransportCatalogue::_internal_mutable_incidence_lists() {
   
-  if (incidence_lists_ == nullptr) {
+  if (_impl_.incidence_lists_ == nullptr) {
     auto* p = CreateMaybeMessage<::TransCatSerial::IncidenceLists>(GetArenaForAllocation());
-    incidence_lists_ = p;
+    _impl_.incidence_lists_ = p;
   }
-  return incidence_lists_;
+  return _impl_.incidence_lists_;
 }
 inline ::TransCatSerial::IncidenceLists* TransportCatalogue::mutable_incidence_lists() {
   ::TransCatSerial::IncidenceLists* _msg = _internal_mutable_incidence_lists();
@@ -4225,12 +4948,11 @@ inline ::TransCatSerial::IncidenceLists* TransportCatalogue::mutable_incidence_l
 inline void TransportCatalogue::set_allocated_incidence_lists(::TransCatSerial::IncidenceLists* incidence_lists) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(incidence_lists_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.incidence_lists_);
   }
   if (incidence_lists) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<
-            ::PROTOBUF_NAMESPACE_ID::MessageLite>::GetOwningArena(
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
                 reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(incidence_lists));
     if (message_arena != submessage_arena) {
       incidence_lists = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
@@ -4240,19 +4962,19 @@ inline void TransportCatalogue::set_allocated_incidence_lists(::TransCatSerial::
   } else {
     
   }
-  incidence_lists_ = incidence_lists;
+  _impl_.incidence_lists_ = incidence_lists;
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.TransportCatalogue.incidence_lists)
 }
 
 // .TransCatSerial.RoutesData routes_data = 11;
 inline bool TransportCatalogue::_internal_has_routes_data() const {
-  return this != internal_default_instance() && routes_data_ != nullptr;
+  return this != internal_default_instance() && _impl_.routes_data_ != nullptr;
 }
 inline bool TransportCatalogue::has_routes_data() const {
   return _internal_has_routes_data();
 }
 inline const ::TransCatSerial::RoutesData& TransportCatalogue::_internal_routes_data() const {
-  const ::TransCatSerial::RoutesData* p = routes_data_;
+  const ::TransCatSerial::RoutesData* p = _impl_.routes_data_;
   return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::RoutesData&>(
       ::TransCatSerial::_RoutesData_default_instance_);
 }
@@ -4263,9 +4985,9 @@ inline const ::TransCatSerial::RoutesData& TransportCatalogue::routes_data() con
 inline void TransportCatalogue::unsafe_arena_set_allocated_routes_data(
     ::TransCatSerial::RoutesData* routes_data) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(routes_data_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.routes_data_);
   }
-  routes_data_ = routes_data;
+  _impl_.routes_data_ = routes_data;
   if (routes_data) {
     
   } else {
@@ -4275,8 +4997,8 @@ inline void TransportCatalogue::unsafe_arena_set_allocated_routes_data(
 }
 inline ::TransCatSerial::RoutesData* TransportCatalogue::release_routes_data() {
   
-  ::TransCatSerial::RoutesData* temp = routes_data_;
-  routes_data_ = nullptr;
+  ::TransCatSerial::RoutesData* temp = _impl_.routes_data_;
+  _impl_.routes_data_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -4291,17 +5013,17 @@ inline ::TransCatSerial::RoutesData* TransportCatalogue::release_routes_data() {
 inline ::TransCatSerial::RoutesData* TransportCatalogue::unsafe_arena_release_routes_data() {
   // @@protoc_insertion_point(field_release:TransCatSerial.TransportCatalogue.routes_data)
   
-  ::TransCatSerial::RoutesData* temp = routes_data_;
-  routes_data_ = nullptr;
+  ::TransCatSerial::RoutesData* temp = _impl_.routes_data_;
+  _impl_.routes_data_ = nullptr;
   return temp;
 }
 inline ::TransCatSerial::RoutesData* TransportCatalogue::_internal_mutable_routes_data() {
   
-  if (routes_data_ == nullptr) {
+  if (_impl_.routes_data_ == nullptr) {
     auto* p = CreateMaybeMessage<::TransCatSerial::RoutesData>(GetArenaForAllocation());
-    routes_data_ = p;
+    _impl_.routes_data_ = p;
   }
-  return routes_data_;
+  return _impl_.routes_data_;
 }
 inline ::TransCatSerial::RoutesData* TransportCatalogue::mutable_routes_data() {
   ::TransCatSerial::RoutesData* _msg = _internal_mutable_routes_data();
@@ -4311,12 +5033,11 @@ inline ::TransCatSerial::RoutesData* TransportCatalogue::mutable_routes_data() {
 inline void TransportCatalogue::set_allocated_routes_data(::TransCatSerial::RoutesData* routes_data) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(routes_data_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.routes_data_);
   }
   if (routes_data) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<
-            ::PROTOBUF_NAMESPACE_ID::MessageLite>::GetOwningArena(
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
                 reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(routes_data));
     if (message_arena != submessage_arena) {
       routes_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
@@ -4326,10 +5047,433 @@ inline void TransportCatalogue::set_allocated_routes_data(::TransCatSerial::Rout
   } else {
     
   }
-  routes_data_ = routes_data;
+  _impl_.routes_data_ = routes_data;
   // @@protoc_insertion_point(field_set_allocated:TransCatSerial.TransportCatalogue.routes_data)
 }
 
+// uint32 format_version = 12;
+inline void TransportCatalogue::clear_format_version() {
+  _impl_.format_version_ = 0u;
+}
+inline uint32_t TransportCatalogue::_internal_format_version() const {
+  return _impl_.format_version_;
+}
+inline uint32_t TransportCatalogue::format_version() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.TransportCatalogue.format_version)
+  return _internal_format_version();
+}
+inline void TransportCatalogue::_internal_set_format_version(uint32_t value) {
+  
+  _impl_.format_version_ = value;
+}
+inline void TransportCatalogue::set_format_version(uint32_t value) {
+  _internal_set_format_version(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.TransportCatalogue.format_version)
+}
+
+// .TransCatSerial.PackedRoutesData packed_routes_data = 13;
+inline bool TransportCatalogue::_internal_has_packed_routes_data() const {
+  return this != internal_default_instance() && _impl_.packed_routes_data_ != nullptr;
+}
+inline bool TransportCatalogue::has_packed_routes_data() const {
+  return _internal_has_packed_routes_data();
+}
+inline const ::TransCatSerial::PackedRoutesData& TransportCatalogue::_internal_packed_routes_data() const {
+  const ::TransCatSerial::PackedRoutesData* p = _impl_.packed_routes_data_;
+  return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::PackedRoutesData&>(
+      ::TransCatSerial::_PackedRoutesData_default_instance_);
+}
+inline const ::TransCatSerial::PackedRoutesData& TransportCatalogue::packed_routes_data() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.TransportCatalogue.packed_routes_data)
+  return _internal_packed_routes_data();
+}
+inline void TransportCatalogue::unsafe_arena_set_allocated_packed_routes_data(
+    ::TransCatSerial::PackedRoutesData* packed_routes_data) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.packed_routes_data_);
+  }
+  _impl_.packed_routes_data_ = packed_routes_data;
+  if (packed_routes_data) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:TransCatSerial.TransportCatalogue.packed_routes_data)
+}
+inline ::TransCatSerial::PackedRoutesData* TransportCatalogue::release_packed_routes_data() {
+  
+  ::TransCatSerial::PackedRoutesData* temp = _impl_.packed_routes_data_;
+  _impl_.packed_routes_data_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::TransCatSerial::PackedRoutesData* TransportCatalogue::unsafe_arena_release_packed_routes_data() {
+  // @@protoc_insertion_point(field_release:TransCatSerial.TransportCatalogue.packed_routes_data)
+  
+  ::TransCatSerial::PackedRoutesData* temp = _impl_.packed_routes_data_;
+  _impl_.packed_routes_data_ = nullptr;
+  return temp;
+}
+inline ::TransCatSerial::PackedRoutesData* TransportCatalogue::_internal_mutable_packed_routes_data() {
+  
+  if (_impl_.packed_routes_data_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TransCatSerial::PackedRoutesData>(GetArenaForAllocation());
+    _impl_.packed_routes_data_ = p;
+  }
+  return _impl_.packed_routes_data_;
+}
+inline ::TransCatSerial::PackedRoutesData* TransportCatalogue::mutable_packed_routes_data() {
+  ::TransCatSerial::PackedRoutesData* _msg = _internal_mutable_packed_routes_data();
+  // @@protoc_insertion_point(field_mutable:TransCatSerial.TransportCatalogue.packed_routes_data)
+  return _msg;
+}
+inline void TransportCatalogue::set_allocated_packed_routes_data(::TransCatSerial::PackedRoutesData* packed_routes_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.packed_routes_data_);
+  }
+  if (packed_routes_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(packed_routes_data));
+    if (message_arena != submessage_arena) {
+      packed_routes_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, packed_routes_data, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.packed_routes_data_ = packed_routes_data;
+  // @@protoc_insertion_point(field_set_allocated:TransCatSerial.TransportCatalogue.packed_routes_data)
+}
+
+// .TransCatSerial.ContractionHierarchy contraction_hierarchy = 14;
+inline bool TransportCatalogue::_internal_has_contraction_hierarchy() const {
+  return this != internal_default_instance() && _impl_.contraction_hierarchy_ != nullptr;
+}
+inline bool TransportCatalogue::has_contraction_hierarchy() const {
+  return _internal_has_contraction_hierarchy();
+}
+inline const ::TransCatSerial::ContractionHierarchy& TransportCatalogue::_internal_contraction_hierarchy() const {
+  const ::TransCatSerial::ContractionHierarchy* p = _impl_.contraction_hierarchy_;
+  return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::ContractionHierarchy&>(
+      ::TransCatSerial::_ContractionHierarchy_default_instance_);
+}
+inline const ::TransCatSerial::ContractionHierarchy& TransportCatalogue::contraction_hierarchy() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.TransportCatalogue.contraction_hierarchy)
+  return _internal_contraction_hierarchy();
+}
+inline void TransportCatalogue::unsafe_arena_set_allocated_contraction_hierarchy(
+    ::TransCatSerial::ContractionHierarchy* contraction_hierarchy) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.contraction_hierarchy_);
+  }
+  _impl_.contraction_hierarchy_ = contraction_hierarchy;
+  if (contraction_hierarchy) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:TransCatSerial.TransportCatalogue.contraction_hierarchy)
+}
+inline ::TransCatSerial::ContractionHierarchy* TransportCatalogue::release_contraction_hierarchy() {
+  
+  ::TransCatSerial::ContractionHierarchy* temp = _impl_.contraction_hierarchy_;
+  _impl_.contraction_hierarchy_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::TransCatSerial::ContractionHierarchy* TransportCatalogue::unsafe_arena_release_contraction_hierarchy() {
+  // @@protoc_insertion_point(field_release:TransCatSerial.TransportCatalogue.contraction_hierarchy)
+  
+  ::TransCatSerial::ContractionHierarchy* temp = _impl_.contraction_hierarchy_;
+  _impl_.contraction_hierarchy_ = nullptr;
+  return temp;
+}
+inline ::TransCatSerial::ContractionHierarchy* TransportCatalogue::_internal_mutable_contraction_hierarchy() {
+  
+  if (_impl_.contraction_hierarchy_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TransCatSerial::ContractionHierarchy>(GetArenaForAllocation());
+    _impl_.contraction_hierarchy_ = p;
+  }
+  return _impl_.contraction_hierarchy_;
+}
+inline ::TransCatSerial::ContractionHierarchy* TransportCatalogue::mutable_contraction_hierarchy() {
+  ::TransCatSerial::ContractionHierarchy* _msg = _internal_mutable_contraction_hierarchy();
+  // @@protoc_insertion_point(field_mutable:TransCatSerial.TransportCatalogue.contraction_hierarchy)
+  return _msg;
+}
+inline void TransportCatalogue::set_allocated_contraction_hierarchy(::TransCatSerial::ContractionHierarchy* contraction_hierarchy) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.contraction_hierarchy_);
+  }
+  if (contraction_hierarchy) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(contraction_hierarchy));
+    if (message_arena != submessage_arena) {
+      contraction_hierarchy = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, contraction_hierarchy, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.contraction_hierarchy_ = contraction_hierarchy;
+  // @@protoc_insertion_point(field_set_allocated:TransCatSerial.TransportCatalogue.contraction_hierarchy)
+}
+
+// .TransCatSerial.HubLabels hub_labels = 15;
+inline bool TransportCatalogue::_internal_has_hub_labels() const {
+  return this != internal_default_instance() && _impl_.hub_labels_ != nullptr;
+}
+inline bool TransportCatalogue::has_hub_labels() const {
+  return _internal_has_hub_labels();
+}
+inline const ::TransCatSerial::HubLabels& TransportCatalogue::_internal_hub_labels() const {
+  const ::TransCatSerial::HubLabels* p = _impl_.hub_labels_;
+  return p != nullptr ? *p : reinterpret_cast<const ::TransCatSerial::HubLabels&>(
+      ::TransCatSerial::_HubLabels_default_instance_);
+}
+inline const ::TransCatSerial::HubLabels& TransportCatalogue::hub_labels() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.TransportCatalogue.hub_labels)
+  return _internal_hub_labels();
+}
+inline void TransportCatalogue::unsafe_arena_set_allocated_hub_labels(
+    ::TransCatSerial::HubLabels* hub_labels) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hub_labels_);
+  }
+  _impl_.hub_labels_ = hub_labels;
+  if (hub_labels) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:TransCatSerial.TransportCatalogue.hub_labels)
+}
+inline ::TransCatSerial::HubLabels* TransportCatalogue::release_hub_labels() {
+  
+  ::TransCatSerial::HubLabels* temp = _impl_.hub_labels_;
+  _impl_.hub_labels_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::TransCatSerial::HubLabels* TransportCatalogue::unsafe_arena_release_hub_labels() {
+  // @@protoc_insertion_point(field_release:TransCatSerial.TransportCatalogue.hub_labels)
+  
+  ::TransCatSerial::HubLabels* temp = _impl_.hub_labels_;
+  _impl_.hub_labels_ = nullptr;
+  return temp;
+}
+inline ::TransCatSerial::HubLabels* TransportCatalogue::_internal_mutable_hub_labels() {
+  
+  if (_impl_.hub_labels_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TransCatSerial::HubLabels>(GetArenaForAllocation());
+    _impl_.hub_labels_ = p;
+  }
+  return _impl_.hub_labels_;
+}
+inline ::TransCatSerial::HubLabels* TransportCatalogue::mutable_hub_labels() {
+  ::TransCatSerial::HubLabels* _msg = _internal_mutable_hub_labels();
+  // @@protoc_insertion_point(field_mutable:TransCatSerial.TransportCatalogue.hub_labels)
+  return _msg;
+}
+inline void TransportCatalogue::set_allocated_hub_labels(::TransCatSerial::HubLabels* hub_labels) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hub_labels_);
+  }
+  if (hub_labels) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(hub_labels));
+    if (message_arena != submessage_arena) {
+      hub_labels = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hub_labels, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.hub_labels_ = hub_labels;
+  // @@protoc_insertion_point(field_set_allocated:TransCatSerial.TransportCatalogue.hub_labels)
+}
+
+// -------------------------------------------------------------------
+
+// BaseSection
+
+// .TransCatSerial.BaseSection.SectionType type = 1;
+inline void BaseSection::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::TransCatSerial::BaseSection_SectionType BaseSection::_internal_type() const {
+  return static_cast< ::TransCatSerial::BaseSection_SectionType >(_impl_.type_);
+}
+inline ::TransCatSerial::BaseSection_SectionType BaseSection::type() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.BaseSection.type)
+  return _internal_type();
+}
+inline void BaseSection::_internal_set_type(::TransCatSerial::BaseSection_SectionType value) {
+  
+  _impl_.type_ = value;
+}
+inline void BaseSection::set_type(::TransCatSerial::BaseSection_SectionType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.BaseSection.type)
+}
+
+// uint64 offset = 2;
+inline void BaseSection::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
+}
+inline uint64_t BaseSection::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint64_t BaseSection::offset() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.BaseSection.offset)
+  return _internal_offset();
+}
+inline void BaseSection::_internal_set_offset(uint64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void BaseSection::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.BaseSection.offset)
+}
+
+// uint64 size = 3;
+inline void BaseSection::clear_size() {
+  _impl_.size_ = uint64_t{0u};
+}
+inline uint64_t BaseSection::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint64_t BaseSection::size() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.BaseSection.size)
+  return _internal_size();
+}
+inline void BaseSection::_internal_set_size(uint64_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void BaseSection::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.BaseSection.size)
+}
+
+// bool compressed = 4;
+inline void BaseSection::clear_compressed() {
+  _impl_.compressed_ = false;
+}
+inline bool BaseSection::_internal_compressed() const {
+  return _impl_.compressed_;
+}
+inline bool BaseSection::compressed() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.BaseSection.compressed)
+  return _internal_compressed();
+}
+inline void BaseSection::_internal_set_compressed(bool value) {
+  
+  _impl_.compressed_ = value;
+}
+inline void BaseSection::set_compressed(bool value) {
+  _internal_set_compressed(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.BaseSection.compressed)
+}
+
+// -------------------------------------------------------------------
+
+// BaseIndex
+
+// uint32 format_version = 1;
+inline void BaseIndex::clear_format_version() {
+  _impl_.format_version_ = 0u;
+}
+inline uint32_t BaseIndex::_internal_format_version() const {
+  return _impl_.format_version_;
+}
+inline uint32_t BaseIndex::format_version() const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.BaseIndex.format_version)
+  return _internal_format_version();
+}
+inline void BaseIndex::_internal_set_format_version(uint32_t value) {
+  
+  _impl_.format_version_ = value;
+}
+inline void BaseIndex::set_format_version(uint32_t value) {
+  _internal_set_format_version(value);
+  // @@protoc_insertion_point(field_set:TransCatSerial.BaseIndex.format_version)
+}
+
+// repeated .TransCatSerial.BaseSection sections = 2;
+inline int BaseIndex::_internal_sections_size() const {
+  return _impl_.sections_.size();
+}
+inline int BaseIndex::sections_size() const {
+  return _internal_sections_size();
+}
+inline void BaseIndex::clear_sections() {
+  _impl_.sections_.Clear();
+}
+inline ::TransCatSerial::BaseSection* BaseIndex::mutable_sections(int index) {
+  // @@protoc_insertion_point(field_mutable:TransCatSerial.BaseIndex.sections)
+  return _impl_.sections_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::BaseSection >*
+BaseIndex::mutable_sections() {
+  // @@protoc_insertion_point(field_mutable_list:TransCatSerial.BaseIndex.sections)
+  return &_impl_.sections_;
+}
+inline const ::TransCatSerial::BaseSection& BaseIndex::_internal_sections(int index) const {
+  return _impl_.sections_.Get(index);
+}
+inline const ::TransCatSerial::BaseSection& BaseIndex::sections(int index) const {
+  // @@protoc_insertion_point(field_get:TransCatSerial.BaseIndex.sections)
+  return _internal_sections(index);
+}
+inline ::TransCatSerial::BaseSection* BaseIndex::_internal_add_sections() {
+  return _impl_.sections_.Add();
+}
+inline ::TransCatSerial::BaseSection* BaseIndex::add_sections() {
+  ::TransCatSerial::BaseSection* _add = _internal_add_sections();
+  // @@protoc_insertion_point(field_add:TransCatSerial.BaseIndex.sections)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TransCatSerial::BaseSection >&
+BaseIndex::sections() const {
+  // @@protoc_insertion_point(field_list:TransCatSerial.BaseIndex.sections)
+  return _impl_.sections_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -4355,6 +5499,10 @@ inline void TransportCatalogue::set_allocated_routes_data(::TransCatSerial::Rout
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -4377,6 +5525,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::TransCatSerial::Bus_BusType>() {
   return ::TransCatSerial::Bus_BusType_descriptor();
 }
+template <> struct is_proto_enum< ::TransCatSerial::BaseSection_SectionType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::TransCatSerial::BaseSection_SectionType>() {
+  return ::TransCatSerial::BaseSection_SectionType_descriptor();
+}
 
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -0,0 +1,740 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <future>
+#include <filesystem>
+#include <stdexcept>
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#include "compression.h"
+#include "geo.h"
+#include "json.h"
+#include "json_reader.h"
+#include "base_snapshot.h"
+#include "transport_catalogue.h"
+#include "transport_catalogue.pb.h"
+
+using namespace std;
+using namespace std::literals;
+
+// Проверки справочника, запускаемые через ctest. Проверка при нарушении условия выбрасывает
+// исключение с его текстом и местом; файлы баз создаются в текущем каталоге и затем удаляются.
+
+#define CHECK(condition) \
+    if (!(condition)) \
+        throw logic_error(string(__FILE__) + ":"s + to_string(__LINE__) + ": "s + #condition)
+
+namespace tests
+{
+    string ToString(const json::Node& node)
+    {
+        ostringstream output;
+        json::Print(json::Document(node), output);
+        return output.str();
+    }
+
+    json::Dict MakeRoutingSettings(double bus_wait_time, double bus_velocity, const string& routing_algorithm = "matrix"s)
+    {
+        return json::Dict{{"bus_wait_time"s, bus_wait_time}, {"bus_velocity"s, bus_velocity},
+                          {"routing_algorithm"s, routing_algorithm}};
+    }
+
+    // Документ из настроек сериализации и маршрутизации и списка запросов с ключом requests_name
+    string MakeDocument(const string& base_file, json::Array requests, string_view requests_name,
+                        json::Dict routing_settings = MakeRoutingSettings(2, 30))
+    {
+        return ToString(json::Dict{{"serialization_settings"s, json::Dict{{"file"s, base_file}}},
+                                   {"routing_settings"s, move(routing_settings)},
+                                   {string(requests_name), move(requests)}});
+    }
+
+    void MakeBase(const string& base_file, json::Array base_requests, json::Dict routing_settings = MakeRoutingSettings(2, 30))
+    {
+        istringstream input(MakeDocument(base_file, move(base_requests), "base_requests"sv, move(routing_settings)));
+        transport::TransportCatalogue trans_cat;
+        transport::reader::JSONReader jsr(input, trans_cat);
+        jsr.ProcessAddInfoRequests();
+        jsr.BuildBusRouter();
+        jsr.ProcessSerialize();
+    }
+
+    // Правка базы в режиме make_delta
+    void MakeDelta(const string& base_file, json::Array base_requests, json::Dict routing_settings)
+    {
+        istringstream input(MakeDocument(base_file, move(base_requests), "base_requests"sv, move(routing_settings)));
+        transport::TransportCatalogue trans_cat;
+        transport::reader::JSONReader jsr(input, trans_cat);
+        jsr.ProcessDeserialize();
+        jsr.ProcessDeltaRequests();
+        jsr.ProcessSerialize();
+    }
+
+    string ProcessRequests(const transport::BaseSnapshot& snapshot, json::Array stat_requests)
+    {
+        istringstream input(ToString(json::Dict{{"stat_requests"s, move(stat_requests)}}));
+        transport::TransportCatalogue unused;
+        transport::reader::JSONReader jsr(input, unused);
+        return ToString(jsr.ProcessGetInfoRequests(snapshot).GetRoot());
+    }
+
+    // Остановки S0..S(count - 1), по 500 метров между соседними
+    json::Array MakeStops(int count)
+    {
+        json::Array result;
+        for (int i = 0; i < count; ++i)
+        {
+            json::Dict distances;
+            if (i + 1 < count)
+                distances["S"s + to_string(i + 1)] = 500;
+            result.push_back(json::Dict{{"type"s, "Stop"s}, {"name"s, "S"s + to_string(i)},
+                                        {"latitude"s, 55.0 + i * 0.004}, {"longitude"s, 37.0},
+                                        {"road_distances"s, move(distances)}});
+        }
+        return result;
+    }
+
+    json::Dict MakeBus(const string& name, vector<string> stops, bool is_roundtrip = false)
+    {
+        json::Array stop_list(stops.begin(), stops.end());
+        return json::Dict{{"type"s, "Bus"s}, {"name"s, name}, {"stops"s, move(stop_list)}, {"is_roundtrip"s, is_roundtrip}};
+    }
+
+    // Остановки S0..S(count - 1) на сетке 4 x N с шагом около километра и случайными (но воспроизводимыми)
+    // расстояниями между каждой парой остановок, чтобы равные по времени маршруты были редкостью.
+    json::Array MakeRandomStops(int count, unsigned seed)
+    {
+        mt19937 generator(seed);
+        json::Array result;
+        for (int i = 0; i < count; ++i)
+        {
+            json::Dict distances;
+            for (int j = i + 1; j < count; ++j)
+                distances["S"s + to_string(j)] = static_cast<int>(700 + generator() % 2000);
+            result.push_back(json::Dict{{"type"s, "Stop"s}, {"name"s, "S"s + to_string(i)},
+                                        {"latitude"s, 55.0 + (i % 4) * 0.01}, {"longitude"s, 37.0 + (i / 4) * 0.015},
+                                        {"road_distances"s, move(distances)}});
+        }
+        return result;
+    }
+
+    // Запросы "Route" между всеми парами из count остановок S0..S(count - 1)
+    json::Array MakeAllRouteRequests(int count)
+    {
+        json::Array result;
+        for (int from = 0; from < count; ++from)
+            for (int to = 0; to < count; ++to)
+                result.push_back(json::Dict{{"id"s, from * count + to}, {"type"s, "Route"s},
+                                            {"from"s, "S"s + to_string(from)}, {"to"s, "S"s + to_string(to)}});
+        return result;
+    }
+
+    // Времена поездок из ответов на запросы "Route" (-1 - маршрут не найден)
+    vector<double> GetRouteTimes(const string& answer)
+    {
+        istringstream input(answer);
+        vector<double> result;
+        const json::Document answer_document = json::Load(input);
+        for (const json::Node& node : answer_document.GetRoot().AsArray())
+            result.push_back(node.AsDict().count("total_time"s) ? node.AsDict().at("total_time"s).AsDouble() : -1.0);
+        return result;
+    }
+
+    bool IsSameRouteTimes(const vector<double>& lhs, const vector<double>& rhs)
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+        for (size_t i = 0; i < lhs.size(); ++i)
+            if (abs(lhs[i] - rhs[i]) > 1e-6 * max(1.0, abs(rhs[i])))
+                return false;
+        return true;
+    }
+
+    // Пакетные расчёты расстояний (попарный и по ломаной) совпадают с эталонной функцией ComputeDistance
+    // в пределах DISTANCE_TOLERANCE - и для случайных точек, и для почти совпадающих. Длины пакетов
+    // перебираются от 0 до 13, так что векторные циклы (по 2 и по 4 пары) заканчиваются остатком любой длины.
+    void TestDistanceBatches()
+    {
+        mt19937 generator(26);
+        uniform_real_distribution<double> lat_distribution(-80.0, 80.0), lng_distribution(-180.0, 180.0);
+        uniform_real_distribution<double> shift_distribution(-1e-7, 1e-7);
+        for (const bool is_near : {false, true})
+            for (size_t count = 0; count <= 13; ++count)
+            {
+                vector<detail::Coordinates> points;
+                detail::CoordinatesBatch from, to, chain;
+                for (size_t i = 0; i <= count; ++i)
+                {
+                    detail::Coordinates point{lat_distribution(generator), lng_distribution(generator)};
+                    if (is_near && !points.empty())
+                        point = {points.back().lat + shift_distribution(generator),
+                                 points.back().lng + shift_distribution(generator)};
+                    points.push_back(point);
+                    chain.push_back(detail::ComputeCoordinatesTrig(point));
+                }
+                for (size_t i = 0; i < count; ++i)
+                {
+                    from.push_back(detail::ComputeCoordinatesTrig(points[i]));
+                    to.push_back(detail::ComputeCoordinatesTrig(points[i + 1]));
+                }
+                vector<double> pair_distances(count), chain_distances(count);
+                detail::ComputeDistances(from, to, pair_distances.data());
+                detail::ComputeChainDistances(chain, chain_distances.data());
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const double expected = detail::ComputeDistance(points[i], points[i + 1]);
+                    CHECK(abs(pair_distances[i] - expected) <= detail::DISTANCE_TOLERANCE);
+                    CHECK(abs(chain_distances[i] - expected) <= detail::DISTANCE_TOLERANCE);
+                }
+            }
+    }
+
+    // Данные для проверок кодека: повторяющийся текст с вкраплениями, случайные байты и их смесь
+    vector<string> MakeCompressionSamples()
+    {
+        mt19937 generator(34);
+        string text, noise, mixed;
+        for (int i = 0; i < 3000; ++i)
+            text += "Stop "s + to_string(i % 97) + ": road_distances "s + to_string(generator() % 1000) + "\n"s;
+        for (int i = 0; i < 5000; ++i)
+            noise += static_cast<char>(generator());
+        mixed = text.substr(0, 20000) + noise + text.substr(20000, 20000) + string(3000, 'x');
+        return {""s, "a"s, "abcabcabcabcabcabcabcabc"s, text, noise, mixed};
+    }
+
+    template <typename Func>
+    bool IsCompressionErrorThrown(Func func)
+    {
+        try
+        {
+            func();
+        }
+        catch (const compression::CompressionError&)
+        {
+            return true;
+        }
+        return false;
+    }
+
+    // Блоки и контейнеры (из нескольких фрагментов, в один и в несколько потоков) распаковываются в исходные
+    // данные; усечённые и повреждённые данные дают CompressionError, а не порчу памяти или другие исключения.
+    void TestCompression()
+    {
+        const vector<string> samples = MakeCompressionSamples();
+        for (const string& sample : samples)
+        {
+            const string block = compression::CompressBlock(sample);
+            string restored(sample.size(), '\0');
+            compression::DecompressBlock(block, restored.data(), restored.size());
+            CHECK(restored == sample);
+            for (const unsigned thread_count : {1u, 3u})
+            {
+                const string container = compression::PackContainer(sample, 4096, thread_count);
+                CHECK(compression::IsContainer(container));
+                CHECK(compression::UnpackContainer(container, thread_count) == sample);
+            }
+        }
+        const string& text = samples[3];
+        CHECK(compression::CompressBlock(text).size() < text.size() / 2);
+
+        // Любое усечение блока или контейнера обнаруживается.
+        const string block = compression::CompressBlock(samples[5]);
+        const string container = compression::PackContainer(samples[5], 4096, 1);
+        string restored(samples[5].size(), '\0');
+        for (size_t size = 0; size < block.size(); size += 1 + size / 64)
+            CHECK(IsCompressionErrorThrown([&]() {compression::DecompressBlock(string_view(block).substr(0, size),
+                                                                               restored.data(), restored.size());}));
+        for (size_t size = 0; size < container.size(); size += 1 + size / 64)
+            CHECK(IsCompressionErrorThrown([&]() {compression::UnpackContainer(string_view(container).substr(0, size), 1);}));
+
+        // Явные повреждения: сигнатура, заголовок, неверный исходный размер, совпадение вне распакованных данных.
+        string bad_magic = container;
+        bad_magic[0] = 'X';
+        CHECK(IsCompressionErrorThrown([&]() {compression::UnpackContainer(bad_magic, 1);}));
+        string bad_header = container;
+        bad_header[compression::CONTAINER_MAGIC.size() + 5] ^= 0x40; // Исходный размер не согласован с числом фрагментов
+        CHECK(IsCompressionErrorThrown([&]() {compression::UnpackContainer(bad_header, 1);}));
+        CHECK(IsCompressionErrorThrown([&]() {compression::DecompressBlock(block, restored.data(), restored.size() - 1);}));
+        const string bad_offset("\x00\x05\x00"s); // Совпадение со смещением 5 в начале блока
+        CHECK(IsCompressionErrorThrown([&]() {compression::DecompressBlock(bad_offset, restored.data(), restored.size());}));
+
+        // Случайные повреждения байтов: либо ошибка распаковки, либо данные исходного размера.
+        mt19937 generator(340);
+        for (int i = 0; i < 2000; ++i)
+        {
+            string damaged = container;
+            damaged[generator() % damaged.size()] ^= static_cast<char>(1 + generator() % 255);
+            try
+            {
+                CHECK(compression::UnpackContainer(damaged, 1).size() == samples[5].size());
+            }
+            catch (const compression::CompressionError&)
+            {
+            }
+        }
+    }
+
+    // Читающие потоки исполняют запросы по текущему снимку, пока хранилище поочерёдно загружает две
+    // разные базы. Каждый ответ должен целиком совпадать с ответом по одной из баз.
+    void TestSnapshotReload()
+    {
+        json::Array requests_a = MakeStops(6), requests_b = MakeStops(6);
+        requests_a.push_back(MakeBus("1"s, {"S0"s, "S1"s, "S2"s, "S3"s, "S4"s, "S5"s}));
+        requests_b.push_back(MakeBus("2"s, {"S0"s, "S2"s, "S4"s}));
+        requests_b.push_back(MakeBus("3"s, {"S4"s, "S5"s}));
+        MakeBase("snapshot_a.db"s, move(requests_a));
+        MakeBase("snapshot_b.db"s, move(requests_b));
+        serial::SerializationContext context_a, context_b;
+        context_a.input_file = "snapshot_a.db"s;
+        context_b.input_file = "snapshot_b.db"s;
+
+        const json::Array stat_requests{
+            json::Dict{{"id"s, 1}, {"type"s, "Route"s}, {"from"s, "S0"s}, {"to"s, "S5"s}},
+            json::Dict{{"id"s, 2}, {"type"s, "Route"s}, {"from"s, "S1"s}, {"to"s, "S4"s}},
+            json::Dict{{"id"s, 3}, {"type"s, "Stop"s}, {"name"s, "S2"s}}};
+        const string expected_a = ProcessRequests(*transport::LoadBaseSnapshot(context_a), stat_requests);
+        const string expected_b = ProcessRequests(*transport::LoadBaseSnapshot(context_b), stat_requests);
+        CHECK(expected_a != expected_b);
+
+        transport::SnapshotHolder holder(transport::LoadBaseSnapshot(context_a));
+        atomic<bool> stop{false};
+        atomic<int> bad_answers{0}, answers_b{0};
+        vector<thread> readers;
+        for (int i = 0; i < 4; ++i)
+            readers.emplace_back([&]()
+            {
+                transport::SnapshotReader reader(holder);
+                while (!stop)
+                {
+                    const string answer = ProcessRequests(reader.Get(), stat_requests);
+                    if (answer == expected_b)
+                        ++answers_b;
+                    else if (answer != expected_a)
+                        ++bad_answers;
+                }
+            });
+        const uint64_t start_version = holder.GetVersion();
+        for (int i = 0; i < 10; ++i)
+            holder.ReloadAsync(i % 2 ? context_a : context_b).get();
+        // Последней публикуется база B, и после паузы читатели работают уже только с ней.
+        holder.ReloadAsync(context_b).get();
+        this_thread::sleep_for(50ms);
+        stop = true;
+        for (thread& reader : readers)
+            reader.join();
+        CHECK(bad_answers == 0);
+        CHECK(answers_b > 0);
+        CHECK(holder.GetVersion() == start_version + 11);
+        CHECK(ProcessRequests(*holder.Acquire(), stat_requests) == expected_b);
+
+        // Ошибка загрузки передаётся через future, а текущий снимок не меняется.
+        serial::SerializationContext context_missing;
+        context_missing.input_file = "snapshot_missing.db"s;
+        bool is_thrown = false;
+        try
+        {
+            holder.ReloadAsync(context_missing).get();
+        }
+        catch (const exception&)
+        {
+            is_thrown = true;
+        }
+        CHECK(is_thrown);
+        CHECK(holder.GetVersion() == start_version + 11);
+
+        // Хранилище, уничтоженное до окончания загрузки, дожидается в деструкторе публикации снимка,
+        // и загрузка завершается без обращения к уже освобождённому хранилищу.
+        future<void> pending_reload;
+        {
+            transport::SnapshotHolder short_lived_holder(transport::LoadBaseSnapshot(context_a));
+            pending_reload = short_lived_holder.ReloadAsync(context_b);
+        }
+        pending_reload.get();
+
+        filesystem::remove("snapshot_a.db"s);
+        filesystem::remove("snapshot_b.db"s);
+    }
+
+    // Автобус 1 идёт S0 - S1 - S2, автобус 2 - S1 - S2 - S3. Из S0 в S3 можно пересесть с первого на второй
+    // как на S1, так и на S2: последовательность автобусов одна, но маршруты для пассажира разные, и оба
+    // должны попасть в ответ.
+    void TestAlternativeRoutes()
+    {
+        json::Array base_requests = MakeStops(4);
+        base_requests.push_back(MakeBus("1"s, {"S0"s, "S1"s, "S2"s}));
+        base_requests.push_back(MakeBus("2"s, {"S1"s, "S2"s, "S3"s}));
+        MakeBase("alternatives.db"s, move(base_requests));
+        serial::SerializationContext context;
+        context.input_file = "alternatives.db"s;
+
+        const json::Array stat_requests{json::Dict{{"id"s, 1}, {"type"s, "Route"s}, {"from"s, "S0"s},
+                                                   {"to"s, "S3"s}, {"alternatives"s, 3}}};
+        istringstream answer_input(ProcessRequests(*transport::LoadBaseSnapshot(context), stat_requests));
+        const json::Node answer = json::Load(answer_input).GetRoot();
+        const json::Dict& route = answer.AsArray().at(0).AsDict();
+        // Остановка пересадки - остановка ожидания автобуса 2
+        auto transfer_stop = [](const json::Dict& route)
+        {
+            const json::Array& items = route.at("items"s).AsArray();
+            CHECK(items.size() == 4);
+            CHECK(items[1].AsDict().at("bus"s).AsString() == "1"s);
+            CHECK(items[3].AsDict().at("bus"s).AsString() == "2"s);
+            return items[2].AsDict().at("stop_name"s).AsString();
+        };
+        const json::Array& alternatives = route.at("alternatives"s).AsArray();
+        CHECK(alternatives.size() == 1);
+        const string main_transfer = transfer_stop(route);
+        const string alternative_transfer = transfer_stop(alternatives[0].AsDict());
+        CHECK(main_transfer != alternative_transfer);
+        CHECK(main_transfer == "S1"s || main_transfer == "S2"s);
+        CHECK(alternative_transfer == "S1"s || alternative_transfer == "S2"s);
+
+        filesystem::remove("alternatives.db"s);
+    }
+
+    // Переписывает несжатую базу в формат третьей версии, в описателях поездных рёбер которого нет позиций
+    // остановок, и заодно нумерует рёбра графа в обратном порядке, как если бы база была построена прежней
+    // версией программы. При is_weight_changed вес одного поездного ребра удваивается - такое ребро не
+    // сопоставить ни с одним ребром, построенным по справочнику.
+    void MakeOldFormatBase(const string& base_file, bool is_weight_changed)
+    {
+        ifstream input(base_file, ios::binary);
+        const string data{istreambuf_iterator<char>(input), istreambuf_iterator<char>()};
+        input.close();
+        CHECK(data.substr(0, 4) == "TCSB"s);
+        size_t index_size = 0;
+        for (int i = 0; i < 4; ++i)
+            index_size |= static_cast<size_t>(static_cast<unsigned char>(data[4 + i])) << (8 * i);
+        TransCatSerial::BaseIndex pb_index;
+        CHECK(pb_index.ParseFromString(data.substr(8, index_size)));
+        pb_index.set_format_version(3);
+        string sections_data;
+        for (TransCatSerial::BaseSection& pb_section_entry : *pb_index.mutable_sections())
+        {
+            CHECK(!pb_section_entry.compressed());
+            TransCatSerial::TransportCatalogue pb_section;
+            CHECK(pb_section.ParseFromString(data.substr(8 + index_size + pb_section_entry.offset(), pb_section_entry.size())));
+            pb_section.set_format_version(3);
+            const uint32_t edge_count = pb_section.edges().edges_size();
+            for (TransCatSerial::EdgeToDesc& pb_edge_to_desc : *pb_section.mutable_edge_to_desc()->mutable_edge_to_desc())
+            {
+                pb_edge_to_desc.set_edge_id(edge_count - 1 - pb_edge_to_desc.edge_id());
+                pb_edge_to_desc.mutable_edge_descriptor()->clear_from_position();
+                pb_edge_to_desc.mutable_edge_descriptor()->clear_is_backward();
+            }
+            auto& pb_edges = *pb_section.mutable_edges()->mutable_edges();
+            reverse(pb_edges.begin(), pb_edges.end());
+            for (TransCatSerial::IncidenceList& pb_incidence_list : *pb_section.mutable_incidence_lists()->mutable_incidence_list())
+                for (uint32_t& edge_id : *pb_incidence_list.mutable_edge_id())
+                    edge_id = edge_count - 1 - edge_id;
+            if (is_weight_changed)
+                for (const TransCatSerial::EdgeToDesc& pb_edge_to_desc : pb_section.edge_to_desc().edge_to_desc())
+                    if (pb_edge_to_desc.edge_descriptor().edge_type() == TransCatSerial::EdgeDescriptor::EDGE_STAGE)
+                    {
+                        TransCatSerial::Edge& pb_edge = pb_edges[pb_edge_to_desc.edge_id()];
+                        pb_edge.set_weight(pb_edge.weight() * 2);
+                        break;
+                    }
+            string section_data;
+            pb_section.SerializeToString(&section_data);
+            pb_section_entry.set_offset(sections_data.size());
+            pb_section_entry.set_size(section_data.size());
+            sections_data += section_data;
+        }
+        string index_data;
+        pb_index.SerializeToString(&index_data);
+        ofstream output(base_file, ios::binary);
+        output << "TCSB"s;
+        for (int i = 0; i < 4; ++i)
+            output.put(static_cast<char>((index_data.size() >> (8 * i)) & 0xFF));
+        output << index_data << sections_data;
+    }
+
+    // Новые общие скорость и время ожидания из файла правок применяются к базе без правок справочника
+    // пересчётом весов рёбер. Ответы по правленой базе должны совпадать с ответами по базе, сразу созданной
+    // с новыми параметрами, а заданные в справочнике скорость маршрута и время ожидания - сохраниться.
+    void TestRoutingSettingsDelta()
+    {
+        json::Array base_requests = MakeStops(6);
+        json::Dict slow_stop = base_requests[3].AsDict();
+        slow_stop["wait_time"s] = 5;
+        base_requests[3] = move(slow_stop);
+        base_requests.push_back(MakeBus("1"s, {"S0"s, "S1"s, "S2"s, "S3"s}));
+        base_requests.push_back(MakeBus("2"s, {"S3"s, "S4"s, "S5"s}));
+        json::Dict fast_bus = MakeBus("3"s, {"S0"s, "S2"s, "S4"s});
+        fast_bus["velocity"s] = 45;
+        base_requests.push_back(move(fast_bus));
+        const json::Array stat_requests{
+            json::Dict{{"id"s, 1}, {"type"s, "Route"s}, {"from"s, "S0"s}, {"to"s, "S5"s}},
+            json::Dict{{"id"s, 2}, {"type"s, "Route"s}, {"from"s, "S1"s}, {"to"s, "S4"s}, {"alternatives"s, 2}},
+            json::Dict{{"id"s, 3}, {"type"s, "Route"s}, {"from"s, "S5"s}, {"to"s, "S0"s}}};
+        serial::SerializationContext context;
+        context.input_file = "routing_delta.db"s;
+
+        for (const string& routing_algorithm : {"matrix"s, "dijkstra"s, "astar"s, "contraction_hierarchy"s, "hub_labels"s})
+        {
+            MakeBase("routing_delta.db"s, base_requests, MakeRoutingSettings(6, 60, routing_algorithm));
+            const string expected = ProcessRequests(*transport::LoadBaseSnapshot(context), stat_requests);
+            MakeBase("routing_delta.db"s, base_requests, MakeRoutingSettings(2, 20, routing_algorithm));
+            const string original = ProcessRequests(*transport::LoadBaseSnapshot(context), stat_requests);
+            CHECK(original != expected);
+
+            MakeDelta("routing_delta.db"s, {}, MakeRoutingSettings(6, 60, routing_algorithm));
+            CHECK(ProcessRequests(*transport::LoadBaseSnapshot(context), stat_requests) == expected);
+            MakeDelta("routing_delta.db"s, {}, MakeRoutingSettings(2, 20, routing_algorithm));
+            CHECK(ProcessRequests(*transport::LoadBaseSnapshot(context), stat_requests) == original);
+        }
+
+        filesystem::remove("routing_delta.db"s);
+    }
+
+    // Сеть для сравнения способов поиска: 16 остановок со случайными расстояниями, кольцевые и обычные
+    // маршруты, пересадки; остановка S15 не обслуживается ни одним маршрутом.
+    json::Array MakeRoutingNetwork()
+    {
+        json::Array result = MakeRandomStops(16, 42);
+        result.push_back(MakeBus("1"s, {"S0"s, "S1"s, "S2"s, "S3"s, "S7"s, "S11"s}));
+        result.push_back(MakeBus("2"s, {"S4"s, "S5"s, "S6"s, "S7"s, "S4"s}, true));
+        result.push_back(MakeBus("3"s, {"S8"s, "S9"s, "S10"s, "S11"s, "S14"s}));
+        result.push_back(MakeBus("4"s, {"S0"s, "S4"s, "S8"s, "S12"s}));
+        result.push_back(MakeBus("5"s, {"S13"s, "S9"s, "S5"s, "S1"s, "S13"s}, true));
+        result.push_back(MakeBus("6"s, {"S2"s, "S6"s, "S10"s, "S14"s, "S12"s}));
+        return result;
+    }
+
+    // Времена поездок из ответа на запрос "Matrix" (-1 - маршрута нет), построчно
+    vector<double> GetMatrixTimes(const string& answer)
+    {
+        istringstream input(answer);
+        const json::Document answer_document = json::Load(input);
+        vector<double> result;
+        for (const json::Node& row : answer_document.GetRoot().AsArray().at(0).AsDict().at("total_times"s).AsArray())
+            for (const json::Node& travel_time : row.AsArray())
+                result.push_back(travel_time.IsNull() ? -1.0 : travel_time.AsDouble());
+        return result;
+    }
+
+    // Каждый способ поиска маршрутов даёт те же времена поездок между всеми парами остановок, что и
+    // поиск Дейкстры по запросу (сами маршруты из равных по времени могут различаться), - и в ответах
+    // на запросы "Route", и в матрице времён "Matrix".
+    void TestRoutingAlgorithms()
+    {
+        const json::Array base_requests = MakeRoutingNetwork();
+        const json::Array stat_requests = MakeAllRouteRequests(16);
+        json::Array all_stops;
+        for (int i = 0; i < 16; ++i)
+            all_stops.push_back("S"s + to_string(i));
+        const json::Array matrix_requests{json::Dict{{"id"s, 1}, {"type"s, "Matrix"s}, {"sources"s, all_stops},
+                                                     {"targets"s, all_stops}}};
+        serial::SerializationContext context;
+        context.input_file = "routing_algorithms.db"s;
+        MakeBase("routing_algorithms.db"s, base_requests, MakeRoutingSettings(3, 35, "dijkstra"s));
+        const vector<double> expected = GetRouteTimes(ProcessRequests(*transport::LoadBaseSnapshot(context), stat_requests));
+        CHECK(count(expected.begin(), expected.end(), -1.0) == 30); // S15 недостижима, кроме как из самой себя
+
+        for (const string& routing_algorithm : {"dijkstra"s, "matrix"s, "bidirectional"s, "astar"s,
+                                                "contraction_hierarchy"s, "hub_labels"s})
+        {
+            MakeBase("routing_algorithms.db"s, base_requests, MakeRoutingSettings(3, 35, routing_algorithm));
+            const auto snapshot = transport::LoadBaseSnapshot(context);
+            CHECK(IsSameRouteTimes(GetRouteTimes(ProcessRequests(*snapshot, stat_requests)), expected));
+            CHECK(IsSameRouteTimes(GetMatrixTimes(ProcessRequests(*snapshot, matrix_requests)), expected));
+        }
+
+        filesystem::remove("routing_algorithms.db"s);
+    }
+
+    // Краткая запись ответа на запрос "Route": время поездки, время прибытия (если есть) и элементы
+    // маршрута, например "6 486 | W S0 0 | B 1 2 2" (ожидание: остановка и время; поездка: автобус, число
+    // пролётов и время).
+    string DescribeRoute(const json::Node& answer)
+    {
+        const json::Dict& route = answer.AsDict();
+        if (route.count("error_message"s))
+            return route.at("error_message"s).AsString();
+        ostringstream result;
+        result << route.at("total_time"s).AsDouble();
+        if (route.count("arrival_time"s))
+            result << ' ' << route.at("arrival_time"s).AsDouble();
+        for (const json::Node& item_node : route.at("items"s).AsArray())
+        {
+            const json::Dict& item = item_node.AsDict();
+            if (item.at("type"s).AsString() == "Wait"s)
+                result << " | W "s << item.at("stop_name"s).AsString() << ' ' << item.at("time"s).AsDouble();
+            else
+                result << " | B "s << item.at("bus"s).AsString() << ' ' << item.at("span_count"s).AsInt() << ' '
+                       << item.at("time"s).AsDouble();
+        }
+        return result.str();
+    }
+
+    // Поиск по расписаниям на сети, рассчитанной вручную: пролёт между соседними остановками - 500 м, то есть
+    // ровно минута при 30 км/ч. Автобус 1 (S0 - S2) отправляется в 480 и 490, автобус 2 (S2 - S5) - в 481,
+    // 483 и 500. С рейса автобуса 1 в 480 пассажир приходит на S2 в 482: рейс 481 уже ушёл, и пересадка
+    // идёт на рейс 483. Выйдя на минуту позже, в 481, пассажир опаздывает на рейс 480 автобуса 1, а тогда
+    // и на рейс 483 автобуса 2. Рейс автобуса 1 проходит S1 через минуту после отправления, а обратный рейс
+    // отправляется с S2 по тому же расписанию. После последнего рейса маршрута нет.
+    void TestTimetableRoute()
+    {
+        json::Array base_requests = MakeStops(6);
+        json::Dict first_bus = MakeBus("1"s, {"S0"s, "S1"s, "S2"s});
+        first_bus["departures"s] = json::Array{480, 490};
+        base_requests.push_back(move(first_bus));
+        json::Dict second_bus = MakeBus("2"s, {"S2"s, "S3"s, "S4"s, "S5"s});
+        second_bus["departures"s] = json::Array{481, 483, 500};
+        base_requests.push_back(move(second_bus));
+        MakeBase("timetable.db"s, move(base_requests), MakeRoutingSettings(2, 30));
+        serial::SerializationContext context;
+        context.input_file = "timetable.db"s;
+
+        auto route_request = [](int id, const string& from, const string& to, double departure_time)
+        {
+            return json::Dict{{"id"s, id}, {"type"s, "Route"s}, {"from"s, from}, {"to"s, to},
+                              {"departure_time"s, departure_time}};
+        };
+        const json::Array stat_requests{route_request(1, "S0"s, "S5"s, 480), route_request(2, "S0"s, "S5"s, 481),
+                                        route_request(3, "S1"s, "S4"s, 470), route_request(4, "S2"s, "S0"s, 485),
+                                        route_request(5, "S0"s, "S5"s, 491)};
+        istringstream answer_input(ProcessRequests(*transport::LoadBaseSnapshot(context), stat_requests));
+        const json::Document answer = json::Load(answer_input);
+        const json::Array& routes = answer.GetRoot().AsArray();
+        CHECK(routes.size() == 5);
+        CHECK(DescribeRoute(routes[0]) == "6 486 | W S0 0 | B 1 2 2 | W S2 1 | B 2 3 3"s);
+        CHECK(DescribeRoute(routes[1]) == "22 503 | W S0 9 | B 1 2 2 | W S2 8 | B 2 3 3"s);
+        CHECK(DescribeRoute(routes[2]) == "15 485 | W S1 11 | B 1 1 1 | W S2 1 | B 2 2 2"s);
+        CHECK(DescribeRoute(routes[3]) == "7 492 | W S2 5 | B 1 2 2"s);
+        CHECK(DescribeRoute(routes[4]) == "not found"s);
+
+        filesystem::remove("timetable.db"s);
+    }
+
+    // Правка настроек маршрутизации в базе третьей версии формата с другой нумерацией рёбер: позиции
+    // остановок поездных рёбер восстанавливаются по маршруту, остановкам и весу ребра, а если ребро
+    // сопоставить не удалось, маршрутизатор строится заново. Расстояния между остановками различны, так что
+    // неверная позиция меняет вес ребра. Из равных по времени маршрутов при другой нумерации рёбер может
+    // найтись другой, поэтому сравниваются времена поездок.
+    void TestOldBaseRoutingSettingsDelta()
+    {
+        const json::Array base_requests = MakeRoutingNetwork();
+        const json::Array stat_requests = MakeAllRouteRequests(16);
+        serial::SerializationContext context;
+        context.input_file = "old_routing_delta.db"s;
+        MakeBase("old_routing_delta.db"s, base_requests, MakeRoutingSettings(3, 25, "dijkstra"s));
+        const vector<double> expected = GetRouteTimes(ProcessRequests(*transport::LoadBaseSnapshot(context), stat_requests));
+
+        for (const bool is_weight_changed : {false, true})
+        {
+            MakeBase("old_routing_delta.db"s, base_requests, MakeRoutingSettings(6, 40, "dijkstra"s));
+            const vector<double> original = GetRouteTimes(ProcessRequests(*transport::LoadBaseSnapshot(context), stat_requests));
+            CHECK(!IsSameRouteTimes(original, expected));
+            MakeOldFormatBase("old_routing_delta.db"s, is_weight_changed);
+            if (!is_weight_changed)
+                CHECK(IsSameRouteTimes(GetRouteTimes(ProcessRequests(*transport::LoadBaseSnapshot(context), stat_requests)),
+                                       original));
+            MakeDelta("old_routing_delta.db"s, {}, MakeRoutingSettings(3, 25, "dijkstra"s));
+            CHECK(IsSameRouteTimes(GetRouteTimes(ProcessRequests(*transport::LoadBaseSnapshot(context), stat_requests)),
+                                   expected));
+        }
+
+        filesystem::remove("old_routing_delta.db"s);
+    }
+
+    // Правка базы с маршрутной матрицей (замена и удаление маршрутов, изменение расстояния, новые остановка
+    // и маршрут) пересчитывает матрицу по прежней. Времена всех маршрутов и ответы "Bus" должны совпадать
+    // с полученными по базе, сразу созданной с правками.
+    void TestDeltaMatrixRepair()
+    {
+        json::Array base_requests = MakeRandomStops(10, 36);
+        base_requests.push_back(MakeBus("1"s, {"S0"s, "S1"s, "S2"s, "S3"s, "S4"s}));
+        base_requests.push_back(MakeBus("2"s, {"S5"s, "S6"s, "S7"s, "S8"s, "S9"s, "S5"s}, true));
+        base_requests.push_back(MakeBus("3"s, {"S0"s, "S5"s, "S2"s, "S7"s}));
+        base_requests.push_back(MakeBus("4"s, {"S3"s, "S8"s, "S4"s, "S9"s}));
+        MakeBase("delta_repair.db"s, base_requests);
+
+        json::Dict new_stop{{"type"s, "Stop"s}, {"name"s, "S10"s}, {"latitude"s, 55.035}, {"longitude"s, 37.07},
+                            {"road_distances"s, json::Dict{{"S4"s, 900}, {"S1"s, 2500}}}};
+        json::Dict changed_stop = base_requests[1].AsDict();
+        changed_stop["road_distances"s] = json::Dict{{"S2"s, 150}};
+        const json::Array delta_requests{
+            MakeBus("3"s, {"S0"s, "S6"s, "S2"s, "S8"s}),
+            json::Dict{{"type"s, "Bus"s}, {"name"s, "4"s}, {"removed"s, true}},
+            changed_stop,
+            new_stop,
+            MakeBus("5"s, {"S10"s, "S4"s, "S1"s})};
+        MakeDelta("delta_repair.db"s, delta_requests, MakeRoutingSettings(2, 30));
+
+        // Та же сеть, описанная целиком
+        json::Array full_requests(base_requests.begin(), base_requests.begin() + 10);
+        json::Dict full_changed_stop = full_requests[1].AsDict();
+        json::Dict full_distances = full_changed_stop.at("road_distances"s).AsDict();
+        full_distances["S2"s] = 150;
+        full_changed_stop["road_distances"s] = move(full_distances);
+        full_requests[1] = move(full_changed_stop);
+        full_requests.push_back(new_stop);
+        full_requests.push_back(base_requests[10]);
+        full_requests.push_back(base_requests[11]);
+        full_requests.push_back(MakeBus("3"s, {"S0"s, "S6"s, "S2"s, "S8"s}));
+        full_requests.push_back(MakeBus("5"s, {"S10"s, "S4"s, "S1"s}));
+        MakeBase("delta_full.db"s, full_requests);
+
+        json::Array stat_requests = MakeAllRouteRequests(11);
+        for (const string& bus_name : {"1"s, "2"s, "3"s, "4"s, "5"s})
+            stat_requests.push_back(json::Dict{{"id"s, 1000}, {"type"s, "Bus"s}, {"name"s, bus_name}});
+        serial::SerializationContext delta_context, full_context;
+        delta_context.input_file = "delta_repair.db"s;
+        full_context.input_file = "delta_full.db"s;
+        const string delta_answer = ProcessRequests(*transport::LoadBaseSnapshot(delta_context), stat_requests);
+        const string full_answer = ProcessRequests(*transport::LoadBaseSnapshot(full_context), stat_requests);
+        const vector<double> delta_times = GetRouteTimes(delta_answer), full_times = GetRouteTimes(full_answer);
+        CHECK(IsSameRouteTimes(delta_times, full_times));
+        // Правки меняют времена поездок, а маршрут "4" удалён.
+        MakeBase("delta_repair.db"s, base_requests);
+        CHECK(!IsSameRouteTimes(GetRouteTimes(ProcessRequests(*transport::LoadBaseSnapshot(delta_context), stat_requests)),
+                                full_times));
+        istringstream delta_input(delta_answer), full_input(full_answer);
+        const json::Array delta_nodes = json::Load(delta_input).GetRoot().AsArray();
+        const json::Array full_nodes = json::Load(full_input).GetRoot().AsArray();
+        for (size_t i = 121; i < delta_nodes.size(); ++i)
+            CHECK(ToString(delta_nodes[i]) == ToString(full_nodes[i]));
+        CHECK(full_nodes[124].AsDict().count("error_message"s));
+
+        filesystem::remove("delta_repair.db"s);
+        filesystem::remove("delta_full.db"s);
+    }
+} // namespace tests
+
+int main()
+{
+    const vector<pair<string_view, void (*)()>> test_list{
+        {"TestDistanceBatches"sv, tests::TestDistanceBatches},
+        {"TestCompression"sv, tests::TestCompression},
+        {"TestSnapshotReload"sv, tests::TestSnapshotReload},
+        {"TestAlternativeRoutes"sv, tests::TestAlternativeRoutes},
+        {"TestRoutingAlgorithms"sv, tests::TestRoutingAlgorithms},
+        {"TestRoutingSettingsDelta"sv, tests::TestRoutingSettingsDelta},
+        {"TestOldBaseRoutingSettingsDelta"sv, tests::TestOldBaseRoutingSettingsDelta},
+        {"TestTimetableRoute"sv, tests::TestTimetableRoute},
+        {"TestDeltaMatrixRepair"sv, tests::TestDeltaMatrixRepair}};
+    int failed_count = 0;
+    for (const auto& [test_name, test_func] : test_list)
+    {
+        try
+        {
+            test_func();
+            cerr << test_name << " OK"sv << endl;
+        }
+        catch (const exception& exc)
+        {
+            cerr << test_name << " FAILED: "sv << exc.what() << endl;
+            ++failed_count;
+        }
+    }
+    return failed_count ? 1 : 0;
+}
@@ -3,12 +3,19 @@
 #include <optional>
 #include <variant>
 #include <unordered_map>
+#include <set>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
 
 #include "geo.h"
 #include "svg.h"
 #include "domain.h"
 #include "transport_router.h"
 #include "transport_catalogue.h"
+#include "stats.h"
+#include "parallel.h"
 
 using namespace transport;
 using namespace graph;
@@ -17,25 +24,65 @@ using namespace std;
 namespace router
 {
     BusRouter::BusRouter(const RouterContext& rc, const transport::TransportCatalogue& tc) :
-                         router_context_(rc), tc_(tc), catalogue_graph_(ConstructGraph()), router_(catalogue_graph_)
+                         router_context_(rc), tc_(tc), catalogue_graph_(ConstructGraph()),
+                         router_(catalogue_graph_, rc.route_search, MakeLowerBound()),
+                         timetable_router_(tc, weight_settings_.bus_velocities)
     {}
 
+    // Маршрутная матрица, иерархия сжатия и метки хабов восстанавливаются из базы, а маршрутизатору, ищущему
+    // маршруты по запросу, восстанавливать нечего.
+    BusRouter::BusRouter(const RouterContext& rc, const transport::TransportCatalogue& tc, RouterT::DeferredRoutes) :
+                         router_context_(rc), tc_(tc), catalogue_graph_(ConstructGraph()),
+                         router_(graph::IsPrecomputedRouteSearch(rc.route_search) ?
+                                 RouterT(catalogue_graph_, RouterT::DeferredRoutes{rc.route_search}) :
+                                 RouterT(catalogue_graph_, rc.route_search, MakeLowerBound())),
+                         timetable_router_(tc, weight_settings_.bus_velocities)
+    {}
+
+    BusRouter::BusRouter(const RouterContext& rc, const transport::TransportCatalogue& tc, const BusRouter& prev_router) :
+                         router_context_(rc), tc_(tc), catalogue_graph_(ConstructGraph()),
+                         router_(catalogue_graph_, prev_router.router_, MapPrevVertexes(prev_router)),
+                         timetable_router_(tc, weight_settings_.bus_velocities)
+    {}
+
+    vector<optional<VertexId>> BusRouter::MapPrevVertexes(const BusRouter& prev_router) const
+    { // Вершины прежнего и нового графов соответствуют друг другу, если относятся к одноимённым остановкам.
+        vector<optional<VertexId>> result(prev_router.catalogue_graph_.GetVertexCount());
+        for (const auto& [stop_name, prev_vertex] : prev_router.stop_name_to_enter_vertex_)
+            if (auto vertex_it = stop_name_to_enter_vertex_.find(stop_name); vertex_it != stop_name_to_enter_vertex_.end())
+                result[prev_vertex] = vertex_it->second;
+        for (const auto& [stop_name, prev_vertex] : prev_router.stop_name_to_exit_vertex_)
+            if (auto vertex_it = stop_name_to_exit_vertex_.find(stop_name); vertex_it != stop_name_to_exit_vertex_.end())
+                result[prev_vertex] = vertex_it->second;
+        return result;
+    }
+
     size_t BusRouter::RegisterVertexes()
     {
         // Вычисляем необходимое нам количество вершин строящегося графа,
         // одновременно регистрируем их в словарях stop_name_to_enter_vertex_
         // и stop_name_to_exit_vertex для дальнейшего использования при проведении
         // рёбер и построении маршрутов.
-        // Для этого перечисляем все имеющиеся остановки и заводим для каждой
-        // "перрон отправления" (вершину для исходящих рёбер) и "перрон прибытия"
-        // (вершину для входящих ребёр).
+        // Для этого перечисляем остановки и заводим для каждой "перрон отправления"
+        // (вершину для исходящих рёбер) и "перрон прибытия" (вершину для входящих ребёр).
+        // Остановкам, через которые не проходит ни один маршрут (в том числе болванкам),
+        // вершины не нужны: ни одно поездное ребро их не касается.
+        // Номера вершин остановок, кроме того, запоминаются в векторах, индексированных номерами
+        // остановок, - чтобы при проведении рёбер не искать их по именам.
+        const TCCommonMetric metric = tc_.GetCommonMetric();
+        stop_id_to_enter_vertex_.assign(metric.stops_count, NO_VERTEX);
+        stop_id_to_exit_vertex_.assign(metric.stops_count, NO_VERTEX);
         size_t vertex_counter = 0;
-        for (auto stop_it = tc_.stop_begin(); stop_it != tc_.stop_end(); ++stop_it)
+        for (uint32_t stop_id = 0; stop_id < metric.stops_count; ++stop_id)
         {
-            StopDescriptor stop_desc = *stop_it;
-            stop_name_to_enter_vertex_[stop_desc.stop_name] = vertex_counter;
+            if (!tc_.GetStopBusCount(stop_id))
+                continue;
+            const string& stop_name = tc_.GetStopName(stop_id);
+            stop_name_to_enter_vertex_[stop_name] = vertex_counter;
+            stop_id_to_enter_vertex_[stop_id] = vertex_counter;
             ++vertex_counter;
-            stop_name_to_exit_vertex_[stop_desc.stop_name] = vertex_counter;
+            stop_name_to_exit_vertex_[stop_name] = vertex_counter;
+            stop_id_to_exit_vertex_[stop_id] = vertex_counter;
             ++vertex_counter;
         }
         return vertex_counter;
@@ -43,91 +90,345 @@ namespace router
 
     void BusRouter::BuildTranferEdges(GraphT& result)
     { // Процедура создаёт пересадочные рёбра между "перроном отправления" и "перроном прибытия".
-        for (auto stop_it = tc_.stop_begin(); stop_it != tc_.stop_end(); ++stop_it)
+        for (uint32_t stop_id = 0; stop_id < stop_id_to_enter_vertex_.size(); ++stop_id)
         {
-            StopDescriptor stop_desc = *stop_it;
-            EdgeT edge_transfer{stop_name_to_enter_vertex_[stop_desc.stop_name],
-                                stop_name_to_exit_vertex_[stop_desc.stop_name], router_context_.bus_wait_time};
-            edge_to_desc_[result.AddEdge(edge_transfer)] =
-                {EdgeType::EDGE_TRANSFER, stop_desc.stop_name, ""s, ""s, 1, edge_transfer.weight};
+            if (stop_id_to_enter_vertex_[stop_id] == NO_VERTEX)
+                continue;
+            const EdgeDescriptor edge_desc{EdgeType::EDGE_TRANSFER, false, stop_id, stop_id, TransportCatalogue::NO_ID, 1, 0};
+            result.AddEdge({stop_id_to_enter_vertex_[stop_id], stop_id_to_exit_vertex_[stop_id], ComputeEdgeWeight(edge_desc)});
+            edge_to_desc_.push_back(edge_desc);
         }
     }
 
-    void BusRouter::BuildRideEdges(GraphT& result)
+    void BusRouter::BuildBusRideEdges(uint32_t bus_id, BusEdges& bus_edges) const
     { // Функция строит "поездные" рёбра, соответствующие каждому возможному отрезку пути
       // при поездке на конкретном автобусе. Эти отрезки попарно соединяют каждые две остановки,
-      // между которыми можно совершить поездку по маршруту.
-        for (const BusDescriptor bds : tc_)
+      // между которыми можно совершить поездку по маршруту. Функция только читает справочник
+      // и номера вершин остановок, поэтому может одновременно выполняться для разных маршрутов.
+      // Остановки и вершины берутся по номерам, без поиска по именам и копирования описания маршрута.
+        const TransportCatalogue::StopIdsRange bus_stop_ids = tc_.GetBusStopIds(bus_id);
+        const uint32_t* stop_ids = bus_stop_ids.begin();
+        const size_t stop_count = bus_stop_ids.end() - bus_stop_ids.begin();
+        if (stop_count < 2)
+            return;
+        // Веса рёбер рассчитываем по префиксным суммам расстояний маршрута - так же, как при их пересчёте в Reweight.
+        const BusType bus_type = tc_.GetBusType(bus_id);
+        const size_t edge_count = stop_count * (stop_count - 1) / 2 * (bus_type == BusType::BUSTYPE_ORDINAR ? 2 : 1);
+        bus_edges.edges.reserve(edge_count);
+        bus_edges.descs.reserve(edge_count);
+        for (size_t i = 0; i < stop_count - 1; ++i)
         {
-            if (bds.bus_stops.size() < 2)
-                continue;
-            for (size_t i = 0; i < bds.bus_stops.size() - 1; ++i)
+            for (size_t j = i + 1; j < stop_count; ++j)
             {
-                double i_j_distance = 0, j_i_distance = 0;
-                for (size_t j = i + 1; j < bds.bus_stops.size(); ++j)
-                {
-                    i_j_distance += tc_.CountNeighborsDistance(bds.bus_stops[j - 1], bds.bus_stops[j]).first;
-                    j_i_distance += tc_.CountNeighborsDistance(bds.bus_stops[j], bds.bus_stops[j - 1]).first;
-                    // Прокладывем ребро от остановки i к остановке j
-                    EdgeT edge_i_j{stop_name_to_exit_vertex_[bds.bus_stops[i]],
-                                   stop_name_to_enter_vertex_[bds.bus_stops[j]],
-                                   i_j_distance / (router_context_.bus_velocity * 1000.0 / 60.0)};
-                    edge_to_desc_[result.AddEdge(edge_i_j)] =
-                        {EdgeType::EDGE_STAGE, bds.bus_stops[i], bds.bus_stops[j], bds.bus_name,
-                        static_cast<int>(j - i), edge_i_j.weight};
-                    if (bds.bus_type == BusType::BUSTYPE_ORDINAR)
-                    { // Для обыкновенного, некольцевого, автобуса с двусторонним движением проведём также и обратное ребро, от j до i.
-                        EdgeT edge_j_i{stop_name_to_exit_vertex_[bds.bus_stops[j]],
-                                       stop_name_to_enter_vertex_[bds.bus_stops[i]],
-                                       j_i_distance / (router_context_.bus_velocity * 1000.0 / 60.0)};
-                        edge_to_desc_[result.AddEdge(edge_j_i)] =
-                            {EdgeType::EDGE_STAGE, bds.bus_stops[j], bds.bus_stops[i], bds.bus_name,
-                            static_cast<int>(j - i), edge_j_i.weight};
-                    }
+                // Прокладывем ребро от остановки i к остановке j
+                const EdgeDescriptor forward_desc{EdgeType::EDGE_STAGE, false, stop_ids[i], stop_ids[j], bus_id,
+                                                  static_cast<uint32_t>(j - i), static_cast<uint32_t>(i)};
+                bus_edges.edges.push_back({stop_id_to_exit_vertex_[stop_ids[i]], stop_id_to_enter_vertex_[stop_ids[j]],
+                                           ComputeEdgeWeight(forward_desc)});
+                bus_edges.descs.push_back(forward_desc);
+                if (bus_type == BusType::BUSTYPE_ORDINAR)
+                { // Для обыкновенного, некольцевого, автобуса с двусторонним движением проведём также и обратное ребро, от j до i.
+                    const EdgeDescriptor backward_desc{EdgeType::EDGE_STAGE, true, stop_ids[j], stop_ids[i], bus_id,
+                                                       static_cast<uint32_t>(j - i), static_cast<uint32_t>(j)};
+                    bus_edges.edges.push_back({stop_id_to_exit_vertex_[stop_ids[j]], stop_id_to_enter_vertex_[stop_ids[i]],
+                                               ComputeEdgeWeight(backward_desc)});
+                    bus_edges.descs.push_back(backward_desc);
                 }
             }
         }
     }
 
+    void BusRouter::BuildRideEdges(GraphT& result)
+    { // Рёбра маршрутов строятся параллельно, каждый маршрут - в свой буфер, а затем добавляются в граф
+      // в порядке номеров маршрутов. Поэтому номера рёбер, а значит и весь граф, не зависят от числа
+      // потоков и совпадают с получаемыми при последовательном построении.
+        const size_t bus_count = tc_.GetCommonMetric().buses_count;
+        vector<BusEdges> bus_edges(bus_count);
+        parallel::ParallelFor(bus_count, 0, [&](size_t bus_id)
+        {
+            BuildBusRideEdges(static_cast<uint32_t>(bus_id), bus_edges[bus_id]);
+        });
+
+        size_t edge_count = edge_to_desc_.size();
+        for (const BusEdges& cur_bus_edges : bus_edges)
+            edge_count += cur_bus_edges.edges.size();
+        edge_to_desc_.reserve(edge_count);
+        for (BusEdges& cur_bus_edges : bus_edges)
+        {
+            for (size_t i = 0; i < cur_bus_edges.edges.size(); ++i)
+            {
+                result.AddEdge(cur_bus_edges.edges[i]);
+                edge_to_desc_.push_back(cur_bus_edges.descs[i]);
+            }
+            cur_bus_edges = BusEdges{}; // Буфер маршрута больше не нужен
+        }
+    }
+
     BusRouter::GraphT BusRouter::ConstructGraph()
     {
+        stats::ScopedTimer timer("graph_construction"sv);
         stop_name_to_enter_vertex_.clear();
         stop_name_to_exit_vertex_.clear();
         // Создаём граф с нужным числом вершин и пока без рёбер.
         GraphT result(RegisterVertexes());
+        weight_settings_ = MakeWeightSettings();
         edge_to_desc_.clear();
         // Теперь займёмся прокладкой рёбер. Между каждой парой вершин, принадлежащих одной остановке,
         // проведём пересадочные рёбра.
         BuildTranferEdges(result);
         // Наконец, проводим, собственно, маршрутные рёбра.
         BuildRideEdges(result);
+        edge_to_desc_.shrink_to_fit();
+        IndexVertexes(result);
+        return result;
+    }
+
+    void BusRouter::RestoreStopVertexes()
+    { // Номера вершин по номерам остановок - по считанным из базы словарям вершин.
+        const TCCommonMetric metric = tc_.GetCommonMetric();
+        stop_id_to_enter_vertex_.assign(metric.stops_count, NO_VERTEX);
+        stop_id_to_exit_vertex_.assign(metric.stops_count, NO_VERTEX);
+        for (const auto& [stop_name, vertex] : stop_name_to_enter_vertex_)
+            stop_id_to_enter_vertex_[tc_.FindStopId(stop_name)] = vertex;
+        for (const auto& [stop_name, vertex] : stop_name_to_exit_vertex_)
+            stop_id_to_exit_vertex_[tc_.FindStopId(stop_name)] = vertex;
+    }
+
+    void BusRouter::IndexVertexes(const GraphT& graph)
+    { // Данные, зависящие от нумерации вершин. Вызывается и после чтения графа из базы: в базах прежних
+      // версий вершины заведены для всех остановок, и нумерация там иная, чем у построенного графа.
+        enter_vertex_to_stop_id_.assign(graph.GetVertexCount(), TransportCatalogue::NO_ID);
+        for (uint32_t stop_id = 0; stop_id < stop_id_to_enter_vertex_.size(); ++stop_id)
+            if (stop_id_to_enter_vertex_[stop_id] != NO_VERTEX)
+                enter_vertex_to_stop_id_[stop_id_to_enter_vertex_[stop_id]] = stop_id;
+        if (router_context_.route_search == RouteSearch::ASTAR)
+            PrepareLowerBound(graph);
+    }
+
+    BusRouter::WeightSettings BusRouter::MakeWeightSettings() const
+    {
+        const TCCommonMetric metric = tc_.GetCommonMetric();
+        WeightSettings result;
+        result.bus_velocities.reserve(metric.buses_count);
+        for (uint32_t bus_id = 0; bus_id < metric.buses_count; ++bus_id)
+            result.bus_velocities.push_back(tc_.GetBusVelocity(bus_id).value_or(router_context_.bus_velocity));
+        result.stop_wait_times.reserve(metric.stops_count);
+        for (uint32_t stop_id = 0; stop_id < metric.stops_count; ++stop_id)
+            result.stop_wait_times.push_back(tc_.GetStopWaitTime(stop_id).value_or(router_context_.bus_wait_time));
         return result;
     }
 
-    optional<RouteResult> BusRouter::DoRoute(const string& from, const string& to)
+    BusRouter::WeightT BusRouter::ComputeEdgeWeight(const EdgeDescriptor& edge_desc) const
+    { // Вес пересадочного ребра - время ожидания на остановке, поездного - время поездки по маршруту
+      // между остановками ребра, рассчитанное по префиксным суммам расстояний маршрута.
+        if (edge_desc.edge_type == EdgeType::EDGE_TRANSFER)
+            return weight_settings_.stop_wait_times[edge_desc.from_stop_id];
+        const BusDistanceTable& dist_table = tc_.GetBusDistanceTable(edge_desc.bus_id);
+        const double distance = edge_desc.is_backward ?
+            dist_table.BackwardRoadDistance(edge_desc.from_position, edge_desc.from_position - edge_desc.span_count) :
+            dist_table.ForwardRoadDistance(edge_desc.from_position, edge_desc.from_position + edge_desc.span_count);
+        return distance / (weight_settings_.bus_velocities[edge_desc.bus_id] * 1000.0 / 60.0);
+    }
+
+    void BusRouter::Reweight(WeightSettings weight_settings)
     {
-        RouteResult result;
+        stats::ScopedTimer timer("graph_reweight"sv);
+        if (!has_edge_positions_)
+            throw logic_error("Edge positions are unknown, the router should be rebuilt"s);
+        const TCCommonMetric metric = tc_.GetCommonMetric();
+        if (weight_settings.bus_velocities.size() != metric.buses_count ||
+            weight_settings.stop_wait_times.size() != metric.stops_count)
+            throw invalid_argument("Weight settings do not match the catalogue"s);
+        for (const double bus_velocity : weight_settings.bus_velocities)
+            if (!(bus_velocity > 0))
+                throw invalid_argument("Bus velocity should be positive"s);
+        weight_settings_ = move(weight_settings);
+        // Рёбра графа и их описатели идут в одном порядке, поэтому пересчёт - один проход по рёбрам.
+        for (EdgeId edge_id = 0; edge_id < edge_to_desc_.size(); ++edge_id)
+            catalogue_graph_.SetEdgeWeight(edge_id, ComputeEdgeWeight(edge_to_desc_[edge_id]));
+        if (router_context_.route_search == RouteSearch::ASTAR)
+            PrepareLowerBound(catalogue_graph_);
+        router_.UpdateWeights();
+        timetable_router_ = TimetableRouter(tc_, weight_settings_.bus_velocities);
+    }
+
+    void BusRouter::Reweight(const RouterContext& rc)
+    {
+        if (rc.route_search != router_context_.route_search)
+            throw invalid_argument("Routing algorithm cannot be changed by reweighting"s);
+        if (!(rc.bus_velocity > 0))
+            throw invalid_argument("Bus velocity should be positive"s);
+        router_context_ = rc;
+        Reweight(MakeWeightSettings());
+    }
+
+    void BusRouter::PrepareLowerBound(const GraphT& graph)
+    { // Время поездки не меньше географического расстояния, делённого на скорость автобуса, если расстояния
+      // по дорогам не короче географических. В данных это не гарантировано, поэтому множитель уменьшается
+      // до наименьшего отношения веса поездного ребра к географическому расстоянию между его остановками.
+      // Тогда по неравенству треугольника оценка не превышает веса никакого пути и согласована для каждого ребра.
+        vertex_coords_.assign(graph.GetVertexCount(), {});
+        for (const auto& [stop_name, vertex] : stop_name_to_enter_vertex_)
+        {
+            const detail::CoordinatesTrig stop_coords = detail::ComputeCoordinatesTrig(tc_.GetStopCoordinates(stop_name));
+            vertex_coords_[vertex] = stop_coords;
+            vertex_coords_[stop_name_to_exit_vertex_.at(stop_name)] = stop_coords;
+        }
+        double max_velocity = router_context_.bus_velocity;
+        for (const double bus_velocity : weight_settings_.bus_velocities)
+            max_velocity = max(max_velocity, bus_velocity);
+        min_minutes_per_meter_ = 60.0 / (max_velocity * 1000.0);
+        for (EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id)
+        {
+            const EdgeT& edge = graph.GetEdge(edge_id);
+            const double distance = detail::ComputeDistance(vertex_coords_[edge.from], vertex_coords_[edge.to]);
+            if (distance > detail::DISTANCE_TOLERANCE)
+                min_minutes_per_meter_ = min(min_minutes_per_meter_, edge.weight / distance);
+        }
+    }
+
+    BusRouter::RouterT::LowerBound BusRouter::MakeLowerBound() const
+    {
+        if (router_context_.route_search != RouteSearch::ASTAR)
+            return {};
+        return [this](VertexId from, VertexId to)
+        {
+            // Расстояние уменьшается на погрешность его расчёта, чтобы оценка оставалась нижней.
+            const double distance = detail::ComputeDistance(vertex_coords_[from], vertex_coords_[to]) - detail::DISTANCE_TOLERANCE;
+            return distance > 0 ? distance * min_minutes_per_meter_ : 0.0;
+        };
+    }
+
+    bool BusRouter::IsStopWithoutVertexes(const string& stop_name) const
+    { // Остановка есть в справочнике, но ни один маршрут через неё не проходит, поэтому вершин в графе
+      // у неё нет. Из такой остановки, как и в любой другой, достижима она сама - за нулевое время.
+        return !stop_name_to_enter_vertex_.count(stop_name) && tc_.FindStopId(stop_name) != TransportCatalogue::NO_ID;
+    }
 
+    optional<RouteResult> BusRouter::DoRoute(const string& from, const string& to, RouterT::SearchStats* search_stats) const
+    {
+        if (from == to && IsStopWithoutVertexes(from))
+            return RouteResult{0.0, {}};
         if (!stop_name_to_enter_vertex_.count(from) || !stop_name_to_enter_vertex_.count(to))
             return nullopt;
         VertexId from_vertex = stop_name_to_enter_vertex_.at(from);
         VertexId to_vertex = stop_name_to_enter_vertex_.at(to);
-        auto br = router_.BuildRoute(from_vertex, to_vertex);
+        auto br = router_.BuildRoute(from_vertex, to_vertex, search_stats);
         if (!br)
             return nullopt;
+        return MakeRouteResult(*br);
+    }
+
+    vector<optional<RouteResult>> BusRouter::DoRoutes(const string& from, const vector<string>& targets) const
+    {
+        vector<optional<RouteResult>> result(targets.size());
+        auto from_it = stop_name_to_enter_vertex_.find(from);
+        if (from_it == stop_name_to_enter_vertex_.end())
+        {
+            if (IsStopWithoutVertexes(from))
+                for (size_t target_num = 0; target_num < targets.size(); ++target_num)
+                    if (targets[target_num] == from)
+                        result[target_num] = RouteResult{0.0, {}};
+            return result;
+        }
+        vector<VertexId> target_vertexes;
+        vector<size_t> target_positions; // Места известных остановок в списке targets
+        for (size_t target_num = 0; target_num < targets.size(); ++target_num)
+            if (auto vertex_it = stop_name_to_enter_vertex_.find(targets[target_num]);
+                vertex_it != stop_name_to_enter_vertex_.end())
+            {
+                target_vertexes.push_back(vertex_it->second);
+                target_positions.push_back(target_num);
+            }
+        const auto routes = router_.BuildRoutes(from_it->second, target_vertexes);
+        for (size_t i = 0; i < routes.size(); ++i)
+            if (routes[i])
+                result[target_positions[i]] = MakeRouteResult(*routes[i]);
+        return result;
+    }
+
+    vector<RouteResult> BusRouter::DoAlternativeRoutes(const string& from, const string& to, size_t max_alternatives,
+                                                       double max_stretch) const
+    {
+        vector<RouteResult> result;
+        if (from == to && IsStopWithoutVertexes(from))
+        {
+            result.push_back(RouteResult{0.0, {}});
+            return result;
+        }
+        auto from_it = stop_name_to_enter_vertex_.find(from);
+        auto to_it = stop_name_to_enter_vertex_.find(to);
+        if (from_it == stop_name_to_enter_vertex_.end() || to_it == stop_name_to_enter_vertex_.end())
+            return result;
+        // Маршрут описывается для пассажира последовательностью поездок (автобус, остановка посадки, остановка
+        // выхода); соседние поездки на одном автобусе, разделённые выходом из него и посадкой в него же,
+        // сливаются в одну. Маршруты графа с одинаковым описанием для пассажира одинаковы: из них оставляется
+        // первый, а маршрутизатор продолжает перебирать кандидатов взамен отброшенного.
+        set<vector<array<uint32_t, 3>>> accepted_trips;
+        vector<array<uint32_t, 3>> trips;
+        auto is_distinct = [this, &accepted_trips, &trips](const RouterT::RouteInfo& route)
+        {
+            trips.clear();
+            for (const EdgeId edge : route.edges)
+            {
+                const EdgeDescriptor& ed = edge_to_desc_[edge];
+                if (ed.edge_type != EdgeType::EDGE_STAGE)
+                    continue;
+                if (!trips.empty() && trips.back()[0] == ed.bus_id)
+                    trips.back()[2] = ed.to_stop_id;
+                else
+                    trips.push_back({ed.bus_id, ed.from_stop_id, ed.to_stop_id});
+            }
+            return accepted_trips.insert(trips).second;
+        };
+        for (const RouterT::RouteInfo& route : router_.BuildAlternativeRoutes(from_it->second, to_it->second,
+                                                                              max_alternatives, max_stretch, is_distinct))
+            result.push_back(MakeRouteResult(route));
+        return result;
+    }
+
+    optional<RouteResult> BusRouter::DoTimetableRoute(const string& from, const string& to, double departure_time) const
+    {
+        const uint32_t from_stop_id = tc_.FindStopId(from);
+        const uint32_t to_stop_id = tc_.FindStopId(to);
+        if (from_stop_id == TransportCatalogue::NO_ID || to_stop_id == TransportCatalogue::NO_ID)
+            return nullopt;
+        auto journey = timetable_router_.FindEarliestArrival(from_stop_id, to_stop_id, departure_time);
+        if (!journey)
+            return nullopt;
+
+        RouteResult result;
+        result.total_time = journey->arrival_time - journey->departure_time;
+        double current_time = journey->departure_time;
+        for (const TimetableRouter::Leg& leg : journey->legs)
+        {
+            result.route_items.push_back(WaitEvent{tc_.GetStopName(leg.board_stop_id), leg.departure_time - current_time});
+            result.route_items.push_back(RideEvent{tc_.GetBusName(leg.bus_id), static_cast<int>(leg.span_count),
+                                                   leg.arrival_time - leg.departure_time});
+            current_time = leg.arrival_time;
+        }
+        return result;
+    }
 
-        result.total_time = br->weight;
+    RouteResult BusRouter::MakeRouteResult(const RouterT::RouteInfo& route) const
+    {
+        RouteResult result;
+        result.total_time = route.weight;
 
-        for (const EdgeId& edge : br->edges)
+        for (const EdgeId& edge : route.edges)
         {
-            EdgeDescriptor ed = edge_to_desc_.at(edge);
+            // Имена остановок и маршрутов извлекаются из справочника по номерам лишь здесь,
+            // при формировании ответа.
+            const EdgeDescriptor& ed = edge_to_desc_[edge];
+            const double time_length = catalogue_graph_.GetEdge(edge).weight;
             switch (ed.edge_type)
             {
                 case EdgeType::EDGE_TRANSFER:
-                    result.route_items.push_back(WaitEvent{ed.from_stop, ed.time_length});
+                    result.route_items.push_back(WaitEvent{tc_.GetStopName(ed.from_stop_id), time_length});
                     break;
                 case EdgeType::EDGE_STAGE:
-                    result.route_items.push_back(RideEvent{ed.bus_name, ed.span_count, ed.time_length});
+                    result.route_items.push_back(RideEvent{tc_.GetBusName(ed.bus_id),
+                                                           static_cast<int>(ed.span_count), time_length});
                     break;
                 default:
                     break;
@@ -136,4 +437,54 @@ namespace router
 
         return result;
     }
+    vector<vector<optional<double>>> BusRouter::ComputeTravelTimes(const vector<string>& sources,
+                                                                   const vector<string>& targets) const
+    {
+        vector<VertexId> target_vertexes;
+        vector<size_t> target_positions; // Места известных остановок в списке targets
+        for (size_t target_num = 0; target_num < targets.size(); ++target_num)
+            if (auto vertex_it = stop_name_to_enter_vertex_.find(targets[target_num]);
+                vertex_it != stop_name_to_enter_vertex_.end())
+            {
+                target_vertexes.push_back(vertex_it->second);
+                target_positions.push_back(target_num);
+            }
+
+        vector<vector<optional<double>>> result(sources.size(), vector<optional<double>>(targets.size()));
+        parallel::ParallelFor(sources.size(), 0, [&](size_t source_num)
+        {
+            auto vertex_it = stop_name_to_enter_vertex_.find(sources[source_num]);
+            if (vertex_it == stop_name_to_enter_vertex_.end())
+            {
+                if (IsStopWithoutVertexes(sources[source_num]))
+                    for (size_t target_num = 0; target_num < targets.size(); ++target_num)
+                        if (targets[target_num] == sources[source_num])
+                            result[source_num][target_num] = 0.0;
+                return;
+            }
+            if (target_vertexes.empty())
+                return;
+            const auto weights = router_.BuildRouteWeights(vertex_it->second, target_vertexes);
+            for (size_t i = 0; i < weights.size(); ++i)
+                result[source_num][target_positions[i]] = weights[i];
+        });
+        return result;
+    }
+    optional<vector<StopArrival>> BusRouter::ComputeIsochrone(const string& from, double max_time) const
+    {
+        vector<StopArrival> result;
+        auto vertex_it = stop_name_to_enter_vertex_.find(from);
+        if (vertex_it == stop_name_to_enter_vertex_.end())
+        {
+            if (!IsStopWithoutVertexes(from))
+                return nullopt;
+            result.push_back({tc_.GetStopName(tc_.FindStopId(from)), 0.0});
+            return result;
+        }
+        // Остановка достигнута, когда достигнут её "перрон отправления" - как и при построении маршрута.
+        for (const auto& [vertex, weight] : router_.BuildReachableVertexes(vertex_it->second, max_time))
+            if (const uint32_t stop_id = enter_vertex_to_stop_id_[vertex]; stop_id != TransportCatalogue::NO_ID)
+                result.push_back({tc_.GetStopName(stop_id), weight});
+        return result;
+    }
 } // namespace router
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <variant>
 
@@ -8,6 +11,7 @@
 #include "svg.h"
 #include "graph.h"
 #include "router.h"
+#include "timetable_router.h"
 #include "transport_catalogue.h"
 #include "serialization.h"
 
@@ -17,6 +21,7 @@ namespace router
     {
         double bus_wait_time;
         double bus_velocity;
+        graph::RouteSearch route_search = graph::RouteSearch::ROUTES_MATRIX;
     };
 
     struct WaitEvent
@@ -44,8 +49,75 @@ namespace router
     {
     public:
         friend class serial::Serializer;
+        // Параметры, по которым рассчитываются веса рёбер графа: скорости автобусов в км/ч, индексированные
+        // номерами маршрутов справочника, и времена ожидания на остановках в минутах, индексированные номерами
+        // остановок. Исходно это заданные в справочнике значения, а где они не заданы - общие из RouterContext.
+        struct WeightSettings
+        {
+            std::vector<double> bus_velocities;
+            std::vector<double> stop_wait_times;
+        };
+
         BusRouter(const RouterContext& rc, const transport::TransportCatalogue& tc);
-        std::optional<RouteResult> DoRoute(const std::string& from, const std::string& to);
+        // Строит граф, но не рассчитывает маршрутную матрицу: её восстанавливает из базы serial::Serializer.
+        BusRouter(const RouterContext& rc, const transport::TransportCatalogue& tc, graph::Router<double>::DeferredRoutes);
+        // Строит граф изменённого справочника, а маршрутную матрицу не рассчитывает с нуля, а пересчитывает
+        // из матрицы маршрутизатора prev_router, построенного по прежнему состоянию справочника.
+        BusRouter(const RouterContext& rc, const transport::TransportCatalogue& tc, const BusRouter& prev_router);
+        // Маршрут между остановками. Если передан search_stats, в него записываются сведения о работе поиска.
+        std::optional<RouteResult> DoRoute(const std::string& from, const std::string& to,
+                                           graph::Router<double>::SearchStats* search_stats = nullptr) const;
+        // Маршруты из остановки from до каждой из остановок targets, найденные по возможности одним поиском
+        // (см. graph::Router::BuildRoutes). nullopt - маршрута нет или остановка неизвестна.
+        std::vector<std::optional<RouteResult>> DoRoutes(const std::string& from, const std::vector<std::string>& targets) const;
+        // Кратчайший маршрут (первым элементом) и до max_alternatives заметно отличающихся от него альтернативных
+        // маршрутов, время поездки по которым не более чем в max_stretch раз больше, чем по кратчайшему.
+        // Пустой результат - маршрута нет или остановка неизвестна.
+        std::vector<RouteResult> DoAlternativeRoutes(const std::string& from, const std::string& to,
+                                                     size_t max_alternatives, double max_stretch) const;
+        // Маршрут с наиболее ранним прибытием по расписаниям автобусов при отправлении из from в момент
+        // departure_time (в минутах от начала суток). Время каждого ожидания определяется расписанием, а общее
+        // время поездки отсчитывается от departure_time. nullopt - маршрута нет или остановка неизвестна.
+        std::optional<RouteResult> DoTimetableRoute(const std::string& from, const std::string& to,
+                                                    double departure_time) const;
+        // Матрица времён поездок от каждой из остановок sources до каждой из остановок targets (строка - начальная
+        // остановка). nullopt - маршрута нет или остановка неизвестна. Маршруты не восстанавливаются, а строки
+        // матрицы рассчитываются параллельно.
+        std::vector<std::vector<std::optional<double>>> ComputeTravelTimes(const std::vector<std::string>& sources,
+                                                                           const std::vector<std::string>& targets) const;
+        // Остановки, до которых из остановки from можно доехать не более чем за max_time минут, в порядке
+        // возрастания времени поездки (сама from - первой, с нулевым временем). nullopt - остановка неизвестна.
+        std::optional<std::vector<transport::StopArrival>> ComputeIsochrone(const std::string& from, double max_time) const;
+        const WeightSettings& GetWeightSettings() const
+        {
+            return weight_settings_;
+        }
+        // Заменяет скорости автобусов и времена ожидания на остановках, не перестраивая граф: веса его рёбер
+        // пересчитываются на месте по префиксным суммам расстояний маршрутов. Линеен по числу рёбер лишь этот
+        // шаг и, при поиске по запросу, вся правка. Маршрутная матрица (алгоритмом Флойда - Уоршелла, куб числа
+        // вершин), иерархия сжатия или метки хабов рассчитываются заново целиком, то есть не быстрее, чем при
+        // построении базы; поиск по расписаниям строится заново по справочнику.
+        void Reweight(WeightSettings weight_settings);
+        // Заменяет общие скорость автобусов и время ожидания на остановках из rc и пересчитывает по ним веса
+        // рёбер (см. Reweight выше); заданные в справочнике скорости маршрутов и времена ожидания остановок
+        // сохраняются. Способ поиска маршрутов должен совпадать с прежним.
+        void Reweight(const RouterContext& rc);
+        // false - позиции остановок поездных рёбер неизвестны (база прежней версии формата, рёбра которой
+        // не удалось сопоставить с построенными по справочнику), и веса рёбер пересчитать нельзя:
+        // маршрутизатор строится заново.
+        bool CanReweight() const
+        {
+            return has_edge_positions_;
+        }
+        // Маршрутизирующий граф и маршрутизатор - для оценки объёма их данных.
+        const graph::DirectedWeightedGraph<double>& GetGraph() const
+        {
+            return catalogue_graph_;
+        }
+        const graph::Router<double>& GetRouter() const
+        {
+            return router_;
+        }
 
     private:
 
@@ -56,41 +128,77 @@ namespace router
         using RouterT = graph::Router<WeightT>;
         using StopToVertexT = std::unordered_map<std::string, graph::VertexId>;
 
-        enum class EdgeType
+        enum class EdgeType : uint8_t
         {
             EDGE_UNKNOWN = 0,
             EDGE_STAGE,
             EDGE_TRANSFER
         };
 
+        // Описатель ребра графа. Остановки и маршрут задаются плотными номерами справочника,
+        // имена по ним извлекаются только при формировании ответа на запрос маршрута. Время
+        // прохождения ребра не дублируется - это вес ребра в графе catalogue_graph_. Позиция остановки
+        // в маршруте и направление поездки нужны для пересчёта веса поездного ребра.
         struct EdgeDescriptor
         {
             EdgeType edge_type;
-            std::string from_stop;
-            std::string to_stop;
-            std::string bus_name;
-            int span_count;
-            double time_length;
+            bool is_backward; // Поездка в обратном направлении некольцевого маршрута
+            uint32_t from_stop_id;
+            uint32_t to_stop_id;
+            uint32_t bus_id; // Для пересадочного ребра - TransportCatalogue::NO_ID
+            uint32_t span_count;
+            uint32_t from_position; // Позиция остановки from_stop_id в списке остановок маршрута
         };
 
-        using EdgeToDescT = std::unordered_map<graph::EdgeId, EdgeDescriptor>;
+        // Описатели рёбер, индексированные номерами рёбер (номера рёбер графа идут подряд с нуля).
+        using EdgeToDescT = std::vector<EdgeDescriptor>;
+
+        // Поездные рёбра одного маршрута с их описателями, ещё не добавленные в граф
+        struct BusEdges
+        {
+            std::vector<EdgeT> edges;
+            EdgeToDescT descs;
+        };
 
         // Переменные, которые уже должны быть проинициализированы к моменты вызова конструктора BusRouter
         StopToVertexT stop_name_to_enter_vertex_;
         StopToVertexT stop_name_to_exit_vertex_;
+        // Те же номера вершин, индексированные номерами остановок; у остановок без вершин - NO_VERTEX.
+        static constexpr graph::VertexId NO_VERTEX = std::numeric_limits<graph::VertexId>::max();
+        std::vector<graph::VertexId> stop_id_to_enter_vertex_;
+        std::vector<graph::VertexId> stop_id_to_exit_vertex_;
         EdgeToDescT edge_to_desc_;
+        bool has_edge_positions_ = true;
+        // Координаты остановок вершин графа и множитель, переводящий географическое расстояние в нижнюю
+        // оценку времени поездки, - для поиска маршрутов способом ASTAR.
+        std::vector<detail::CoordinatesTrig> vertex_coords_;
+        // Номер остановки по вершине её "перрона отправления"; для вершин "перронов прибытия" - NO_ID.
+        std::vector<uint32_t> enter_vertex_to_stop_id_;
+        double min_minutes_per_meter_ = 0;
+        WeightSettings weight_settings_;
 
         // Переменные, входящие в список инициализации конструктора BusRouter
         // Должны инициализироваться и следовать в объявлении класса именно в таком порядке
-        const RouterContext& router_context_;
+        RouterContext router_context_; // Копия: маршрутизатор не зависит от времени жизни объекта настроек
         const transport::TransportCatalogue& tc_;
         GraphT catalogue_graph_;
         RouterT router_;
+        TimetableRouter timetable_router_;
 
         //Приватные методы класса
         GraphT ConstructGraph();
+        WeightSettings MakeWeightSettings() const;
+        WeightT ComputeEdgeWeight(const EdgeDescriptor& edge_desc) const;
         size_t RegisterVertexes();
         void BuildTranferEdges(GraphT& result);
         void BuildRideEdges(GraphT& result);
+        void BuildBusRideEdges(uint32_t bus_id, BusEdges& bus_edges) const;
+        void RestoreStopVertexes();
+        void IndexVertexes(const GraphT& graph);
+        void PrepareLowerBound(const GraphT& graph);
+        bool IsStopWithoutVertexes(const std::string& stop_name) const;
+        RouterT::LowerBound MakeLowerBound() const;
+        std::vector<std::optional<graph::VertexId>> MapPrevVertexes(const BusRouter& prev_router) const;
+        RouteResult MakeRouteResult(const RouterT::RouteInfo& route) const;
     };
 } // namespace router